@@ -0,0 +1,503 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinUtilsConfig.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "CoinPragma.hpp"
+#include "CoinDoubleFormat.hpp"
+
+namespace {
+
+// CoinUInt64 may not be unsigned (it follows configure), so use our own
+typedef unsigned long long UInt64;
+
+#define COIN_DTOA_U64(hi,lo) \
+  ((static_cast<UInt64>(hi) << 32) | static_cast<UInt64>(lo))
+
+const UInt64 hiddenBit = COIN_DTOA_U64(0x00100000,0x00000000);
+const UInt64 fractionMask = COIN_DTOA_U64(0x000fffff,0xffffffff);
+const UInt64 lowMask = COIN_DTOA_U64(0x00000000,0xffffffff);
+
+const unsigned int powerOfTen32[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+const UInt64 powerOfTen64[] = {
+  COIN_DTOA_U64(0x00000000,0x00000001), COIN_DTOA_U64(0x00000000,0x0000000a),
+  COIN_DTOA_U64(0x00000000,0x00000064), COIN_DTOA_U64(0x00000000,0x000003e8),
+  COIN_DTOA_U64(0x00000000,0x00002710), COIN_DTOA_U64(0x00000000,0x000186a0),
+  COIN_DTOA_U64(0x00000000,0x000f4240), COIN_DTOA_U64(0x00000000,0x00989680),
+  COIN_DTOA_U64(0x00000000,0x05f5e100), COIN_DTOA_U64(0x00000000,0x3b9aca00),
+  COIN_DTOA_U64(0x00000002,0x540be400), COIN_DTOA_U64(0x00000017,0x4876e800),
+  COIN_DTOA_U64(0x000000e8,0xd4a51000), COIN_DTOA_U64(0x00000918,0x4e72a000),
+  COIN_DTOA_U64(0x00005af3,0x107a4000), COIN_DTOA_U64(0x00038d7e,0xa4c68000),
+  COIN_DTOA_U64(0x002386f2,0x6fc10000), COIN_DTOA_U64(0x01634578,0x5d8a0000),
+  COIN_DTOA_U64(0x0de0b6b3,0xa7640000), COIN_DTOA_U64(0x8ac72304,0x89e80000)
+};
+
+/*
+  Normalised 64 bit approximations f*2^e of 10^k for k = -348, -340, ..., 340
+*/
+const UInt64 cachedPowerF[] = {
+  COIN_DTOA_U64(0xfa8fd5a0,0x081c0288), COIN_DTOA_U64(0xbaaee17f,0xa23ebf76),
+  COIN_DTOA_U64(0x8b16fb20,0x3055ac76), COIN_DTOA_U64(0xcf42894a,0x5dce35ea),
+  COIN_DTOA_U64(0x9a6bb0aa,0x55653b2d), COIN_DTOA_U64(0xe61acf03,0x3d1a45df),
+  COIN_DTOA_U64(0xab70fe17,0xc79ac6ca), COIN_DTOA_U64(0xff77b1fc,0xbebcdc4f),
+  COIN_DTOA_U64(0xbe5691ef,0x416bd60c), COIN_DTOA_U64(0x8dd01fad,0x907ffc3c),
+  COIN_DTOA_U64(0xd3515c28,0x31559a83), COIN_DTOA_U64(0x9d71ac8f,0xada6c9b5),
+  COIN_DTOA_U64(0xea9c2277,0x23ee8bcb), COIN_DTOA_U64(0xaecc4991,0x4078536d),
+  COIN_DTOA_U64(0x823c1279,0x5db6ce57), COIN_DTOA_U64(0xc2109436,0x4dfb5637),
+  COIN_DTOA_U64(0x9096ea6f,0x3848984f), COIN_DTOA_U64(0xd77485cb,0x25823ac7),
+  COIN_DTOA_U64(0xa086cfcd,0x97bf97f4), COIN_DTOA_U64(0xef340a98,0x172aace5),
+  COIN_DTOA_U64(0xb23867fb,0x2a35b28e), COIN_DTOA_U64(0x84c8d4df,0xd2c63f3b),
+  COIN_DTOA_U64(0xc5dd4427,0x1ad3cdba), COIN_DTOA_U64(0x936b9fce,0xbb25c996),
+  COIN_DTOA_U64(0xdbac6c24,0x7d62a584), COIN_DTOA_U64(0xa3ab6658,0x0d5fdaf6),
+  COIN_DTOA_U64(0xf3e2f893,0xdec3f126), COIN_DTOA_U64(0xb5b5ada8,0xaaff80b8),
+  COIN_DTOA_U64(0x87625f05,0x6c7c4a8b), COIN_DTOA_U64(0xc9bcff60,0x34c13053),
+  COIN_DTOA_U64(0x964e858c,0x91ba2655), COIN_DTOA_U64(0xdff97724,0x70297ebd),
+  COIN_DTOA_U64(0xa6dfbd9f,0xb8e5b88f), COIN_DTOA_U64(0xf8a95fcf,0x88747d94),
+  COIN_DTOA_U64(0xb9447093,0x8fa89bcf), COIN_DTOA_U64(0x8a08f0f8,0xbf0f156b),
+  COIN_DTOA_U64(0xcdb02555,0x653131b6), COIN_DTOA_U64(0x993fe2c6,0xd07b7fac),
+  COIN_DTOA_U64(0xe45c10c4,0x2a2b3b06), COIN_DTOA_U64(0xaa242499,0x697392d3),
+  COIN_DTOA_U64(0xfd87b5f2,0x8300ca0e), COIN_DTOA_U64(0xbce50864,0x92111aeb),
+  COIN_DTOA_U64(0x8cbccc09,0x6f5088cc), COIN_DTOA_U64(0xd1b71758,0xe219652c),
+  COIN_DTOA_U64(0x9c400000,0x00000000), COIN_DTOA_U64(0xe8d4a510,0x00000000),
+  COIN_DTOA_U64(0xad78ebc5,0xac620000), COIN_DTOA_U64(0x813f3978,0xf8940984),
+  COIN_DTOA_U64(0xc097ce7b,0xc90715b3), COIN_DTOA_U64(0x8f7e32ce,0x7bea5c70),
+  COIN_DTOA_U64(0xd5d238a4,0xabe98068), COIN_DTOA_U64(0x9f4f2726,0x179a2245),
+  COIN_DTOA_U64(0xed63a231,0xd4c4fb27), COIN_DTOA_U64(0xb0de6538,0x8cc8ada8),
+  COIN_DTOA_U64(0x83c7088e,0x1aab65db), COIN_DTOA_U64(0xc45d1df9,0x42711d9a),
+  COIN_DTOA_U64(0x924d692c,0xa61be758), COIN_DTOA_U64(0xda01ee64,0x1a708dea),
+  COIN_DTOA_U64(0xa26da399,0x9aef774a), COIN_DTOA_U64(0xf209787b,0xb47d6b85),
+  COIN_DTOA_U64(0xb454e4a1,0x79dd1877), COIN_DTOA_U64(0x865b8692,0x5b9bc5c2),
+  COIN_DTOA_U64(0xc83553c5,0xc8965d3d), COIN_DTOA_U64(0x952ab45c,0xfa97a0b3),
+  COIN_DTOA_U64(0xde469fbd,0x99a05fe3), COIN_DTOA_U64(0xa59bc234,0xdb398c25),
+  COIN_DTOA_U64(0xf6c69a72,0xa3989f5c), COIN_DTOA_U64(0xb7dcbf53,0x54e9bece),
+  COIN_DTOA_U64(0x88fcf317,0xf22241e2), COIN_DTOA_U64(0xcc20ce9b,0xd35c78a5),
+  COIN_DTOA_U64(0x98165af3,0x7b2153df), COIN_DTOA_U64(0xe2a0b5dc,0x971f303a),
+  COIN_DTOA_U64(0xa8d9d153,0x5ce3b396), COIN_DTOA_U64(0xfb9b7cd9,0xa4a7443c),
+  COIN_DTOA_U64(0xbb764c4c,0xa7a44410), COIN_DTOA_U64(0x8bab8eef,0xb6409c1a),
+  COIN_DTOA_U64(0xd01fef10,0xa657842c), COIN_DTOA_U64(0x9b10a4e5,0xe9913129),
+  COIN_DTOA_U64(0xe7109bfb,0xa19c0c9d), COIN_DTOA_U64(0xac2820d9,0x623bf429),
+  COIN_DTOA_U64(0x80444b5e,0x7aa7cf85), COIN_DTOA_U64(0xbf21e440,0x03acdd2d),
+  COIN_DTOA_U64(0x8e679c2f,0x5e44ff8f), COIN_DTOA_U64(0xd433179d,0x9c8cb841),
+  COIN_DTOA_U64(0x9e19db92,0xb4e31ba9), COIN_DTOA_U64(0xeb96bf6e,0xbadf77d9),
+  COIN_DTOA_U64(0xaf87023b,0x9bf0ee6b)
+};
+
+const short cachedPowerE[] = {
+  -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+  -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+  -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+  -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+  -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+  109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+  375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+  641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+  907, 933, 960, 986, 1013, 1039, 1066
+};
+
+// Do-it-yourself floating point f*2^e
+struct DiyFp {
+  DiyFp() : f(0), e(0) {}
+  DiyFp(UInt64 fIn, int eIn) : f(fIn), e(eIn) {}
+  UInt64 f;
+  int e;
+};
+
+DiyFp multiply(const DiyFp & x, const DiyFp & y)
+{
+  const UInt64 a = x.f >> 32;
+  const UInt64 b = x.f & lowMask;
+  const UInt64 c = y.f >> 32;
+  const UInt64 d = y.f & lowMask;
+  const UInt64 ac = a*c;
+  const UInt64 bc = b*c;
+  const UInt64 ad = a*d;
+  const UInt64 bd = b*d;
+  UInt64 tmp = (bd >> 32) + (ad & lowMask) + (bc & lowMask);
+  tmp += static_cast<UInt64>(1) << 31; // round
+  return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64);
+}
+
+DiyFp normalize(DiyFp x)
+{
+  while (!(x.f & (static_cast<UInt64>(1) << 63))) {
+    x.f <<= 1;
+    x.e--;
+  }
+  return x;
+}
+
+// Cached power c with 10^-k = c, such that the product with w has e in
+// a small range
+DiyFp cachedPower(int e, int & k)
+{
+  const double dk = (-61 - e) * 0.30102999566398114 + 347;
+  int ik = static_cast<int>(dk);
+  if (dk - ik > 0.0)
+    ik++;
+  const int index = (ik >> 3) + 1;
+  k = -(-348 + (index << 3));
+  return DiyFp(cachedPowerF[index], cachedPowerE[index]);
+}
+
+void grisuRound(char * buffer, int length, UInt64 delta, UInt64 rest,
+		UInt64 tenKappa, UInt64 wpw)
+{
+  while (rest < wpw && delta - rest >= tenKappa &&
+	 (rest + tenKappa < wpw || wpw - rest > rest + tenKappa - wpw)) {
+    buffer[length-1]--;
+    rest += tenKappa;
+  }
+}
+
+void digitGen(const DiyFp & w, const DiyFp & mp, UInt64 delta,
+	      char * buffer, int & length, int & k)
+{
+  const DiyFp one(static_cast<UInt64>(1) << -mp.e, mp.e);
+  const UInt64 wpw = mp.f - w.f;
+  unsigned int p1 = static_cast<unsigned int>(mp.f >> -one.e);
+  UInt64 p2 = mp.f & (one.f - 1);
+  int kappa = 1;
+  while (kappa < 10 && p1 >= powerOfTen32[kappa])
+    kappa++;
+  length = 0;
+  while (kappa > 0) {
+    const unsigned int divisor = powerOfTen32[kappa-1];
+    const unsigned int digit = p1 / divisor;
+    p1 %= divisor;
+    if (digit || length)
+      buffer[length++] = static_cast<char>('0' + digit);
+    kappa--;
+    const UInt64 rest = (static_cast<UInt64>(p1) << -one.e) + p2;
+    if (rest <= delta) {
+      k += kappa;
+      grisuRound(buffer, length, delta, rest,
+		 static_cast<UInt64>(powerOfTen32[kappa]) << -one.e, wpw);
+      return;
+    }
+  }
+  while (true) {
+    p2 *= 10;
+    delta *= 10;
+    const char digit = static_cast<char>(p2 >> -one.e);
+    if (digit || length)
+      buffer[length++] = static_cast<char>('0' + digit);
+    p2 &= one.f - 1;
+    kappa--;
+    if (p2 < delta) {
+      k += kappa;
+      const int index = -kappa;
+      grisuRound(buffer, length, delta, p2, one.f,
+		 index < 20 ? wpw * powerOfTen64[index] : 0);
+      return;
+    }
+  }
+}
+
+// Digits of positive finite value with value = digits*10^k
+void grisu2(double value, char * buffer, int & length, int & k)
+{
+  UInt64 bits;
+  memcpy(&bits, &value, sizeof(double));
+  const int biasedExponent = static_cast<int>((bits >> 52) & 0x7ff);
+  DiyFp v;
+  if (biasedExponent) {
+    v.f = (bits & fractionMask) + hiddenBit;
+    v.e = biasedExponent - 1075;
+  } else {
+    v.f = bits & fractionMask;
+    v.e = -1074;
+  }
+  // boundaries m+ and m- with the same exponent
+  DiyFp plus((v.f << 1) + 1, v.e - 1);
+  while (!(plus.f & (hiddenBit << 1))) {
+    plus.f <<= 1;
+    plus.e--;
+  }
+  plus.f <<= 10;
+  plus.e -= 10;
+  DiyFp minus = (v.f == hiddenBit) ? DiyFp((v.f << 2) - 1, v.e - 2) :
+    DiyFp((v.f << 1) - 1, v.e - 1);
+  minus.f <<= minus.e - plus.e;
+  minus.e = plus.e;
+
+  const DiyFp cached = cachedPower(plus.e, k);
+  const DiyFp w = multiply(normalize(v), cached);
+  DiyFp wPlus = multiply(plus, cached);
+  DiyFp wMinus = multiply(minus, cached);
+  wMinus.f++;
+  wPlus.f--;
+  digitGen(w, wPlus, wPlus.f - wMinus.f, buffer, length, k);
+}
+
+char * writeExponent(int exponent, char * output)
+{
+  *output++ = 'e';
+  if (exponent < 0) {
+    *output++ = '-';
+    exponent = -exponent;
+  } else {
+    *output++ = '+';
+  }
+  if (exponent >= 100) {
+    *output++ = static_cast<char>('0' + exponent / 100);
+    exponent %= 100;
+  }
+  *output++ = static_cast<char>('0' + exponent / 10);
+  *output++ = static_cast<char>('0' + exponent % 10);
+  return output;
+}
+
+// Full product of two 64 bit numbers
+void multiply128(UInt64 a, UInt64 b, UInt64 & hi, UInt64 & lo)
+{
+  const UInt64 aLo = a & lowMask;
+  const UInt64 aHi = a >> 32;
+  const UInt64 bLo = b & lowMask;
+  const UInt64 bHi = b >> 32;
+  const UInt64 p0 = aLo*bLo;
+  const UInt64 p1 = aLo*bHi;
+  const UInt64 p2 = aHi*bLo;
+  const UInt64 middle = (p0 >> 32) + (p1 & lowMask) + (p2 & lowMask);
+  lo = (middle << 32) | (p0 & lowMask);
+  hi = aHi*bHi + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+}
+
+// Bit i of the 128 bit number hi:lo
+inline bool testBit(UInt64 hi, UInt64 lo, int i)
+{
+  return i < 64 ? ((lo >> i) & 1) != 0 : ((hi >> (i - 64)) & 1) != 0;
+}
+
+// True if any of the bits below bit i of hi:lo is set
+bool lowBitsSet(UInt64 hi, UInt64 lo, int i)
+{
+  if (i <= 0)
+    return false;
+  if (i < 64)
+    return (lo & ((static_cast<UInt64>(1) << i) - 1)) != 0;
+  if (lo)
+    return true;
+  if (i == 64)
+    return false;
+  return (hi & ((static_cast<UInt64>(1) << (i - 64)) - 1)) != 0;
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+
+int CoinShortestDouble(double value, char * output)
+{
+  UInt64 bits;
+  memcpy(&bits, &value, sizeof(double));
+  if (((bits >> 52) & 0x7ff) == 0x7ff)
+    return sprintf(output, "%.16g", value); // infinity or NaN
+  char * put = output;
+  if (bits >> 63) {
+    *put++ = '-';
+    value = -value;
+  }
+  if (value == 0.0) {
+    *put++ = '0';
+    *put = '\0';
+    return static_cast<int>(put - output);
+  }
+  char digits[24];
+  int length;
+  int k;
+  grisu2(value, digits, length, k);
+  // decimal exponent of first digit
+  const int exponent = length + k - 1;
+  if (exponent >= -4 && exponent < 16) {
+    if (k >= 0) {
+      memcpy(put, digits, length);
+      put += length;
+      memset(put, '0', k);
+      put += k;
+    } else if (exponent >= 0) {
+      memcpy(put, digits, exponent + 1);
+      put += exponent + 1;
+      *put++ = '.';
+      memcpy(put, digits + exponent + 1, length - exponent - 1);
+      put += length - exponent - 1;
+    } else {
+      *put++ = '0';
+      *put++ = '.';
+      memset(put, '0', -exponent - 1);
+      put += -exponent - 1;
+      memcpy(put, digits, length);
+      put += length;
+    }
+  } else if ((put - output) + length +
+	     (exponent <= -100 || exponent >= 100 ? 6 : 5) <= 23) {
+    *put++ = digits[0];
+    if (length > 1) {
+      *put++ = '.';
+      memcpy(put, digits + 1, length - 1);
+      put += length - 1;
+    }
+    put = writeExponent(exponent, put);
+  } else {
+    // 17 digits and 3 digit exponent - leave out the point to fit
+    memcpy(put, digits, length);
+    put += length;
+    put = writeExponent(k, put);
+  }
+  *put = '\0';
+  return static_cast<int>(put - output);
+}
+
+//-----------------------------------------------------------------------------
+
+int CoinFixedDouble(double value, int decimals, char * output)
+{
+  UInt64 bits;
+  memcpy(&bits, &value, sizeof(double));
+  const int biasedExponent = static_cast<int>((bits >> 52) & 0x7ff);
+  if (biasedExponent == 0x7ff || decimals < 0 || decimals > 27)
+    return -1;
+  const bool negative = (bits >> 63) != 0;
+  UInt64 mantissa = bits & fractionMask;
+  int exponent = -1074;
+  if (biasedExponent) {
+    mantissa += hiddenBit;
+    exponent = biasedExponent - 1075;
+  }
+  /*
+    value*10^decimals = mantissa*5^decimals*2^(exponent+decimals).  The
+    first part is at most 2^53*5^27 < 2^116 so fits in 128 bits.
+  */
+  UInt64 number = 0;
+  if (mantissa) {
+    UInt64 power5 = 1;
+    for (int i = 0; i < decimals; i++)
+      power5 *= 5;
+    UInt64 hi;
+    UInt64 lo;
+    multiply128(mantissa, power5, hi, lo);
+    const int shift = exponent + decimals;
+    if (shift >= 0) {
+      if (hi || shift >= 64 || (shift && (lo >> (64 - shift))))
+	return -1;
+      number = lo << shift;
+    } else {
+      const int right = -shift;
+      if (right < 128) {
+	UInt64 quotientHi;
+	if (right >= 64) {
+	  number = hi >> (right - 64);
+	  quotientHi = 0;
+	} else {
+	  number = (lo >> right) | (hi << (64 - right));
+	  quotientHi = hi >> right;
+	}
+	if (quotientHi)
+	  return -1;
+	// round half to even
+	if (testBit(hi, lo, right - 1) &&
+	    (lowBitsSet(hi, lo, right - 1) || (number & 1))) {
+	  number++;
+	  if (!number)
+	    return -1;
+	}
+      }
+      // else value*10^decimals is below 2^-12 so rounds to zero
+    }
+  }
+  char digits[48];
+  int nDigits = 0;
+  while (number) {
+    digits[nDigits++] = static_cast<char>('0' + number % 10);
+    number /= 10;
+  }
+  while (nDigits <= decimals)
+    digits[nDigits++] = '0';
+  char * put = output;
+  if (negative)
+    *put++ = '-';
+  while (nDigits > decimals)
+    *put++ = digits[--nDigits];
+  if (decimals) {
+    *put++ = '.';
+    while (nDigits)
+      *put++ = digits[--nDigits];
+  }
+  *put = '\0';
+  return static_cast<int>(put - output);
+}
+
+//-----------------------------------------------------------------------------
+
+double CoinReadDouble(const char * str)
+{
+  static const double powerOfTen[] = {
+    1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9,
+    1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18,
+    1.0e19, 1.0e20, 1.0e21, 1.0e22
+  };
+  const char *ptr = str;
+  bool negative = false;
+  if (*ptr == '-' || *ptr == '+') {
+    negative = (*ptr == '-');
+    ptr++;
+  }
+  double mantissa = 0.0;
+  int nDigits = 0;
+  int nSignificant = 0;
+  int exponent = 0;
+  for (; *ptr >= '0' && *ptr <= '9'; ptr++) {
+    nDigits++;
+    if (nSignificant || *ptr != '0') {
+      mantissa = 10.0*mantissa + (*ptr-'0');
+      nSignificant++;
+    }
+  }
+  if (*ptr == '.') {
+    for (ptr++; *ptr >= '0' && *ptr <= '9'; ptr++) {
+      nDigits++;
+      if (nSignificant || *ptr != '0') {
+	mantissa = 10.0*mantissa + (*ptr-'0');
+	nSignificant++;
+      }
+      exponent--;
+    }
+  }
+  if (!nDigits || nSignificant > 15 || *ptr == 'x' || *ptr == 'X')
+    return atof(str);
+  if (*ptr == 'e' || *ptr == 'E') {
+    const char *expPtr = ptr+1;
+    bool expNegative = false;
+    if (*expPtr == '-' || *expPtr == '+') {
+      expNegative = (*expPtr == '-');
+      expPtr++;
+    }
+    if (*expPtr >= '0' && *expPtr <= '9') {
+      int value = 0;
+      for (; *expPtr >= '0' && *expPtr <= '9'; expPtr++) {
+	if (value > 1000)
+	  return atof(str);
+	value = 10*value + (*expPtr-'0');
+      }
+      exponent += expNegative ? -value : value;
+    }
+  }
+  double value = mantissa;
+  if (mantissa != 0.0) {
+    if (exponent > 22 || exponent < -22)
+      return atof(str);
+    if (exponent > 0)
+      value *= powerOfTen[exponent];
+    else if (exponent < 0)
+      value /= powerOfTen[-exponent];
+  }
+  return negative ? -value : value;
+}
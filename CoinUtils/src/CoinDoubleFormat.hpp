@@ -0,0 +1,52 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinDoubleFormat_H
+#define CoinDoubleFormat_H
+
+/*! \file CoinDoubleFormat.hpp
+    \brief Fast conversion between doubles and text for the file readers
+  and writers.
+
+  The MPS and Lp writers format every coefficient, so going through
+  sprintf and a format string for each one dominates the time taken to
+  write a large model.  The writing functions here do the conversion with
+  integer arithmetic.  Neither adds padding; callers lay out fields.
+*/
+
+/*! \brief Shortest string which reads back as \p value.
+
+  The digits are produced with the Grisu2 algorithm: reading the string
+  back with strtod gives exactly \p value, and in almost all cases no
+  shorter string would do.  The layout follows printf's \c %.16g: plain
+  notation for decimal exponents from -4 to 15, otherwise exponent
+  notation with at least two exponent digits.  Infinities and NaN are
+  written as by printf.
+
+  At most 23 characters (plus the terminating null) are written.  Returns
+  the number of characters written.
+*/
+int CoinShortestDouble(double value, char * output);
+
+/*! \brief Same as <code>sprintf(output,"%.*f",decimals,value)</code>.
+
+  The result is exact, rounding ties to even as glibc does.  Returns the
+  number of characters written or -1 (nothing written) if \p value is not
+  finite, \p decimals is outside 0 to 27, or the rounded value times
+  10<sup>decimals</sup> does not fit in 64 bits.  In that case the caller
+  should fall back to sprintf.  \p output needs room for 32 characters.
+*/
+int CoinFixedDouble(double value, int decimals, char * output);
+
+/*! \brief Same as <code>atof(str)</code>.
+
+  Plain decimal numbers with at most 15 significant digits and a decimal
+  exponent of at most 22 are converted with a single exact multiplication
+  or division, which gives the same correctly rounded result as strtod.
+  Anything else is passed to atof.
+*/
+double CoinReadDouble(const char * str);
+
+#endif
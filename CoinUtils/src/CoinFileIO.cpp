@@ -197,6 +197,163 @@ private:
 };
 
 
+// ------ helper class running chunks through threads -------
+
+#ifdef COINUTILS_PTHREADS
+
+#include <pthread.h>
+
+// A ring of chunks which worker threads process in ring order, used to
+// compress and decompress on other threads than the caller's.  The caller
+// owns a chunk until it queues it, and gets it back when finish returns.
+// Chunks must be queued in ring order, as workers take them in that order.
+// If no thread can be started, queue processes the chunk itself.
+// Subclasses call stop in their destructors, before their own data goes.
+class CoinChunkPipeline
+{
+public:
+  struct Chunk {
+    char *input;
+    int inputSize;
+    int inputCapacity;
+    char *output;
+    int outputSize;
+    int outputCapacity;
+    int state;
+    bool ok;
+  };
+
+  CoinChunkPipeline (int numberChunks, int numberThreads):
+    numberChunks_ (numberChunks), nextChunk_ (0), numberThreads_ (0),
+    threadId_ (new pthread_t [numberThreads]),
+    chunks_ (new Chunk [numberChunks]), quit_ (false)
+  {
+    memset (chunks_, 0, numberChunks*sizeof (Chunk));
+    pthread_mutex_init (&mutex_, NULL);
+    pthread_cond_init (&workCondition_, NULL);
+    pthread_cond_init (&doneCondition_, NULL);
+    for (int i = 0; i < numberThreads; i++) {
+      if (pthread_create (threadId_+numberThreads_, NULL, worker, this))
+	break;
+      numberThreads_++;
+    }
+  }
+
+  virtual ~CoinChunkPipeline ()
+  {
+    stop ();
+    pthread_cond_destroy (&doneCondition_);
+    pthread_cond_destroy (&workCondition_);
+    pthread_mutex_destroy (&mutex_);
+    for (int i = 0; i < numberChunks_; i++) {
+      delete [] chunks_[i].input;
+      delete [] chunks_[i].output;
+    }
+    delete [] chunks_;
+    delete [] threadId_;
+  }
+
+  inline int numberChunks () const
+  { return numberChunks_; }
+
+  inline Chunk &chunk (int i)
+  { return chunks_[i]; }
+
+  /// Hand chunk to the workers
+  void queue (int i)
+  {
+    Chunk &chunk = chunks_[i];
+    if (numberThreads_) {
+      pthread_mutex_lock (&mutex_);
+      chunk.state = chunkQueued;
+      pthread_cond_signal (&workCondition_);
+      pthread_mutex_unlock (&mutex_);
+    } else {
+      process (chunk);
+      chunk.state = chunkDone;
+    }
+  }
+
+  /// Wait for chunk to be processed; false if it was not queued
+  bool finish (int i)
+  {
+    Chunk &chunk = chunks_[i];
+    pthread_mutex_lock (&mutex_);
+    bool queued = chunk.state != chunkFree;
+    while (chunk.state != chunkDone && queued)
+      pthread_cond_wait (&doneCondition_, &mutex_);
+    // workers leave free chunks alone
+    chunk.state = chunkFree;
+    pthread_mutex_unlock (&mutex_);
+    return queued;
+  }
+
+  /// Stop the workers, leaving any queued chunks
+  void stop ()
+  {
+    pthread_mutex_lock (&mutex_);
+    quit_ = true;
+    pthread_cond_broadcast (&workCondition_);
+    pthread_mutex_unlock (&mutex_);
+    for (int i = 0; i < numberThreads_; i++)
+      pthread_join (threadId_[i], NULL);
+    numberThreads_ = 0;
+  }
+
+  /// Make sure buffer holds size bytes (contents are lost)
+  static void reserve (char *&buffer, int &capacity, int size)
+  {
+    if (capacity < size) {
+      delete [] buffer;
+      buffer = new char [size];
+      capacity = size;
+    }
+  }
+
+protected:
+  /// Work done on a worker thread (without the lock)
+  virtual void process (Chunk &chunk) = 0;
+
+private:
+  enum { chunkFree = 0, chunkQueued, chunkRunning, chunkDone };
+
+  static void *worker (void *arg)
+  {
+    CoinChunkPipeline *self = reinterpret_cast<CoinChunkPipeline *> (arg);
+    pthread_mutex_lock (&self->mutex_);
+    while (!self->quit_) {
+      Chunk &chunk = self->chunks_[self->nextChunk_];
+      if (chunk.state == chunkQueued) {
+	chunk.state = chunkRunning;
+	self->nextChunk_ = (self->nextChunk_+1)%self->numberChunks_;
+	pthread_mutex_unlock (&self->mutex_);
+	self->process (chunk);
+	pthread_mutex_lock (&self->mutex_);
+	chunk.state = chunkDone;
+	pthread_cond_broadcast (&self->doneCondition_);
+      } else {
+	pthread_cond_wait (&self->workCondition_, &self->mutex_);
+      }
+    }
+    pthread_mutex_unlock (&self->mutex_);
+    return NULL;
+  }
+
+  int numberChunks_;
+  /// Next chunk for a worker to take
+  int nextChunk_;
+  int numberThreads_;
+  pthread_t *threadId_;
+  Chunk *chunks_;
+  bool quit_;
+  pthread_mutex_t mutex_;
+  pthread_cond_t workCondition_;
+  pthread_cond_t doneCondition_;
+};
+
+#endif // COINUTILS_PTHREADS
+
+
 // -------- input for gzip compressed files -------
 
 
@@ -282,10 +439,34 @@ public:
 protected:
   virtual int readRaw (void *buffer, int size)
   {
+    if (bzf_ == 0)
+      return 0;
     int bzError = BZ_OK;
     int count = BZ2_bzRead (&bzError, bzf_, buffer, size);
 
-    if (bzError == BZ_OK || bzError == BZ_STREAM_END)
+    if (bzError == BZ_STREAM_END) {
+      // Files written by bzip2 in parallel (or simply concatenated) hold
+      // several streams; carry on with the next one if there is any.
+      void *unused;
+      int numberUnused;
+      BZ2_bzReadGetUnused (&bzError, bzf_, &unused, &numberUnused);
+      if (bzError == BZ_OK) {
+	char save[BZ_MAX_UNUSED];
+	memcpy (save, unused, numberUnused);
+	BZ2_bzReadClose (&bzError, bzf_);
+	bzf_ = 0;
+	if (numberUnused || !feof (f_))
+	  bzf_ = BZ2_bzReadOpen (&bzError, f_, 0, 0, save, numberUnused);
+	if (bzf_ != 0 && bzError != BZ_OK) {
+	  BZ2_bzReadClose (&bzError, bzf_);
+	  bzf_ = 0;
+	}
+      }
+      if (count == 0 && bzf_ != 0)
+	return readRaw (buffer, size);
+      return count;
+    }
+    if (bzError == BZ_OK)
       return count;
     
     // Error?
@@ -300,6 +481,234 @@ private:
 #endif // COIN_HAS_BZLIB
 
 
+// ------- read-ahead for compressed files ------
+
+#ifdef COINUTILS_PTHREADS
+
+#ifdef COIN_HAS_ZLIB
+
+// gzip members written by CoinParallelFileOutput carry their own size in
+// an extra field (subfield "Co"), so a reader can find them all without
+// inflating anything.  The header is 20 bytes.
+static const int coinGzipHeaderSize = 20;
+
+static void coinGzipHeader (unsigned char *header, unsigned int memberSize)
+{
+  static const unsigned char fixed[16] = {
+    0x1f, 0x8b, 8 /* deflate */, 4 /* FEXTRA */, 0, 0, 0, 0 /* no time */,
+    0, 255 /* unknown OS */, 8, 0 /* XLEN */, 'C', 'o', 4, 0 /* LEN */ };
+  memcpy (header, fixed, 16);
+  for (int i = 0; i < 4; i++)
+    header[16+i] = static_cast<unsigned char> (memberSize >> (8*i));
+}
+
+// Size of the member starting with header, or 0 if not written as above
+static unsigned int coinGzipMemberSize (const unsigned char *header)
+{
+  unsigned char check[coinGzipHeaderSize];
+  coinGzipHeader (check, 0);
+  if (memcmp (header, check, 16))
+    return 0;
+  unsigned int size = 0;
+  for (int i = 3; i >= 0; i--)
+    size = (size << 8) | header[16+i];
+  return size >= coinGzipHeaderSize + 8 ? size : 0;
+}
+
+// Sizes of the members of fileName if it is made up of members as above
+static bool coinGzipMembers (const std::string &fileName,
+			     std::vector<unsigned int> &sizes)
+{
+  FILE *f = fopen (fileName.c_str (), "rb");
+  if (f == 0)
+    return false;
+  unsigned char header[coinGzipHeaderSize];
+  bool ok = true;
+  sizes.clear ();
+  while (ok) {
+    size_t count = fread (header, 1, coinGzipHeaderSize, f);
+    if (count == 0 && feof (f))
+      break;
+    unsigned int size = count == coinGzipHeaderSize ?
+      coinGzipMemberSize (header) : 0;
+    if (size) {
+      sizes.push_back (size);
+      ok = fseek (f, size - coinGzipHeaderSize, SEEK_CUR) == 0;
+    } else {
+      ok = false;
+    }
+  }
+  // a member size running past the end only shows up here
+  ok = ok && !sizes.empty () && ftell (f) >= 0;
+  if (ok) {
+    long position = ftell (f);
+    fseek (f, 0, SEEK_END);
+    ok = position == ftell (f);
+  }
+  fclose (f);
+  return ok;
+}
+
+#endif // COIN_HAS_ZLIB
+
+// Decompresses ahead of the caller into a ring of buffers, so that
+// decompression and parsing overlap.  Either another reader is run on one
+// thread, or the members of a gzip file written by CoinParallelFileOutput
+// are inflated on several threads at once.
+class CoinReadAheadFileInput: public CoinGetslessFileInput,
+			      private CoinChunkPipeline
+{
+public:
+  /// Run source (which is taken over) on one thread
+  CoinReadAheadFileInput (CoinFileInput *source):
+    CoinGetslessFileInput (source->getFileName ()),
+    CoinChunkPipeline (4, 1), source_ (source), f_ (0), nextMember_ (0),
+    current_ (0), position_ (0), end_ (false)
+  {
+    readType_ = source->getReadType ();
+    start ();
+  }
+
+#ifdef COIN_HAS_ZLIB
+  /// Inflate gzip members of given sizes on numberThreads threads
+  CoinReadAheadFileInput (const std::string &fileName,
+			  const std::vector<unsigned int> &memberSizes,
+			  int numberThreads):
+    CoinGetslessFileInput (fileName),
+    CoinChunkPipeline (2*numberThreads, numberThreads), source_ (0),
+    f_ (0), memberSizes_ (memberSizes), nextMember_ (0), current_ (0),
+    position_ (0), end_ (false)
+  {
+    readType_ = "zlib";
+    f_ = fopen (fileName.c_str (), "rb");
+    if (f_ == 0)
+      throw CoinError ("Could not open file for reading!", 
+		       "CoinReadAheadFileInput", 
+		       "CoinReadAheadFileInput");
+    start ();
+  }
+#endif
+
+  virtual ~CoinReadAheadFileInput ()
+  {
+    stop ();
+    delete source_;
+    if (f_ != 0)
+      fclose (f_);
+  }
+
+protected:
+  virtual int readRaw (void *buffer, int size)
+  {
+    while (!end_) {
+      Chunk &current = chunk (current_);
+      if (position_ < current.outputSize) {
+	int n = CoinMin (size, current.outputSize - position_);
+	memcpy (buffer, current.output + position_, n);
+	position_ += n;
+	return n;
+      }
+      // this one is used up, so set it going again and move on
+      fill (current_);
+      current_ = (current_+1)%numberChunks ();
+      collect ();
+    }
+    return 0;
+  }
+
+private:
+  enum { blockSize = 1 << 18 };
+
+  /// Start all chunks and wait for the first
+  void start ()
+  {
+    for (int i = 0; i < numberChunks (); i++)
+      fill (i);
+    collect ();
+  }
+
+  /// Queue work for chunk if there is any
+  void fill (int i)
+  {
+    if (source_ == 0) {
+      if (nextMember_ == memberSizes_.size ())
+	return;
+      Chunk &next = chunk (i);
+      int size = static_cast<int> (memberSizes_[nextMember_++]);
+      reserve (next.input, next.inputCapacity, size);
+      next.inputSize = static_cast<int> (fread (next.input, 1, size, f_));
+    }
+    queue (i);
+  }
+
+  /// Wait for current chunk
+  void collect ()
+  {
+    position_ = 0;
+    Chunk &current = chunk (current_);
+    end_ = !finish (current_) || !current.ok || current.outputSize == 0;
+  }
+
+  virtual void process (Chunk &chunk)
+  {
+    chunk.ok = false;
+    chunk.outputSize = 0;
+    if (source_ != 0) {
+      reserve (chunk.output, chunk.outputCapacity, blockSize);
+      chunk.outputSize = source_->read (chunk.output, blockSize);
+      chunk.ok = true;
+      return;
+    }
+#ifdef COIN_HAS_ZLIB
+    // raw deflate data between header and trailer (crc and size)
+    const unsigned char *input =
+      reinterpret_cast<const unsigned char *> (chunk.input);
+    int size = chunk.inputSize;
+    if (size < coinGzipHeaderSize + 8)
+      return;
+    unsigned int crc = 0;
+    unsigned int length = 0;
+    for (int i = 3; i >= 0; i--) {
+      crc = (crc << 8) | input[size-8+i];
+      length = (length << 8) | input[size-4+i];
+    }
+    // CoinParallelFileOutput members are far smaller
+    if (length > (1u << 26))
+      return;
+    reserve (chunk.output, chunk.outputCapacity,
+	     static_cast<int> (CoinMax (length, 1u)));
+    z_stream stream;
+    memset (&stream, 0, sizeof (stream));
+    if (inflateInit2 (&stream, -15) != Z_OK)
+      return;
+    stream.next_in = const_cast<Bytef *> (input + coinGzipHeaderSize);
+    stream.avail_in = size - coinGzipHeaderSize - 8;
+    stream.next_out = reinterpret_cast<Bytef *> (chunk.output);
+    stream.avail_out = length;
+    chunk.ok = inflate (&stream, Z_FINISH) == Z_STREAM_END &&
+      stream.total_out == length &&
+      crc32 (0, reinterpret_cast<Bytef *> (chunk.output), length) == crc;
+    inflateEnd (&stream);
+    if (chunk.ok)
+      chunk.outputSize = static_cast<int> (length);
+#endif
+  }
+
+  /// Reader run on the worker (or 0 for gzip members)
+  CoinFileInput *source_;
+  /// File with gzip members
+  FILE *f_;
+  std::vector<unsigned int> memberSizes_;
+  size_t nextMember_;
+  /// Chunk being read by the caller and position in it
+  int current_;
+  int position_;
+  bool end_;
+};
+
+#endif // COINUTILS_PTHREADS
+
+
 // ----- implementation of CoinFileInput's methods
 
 /// indicates whether CoinFileInput supports gzip'ed files
@@ -342,6 +751,15 @@ CoinFileInput *CoinFileInput::create (const std::string &fileName)
   if (count >= 2 && header[0] == 0x1f && header[1] == 0x8b)
     {
 #ifdef COIN_HAS_ZLIB
+#ifdef COINUTILS_PTHREADS
+      if (decompressionThreads_ > 0) {
+	std::vector<unsigned int> memberSizes;
+	if (coinGzipMembers (fileName, memberSizes))
+	  return new CoinReadAheadFileInput (fileName, memberSizes,
+					     decompressionThreads_);
+	return new CoinReadAheadFileInput (new CoinGzipFileInput (fileName));
+      }
+#endif
       return new CoinGzipFileInput (fileName);
 #else
       throw CoinError ("Cannot read gzip'ed file because zlib was "
@@ -355,6 +773,10 @@ CoinFileInput *CoinFileInput::create (const std::string &fileName)
   if (count >= 3 && header[0] == 'B' && header[1] == 'Z' && header[2] == 'h')
     {
 #ifdef COIN_HAS_BZLIB
+#ifdef COINUTILS_PTHREADS
+      if (decompressionThreads_ > 0)
+	return new CoinReadAheadFileInput (new CoinBzip2FileInput (fileName));
+#endif
       return new CoinBzip2FileInput (fileName);
 #else
       throw CoinError ("Cannot read bzip2'ed file because bzlib was "
@@ -368,6 +790,13 @@ CoinFileInput *CoinFileInput::create (const std::string &fileName)
   return new CoinPlainFileInput (fileName);
 }
 
+int CoinFileInput::decompressionThreads_ = 0;
+
+void CoinFileInput::setDecompressionThreads (int numberThreads)
+{
+  decompressionThreads_ = CoinMax (numberThreads, 0);
+}
+
 CoinFileInput::CoinFileInput (const std::string &fileName): 
   CoinFileIOBase (fileName)
 {}
@@ -382,14 +811,68 @@ CoinFileInput::~CoinFileInput ()
 // ------------------------------------------------------
 
 
+// -------- CoinBlockFileOutput ---------
+
+// Base for the subclasses below.  The writers put out a short string for
+// each card or coefficient, so collect them into large blocks before
+// handing them on to stdio or the compression library.
+class CoinBlockFileOutput: public CoinFileOutput
+{
+public:
+  CoinBlockFileOutput (const std::string &fileName):
+    CoinFileOutput (fileName), buffer_ (new char [blockSize]), 
+    used_ (0), ok_ (true)
+  {}
+
+  virtual ~CoinBlockFileOutput ()
+  {
+    delete [] buffer_;
+  }
+
+  virtual int write (const void * buffer, int size)
+  {
+    if (size >= blockSize) {
+      if (!flush ())
+	return 0;
+      return writeBlock (buffer, size) ? size : 0;
+    }
+    if (used_ + size > blockSize && !flush ())
+      return 0;
+    memcpy (buffer_ + used_, buffer, size);
+    used_ += size;
+    return size;
+  }
+
+protected:
+  /// Write out what has been collected; subclasses call this before closing
+  bool flush ()
+  {
+    if (used_) {
+      ok_ = writeBlock (buffer_, used_) && ok_;
+      used_ = 0;
+    }
+    return ok_;
+  }
+
+  /// Write a block to the file, return true on success
+  virtual bool writeBlock (const void * buffer, int size) = 0;
+
+private:
+  enum { blockSize = 1 << 20 };
+  char * buffer_;
+  int used_;
+  bool ok_;
+};
+
+
 // -------- CoinPlainFileOutput ---------
 
 // Class to handle output to text files without compression.
-class CoinPlainFileOutput: public CoinFileOutput
+class CoinPlainFileOutput: public CoinBlockFileOutput
 {
 public:
   CoinPlainFileOutput (const std::string &fileName): 
-    CoinFileOutput (fileName), f_ (0)
+    CoinBlockFileOutput (fileName), f_ (0)
   {
     if (fileName == "-" || fileName == "stdout") {
       f_ = stdout;
@@ -404,19 +887,15 @@ public:
 
   virtual ~CoinPlainFileOutput () 
   {
+    flush ();
     if (f_ != 0 && f_ != stdout)
       fclose (f_);
   }
 
-  virtual int write (const void *buffer, int size)
-  {
-    return static_cast<int>(fwrite (buffer, 1, size, f_));
-  }
-
-  // we have something better than the default implementation
-  virtual bool puts (const char *s)
+protected:
+  virtual bool writeBlock (const void *buffer, int size)
   {
-    return fputs (s, f_) >= 0;
+    return static_cast<int>(fwrite (buffer, 1, size, f_)) == size;
   }
 
 private:
@@ -431,11 +910,11 @@ private:
 // no need to include the header, as this was done for the input class
 
 // Handle output with gzip compression
-class CoinGzipFileOutput: public CoinFileOutput
+class CoinGzipFileOutput: public CoinBlockFileOutput
 {
 public:
   CoinGzipFileOutput (const std::string &fileName): 
-    CoinFileOutput (fileName), gzf_ (0)
+    CoinBlockFileOutput (fileName), gzf_ (0)
   {
     gzf_ = gzopen (fileName.c_str (), "w");
     if (gzf_ == 0)
@@ -446,18 +925,17 @@ public:
 
   virtual ~CoinGzipFileOutput () 
   {
+    flush ();
     if (gzf_ != 0)
       gzclose (gzf_);
   }
 
-  virtual int write (const void * buffer, int size)
+protected:
+  virtual bool writeBlock (const void * buffer, int size)
   {
-    return gzwrite (gzf_, const_cast<void *> (buffer), size);
+    return gzwrite (gzf_, const_cast<void *> (buffer), size) == size;
   }
   
-  // as zlib's gzputs is no more clever than our own, there's
-  // no need to replace the default.
-  
 private:
   gzFile gzf_;
 };
@@ -472,11 +950,11 @@ private:
 // no need to include the header, as this was done for the input class
 
 // Output to bzip2 compressed file
-class CoinBzip2FileOutput: public CoinFileOutput
+class CoinBzip2FileOutput: public CoinBlockFileOutput
 {
 public:
   CoinBzip2FileOutput (const std::string &fileName): 
-    CoinFileOutput (fileName), f_ (0), bzf_ (0)
+    CoinBlockFileOutput (fileName), f_ (0), bzf_ (0)
   {
     int bzError = BZ_OK;
 
@@ -499,6 +977,7 @@ public:
 
   virtual ~CoinBzip2FileOutput () 
   {
+    flush ();
     int bzError = BZ_OK;
     if (bzf_ != 0)
       BZ2_bzWriteClose (&bzError, bzf_, 0, 0, 0);
@@ -507,11 +986,12 @@ public:
       fclose (f_);
   }
 
-  virtual int write (const void *buffer, int size)
+protected:
+  virtual bool writeBlock (const void *buffer, int size)
   {
     int bzError = BZ_OK;
     BZ2_bzWrite (&bzError, bzf_, const_cast<void *> (buffer), size);
-    return (bzError == BZ_OK) ? size : 0;
+    return bzError == BZ_OK;
   }
   
 private:
@@ -522,6 +1002,162 @@ private:
 #endif // COIN_HAS_BZLIB
 
 
+// ------- CoinParallelFileOutput -------
+
+#if defined(COINUTILS_PTHREADS) && (defined(COIN_HAS_ZLIB) || defined(COIN_HAS_BZLIB))
+
+/*
+  Compressed output spread over threads.  The data is cut into chunks and
+  each chunk is compressed on its own into a complete gzip member or bzip2
+  stream.  Both formats allow such pieces to be concatenated, and gunzip,
+  bunzip2 and the input classes above read the result as one file.  gzip
+  members also record their size, so CoinReadAheadFileInput can inflate
+  several at once.
+
+  The caller fills chunks in a ring of 2*threads.  A full chunk is queued
+  for the workers and the caller moves on to the next one, first waiting
+  for its previous contents to be compressed and written, so chunks reach
+  the file in order.
+*/
+class CoinParallelFileOutput: public CoinFileOutput,
+			      private CoinChunkPipeline
+{
+public:
+  CoinParallelFileOutput (const std::string &fileName,
+			  Compression compression, int numberThreads):
+    CoinFileOutput (fileName),
+    CoinChunkPipeline (2*numberThreads, numberThreads), f_ (0),
+    compression_ (compression), current_ (0), anyChunks_ (false),
+    ok_ (true)
+  {
+    // gzip members need a little more than the 32k window to compress
+    // well; bzip2 works in blocks of 900k at level 9
+    chunkSize_ = compression == COMPRESS_GZIP ? 1 << 18 : 900000;
+    f_ = fopen (fileName.c_str (), "wb");
+    if (f_ == 0)
+      throw CoinError ("Could not open file for writing!",
+		       "CoinParallelFileOutput",
+		       "CoinParallelFileOutput");
+    for (int i = 0; i < numberChunks (); i++) {
+      Chunk &next = chunk (i);
+      reserve (next.input, next.inputCapacity, chunkSize_);
+    }
+  }
+
+  virtual ~CoinParallelFileOutput ()
+  {
+    // an empty file still needs one (empty) member
+    if (chunk (current_).inputSize || !anyChunks_)
+      submit ();
+    for (int i = 0; i < numberChunks (); i++)
+      retire ((current_+i)%numberChunks ());
+    stop ();
+    fclose (f_);
+  }
+
+  virtual int write (const void * buffer, int size)
+  {
+    const char * data = reinterpret_cast<const char *> (buffer);
+    int left = size;
+    while (left) {
+      Chunk & current = chunk (current_);
+      int n = CoinMin (left, chunkSize_ - current.inputSize);
+      memcpy (current.input + current.inputSize, data, n);
+      current.inputSize += n;
+      data += n;
+      left -= n;
+      if (current.inputSize == chunkSize_)
+	submit ();
+    }
+    return ok_ ? size : 0;
+  }
+
+private:
+  /// Queue current chunk and make the next one available
+  void submit ()
+  {
+    anyChunks_ = true;
+    queue (current_);
+    current_ = (current_+1)%numberChunks ();
+    retire (current_);
+  }
+
+  /// Wait for chunk to be compressed and write it out
+  void retire (int i)
+  {
+    if (finish (i)) {
+      Chunk & done = chunk (i);
+      if (!done.ok || static_cast<int> (fwrite (done.output, 1,
+						done.outputSize, f_))
+	  != done.outputSize)
+	ok_ = false;
+      done.inputSize = 0;
+    }
+  }
+
+  virtual void process (Chunk & chunk)
+  {
+    chunk.ok = false;
+    chunk.outputSize = 0;
+#ifdef COIN_HAS_ZLIB
+    if (compression_ == COMPRESS_GZIP) {
+      // raw deflate, header and trailer are written here
+      z_stream stream;
+      memset (&stream, 0, sizeof (stream));
+      if (deflateInit2 (&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15,
+			8, Z_DEFAULT_STRATEGY) != Z_OK)
+	return;
+      int bound = static_cast<int> (deflateBound (&stream, chunk.inputSize));
+      reserve (chunk.output, chunk.outputCapacity,
+	       coinGzipHeaderSize + bound + 8);
+      stream.next_in = reinterpret_cast<Bytef *> (chunk.input);
+      stream.avail_in = chunk.inputSize;
+      stream.next_out =
+	reinterpret_cast<Bytef *> (chunk.output + coinGzipHeaderSize);
+      stream.avail_out = bound;
+      chunk.ok = deflate (&stream, Z_FINISH) == Z_STREAM_END;
+      int size = coinGzipHeaderSize + static_cast<int> (stream.total_out);
+      deflateEnd (&stream);
+      unsigned int crc = crc32 (0, reinterpret_cast<Bytef *> (chunk.input),
+				chunk.inputSize);
+      unsigned char *trailer =
+	reinterpret_cast<unsigned char *> (chunk.output + size);
+      for (int i = 0; i < 4; i++) {
+	trailer[i] = static_cast<unsigned char> (crc >> (8*i));
+	trailer[4+i] = static_cast<unsigned char> (chunk.inputSize >> (8*i));
+      }
+      chunk.outputSize = size + 8;
+      coinGzipHeader (reinterpret_cast<unsigned char *> (chunk.output),
+		      chunk.outputSize);
+      return;
+    }
+#endif
+#ifdef COIN_HAS_BZLIB
+    if (compression_ == COMPRESS_BZIP2) {
+      // worst case given in bzlib manual
+      int bound = chunk.inputSize + chunk.inputSize/100 + 600;
+      reserve (chunk.output, chunk.outputCapacity, bound);
+      unsigned int size = bound;
+      // same block size, verbosity and work factor as CoinBzip2FileOutput
+      chunk.ok = BZ2_bzBuffToBuffCompress (chunk.output, &size, chunk.input,
+					   chunk.inputSize, 9, 0, 30) == BZ_OK;
+      chunk.outputSize = static_cast<int> (size);
+    }
+#endif
+  }
+
+  FILE * f_;
+  Compression compression_;
+  int chunkSize_;
+  /// Chunk being filled by the caller
+  int current_;
+  bool anyChunks_;
+  bool ok_;
+};
+
+#endif // COINUTILS_PTHREADS
+
+
 // ------- implementation of CoinFileOutput's methods
 
 bool CoinFileOutput::compressionSupported (Compression compression)
@@ -560,12 +1196,22 @@ CoinFileOutput *CoinFileOutput::create (const std::string &fileName,
 
     case COMPRESS_GZIP:
 #ifdef COIN_HAS_ZLIB
+#ifdef COINUTILS_PTHREADS
+      if (compressionThreads_ > 1)
+	return new CoinParallelFileOutput (fileName, compression,
+					   compressionThreads_);
+#endif
       return new CoinGzipFileOutput (fileName);
 #endif
       break;
       
     case COMPRESS_BZIP2:
 #ifdef COIN_HAS_BZLIB
+#ifdef COINUTILS_PTHREADS
+      if (compressionThreads_ > 1)
+	return new CoinParallelFileOutput (fileName, compression,
+					   compressionThreads_);
+#endif
       return new CoinBzip2FileOutput (fileName);
 #endif
       break;
@@ -579,6 +1225,13 @@ CoinFileOutput *CoinFileOutput::create (const std::string &fileName,
 		   "CoinFileOutput");
 }
 
+int CoinFileOutput::compressionThreads_ = 1;
+
+void CoinFileOutput::setCompressionThreads (int numberThreads)
+{
+  compressionThreads_ = CoinMax (numberThreads, 1);
+}
+
 CoinFileOutput::CoinFileOutput (const std::string &fileName):
   CoinFileIOBase (fileName)
 {}
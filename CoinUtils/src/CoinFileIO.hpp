@@ -51,6 +51,19 @@ public:
   /// @param fileName The file that should be read.
   static CoinFileInput *create (const std::string &fileName);
 
+  /// Set the number of threads used to decompress files opened by create.
+  /// With one or more, a compressed file is decompressed ahead of the
+  /// reader on another thread.  gzip files written by CoinFileOutput on
+  /// several threads are split into pieces which are then inflated on up
+  /// to this many threads at once.  Only has an effect if CoinUtils was
+  /// built with thread support (--enable-coinutils-threads); the default
+  /// is none, decompressing as the data is read.
+  static void setDecompressionThreads (int numberThreads);
+
+  /// Number of threads used to decompress files opened by create.
+  static inline int decompressionThreads ()
+  { return decompressionThreads_; }
+
   /// Constructor (don't use this, use the create method instead).
   /// @param fileName The name of the file used by this object.
   CoinFileInput (const std::string &fileName);
@@ -74,6 +87,9 @@ public:
   /// @param size The size of the buffer in characters.
   /// @return buffer on success, or 0 if no characters have been read.
   virtual char *gets (char *buffer, int size) = 0;
+
+private:
+  static int decompressionThreads_;
 };
 
 /// Abstract base class for file output classes.
@@ -105,6 +121,19 @@ public:
   static CoinFileOutput *create (const std::string &fileName, 
 				 Compression compression);
 
+  /// Set the number of threads used to compress files opened by create.
+  /// With more than one thread the data is compressed in independent
+  /// pieces, written as a multi-member gzip file or a sequence of bzip2
+  /// streams, which gunzip, bunzip2 and CoinFileInput read as one file
+  /// (see also CoinFileInput::setDecompressionThreads).
+  /// Only has an effect if CoinUtils was built with thread support
+  /// (--enable-coinutils-threads); the default is one thread.
+  static void setCompressionThreads (int numberThreads);
+
+  /// Number of threads used to compress files opened by create.
+  static inline int compressionThreads ()
+  { return compressionThreads_; }
+
   /// Constructor (don't use this, use the create method instead).
   /// @param fileName The name of the file used by this object.
   CoinFileOutput (const std::string &fileName);
@@ -132,6 +161,9 @@ public:
   {
     return puts (s.c_str ());
   } 
+
+private:
+  static int compressionThreads_;
 };
 
 /*! \relates CoinFileInput
@@ -31,6 +31,17 @@
 #endif
 #endif
 
+// Storage local to each thread, where the compiler has it
+#ifndef COIN_THREAD_LOCAL
+#if defined(_MSC_VER)
+#define COIN_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define COIN_THREAD_LOCAL __thread
+#else
+#define COIN_THREAD_LOCAL
+#endif
+#endif
+
 //#############################################################################
 
 /** This helper function copies an array to another location using Duff's
@@ -766,11 +777,14 @@ CoinDeleteEntriesFromArray(register T * arrayFirst, register T * arrayLast,
   Set \p isSeed to true and supply an integer seed to set the seed
   (vid. #CoinSeedRandom)
 
-  \todo Anyone want to volunteer an upgrade for 64-bit architectures?
+  Each thread has its own state (where the compiler supports thread local
+  storage), starting from the same default seed, so threads do not race
+  but do not share one sequence either.  Code which must give the same
+  results whatever the threads do should use its own CoinRandom.
 */
 inline double CoinDrand48 (bool isSeed = false, unsigned int seed = 1)
 {
-  static unsigned int last = 123456;
+  static COIN_THREAD_LOCAL unsigned int last = 123456;
   if (isSeed) { 
     last = seed;
   } else {
@@ -780,7 +794,7 @@ inline double CoinDrand48 (bool isSeed = false, unsigned int seed = 1)
   return (0.0);
 }
 
-/// Set the seed for the random number generator
+/// Set the seed for the random number generator (of this thread)
 inline void CoinSeedRandom(int iseed)
 {
   CoinDrand48(true, iseed);
@@ -1101,6 +1115,100 @@ protected:
   //@}
 };
 #endif
+
+/** Random numbers from an object of their own
+
+  Uses xoshiro256** (Blackman and Vigna), seeded through splitmix64.  It is
+  fast, has a period of 2<sup>256</sup>-1 and passes the usual statistical
+  tests, and the sequence for a seed is the same on every platform.  There
+  is no shared state, so each thread (or each task of a parallel
+  algorithm) should have its own object.  For several threads to draw
+  from one seed without overlapping, give each a copy and call jump() on
+  the i'th copy i times; each jump moves 2<sup>128</sup> numbers ahead.
+*/
+class CoinRandom {
+public:
+  /// Unsigned 64 bit integer
+  typedef unsigned long long UInt64;
+
+  /**@name Constructors */
+  //@{
+  /// Default constructor (fixed seed)
+  CoinRandom()
+  { setSeed(12345678); }
+  /// Constructor with seed
+  explicit CoinRandom(int seed)
+  { setSeed(seed); }
+  //@}
+
+  /**@name Seeds and numbers */
+  //@{
+  /// Restart the sequence from seed
+  inline void setSeed(int seed)
+  {
+    UInt64 x = static_cast<unsigned int>(seed);
+    for (int i = 0; i < 4; i++) {
+      // splitmix64
+      x += 0x9e3779b97f4a7c15ULL;
+      UInt64 z = x;
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      state_[i] = z ^ (z >> 31);
+    }
+  }
+  /// Next 64 random bits
+  inline UInt64 randomBits()
+  {
+    UInt64 result = rotate(state_[1] * 5, 7) * 9;
+    UInt64 t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = rotate(state_[3], 45);
+    return result;
+  }
+  /// Random number strictly between 0 and 1
+  inline double randomDouble()
+  {
+    return (static_cast<double>(randomBits() >> 11) + 0.5) *
+      (1.0 / 9007199254740992.0);
+  }
+  /// Random integer from 0 to n-1 (n from 1 to 2^32-1)
+  inline int randomInt(int n)
+  {
+    return static_cast<int>(((randomBits() >> 32) *
+			     static_cast<unsigned int>(n)) >> 32);
+  }
+  /// Move 2^128 numbers ahead (for an independent stream)
+  void jump()
+  {
+    static const UInt64 jumpPoly[4] = {
+      0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+      0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+    UInt64 s[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; i++) {
+      for (int b = 0; b < 64; b++) {
+	if (jumpPoly[i] & (static_cast<UInt64>(1) << b)) {
+	  for (int k = 0; k < 4; k++)
+	    s[k] ^= state_[k];
+	}
+	randomBits();
+      }
+    }
+    for (int k = 0; k < 4; k++)
+      state_[k] = s[k];
+  }
+  //@}
+
+private:
+  static inline UInt64 rotate(UInt64 x, int k)
+  { return (x << k) | (x >> (64 - k)); }
+  /// Generator state
+  UInt64 state_[4];
+};
+
 #ifndef COIN_DETAIL
 #define COIN_DETAIL_PRINT(s) {}
 #else
@@ -25,11 +25,120 @@
 #include "CoinPackedMatrix.hpp"
 #include "CoinLpIO.hpp"
 #include "CoinFinite.hpp"
+#include "CoinFileIO.hpp"
+#include "CoinDoubleFormat.hpp"
 
 using namespace std;
 
 //#define LPIO_DEBUG
 
+/************************************************************************/
+/*
+  Buffered tokenizer used by readLp(). It hands out whitespace separated
+  tokens as fscanf("%s") did, but reads the input in large blocks either from
+  a FILE or from a CoinFileInput (so compressed Lp files can be read).
+*/
+class CoinLpTokenizer {
+
+public:
+  /// Size of the token buffers used by CoinLpIO
+  enum { maxToken = 1024 };
+
+  CoinLpTokenizer(FILE *fp) :
+    fp_(fp), input_(NULL), position_(0), end_(0), eof_(false)
+  { buffer_ = new char [bufferSize]; }
+
+  CoinLpTokenizer(CoinFileInput *input) :
+    fp_(NULL), input_(input), position_(0), end_(0), eof_(false)
+  { buffer_ = new char [bufferSize]; }
+
+  ~CoinLpTokenizer() { delete [] buffer_; }
+
+  /** Put the next token in buff (truncated to maxToken-1 characters).
+      Return false if there is no token before the end of the input. */
+  bool next(char *buff)
+  {
+    int c = skipSpace();
+    if (c < 0) 
+      return false;
+    int n = 0;
+    while (c >= 0 && !isSpace(c)) {
+      if (n < maxToken-1)
+	buff[n++] = static_cast<char>(c);
+      position_++;
+      c = peek();
+    }
+    buff[n] = '\0';
+    return true;
+  }
+
+  /// Skip up to and including the next end of line, false if none
+  bool skipLine()
+  {
+    while (true) {
+      if (position_ == end_ && !fill())
+	return false;
+      const char *found = static_cast<const char *>
+	(memchr(buffer_+position_, '\n', end_-position_));
+      if (found) {
+	position_ = static_cast<int>(found-buffer_)+1;
+	return true;
+      }
+      position_ = end_;
+    }
+  }
+
+  /// True once a read has hit the end of the input (as feof)
+  inline bool eof() const { return eof_; }
+
+private:
+  enum { bufferSize = 65536 };
+
+  static inline bool isSpace(int c)
+  { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+  /// Next character without consuming it, -1 at end of input
+  inline int peek()
+  {
+    if (position_ == end_ && !fill())
+      return -1;
+    return static_cast<unsigned char>(buffer_[position_]);
+  }
+
+  inline int skipSpace()
+  {
+    int c = peek();
+    while (c >= 0 && isSpace(c)) {
+      position_++;
+      c = peek();
+    }
+    return c;
+  }
+
+  /// Refill the buffer, return false (and set eof) if nothing was read
+  bool fill()
+  {
+    int n;
+    if (fp_)
+      n = static_cast<int>(fread(buffer_, 1, bufferSize, fp_));
+    else
+      n = input_->read(buffer_, bufferSize);
+    position_ = 0;
+    end_ = CoinMax(n, 0);
+    if (end_ == 0) 
+      eof_ = true;
+    return end_ > 0;
+  }
+
+  FILE *fp_;
+  CoinFileInput *input_;
+  char *buffer_;
+  int position_;
+  int end_;
+  bool eof_;
+};
+
+
 /************************************************************************/
 
 CoinLpIO::CoinLpIO() :
@@ -835,21 +944,27 @@ CoinLpIO::out_coeff(FILE *fp, const double v, const int print_1) const {
   }
 
   double frac = v - floor(v);
+  double value = v;
+  int decimals = getDecimals();
 
   if(frac < lp_eps) {
-    fprintf(fp, " %.0f", floor(v));
+    value = floor(v);
+    decimals = 0;
   }
   else {
     if(frac > 1 - lp_eps) {
-      fprintf(fp, " %.0f", floor(v+0.5));
-    }
-    else {
-      int decimals = getDecimals();
-      char form[15];
-      sprintf(form, " %%.%df", decimals);
-      fprintf(fp, form, v);
+      value = floor(v+0.5);
+      decimals = 0;
     }
   }
+  char buff[40];
+  buff[0] = ' ';
+  if(CoinFixedDouble(value, decimals, buff+1) < 0) {
+    fprintf(fp, " %.*f", decimals, value);
+  }
+  else {
+    fputs(buff, fp);
+  }
 } /* out_coeff */
 
 /************************************************************************/
@@ -1142,7 +1257,7 @@ CoinLpIO::writeLp(FILE *fp, const bool useRowNames)
 
 /*************************************************************************/
 int 
-CoinLpIO::find_obj(FILE *fp) const {
+CoinLpIO::find_obj(CoinLpTokenizer &input) const {
 
   char buff[1024];
 
@@ -1154,10 +1269,10 @@ CoinLpIO::find_obj(FILE *fp) const {
 	((lbuff != 8) || (CoinStrNCaseCmp(buff, "maximize", 8) != 0)) &&
 	((lbuff != 3) || (CoinStrNCaseCmp(buff, "max", 3) != 0))) {
 
-    scan_next(buff, fp);
+    scan_next(buff, input);
     lbuff = strlen(buff);
     
-    if(feof(fp)) {
+    if(input.eof()) {
       char str[8192];
       sprintf(str,"### ERROR: Unable to locate objective function\n");
       throw CoinError(str, "find_obj", "CoinLpIO", __FILE__, __LINE__);
@@ -1262,36 +1377,24 @@ CoinLpIO::is_comment(const char *buff) const {
 
 /*************************************************************************/
 void
-CoinLpIO::skip_comment(char *buff, FILE *fp) const {
+CoinLpIO::skip_comment(char *buff, CoinLpTokenizer &input) const {
 
-  while(strcspn(buff, "\n") == strlen(buff)) { // end of line not read yet
-    if(feof(fp)) {
-      char str[8192];
-      sprintf(str,"### ERROR: end of file reached while skipping comment\n");
-      throw CoinError(str, "skip_comment", "CoinLpIO", __FILE__, __LINE__);
-    }
-    if(ferror(fp)) {
-      char str[8192];
-      sprintf(str,"### ERROR: error while skipping comment\n");
-      throw CoinError(str, "skip_comment", "CoinLpIO", __FILE__, __LINE__);
-    }
-    char * x=fgets(buff, sizeof(buff), fp);    
-    if (!x)
-      throw("bad fgets");
-  } 
+  if(!input.skipLine()) {
+    char str[8192];
+    sprintf(str,"### ERROR: end of file reached while skipping comment\n");
+    throw CoinError(str, "skip_comment", "CoinLpIO", __FILE__, __LINE__);
+  }
 } /* skip_comment */
 
 /*************************************************************************/
 void
-CoinLpIO::scan_next(char *buff, FILE *fp) const {
+CoinLpIO::scan_next(char *buff, CoinLpTokenizer &input) const {
 
-  int x=fscanf(fp, "%s", buff);
-  if (x<=0)
+  if(!input.next(buff))
     throw("bad fscanf");
   while(is_comment(buff)) {
-    skip_comment(buff, fp);
-    x=fscanf(fp, "%s", buff);
-    if (x<=0)
+    skip_comment(buff, input);
+    if(!input.next(buff))
       throw("bad fscanf");
   }
 
@@ -1396,16 +1499,16 @@ CoinLpIO::are_invalid_names(char const * const * const vnames,
 
 /*************************************************************************/
 int 
-CoinLpIO::read_monom_obj(FILE *fp, double *coeff, char **name, int *cnt, 
+CoinLpIO::read_monom_obj(CoinLpTokenizer &input, double *coeff, char **name, int *cnt, 
 						 char **obj_name) {
 
   double mult;
   char buff[1024] = "aa", loc_name[1024], *start;
   int read_st = 0;
 
-  scan_next(buff, fp);
+  scan_next(buff, input);
 
-  if(feof(fp)) {
+  if(input.eof()) {
     char str[8192];
     sprintf(str,"### ERROR: Unable to read objective function\n");
     throw CoinError(str, "read_monom_obj", "CoinLpIO", __FILE__, __LINE__);
@@ -1438,7 +1541,7 @@ CoinLpIO::read_monom_obj(FILE *fp, double *coeff, char **name, int *cnt,
   if(buff[0] == '+') {
     mult = 1;
     if(strlen(buff) == 1) {
-      scan_next(buff, fp);
+      scan_next(buff, input);
       start = buff;
     }
     else {
@@ -1449,7 +1552,7 @@ CoinLpIO::read_monom_obj(FILE *fp, double *coeff, char **name, int *cnt,
   if(buff[0] == '-') {
     mult = -1;
     if(strlen(buff) == 1) {
-      scan_next(buff, fp);
+      scan_next(buff, input);
       start = buff;
     }
     else {
@@ -1458,9 +1561,9 @@ CoinLpIO::read_monom_obj(FILE *fp, double *coeff, char **name, int *cnt,
   }
   
   if(first_is_number(start)) {
-    coeff[*cnt] = atof(start);       
+    coeff[*cnt] = CoinReadDouble(start);       
     sprintf(loc_name, "aa");
-    scan_next(loc_name, fp);
+    scan_next(loc_name, input);
   }
   else {
     coeff[*cnt] = 1;
@@ -1497,7 +1600,7 @@ CoinLpIO::read_monom_obj(FILE *fp, double *coeff, char **name, int *cnt,
 
 /*************************************************************************/
 int 
-CoinLpIO::read_monom_row(FILE *fp, char *start_str, 
+CoinLpIO::read_monom_row(CoinLpTokenizer &input, char *start_str, 
 			 double *coeff, char **name, 
 			 int cnt_coeff) const {
 
@@ -1516,7 +1619,7 @@ CoinLpIO::read_monom_row(FILE *fp, char *start_str,
   if(buff[0] == '+') {
     mult = 1;
     if(strlen(buff) == 1) {
-      scan_next(buff, fp);
+      scan_next(buff, input);
       start = buff;
     }
     else {
@@ -1527,7 +1630,7 @@ CoinLpIO::read_monom_row(FILE *fp, char *start_str,
   if(buff[0] == '-') {
     mult = -1;
     if(strlen(buff) == 1) {
-      scan_next(buff, fp);
+      scan_next(buff, input);
       start = buff;
     }
     else {
@@ -1536,8 +1639,8 @@ CoinLpIO::read_monom_row(FILE *fp, char *start_str,
   }
   
   if(first_is_number(start)) {
-    coeff[cnt_coeff] = atof(start);       
-    scan_next(loc_name, fp);
+    coeff[cnt_coeff] = CoinReadDouble(start);       
+    scan_next(loc_name, input);
   }
   else {
     coeff[cnt_coeff] = 1;
@@ -1592,16 +1695,22 @@ void
 CoinLpIO::realloc_col(double **collow, double **colup, char **is_int,
 		      int *maxcol) const {
   
-  *maxcol += 100;
+  int oldmax = *maxcol;
+  *maxcol = 2 * oldmax + 100;
   *collow = reinterpret_cast<double *> (realloc ((*collow), (*maxcol+1) * sizeof(double)));
   *colup = reinterpret_cast<double *> (realloc ((*colup), (*maxcol+1) * sizeof(double)));
   *is_int = reinterpret_cast<char *> (realloc ((*is_int), (*maxcol+1) * sizeof(char)));
+  for(int i=oldmax; i<=*maxcol; i++) {
+    (*collow)[i] = 0;
+    (*colup)[i] = infinity_;
+    (*is_int)[i] = 0;
+  }
 
 } /* realloc_col */
 
 /*************************************************************************/
 void 
-CoinLpIO::read_row(FILE *fp, char *buff,
+CoinLpIO::read_row(CoinLpTokenizer &input, char *buff,
 		   double **pcoeff, char ***pcolNames, 
 		   int *cnt_coeff,
 		   int *maxcoeff,
@@ -1618,16 +1727,16 @@ CoinLpIO::read_row(FILE *fp, char *buff,
     if((*cnt_coeff) == (*maxcoeff)) {
       realloc_coeff(pcoeff, pcolNames, maxcoeff);
     }
-    read_sense = read_monom_row(fp, start_str, 
+    read_sense = read_monom_row(input, start_str, 
 				*pcoeff, *pcolNames, *cnt_coeff);
 #ifdef KILL_ZERO_READLP
     if (read_sense!=-2) // see if zero
 #endif
       (*cnt_coeff)++;
 
-    scan_next(start_str, fp);
+    scan_next(start_str, input);
 
-    if(feof(fp)) {
+    if(input.eof()) {
       char str[8192];
       sprintf(str,"### ERROR: Unable to read row monomial\n");
       throw CoinError(str, "read_monom_row", "CoinLpIO", __FILE__, __LINE__);
@@ -1635,7 +1744,7 @@ CoinLpIO::read_row(FILE *fp, char *buff,
   }
   (*cnt_coeff)--;
 
-  rhs[*cnt_row] = atof(start_str);
+  rhs[*cnt_row] = CoinReadDouble(start_str);
 
   switch(read_sense) {
   case 0: rowlow[*cnt_row] = -inf; rowup[*cnt_row] = rhs[*cnt_row];
@@ -1696,14 +1805,22 @@ CoinLpIO::readLp(const char *filename, const double epsilon)
 void
 CoinLpIO::readLp(const char *filename)
 {
-  FILE *fp = fopen(filename, "r");
-  if(!fp) {
-    char str[8192];
-    sprintf(str,"### ERROR: Unable to open file %s for reading\n", filename);
-    throw CoinError(str, "readLp", "CoinLpIO", __FILE__, __LINE__);
+  std::string fname(filename);
+  CoinFileInput *input = NULL;
+  if(fileCoinReadable(fname) && (input = CoinFileInput::create(fname))) {
+    try {
+      readLp(input);
+    }
+    catch(...) {
+      delete input;
+      throw;
+    }
+    delete input;
+    return;
   }
-  readLp(fp);
-  fclose(fp);
+  char str[8192];
+  sprintf(str,"### ERROR: Unable to open file %s for reading\n", filename);
+  throw CoinError(str, "readLp", "CoinLpIO", __FILE__, __LINE__);
 }
 
 /*************************************************************************/
@@ -1717,6 +1834,22 @@ CoinLpIO::readLp(FILE* fp, const double epsilon)
 /*************************************************************************/
 void
 CoinLpIO::readLp(FILE* fp)
+{
+  CoinLpTokenizer input(fp);
+  readLp(input);
+}
+
+/*************************************************************************/
+void
+CoinLpIO::readLp(CoinFileInput *input)
+{
+  CoinLpTokenizer tokenizer(input);
+  readLp(tokenizer);
+}
+
+/*************************************************************************/
+void
+CoinLpIO::readLp(CoinLpTokenizer &input)
 {
 
   int maxrow = 1000;
@@ -1740,11 +1873,11 @@ CoinLpIO::readLp(FILE* fp)
 
   int i;
 
-  objsense = find_obj(fp);
+  objsense = find_obj(input);
 
   int read_st = 0;
   while(!read_st) {
-    read_st = read_monom_obj(fp, coeff, colNames, &cnt_obj, &objName);
+    read_st = read_monom_obj(input, coeff, colNames, &cnt_obj, &objName);
 
     if(cnt_obj == maxcoeff) {
       realloc_coeff(&coeff, &colNames, &maxcoeff);
@@ -1755,8 +1888,7 @@ CoinLpIO::readLp(FILE* fp)
   cnt_coeff = cnt_obj;
 
   if(read_st == 2) {
-    int x=fscanf(fp, "%s", buff);
-    if (x<=0)
+    if(!input.next(buff))
       throw("bad fscanf");
     size_t lbuff = strlen(buff);
 
@@ -1767,7 +1899,7 @@ CoinLpIO::readLp(FILE* fp)
     }
   }
   
-  scan_next(buff, fp);
+  scan_next(buff, input);
 
   while(!is_keyword(buff)) {
     if(buff[strlen(buff)-1] == ':') {
@@ -1778,17 +1910,17 @@ CoinLpIO::readLp(FILE* fp)
 #endif
 
       rowNames[cnt_row] = CoinStrdup(buff);
-      scan_next(buff, fp);
+      scan_next(buff, input);
     }
     else {
       char rname[15];
       sprintf(rname, "cons%d", cnt_row); 
       rowNames[cnt_row] = CoinStrdup(rname);
     }
-    read_row(fp, buff, 
+    read_row(input, buff, 
 	     &coeff, &colNames, &cnt_coeff, &maxcoeff, rhs, rowlow, rowup, 
 	     &cnt_row, lp_inf);
-    scan_next(buff, fp);
+    scan_next(buff, input);
     start[cnt_row] = cnt_coeff;
 
     if(cnt_row == maxrow) {
@@ -1813,7 +1945,7 @@ CoinLpIO::readLp(FILE* fp)
   char *is_int = reinterpret_cast<char *> (malloc ((maxcol+1) * sizeof(char)));
   int has_int = 0;
 
-  for (i=0; i<maxcol; i++) {
+  for (i=0; i<=maxcol; i++) {
     collow[i] = 0;
     colup[i] = lp_inf;
     is_int[i] = 0;
@@ -1825,7 +1957,7 @@ CoinLpIO::readLp(FILE* fp)
     switch(is_keyword(buff)) {
 
     case 1: /* Bounds section */ 
-      scan_next(buff, fp);
+      scan_next(buff, input);
 
       while(is_keyword(buff) == 0) {
 
@@ -1837,7 +1969,7 @@ CoinLpIO::readLp(FILE* fp)
 	if(buff[0] == '-' || buff[0] == '+') {
 	  mult = (buff[0] == '-') ? -1 : +1;
 	  if(strlen(buff) == 1) {
-	    scan_next(buff, fp);
+	    scan_next(buff, input);
 	    start_str = buff;
 	  }
 	  else {
@@ -1847,7 +1979,7 @@ CoinLpIO::readLp(FILE* fp)
 
 	int scan_sense = 0;
 	if(first_is_number(start_str)) {
-	  bnd1 = mult * atof(start_str);
+	  bnd1 = mult * CoinReadDouble(start_str);
 	  scan_sense = 1;
 	}
 	else {
@@ -1857,14 +1989,14 @@ CoinLpIO::readLp(FILE* fp)
 	  }
 	}
 	if(scan_sense) {
-	  scan_next(buff, fp);
+	  scan_next(buff, input);
 	  read_sense1 = is_sense(buff);
 	  if(read_sense1 < 0) {
 	    char str[8192];
 	    sprintf(str,"### ERROR: Bounds; expect a sense, get: %s\n", buff);
 	    throw CoinError(str, "readLp", "CoinLpIO", __FILE__, __LINE__);
 	  }
-	  scan_next(buff, fp);
+	  scan_next(buff, input);
 	}
 
 	icol = findHash(buff, 1);
@@ -1880,22 +2012,22 @@ CoinLpIO::readLp(FILE* fp)
 	  }
 	}
 
-	scan_next(buff, fp);
+	scan_next(buff, input);
 	if(is_free(buff)) {
 	  collow[icol] = -lp_inf;
-	  scan_next(buff, fp);
+	  scan_next(buff, input);
 	}
        	else {
 	  read_sense2 = is_sense(buff);
 	  if(read_sense2 > -1) {
-	    scan_next(buff, fp);
+	    scan_next(buff, input);
 	    mult = 1;
 	    start_str = buff;
 
 	    if(buff[0] == '-'||buff[0] == '+') {
 	      mult = (buff[0] == '-') ? -1 : +1;
 	      if(strlen(buff) == 1) {
-		scan_next(buff, fp);
+		scan_next(buff, input);
 		start_str = buff;
 	      }
 	      else {
@@ -1903,13 +2035,13 @@ CoinLpIO::readLp(FILE* fp)
 	      }
 	    }
 	    if(first_is_number(start_str)) {
-	      bnd2 = mult * atof(start_str);
-	      scan_next(buff, fp);
+	      bnd2 = mult * CoinReadDouble(start_str);
+	      scan_next(buff, input);
 	    }
 	    else {
 	      if(is_inf(start_str)) {
 		bnd2 = mult * lp_inf;
-		scan_next(buff, fp);
+		scan_next(buff, input);
 	      }
 	      else {
 		char str[8192];
@@ -1970,7 +2102,7 @@ CoinLpIO::readLp(FILE* fp)
 
     case 2: /* Integers/Generals section */
 
-      scan_next(buff, fp);
+      scan_next(buff, input);
     
       while(is_keyword(buff) == 0) {
       
@@ -2000,13 +2132,13 @@ CoinLpIO::readLp(FILE* fp)
 	}
 	is_int[icol] = 1;
 	has_int = 1;
-	scan_next(buff, fp);
+	scan_next(buff, input);
       };
       break;
 
     case 3: /* Binaries section */
   
-      scan_next(buff, fp);
+      scan_next(buff, input);
       
       while(is_keyword(buff) == 0) {
 
@@ -2042,7 +2174,7 @@ CoinLpIO::readLp(FILE* fp)
 	if(colup[icol] > 1) {
 	  colup[icol] = 1;
 	}
-	scan_next(buff, fp);
+	scan_next(buff, input);
       }
       break;
       
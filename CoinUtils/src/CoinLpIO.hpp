@@ -20,6 +20,9 @@
 #include "CoinPackedMatrix.hpp"
 #include "CoinMessage.hpp"
 
+class CoinFileInput;
+class CoinLpTokenizer;
+
 typedef int COINColumnIndex;
 
   /** Class to read and write Lp files 
@@ -445,6 +448,13 @@ public:
   /// flipped to get a minimization problem.  
   void readLp(const char *filename);
 
+  /// Read the data in Lp format from a CoinFileInput (which may be a
+  /// compressed file).  The input is not deleted.
+  /// If the original problem is
+  /// a maximization problem, the objective function is immediadtly 
+  /// flipped to get a minimization problem.  
+  void readLp(CoinFileInput *input);
+
   /// Read the data in Lp format from the file stream, using
   /// the given value for epsilon.
   /// If the original problem is
@@ -638,7 +648,7 @@ protected:
   /// Locate the objective function. 
   /// Return 1 if found the keyword "Minimize" or one of its variants, 
   /// -1 if found keyword "Maximize" or one of its variants.
-  int find_obj(FILE *fp) const;
+  int find_obj(CoinLpTokenizer &input) const;
 
   /// Return an integer indicating if the keyword "subject to" or one
   /// of its variants has been read.
@@ -655,11 +665,11 @@ protected:
   /// Return 0 otherwise.
   int is_comment(const char *buff) const;
 
-  /// Read the file fp until buff contains an end of line
-  void skip_comment(char *buff, FILE *fp) const;
+  /// Skip the rest of the line holding the comment in buff
+  void skip_comment(char *buff, CoinLpTokenizer &input) const;
 
   /// Put in buff the next string that is not part of a comment
-  void scan_next(char *buff, FILE *fp) const;
+  void scan_next(char *buff, CoinLpTokenizer &input) const;
 
   /// Return 1 if buff is the keyword "free" or one of its variants.
   /// Return 0 otherwise.
@@ -687,17 +697,20 @@ protected:
   /// Return 0 otherwise.
   int is_keyword(const char *buff) const;
 
+  /// Read the data in Lp format from a tokenizer.
+  void readLp(CoinLpTokenizer &input);
+
   /// Read a monomial of the objective function.
   /// Return 1 if "subject to" or one of its variants has been read.
-  int read_monom_obj(FILE *fp, double *coeff, char **name, int *cnt, 
+  int read_monom_obj(CoinLpTokenizer &input, double *coeff, char **name, int *cnt, 
 		     char **obj_name);
 
   /// Read a monomial of a constraint.
   /// Return a positive number if the sense of the inequality has been 
   /// read (see method is_sense() for the return code).
   /// Return -1 otherwise.
-  int read_monom_row(FILE *fp, char *start_str, double *coeff, char **name, 
-		     int cnt_coeff) const;
+  int read_monom_row(CoinLpTokenizer &input, char *start_str,
+		     double *coeff, char **name, int cnt_coeff) const;
 
   /// Reallocate vectors related to number of coefficients.
   void realloc_coeff(double **coeff, char ***colNames, int *maxcoeff) const;
@@ -711,7 +724,8 @@ protected:
 		   int *maxcol) const;
 
   /// Read a constraint.
-  void read_row(FILE *fp, char *buff, double **pcoeff, char ***pcolNames, 
+  void read_row(CoinLpTokenizer &input, char *buff,
+		double **pcoeff, char ***pcolNames, 
 		int *cnt_coeff, int *maxcoeff,
 		     double *rhs, double *rowlow, double *rowup, 
 		     int *cnt_row, double inf) const;
@@ -8,7 +8,11 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstddef>
+#include <cstring>
 #include <map>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 
 /* Default constructor. */
@@ -573,17 +577,7 @@ CoinMessageHandler::clone() const
 */
 void CoinMessageHandler::calcPrintStatus (int msglvl, int msgclass)
 {
-  printStatus_ = 0 ;
-  if (logLevels_[0] == -1000) {
-    if (msglvl >= 8 && logLevel_ >= 0) {
-      if ((msglvl&logLevel_) == 0)
-	printStatus_ = 3 ;
-    } else if (logLevel_ < msglvl) {
-      printStatus_ = 3 ;
-    }
-  } else if (logLevels_[msgclass] < msglvl) {
-    printStatus_ = 3;
-  }
+  printStatus_ = printStatusFor(msglvl,msgclass) ;
 }
 
 /*
@@ -599,28 +593,40 @@ CoinMessageHandler::message (int messageNumber,
   }
   // Acquire the new message
   internalNumber_ = messageNumber ;
-  currentMessage_ = *(normalMessages.message_[messageNumber]) ;
+  const CoinOneMessage * newMessage = normalMessages.message_[messageNumber] ;
+  highestNumber_ = CoinMax(highestNumber_,newMessage->externalNumber_);
+  /*
+    Decide whether or not to print before touching the text. Messages
+    dropped by the log level are common in loops, so for those just note
+    what the message was and leave the format alone; the << operators will
+    return at once.
+  */
+  printStatus_ = printStatusFor(newMessage->detail_,normalMessages.class_) ;
+  if (printStatus_) {
+    currentMessage_.externalNumber_ = newMessage->externalNumber_ ;
+    currentMessage_.detail_ = newMessage->detail_ ;
+    currentMessage_.severity_ = newMessage->severity_ ;
+    format_ = NULL ;
+    messageBuffer_[0] = '\0' ;
+    messageOut_ = messageBuffer_ ;
+    return (*this) ;
+  }
+  currentMessage_ = *newMessage ;
   source_ = normalMessages.source_ ;
   format_ = currentMessage_.message_ ;
-  highestNumber_ = CoinMax(highestNumber_,currentMessage_.externalNumber_);
 
   // Initialise the message construction buffer
   messageBuffer_[0] = '\0' ;
   messageOut_ = messageBuffer_ ;
 
-  // Decide whether or not to print (sets printStatus_)
-  calcPrintStatus(currentMessage_.detail_,normalMessages.class_) ;
-
-  // If we're printing, initialise the message
-  if (!printStatus_) {
-    if (prefix_) {
-      sprintf(messageOut_,"%s%4.4d%c ",source_.c_str(),
-	      currentMessage_.externalNumber_,
-	      currentMessage_.severity_) ;
-      messageOut_ += strlen(messageOut_) ;
-    }
-    format_ = nextPerCent(format_,true) ;
+  // Initialise the message
+  if (prefix_) {
+    sprintf(messageOut_,"%s%4.4d%c ",source_.c_str(),
+	    currentMessage_.externalNumber_,
+	    currentMessage_.severity_) ;
+    messageOut_ += strlen(messageOut_) ;
   }
+  format_ = nextPerCent(format_,true) ;
   return (*this) ;
 }
 /*
@@ -772,12 +778,13 @@ CoinMessageHandler::nextPerCent(char * start , const bool initial)
   } 
   return start;
 }
-// Adds into message
-CoinMessageHandler & 
-CoinMessageHandler::operator<< (int intvalue)
+/*
+  Add a value to a message which prints. The inline << operators skip
+  messages dropped by the log level (printStatus_ == 3).
+*/
+void
+CoinMessageHandler::addValue (int intvalue)
 {
-  if (printStatus_==3)
-    return *this; // not doing this message
   longValue_.push_back(intvalue);
   if (printStatus_<2) {
     if (format_) {
@@ -795,13 +802,10 @@ CoinMessageHandler::operator<< (int intvalue)
       messageOut_+=strlen(messageOut_);
     } 
   }
-  return *this;
 }
-CoinMessageHandler & 
-CoinMessageHandler::operator<< (double doublevalue)
+void
+CoinMessageHandler::addValue (double doublevalue)
 {
-  if (printStatus_==3)
-    return *this; // not doing this message
   doubleValue_.push_back(doublevalue);
 
   if (printStatus_<2) {
@@ -833,14 +837,11 @@ CoinMessageHandler::operator<< (double doublevalue)
       messageOut_+=strlen(messageOut_);
     } 
   }
-  return *this;
 }
 #if COIN_BIG_INDEX==1
-CoinMessageHandler & 
-CoinMessageHandler::operator<< (long longvalue)
+void
+CoinMessageHandler::addValue (long longvalue)
 {
-  if (printStatus_==3)
-    return *this; // not doing this message
   longValue_.push_back(longvalue);
   if (printStatus_<2) {
     if (format_) {
@@ -858,15 +859,12 @@ CoinMessageHandler::operator<< (long longvalue)
       messageOut_+=strlen(messageOut_);
     } 
   }
-  return *this;
 }
 #endif
 #if COIN_BIG_INDEX==2
-CoinMessageHandler & 
-CoinMessageHandler::operator<< (long long longvalue)
+void
+CoinMessageHandler::addValue (long long longvalue)
 {
-  if (printStatus_==3)
-    return *this; // not doing this message
   longValue_.push_back(longvalue);
   if (printStatus_<2) {
     if (format_) {
@@ -884,14 +882,11 @@ CoinMessageHandler::operator<< (long long longvalue)
       messageOut_+=strlen(messageOut_);
     } 
   }
-  return *this;
 }
 #endif
-CoinMessageHandler & 
-CoinMessageHandler::operator<< (const std::string& stringvalue)
+void
+CoinMessageHandler::addValue (const std::string& stringvalue)
 {
-  if (printStatus_==3)
-    return *this; // not doing this message
   stringValue_.push_back(stringvalue);
   if (printStatus_<2) {
     if (format_) {
@@ -909,13 +904,10 @@ CoinMessageHandler::operator<< (const std::string& stringvalue)
       messageOut_+=strlen(messageOut_);
     } 
   }
-  return *this;
 }
-CoinMessageHandler & 
-CoinMessageHandler::operator<< (char charvalue)
+void
+CoinMessageHandler::addValue (char charvalue)
 {
-  if (printStatus_==3)
-    return *this; // not doing this message
   charValue_.push_back(charvalue);
   if (printStatus_<2) {
     if (format_) {
@@ -933,13 +925,10 @@ CoinMessageHandler::operator<< (char charvalue)
       messageOut_+=strlen(messageOut_);
     } 
   }
-  return *this;
 }
-CoinMessageHandler & 
-CoinMessageHandler::operator<< (const char *stringvalue)
+void
+CoinMessageHandler::addValue (const char *stringvalue)
 {
-  if (printStatus_==3)
-    return *this; // not doing this message
   stringValue_.push_back(stringvalue);
   if (printStatus_<2) {
     if (format_) {
@@ -957,7 +946,6 @@ CoinMessageHandler::operator<< (const char *stringvalue)
       messageOut_+=strlen(messageOut_);
     } 
   }
-  return *this;
 }
 
 /*
@@ -982,3 +970,236 @@ CoinMessageHandler::operator<< (CoinMessageMarker marker)
   }
   return (*this) ;
 }
+
+/*
+  Atomic operations for CoinMessageRing. The ring is the bounded queue of
+  D. Vyukov: each slot carries a sequence number which says whether it is
+  waiting to be filled or emptied on the current lap, so a thread claims a
+  slot by advancing the push (or pop) position with a compare and swap and
+  then owns the slot until it publishes the new sequence number.
+
+  Positions grow without bound and are compared through their difference,
+  which is done in unsigned arithmetic so that wrapping is harmless.
+*/
+#if defined(_MSC_VER)
+#pragma intrinsic(_InterlockedCompareExchange, _InterlockedIncrement)
+// Visual C++ gives volatile loads acquire and stores release semantics
+static inline long coinLoadAcquire (volatile long * p)
+{ return *p ; }
+static inline void coinStoreRelease (volatile long * p, long value)
+{ *p = value ; }
+static inline bool coinCompareAndSwap (volatile long * p, long & expected,
+				       long desired)
+{
+  long old = _InterlockedCompareExchange(p,desired,expected) ;
+  if (old == expected)
+    return true ;
+  expected = old ;
+  return false ;
+}
+static inline void coinIncrement (volatile long * p)
+{ _InterlockedIncrement(p) ; }
+#elif defined(__ATOMIC_ACQUIRE)
+static inline long coinLoadAcquire (volatile long * p)
+{ return __atomic_load_n(p,__ATOMIC_ACQUIRE) ; }
+static inline void coinStoreRelease (volatile long * p, long value)
+{ __atomic_store_n(p,value,__ATOMIC_RELEASE) ; }
+static inline bool coinCompareAndSwap (volatile long * p, long & expected,
+				       long desired)
+{
+  return __atomic_compare_exchange_n(p,&expected,desired,false,
+				     __ATOMIC_ACQ_REL,__ATOMIC_ACQUIRE) ;
+}
+static inline void coinIncrement (volatile long * p)
+{ __atomic_fetch_add(p,1,__ATOMIC_RELAXED) ; }
+#elif defined(__GNUC__)
+static inline long coinLoadAcquire (volatile long * p)
+{ return __sync_fetch_and_add(p,0) ; }
+static inline void coinStoreRelease (volatile long * p, long value)
+{ __sync_synchronize() ; *p = value ; }
+static inline bool coinCompareAndSwap (volatile long * p, long & expected,
+				       long desired)
+{
+  long old = __sync_val_compare_and_swap(p,expected,desired) ;
+  if (old == expected)
+    return true ;
+  expected = old ;
+  return false ;
+}
+static inline void coinIncrement (volatile long * p)
+{ __sync_fetch_and_add(p,1) ; }
+#else
+// No atomics known - single thread only
+static inline long coinLoadAcquire (volatile long * p)
+{ return *p ; }
+static inline void coinStoreRelease (volatile long * p, long value)
+{ *p = value ; }
+static inline bool coinCompareAndSwap (volatile long * p, long & expected,
+				       long desired)
+{
+  if (*p == expected) {
+    *p = desired ;
+    return true ;
+  }
+  expected = *p ;
+  return false ;
+}
+static inline void coinIncrement (volatile long * p)
+{ (*p)++ ; }
+#endif
+
+// a+b and a-b, wrapping
+static inline long coinWrapAdd (long a, unsigned long b)
+{ return static_cast<long>(static_cast<unsigned long>(a)+b) ; }
+static inline long coinWrapDifference (long a, long b)
+{
+  return static_cast<long>(static_cast<unsigned long>(a)-
+			   static_cast<unsigned long>(b)) ;
+}
+
+CoinMessageRing::CoinMessageRing (int capacity)
+  : slots_(NULL),
+    mask_(0),
+    pushPosition_(0),
+    popPosition_(0),
+    dropped_(0)
+{
+  int size = 1 ;
+  while (size < capacity && size < (1<<30))
+    size <<= 1 ;
+  mask_ = size-1 ;
+  slots_ = new Slot [size] ;
+  for (int i = 0 ; i < size ; i++)
+    slots_[i].sequence = i ;
+}
+
+CoinMessageRing::~CoinMessageRing ()
+{
+  delete [] slots_ ;
+}
+
+bool
+CoinMessageRing::push (const char * text, int externalNumber, char severity)
+{
+  long position = coinLoadAcquire(&pushPosition_) ;
+  Slot * slot ;
+  while (true) {
+    slot = slots_+(position&mask_) ;
+    long difference =
+      coinWrapDifference(coinLoadAcquire(&slot->sequence),position) ;
+    if (!difference) {
+      // free on this lap - claim it
+      if (coinCompareAndSwap(&pushPosition_,position,
+			     coinWrapAdd(position,1)))
+	break ;
+    } else if (difference < 0) {
+      // not yet emptied on the previous lap - full
+      coinIncrement(&dropped_) ;
+      return false ;
+    } else {
+      // another thread got there first
+      position = coinLoadAcquire(&pushPosition_) ;
+    }
+  }
+  size_t length = strlen(text) ;
+  if (length >= COIN_MESSAGE_HANDLER_MAX_BUFFER_SIZE)
+    length = COIN_MESSAGE_HANDLER_MAX_BUFFER_SIZE-1 ;
+  memcpy(slot->text,text,length) ;
+  slot->text[length] = '\0' ;
+  slot->externalNumber = externalNumber ;
+  slot->severity = severity ;
+  coinStoreRelease(&slot->sequence,coinWrapAdd(position,1)) ;
+  return true ;
+}
+
+bool
+CoinMessageRing::pop (char * text, int * externalNumber, char * severity)
+{
+  long position = coinLoadAcquire(&popPosition_) ;
+  Slot * slot ;
+  while (true) {
+    slot = slots_+(position&mask_) ;
+    long difference =
+      coinWrapDifference(coinLoadAcquire(&slot->sequence),
+			 coinWrapAdd(position,1)) ;
+    if (!difference) {
+      // filled on this lap - claim it
+      if (coinCompareAndSwap(&popPosition_,position,
+			     coinWrapAdd(position,1)))
+	break ;
+    } else if (difference < 0) {
+      // empty
+      return false ;
+    } else {
+      position = coinLoadAcquire(&popPosition_) ;
+    }
+  }
+  strcpy(text,slot->text) ;
+  if (externalNumber)
+    *externalNumber = slot->externalNumber ;
+  if (severity)
+    *severity = slot->severity ;
+  // free for the next lap
+  coinStoreRelease(&slot->sequence,coinWrapAdd(position,mask_+1)) ;
+  return true ;
+}
+
+int
+CoinMessageRing::flush (FILE * fp)
+{
+  char text[COIN_MESSAGE_HANDLER_MAX_BUFFER_SIZE] ;
+  int number = 0 ;
+  while (pop(text)) {
+    fprintf(fp,"%s\n",text) ;
+    number++ ;
+  }
+  return number ;
+}
+
+int
+CoinMessageRing::numberDropped () const
+{
+  return static_cast<int>(coinLoadAcquire(const_cast<volatile long *>
+					  (&dropped_))) ;
+}
+
+CoinRingMessageHandler::CoinRingMessageHandler (CoinMessageRing * ring)
+  : CoinMessageHandler(),
+    ring_(ring)
+{
+}
+
+CoinRingMessageHandler::~CoinRingMessageHandler ()
+{
+}
+
+CoinRingMessageHandler::CoinRingMessageHandler
+  (const CoinRingMessageHandler & rhs)
+  : CoinMessageHandler(rhs),
+    ring_(rhs.ring_)
+{
+}
+
+CoinRingMessageHandler &
+CoinRingMessageHandler::operator= (const CoinRingMessageHandler & rhs)
+{
+  if (this != &rhs) {
+    CoinMessageHandler::operator=(rhs) ;
+    ring_ = rhs.ring_ ;
+  }
+  return *this ;
+}
+
+CoinMessageHandler *
+CoinRingMessageHandler::clone () const
+{
+  return new CoinRingMessageHandler(*this) ;
+}
+
+int
+CoinRingMessageHandler::print ()
+{
+  ring_->push(messageBuffer_,currentMessage_.externalNumber(),
+	      currentMessage_.severity()) ;
+  return 0 ;
+}
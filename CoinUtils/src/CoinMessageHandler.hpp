@@ -451,10 +451,11 @@ public:
   inline int numberStringFields() const
   {return static_cast<int>(stringValue_.size());}
 
-  /// Current message
+  /** Current message.  If the log level drops a message, only its
+      number, detail and severity are set; the text is not copied. */
   inline CoinOneMessage  currentMessage() const
   {return currentMessage_;}
-  /// Source of current message
+  /// Source of current message (last message which printed)
   inline std::string currentSource() const
   {return source_;}
   /// Output buffer
@@ -482,6 +483,18 @@ public:
   CoinMessageHandler &message(int messageNumber,
 			      const CoinMessages &messages) ;
 
+  /*! \brief Whether message \p messageNumber of \p messages would print
+
+    Callers which compute expensive arguments for a message can test this
+    first.  Nothing is needed for cheap arguments: when the log level drops
+    a message, message() just records the message number and the <<
+    operators return at once, with no formatting and no copy of the text.
+  */
+  inline bool wouldPrint(int messageNumber,
+			 const CoinMessages &messages) const
+  { return printStatusFor(messages.message_[messageNumber]->detail_,
+			  messages.class_) == 0 ; }
+
   /*! \brief Start or continue a message
 
     With detail = -1 (default), does nothing except return a reference to the
@@ -517,41 +530,48 @@ public:
 
     The default format code is `%d'.
   */
-  CoinMessageHandler & operator<< (int intvalue);
+  inline CoinMessageHandler & operator<< (int intvalue)
+  { if (printStatus_ != 3) addValue(intvalue); return *this; }
 #if COIN_BIG_INDEX==1
   /*! \brief Process a long integer parameter value.
 
     The default format code is `%ld'.
   */
-  CoinMessageHandler & operator<< (long longvalue);
+  inline CoinMessageHandler & operator<< (long longvalue)
+  { if (printStatus_ != 3) addValue(longvalue); return *this; }
 #endif
 #if COIN_BIG_INDEX==2
   /*! \brief Process a long long integer parameter value.
 
     The default format code is `%ld'.
   */
-  CoinMessageHandler & operator<< (long long longvalue);
+  inline CoinMessageHandler & operator<< (long long longvalue)
+  { if (printStatus_ != 3) addValue(longvalue); return *this; }
 #endif
   /*! \brief Process a double parameter value.
 
     The default format code is `%d'.
   */
-  CoinMessageHandler & operator<< (double doublevalue);
+  inline CoinMessageHandler & operator<< (double doublevalue)
+  { if (printStatus_ != 3) addValue(doublevalue); return *this; }
   /*! \brief Process a STL string parameter value.
 
     The default format code is `%g'.
   */
-  CoinMessageHandler & operator<< (const std::string& stringvalue);
+  inline CoinMessageHandler & operator<< (const std::string& stringvalue)
+  { if (printStatus_ != 3) addValue(stringvalue); return *this; }
   /*! \brief Process a char parameter value.
 
     The default format code is `%s'.
   */
-  CoinMessageHandler & operator<< (char charvalue);
+  inline CoinMessageHandler & operator<< (char charvalue)
+  { if (printStatus_ != 3) addValue(charvalue); return *this; }
   /*! \brief Process a C-style string parameter value.
 
     The default format code is `%c'.
   */
-  CoinMessageHandler & operator<< (const char *stringvalue);
+  inline CoinMessageHandler & operator<< (const char *stringvalue)
+  { if (printStatus_ != 3) addValue(stringvalue); return *this; }
   /*! \brief Process a marker.
 
     The default format code is `%s'.
@@ -650,10 +670,169 @@ private:
 
   /// Decide if this message should print.
   void calcPrintStatus(int msglvl, int msgclass) ;
+
+  /// Print status (0 or 3) for a message of level msglvl and class msgclass
+  inline int printStatusFor(int msglvl, int msgclass) const
+  {
+    if (logLevels_[0] == -1000) {
+      if (msglvl >= 8 && logLevel_ >= 0)
+	return (msglvl&logLevel_) ? 0 : 3 ;
+      else
+	return (logLevel_ < msglvl) ? 3 : 0 ;
+    } else {
+      return (logLevels_[msgclass] < msglvl) ? 3 : 0 ;
+    }
+  }
+
+  /**@name Bodies of the << operators (message is being printed) */
+  //@{
+  void addValue(int intvalue) ;
+#if COIN_BIG_INDEX==1
+  void addValue(long longvalue) ;
+#endif
+#if COIN_BIG_INDEX==2
+  void addValue(long long longvalue) ;
+#endif
+  void addValue(double doublevalue) ;
+  void addValue(const std::string& stringvalue) ;
+  void addValue(char charvalue) ;
+  void addValue(const char *stringvalue) ;
+  //@}
     
 
 };
 
+//#############################################################################
+/** Bounded queue of finished messages
+
+    Worker threads which share one CoinMessageHandler have to serialise
+    every message.  A CoinMessageRing lets each thread have its own handler
+    (a CoinRingMessageHandler) which hands finished messages to the ring,
+    while one thread empties the ring with flush() or pop().  The ring is
+    lock free: push() and pop() claim a slot with a compare and swap and
+    never wait for another thread.  Any number of threads may push and pop.
+
+    The ring has a fixed number of slots, each holding up to
+    COIN_MESSAGE_HANDLER_MAX_BUFFER_SIZE characters.  When it is full
+    push() drops the message and counts it rather than block the worker;
+    see numberDropped().
+
+    The atomic operations are those of gcc (and compatible compilers) and
+    Visual C++.  With other compilers the ring is only safe for use from a
+    single thread.
+*/
+class CoinMessageRing {
+
+public:
+  /**@name Constructors etc */
+  //@{
+  /** Constructor.  Capacity is rounded up to a power of two. */
+  CoinMessageRing(int capacity = 1024);
+  /// Destructor
+  ~CoinMessageRing();
+  //@}
+
+  /**@name Adding and taking messages */
+  //@{
+  /** Add a message.  Returns false (and counts the message as dropped)
+      if the ring is full.  Text longer than the slot is truncated. */
+  bool push(const char * text, int externalNumber = 0, char severity = 'I');
+  /** Take the oldest message.  text must have room for
+      COIN_MESSAGE_HANDLER_MAX_BUFFER_SIZE characters.  Returns false if
+      the ring is empty. */
+  bool pop(char * text, int * externalNumber = NULL, char * severity = NULL);
+  /** Take all messages and print them, one per line, to fp.  Returns
+      the number printed. */
+  int flush(FILE * fp = stdout);
+  //@}
+
+  /**@name Get methods */
+  //@{
+  /// Number of slots
+  inline int capacity() const
+  { return mask_+1; }
+  /// Number of messages dropped because the ring was full
+  int numberDropped() const;
+  //@}
+
+private:
+  /// Not implemented
+  CoinMessageRing(const CoinMessageRing &);
+  /// Not implemented
+  CoinMessageRing & operator=(const CoinMessageRing &);
+
+  /// A slot; sequence says whether it is free or full (and for which lap)
+  struct Slot {
+    volatile long sequence;
+    int externalNumber;
+    char severity;
+    char text[COIN_MESSAGE_HANDLER_MAX_BUFFER_SIZE];
+  };
+
+  /**@name Private member data */
+  //@{
+  /// Slots
+  Slot * slots_;
+  /// Number of slots less one
+  int mask_;
+  /// Position of next push (kept apart from popPosition_ to avoid sharing
+  /// a cache line)
+  volatile long pushPosition_;
+  char padding1_[64];
+  /// Position of next pop
+  volatile long popPosition_;
+  char padding2_[64];
+  /// Messages dropped
+  volatile long dropped_;
+  //@}
+};
+
+/** Message handler which sends finished messages to a CoinMessageRing
+
+    Everything up to print() is as in CoinMessageHandler (log levels,
+    prefixes, formatting); print() pushes the message into the ring
+    instead of writing it.  The ring is not owned.  Give each thread its own
+    handler (clone() shares the ring) and empty the ring from one thread,
+    for example
+    \code
+    CoinMessageRing ring;
+    CoinRingMessageHandler handler(&ring);
+    // each worker: CoinMessageHandler * mine = handler.clone(); ...
+    ring.flush(stdout);
+    \endcode
+*/
+class CoinRingMessageHandler : public CoinMessageHandler {
+
+public:
+  /**@name Constructors etc */
+  //@{
+  /// Constructor
+  CoinRingMessageHandler(CoinMessageRing * ring);
+  /// Destructor
+  virtual ~CoinRingMessageHandler();
+  /// The copy constructor (shares the ring)
+  CoinRingMessageHandler(const CoinRingMessageHandler &);
+  /// Assignment operator (shares the ring)
+  CoinRingMessageHandler & operator=(const CoinRingMessageHandler &);
+  /// Clone (shares the ring)
+  virtual CoinMessageHandler * clone() const;
+  //@}
+
+  /**@name Overrides */
+  //@{
+  /// Push the message into the ring
+  virtual int print();
+  //@}
+
+  /// The ring
+  inline CoinMessageRing * ring() const
+  { return ring_; }
+
+private:
+  /// The ring (not owned)
+  CoinMessageRing * ring_;
+};
+
 //#############################################################################
 /** A function that tests the methods in the CoinMessageHandler class. The
     only reason for it not to be a member method is that this way it doesn't
@@ -3775,6 +3775,17 @@ CoinModel::passInMatrix(const CoinPackedMatrix & matrix)
   type_=3;
   packedMatrix_ = new CoinPackedMatrix(matrix);
 }
+// Take over contents of CoinPackedMatrix (and switch off element updates)
+void 
+CoinModel::assignMatrix(CoinPackedMatrix & matrix)
+{
+  type_=3;
+  if (!packedMatrix_)
+    packedMatrix_ = new CoinPackedMatrix();
+  packedMatrix_->swap(matrix);
+  numberElements_ = packedMatrix_->getNumElements();
+  maximumElements_ = numberElements_;
+}
 // Convert elements to CoinPackedMatrix (and switch off element updates)
 int 
 CoinModel::convertMatrix()
@@ -416,6 +416,9 @@ public:
    //@{
   /// Pass in CoinPackedMatrix (and switch off element updates)
   void passInMatrix(const CoinPackedMatrix & matrix);
+  /** Take over contents of CoinPackedMatrix (and switch off element
+      updates).  matrix is left empty. */
+  void assignMatrix(CoinPackedMatrix & matrix);
   /** Convert elements to CoinPackedMatrix (and switch off element updates).
       Returns number of errors */
   int convertMatrix();
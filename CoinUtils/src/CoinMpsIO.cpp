@@ -23,20 +23,18 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinModel.hpp"
 #include "CoinSort.hpp"
+#include "CoinDoubleFormat.hpp"
 
 //#############################################################################
 // type - 0 normal, 1 INTEL IEEE, 2 other IEEE
 
 namespace {
 
-  const double fraction[]=
-  {1.0,1.0e-1,1.0e-2,1.0e-3,1.0e-4,1.0e-5,1.0e-6,1.0e-7,1.0e-8,
-   1.0e-9,1.0e-10,1.0e-11,1.0e-12,1.0e-13,1.0e-14,1.0e-15,1.0e-16,
-   1.0e-17,1.0e-18,1.0e-19,1.0e-20,1.0e-21,1.0e-22,1.0e-23};
-
-  const double exponent[]=
-  {1.0e-9,1.0e-8,1.0e-7,1.0e-6,1.0e-5,1.0e-4,1.0e-3,1.0e-2,1.0e-1,
-   1.0,1.0e1,1.0e2,1.0e3,1.0e4,1.0e5,1.0e6,1.0e7,1.0e8,1.0e9};
+  // exact in IEEE double
+  const double powerOfTen[]=
+  {1.0,1.0e1,1.0e2,1.0e3,1.0e4,1.0e5,1.0e6,1.0e7,1.0e8,1.0e9,1.0e10,
+   1.0e11,1.0e12,1.0e13,1.0e14,1.0e15,1.0e16,1.0e17,1.0e18,1.0e19,1.0e20,
+   1.0e21,1.0e22};
 
 } // end file-local namespace
 double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type) 
@@ -60,6 +58,14 @@ double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type)
     // more white space
     while (*ptr==' '||*ptr=='\t')
       ptr++;
+    const char * start = ptr;
+    /*
+      Digits go into one integer mantissa.  If that is exact and the power
+      of ten is small, a single multiplication or division is correctly
+      rounded; otherwise the number is read again by CoinReadDouble.
+    */
+    int power = 0;
+    bool exact = true;
     char thisChar=0;
     while (value<1.0e30) {
       thisChar = *ptr;
@@ -72,20 +78,19 @@ double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type)
     if (value<1.0e30) {
       if (thisChar=='.') {
 	// do fraction
-	double value2 = 0.0;
 	int nfrac=0;
 	while (nfrac<24) {
 	  thisChar = *ptr;
 	  ptr++;
 	  if (thisChar>='0'&&thisChar<='9') {
-	    value2 = value2*10.0+thisChar-'0';
+	    value = value*10.0+thisChar-'0';
 	    nfrac++;
 	  } else {
 	    break;
 	  }
 	}
 	if (nfrac<24) {
-	  value += value2*fraction[nfrac];
+	  power = -nfrac;
 	} else {
 	  thisChar='x'; // force error
 	}
@@ -111,21 +116,31 @@ double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type)
 	  }
 	}
 	if (value3<300) {
-	  value3 *= sign2; // power of 10
-	  if (abs(value3)<10) {
-	    // do most common by lookup (for accuracy?)
-	    value *= exponent[value3+9];
-	  } else {
-	    value *= pow(10.0,value3);
-	  }
+	  power += value3*sign2; // power of 10
 	} else if (sign2<0.0) {
 	  value = 0.0; // force zero
+	  power = 0;
 	} else {
 	  value = COIN_DBL_MAX;
+	  power = 0;
 	}
       } 
+      if (power) {
+	if (value<9007199254740992.0&&power>=-22&&power<=22) {
+	  if (power<0)
+	    value /= powerOfTen[-power];
+	  else
+	    value *= powerOfTen[power];
+	} else {
+	  exact = false;
+	}
+      } else if (value>=9007199254740992.0&&value<COIN_DBL_MAX) {
+	exact = false;
+      }
       if (thisChar==0||thisChar=='\t'||thisChar==' ') {
-	// okay
+	// okay - if not exact redo value so that it is correctly rounded
+	if (!exact)
+	  value = CoinReadDouble(start);
 	*output=ptr;
       } else {
 	value = osi_strtod(save,output);
@@ -1184,35 +1199,71 @@ CoinMpsCardReader::nextGmsField ( int expectedType )
 
 //#############################################################################
 
+/* Storage for names.  Reading a large model used to allocate every name
+   on its own; here names are copied one after another into blocks which
+   grow up to a megabyte, so pointers to them stay valid until clear(). */
+class CoinMpsNameArena {
+public:
+  CoinMpsNameArena()
+    : used_(0), size_(0) {}
+  ~CoinMpsNameArena()
+  { clear();}
+  char * add(const char * name)
+  {
+    size_t length = strlen(name) + 1;
+    if (used_ + length > size_) {
+      size_t size = size_ ? CoinMin(2 * size_, static_cast<size_t>(1 << 20))
+	: 4096;
+      size = CoinMax(size, length);
+      blocks_.push_back(reinterpret_cast<char *> (malloc(size)));
+      used_ = 0;
+      size_ = size;
+    }
+    char * put = blocks_.back() + used_;
+    memcpy(put, name, length);
+    used_ += length;
+    return put;
+  }
+  void clear()
+  {
+    for (size_t i = 0; i < blocks_.size(); i++)
+      free(blocks_[i]);
+    blocks_.clear();
+    used_ = 0;
+    size_ = 0;
+  }
+private:
+  CoinMpsNameArena(const CoinMpsNameArena &);
+  CoinMpsNameArena & operator=(const CoinMpsNameArena &);
+  /// Blocks, the last one being filled
+  std::vector<char *> blocks_;
+  /// Bytes used and size of last block
+  size_t used_;
+  size_t size_;
+};
+
 namespace {
-const int mmult[] = {
-    262139, 259459, 256889, 254291, 251701, 249133, 246709, 244247,
-    241667, 239179, 236609, 233983, 231289, 228859, 226357, 223829,
-    221281, 218849, 216319, 213721, 211093, 208673, 206263, 203773,
-    201233, 198637, 196159, 193603, 191161, 188701, 186149, 183761,
-    181303, 178873, 176389, 173897, 171469, 169049, 166471, 163871,
-    161387, 158941, 156437, 153949, 151531, 149159, 146749, 144299,
-    141709, 139369, 136889, 134591, 132169, 129641, 127343, 124853,
-    122477, 120163, 117757, 115361, 112979, 110567, 108179, 105727,
-    103387, 101021, 98639, 96179, 93911, 91583, 89317, 86939, 84521,
-    82183, 79939, 77587, 75307, 72959, 70793, 68447, 66103
-  };
-
-int hash ( const char *name, int maxsiz, int length )
+// FNV-1a
+unsigned int hash ( const char *name )
 {
-  
-  int n = 0;
-  int j;
-
-  for ( j = 0; j < length; ++j ) {
-    int iname = name[j];
+  unsigned int n = 2166136261u;
 
-    n += mmult[j] * iname;
+  for ( ; *name; ++name ) {
+    n ^= static_cast<unsigned char>(*name);
+    n *= 16777619u;
   }
-  return ( abs ( n ) % maxsiz );	/* integer abs */
+  return n;
 }
 } // end file-local namespace
 
+char *
+CoinMpsIO::addName ( int section, const char * name )
+{
+  if (!nameArena_[section])
+    nameArena_[section] = new CoinMpsNameArena();
+  return nameArena_[section]->add(name);
+}
+
 // Define below if you are reading a Cnnnnnn file 
 // Will not do row names (for electricfence)
 //#define NONAMES
@@ -1231,82 +1282,46 @@ CoinMpsIO::startHash ( int section ) const
   char ** names = names_[section];
   COINColumnIndex number = numberHash_[section];
   COINColumnIndex i;
-  COINColumnIndex maxhash = 4 * number;
-  COINColumnIndex ipos, iput;
-
-  //hash_=(CoinHashLink *) malloc(maxhash*sizeof(CoinHashLink));
-  hash_[section] = new CoinHashLink[maxhash];
-  
-  CoinHashLink * hashThis = hash_[section];
+  // at most half full, so probe sequences stay short
+  int size = 2;
+  while ( size < 2 * number )
+    size *= 2;
+  int mask = size - 1;
 
-  for ( i = 0; i < maxhash; i++ ) {
-    hashThis[i].index = -1;
-    hashThis[i].next = -1;
-  }
+  delete [] hash_[section];
+  delete [] nameHash_[section];
+  hash_[section] = new int[size];
+  hashSize_[section] = size;
+  nameHash_[section] = new unsigned int[CoinMax(number,1)];
 
-  /*
-   * Initialize the hash table.  Only the index of the first name that
-   * hashes to a value is entered in the table; subsequent names that
-   * collide with it are not entered.
-   */
-  for ( i = 0; i < number; ++i ) {
-    char *thisName = names[i];
-    int length = static_cast<int>(strlen(thisName));
+  int * hashThis = hash_[section];
+  unsigned int * nameHash = nameHash_[section];
 
-    ipos = hash ( thisName, maxhash, length );
-    if ( hashThis[ipos].index == -1 ) {
-      hashThis[ipos].index = i;
-    }
-  }
+  for ( i = 0; i < size; i++ )
+    hashThis[i] = -1;
 
   /*
-   * Now take care of the names that collided in the preceding loop,
-   * by finding some other entry in the table for them.
-   * Since there are as many entries in the table as there are names,
-   * there must be room for them.
+   * Linear probing from the hash value.  Full hash values are compared
+   * before names, so a probe rarely touches a name that does not match.
+   * Only the first of duplicate names is entered.
    */
-  iput = -1;
   for ( i = 0; i < number; ++i ) {
     char *thisName = names[i];
-    int length = static_cast<int>(strlen(thisName));
+    unsigned int value = hash ( thisName );
+    int ipos = static_cast<int>(value & mask);
 
-    ipos = hash ( thisName, maxhash, length );
+    nameHash[i] = value;
+    while ( hashThis[ipos] >= 0 ) {
+      COINColumnIndex j1 = hashThis[ipos];
 
-    while ( 1 ) {
-      COINColumnIndex j1 = hashThis[ipos].index;
-
-      if ( j1 == i )
+      if ( nameHash[j1] == value && strcmp ( thisName, names[j1] ) == 0 ) {
+	printf ( "** duplicate name %s\n", names[i] );
 	break;
-      else {
-	char *thisName2 = names[j1];
-
-	if ( strcmp ( thisName, thisName2 ) == 0 ) {
-	  printf ( "** duplicate name %s\n", names[i] );
-	  break;
-	} else {
-	  COINColumnIndex k = hashThis[ipos].next;
-
-	  if ( k == -1 ) {
-	    while ( 1 ) {
-	      ++iput;
-	      if ( iput > number ) {
-		printf ( "** too many names\n" );
-		break;
-	      }
-	      if ( hashThis[iput].index == -1 ) {
-		break;
-	      }
-	    }
-	    hashThis[ipos].next = iput;
-	    hashThis[iput].index = i;
-	    break;
-	  } else {
-	    ipos = k;
-	    /* nothing worked - try it again */
-	  }
-	}
       }
+      ipos = ( ipos + 1 ) & mask;
     }
+    if ( hashThis[ipos] < 0 )
+      hashThis[ipos] = i;
   }
 }
 
@@ -1316,48 +1331,35 @@ CoinMpsIO::stopHash ( int section )
 {
   delete [] hash_[section];
   hash_[section] = NULL;
+  delete [] nameHash_[section];
+  nameHash_[section] = NULL;
+  hashSize_[section] = 0;
 }
 
 //  findHash.  -1 not found
 COINColumnIndex
 CoinMpsIO::findHash ( const char *name , int section ) const
 {
-  COINColumnIndex found = -1;
-
   char ** names = names_[section];
-  CoinHashLink * hashThis = hash_[section];
-  COINColumnIndex maxhash = 4 * numberHash_[section];
-  COINColumnIndex ipos;
+  const int * hashThis = hash_[section];
+  const unsigned int * nameHash = nameHash_[section];
 
   /* default if we don't find anything */
-  if ( !maxhash )
+  if ( !numberHash_[section] || !hashThis )
     return -1;
-  int length = static_cast<int>(strlen(name));
+  int mask = hashSize_[section] - 1;
+  unsigned int value = hash ( name );
+  int ipos = static_cast<int>(value & mask);
 
-  ipos = hash ( name, maxhash, length );
   while ( 1 ) {
-    COINColumnIndex j1 = hashThis[ipos].index;
-
-    if ( j1 >= 0 ) {
-      char *thisName2 = names[j1];
+    COINColumnIndex j1 = hashThis[ipos];
 
-      if ( strcmp ( name, thisName2 ) != 0 ) {
-	COINColumnIndex k = hashThis[ipos].next;
-
-	if ( k != -1 )
-	  ipos = k;
-	else
-	  break;
-      } else {
-	found = j1;
-	break;
-      }
-    } else {
-      found = -1;
-      break;
-    }
+    if ( j1 < 0 )
+      return -1;
+    if ( nameHash[j1] == value && strcmp ( name, names[j1] ) == 0 )
+      return j1;
+    ipos = ( ipos + 1 ) & mask;
   }
-  return found;
 }
 #else
 // Version when we know images are C/Rnnnnnn
@@ -1660,6 +1662,9 @@ int CoinMpsIO::readMps(int & numberSets,CoinSet ** &sets)
       handler_->message(COIN_MPS_RETURNING,messages_)<<CoinMessageEol;
       return numberErrors+100000;
     }
+    // names of any previous problem
+    releaseRowNames();
+    releaseColumnNames();
     //use malloc etc as I don't know how to do realloc in C++
     numberRows_ = 0;
     numberColumns_ = 0;
@@ -1693,7 +1698,7 @@ int CoinMpsIO::readMps(int & numberSets,CoinSet ** &sets)
 					      maxFreeRows * sizeof ( char * )));
 	  }
 	  freeRowName[numberOtherFreeRows] =
-	    CoinStrdup ( cardReader_->columnName (  ) );
+	    addName ( 0, cardReader_->columnName (  ) );
 	  numberOtherFreeRows++;
 	}
 	break;
@@ -1711,7 +1716,7 @@ int CoinMpsIO::readMps(int & numberSets,CoinSet ** &sets)
 	}
 	rowType[numberRows_] = cardReader_->mpsType (  );
 #ifndef NONAMES
-	rowName[numberRows_] = CoinStrdup ( cardReader_->columnName (  ) );
+	rowName[numberRows_] = addName ( 0, cardReader_->columnName (  ) );
 #endif
 	numberRows_++;
 	break;
@@ -1749,7 +1754,7 @@ int CoinMpsIO::readMps(int & numberSets,CoinSet ** &sets)
 
 			      numberOtherFreeRows ) * sizeof ( char * )));
 #ifndef NONAMES
-    rowName[numberRows_] = CoinStrdup(objectiveName_);
+    rowName[numberRows_] = addName(0,objectiveName_);
     memcpy ( rowName + numberRows_ + 1, freeRowName,
 	     numberOtherFreeRows * sizeof ( char * ) );
     // now we can get rid of this array
@@ -1832,7 +1837,7 @@ int CoinMpsIO::readMps(int & numberSets,CoinSet ** &sets)
 	    numberIntegers++;
 	  }
 #ifndef NONAMES
-	  columnName[column] = CoinStrdup ( cardReader_->columnName (  ) );
+	  columnName[column] = addName ( 1, cardReader_->columnName (  ) );
 #else
           columnName[column]=NULL;
 #endif
@@ -2865,7 +2870,7 @@ CoinMpsIO::readGMPL(const char * modelName, const char * dataName,
     if (keepNames) {
       strcpy(name,glp_get_row_name(cbc_glp_prob,iRow+1));
       // could look at name?
-      names[kRow]=CoinStrdup(name);
+      names[kRow]=addName(0,name);
     }
     kRow++;
     start[kRow]=numberElements_;
@@ -2945,7 +2950,7 @@ CoinMpsIO::readGMPL(const char * modelName, const char * dataName,
     if (keepNames) {
       strcpy(name,glp_get_col_name(cbc_glp_prob,iColumn+1));
       // could look at name?
-      names[iColumn]=CoinStrdup(name);
+      names[iColumn]=addName(1,name);
     }
   }
   // leave in case report needed
@@ -3104,6 +3109,9 @@ int CoinMpsIO::readGms(int & /*numberSets*/,CoinSet ** &/*sets*/)
     }
   }
 
+  // names of any previous problem
+  releaseRowNames();
+  releaseColumnNames();
   objectiveOffset_ = 0.0;
   rowlower_ = reinterpret_cast<double *> (malloc ( numberRows_ * sizeof ( double )));
   rowupper_ = reinterpret_cast<double *> (malloc ( numberRows_ * sizeof ( double )));
@@ -3145,7 +3153,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/,CoinSet ** &/*sets*/)
     }
     assert (*next==','||*next==';');
     cardReader_->setPosition(next+1);
-    columnName[i]=CoinStrdup(cardReader_->columnName());
+    columnName[i]=addName(1,cardReader_->columnName());
     // Default is free? 
     collower_[i]=-COIN_DBL_MAX;
     // Surely not - check
@@ -3229,7 +3237,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/,CoinSet ** &/*sets*/)
     }
     assert (*next==','||*next==';');
     cardReader_->setPosition(next+1);
-    rowName[i]=CoinStrdup(cardReader_->columnName());
+    rowName[i]=addName(0,cardReader_->columnName());
     // Default is free?
     rowlower_[i]=-COIN_DBL_MAX;
     rowupper_[i]=COIN_DBL_MAX;
@@ -3393,7 +3401,6 @@ int CoinMpsIO::readGms(int & /*numberSets*/,CoinSet ** &/*sets*/)
   } else {
     // move column stuff
     COINColumnIndex iColumn;
-    free(names_[1][iObjCol]);
     for ( iColumn = iObjCol+1; iColumn < numberColumns_; iColumn++ ) {
       integerType_[iColumn-1]=integerType_[iColumn];
       collower_[iColumn-1]=collower_[iColumn];
@@ -3431,7 +3438,6 @@ int CoinMpsIO::readGms(int & /*numberSets*/,CoinSet ** &/*sets*/)
 	start[kRow+1]=nel;
 	kRow++;
       } else {
-	free(names_[0][iRow]);
 	iObjRow = iRow;
 	for (j=last;j<start[iRow+1];j++) {
 	  int iColumn = column[j];
@@ -3676,10 +3682,6 @@ CoinMpsIO::readBasis(const char *filename, const char *extension ,
     free(names_[1]);
     names_[1]=NULL;
     numberHash_[1]=0;
-    delete[] hash_[0];
-    delete[] hash_[1];
-    hash_[0]=0;
-    hash_[1]=0;
   }
   if ( cardReader_->whichSection (  ) != COIN_ENDATA_SECTION) {
     handler_->message(COIN_MPS_BADIMAGE,messages_)<<cardReader_->cardNumber()
@@ -3736,6 +3738,21 @@ convertDouble(int section,int formatType, double value, char outputValue[24],
   convertRowName(formatType,name,outputRow);
   CoinConvertDouble(section,formatType&3,value,outputValue);
 }
+// As sprintf(outputValue,"%12.*f",decimal,value) without going through libc
+static void
+fixedDouble(double value, int decimal, char outputValue[24])
+{
+  char temp[32];
+  int length = CoinFixedDouble(value,decimal,temp);
+  if (length<0) {
+    sprintf(outputValue,"%12.*f",decimal,value);
+  } else if (length<12) {
+    memset(outputValue,' ',12-length);
+    memcpy(outputValue+12-length,temp,length+1);
+  } else {
+    memcpy(outputValue,temp,length+1);
+  }
+}
 // Function to return number in most efficient way
 /* formatType is
    0 - normal and 8 character names
@@ -3754,9 +3771,7 @@ CoinConvertDouble(int section, int formatType, double value, char outputValue[24
 	power10 =static_cast<int> (log10(value));
 	if (power10<9&&power10>-4) {
 	  decimal = CoinMin(10,10-power10);
-	  char format[8];
-	  sprintf(format,"%%12.%df",decimal);
-	  sprintf(outputValue,format,value);
+	  fixedDouble(value,decimal,outputValue);
 	} else {
 	  sprintf(outputValue,"%13.7g",value);
 	  stripZeros=false;
@@ -3765,9 +3780,7 @@ CoinConvertDouble(int section, int formatType, double value, char outputValue[24
 	power10 =static_cast<int> (log10(-value))+1;
 	if (power10<8&&power10>-3) {
 	  decimal = CoinMin(9,9-power10);
-	  char format[8];
-	  sprintf(format,"%%12.%df",decimal);
-	  sprintf(outputValue,format,value);
+	  fixedDouble(value,decimal,outputValue);
 	} else {
 	  sprintf(outputValue,"%13.6g",value);
 	  stripZeros=false;
@@ -3844,16 +3857,8 @@ CoinConvertDouble(int section, int formatType, double value, char outputValue[24
     outputValue[12]='\0';
   } else if (formatType==1) {
     if (fabs(value)<1.0e40) {
-      memset(outputValue,' ',24);
-      sprintf(outputValue,"%.16g",value);
-      // take out blanks
-      int i=0;
-      int j;
-      for (j=0;j<23;j++) {
-	if (outputValue[j]!=' ')
-	  outputValue[i++]=outputValue[j];
-      }
-      outputValue[i]='\0';
+      // shortest string which reads back exactly
+      CoinShortestDouble(value,outputValue);
     } else {
       if (section==2) {
         outputValue[0]= '\0'; // needs no value
@@ -3973,7 +3978,8 @@ static void outputCard(int formatType,int numberFields,
    writeString(output, line.c_str());
 }
 static int
-makeUniqueNames(char ** names,int number,char first)
+makeUniqueNames(char ** names,int number,char first,
+		CoinMpsNameArena * arena)
 {
   int largest=-1;
   int i;
@@ -4023,10 +4029,9 @@ makeUniqueNames(char ** names,int number,char first)
           } else {
             // duplicate
             nDup++;
-            free(names[i]);
             char newName[9];
             sprintf(newName,"%c%7.7d",first,largest);
-            names[i] = CoinStrdup(newName);
+            names[i] = arena->add(newName);
             largest++;
           }
         }
@@ -4100,11 +4105,11 @@ CoinMpsIO::writeMps(const char *filename, int compression,
    bool freeFormat = (formatType==1);
    // Check names for uniqueness if default
    int nChanged;
-   nChanged=makeUniqueNames(names_[0],numberRows_,'R');
+   nChanged=makeUniqueNames(names_[0],numberRows_,'R',nameArena_[0]);
    if (nChanged)
      handler_->message(COIN_MPS_CHANGED,messages_)<<"row"<<nChanged
                                                   <<CoinMessageEol;
-   nChanged=makeUniqueNames(names_[1],numberColumns_,'C');
+   nChanged=makeUniqueNames(names_[1],numberColumns_,'C',nameArena_[1]);
    if (nChanged)
      handler_->message(COIN_MPS_CHANGED,messages_)<<"column"<<nChanged
                                                   <<CoinMessageEol;
@@ -4960,36 +4965,37 @@ CoinMpsIO::setMpsDataColAndRowNames(
    numberHash_[1]=numberColumns_;
    char** rowNames = names_[0];
    char** columnNames = names_[1];
+   char name[9];
    int i;
    if (rownames) {
      for (i = 0 ; i < numberRows_; ++i) {
        if (rownames[i]) {
-         rowNames[i] = CoinStrdup(rownames[i]);
+         rowNames[i] = addName(0,rownames[i]);
        } else {
-         rowNames[i] = reinterpret_cast<char *> (malloc (9 * sizeof(char)));
-         sprintf(rowNames[i],"R%7.7d",i);
+         sprintf(name,"R%7.7d",i);
+         rowNames[i] = addName(0,name);
        }
      }
    } else {
      for (i = 0; i < numberRows_; ++i) {
-       rowNames[i] = reinterpret_cast<char *> (malloc (9 * sizeof(char)));
-       sprintf(rowNames[i],"R%7.7d",i);
+       sprintf(name,"R%7.7d",i);
+       rowNames[i] = addName(0,name);
      }
    }
 #ifndef NONAMES
    if (colnames) {
      for (i = 0 ; i < numberColumns_; ++i) {
        if (colnames[i]) {
-         columnNames[i] = CoinStrdup(colnames[i]);
+         columnNames[i] = addName(1,colnames[i]);
        } else {
-         columnNames[i] = reinterpret_cast<char *> (malloc (9 * sizeof(char)));
-         sprintf(columnNames[i],"C%7.7d",i);
+         sprintf(name,"C%7.7d",i);
+         columnNames[i] = addName(1,name);
        }
      }
    } else {
      for (i = 0; i < numberColumns_; ++i) {
-       columnNames[i] = reinterpret_cast<char *> (malloc (9 * sizeof(char)));
-       sprintf(columnNames[i],"C%7.7d",i);
+       sprintf(name,"C%7.7d",i);
+       columnNames[i] = addName(1,name);
      }
    }
 #else
@@ -4998,8 +5004,8 @@ CoinMpsIO::setMpsDataColAndRowNames(
    const int * lengths = matrix->getVectorLengths();
    int k=0;
    for (i = 0 ; i < numberColumns_; ++i) {
-     columnNames[i] = reinterpret_cast<char *> (malloc (9 * sizeof(char)));
-     sprintf(columnNames[i],"C%7.7d",k);
+     sprintf(name,"C%7.7d",k);
+     columnNames[i] = addName(1,name);
      if (objective[i]||lengths[i])
        k++;
      }
@@ -5011,30 +5017,35 @@ CoinMpsIO::setMpsDataColAndRowNames(
 		      const std::vector<std::string> & colnames,
 		      const std::vector<std::string> & rownames)
 {  
+  releaseRowNames();
+  releaseColumnNames();
    // If long names free format
   names_[0] = reinterpret_cast<char **> (malloc(numberRows_ * sizeof(char *)));
   names_[1] = reinterpret_cast<char **> (malloc (numberColumns_ * sizeof(char *)));
+   numberHash_[0]=numberRows_;
+   numberHash_[1]=numberColumns_;
    char** rowNames = names_[0];
    char** columnNames = names_[1];
+   char name[9];
    int i;
    if (rownames.size()!=0) {
      for (i = 0 ; i < numberRows_; ++i) {
-       rowNames[i] = CoinStrdup(rownames[i].c_str());
+       rowNames[i] = addName(0,rownames[i].c_str());
      }
    } else {
      for (i = 0; i < numberRows_; ++i) {
-       rowNames[i] = reinterpret_cast<char *> (malloc (9 * sizeof(char)));
-       sprintf(rowNames[i],"R%7.7d",i);
+       sprintf(name,"R%7.7d",i);
+       rowNames[i] = addName(0,name);
      }
    }
    if (colnames.size()!=0) {
      for (i = 0 ; i < numberColumns_; ++i) {
-       columnNames[i] = CoinStrdup(colnames[i].c_str());
+       columnNames[i] = addName(1,colnames[i].c_str());
      }
    } else {
      for (i = 0; i < numberColumns_; ++i) {
-       columnNames[i] = reinterpret_cast<char *> (malloc (9 * sizeof(char)));
-       sprintf(columnNames[i],"C%7.7d",i);
+       sprintf(name,"C%7.7d",i);
+       columnNames[i] = addName(1,name);
      }
    }
 }
@@ -5230,25 +5241,21 @@ void CoinMpsIO::releaseIntegerInformation()
 void CoinMpsIO::releaseRowNames()
 {
   releaseRedundantInformation();
-  int i;
-  for (i=0;i<numberHash_[0];i++) {
-    free(names_[0][i]);
-  }
   free(names_[0]);
   names_[0]=NULL;
   numberHash_[0]=0;
+  if (nameArena_[0])
+    nameArena_[0]->clear();
 }
 // Release column names
 void CoinMpsIO::releaseColumnNames()
 {
   releaseRedundantInformation();
-  int i;
-  for (i=0;i<numberHash_[1];i++) {
-    free(names_[1][i]);
-  }
   free(names_[1]);
   names_[1]=NULL;
   numberHash_[1]=0;
+  if (nameArena_[1])
+    nameArena_[1]->clear();
 }
 // Release matrix information
 void CoinMpsIO::releaseMatrixInformation()
@@ -5297,12 +5304,14 @@ maximumStringElements_(0),
 numberStringElements_(0),
 stringElements_(NULL)
 {
-  numberHash_[0]=0;
-  hash_[0]=NULL;
-  names_[0]=NULL;
-  numberHash_[1]=0;
-  hash_[1]=NULL;
-  names_[1]=NULL;
+  for (int section=0;section<2;section++) {
+    numberHash_[section]=0;
+    hash_[section]=NULL;
+    hashSize_[section]=0;
+    nameHash_[section]=NULL;
+    names_[section]=NULL;
+    nameArena_[section]=NULL;
+  }
   handler_ = new CoinMessageHandler();
   messages_ = CoinMessage();
 }
@@ -5343,12 +5352,14 @@ maximumStringElements_(rhs.maximumStringElements_),
 numberStringElements_(rhs.numberStringElements_),
 stringElements_(NULL)
 {
-  numberHash_[0]=0;
-  hash_[0]=NULL;
-  names_[0]=NULL;
-  numberHash_[1]=0;
-  hash_[1]=NULL;
-  names_[1]=NULL;
+  for (int section=0;section<2;section++) {
+    numberHash_[section]=0;
+    hash_[section]=NULL;
+    hashSize_[section]=0;
+    nameHash_[section]=NULL;
+    names_[section]=NULL;
+    nameArena_[section]=NULL;
+  }
   if ( rhs.rowlower_ !=NULL || rhs.collower_ != NULL) {
     gutsOfCopy(rhs);
     // OK and proper to leave rowsense_, rhs_, and
@@ -5417,7 +5428,7 @@ void CoinMpsIO::gutsOfCopy(const CoinMpsIO & rhs)
       char ** names = names_[section];
       int i;
       for (i=0;i<numberHash_[section];i++) {
-	names[i]=CoinStrdup(names2[i]);
+	names[i]=addName(section,names2[i]);
       }
     }
   }
@@ -5466,6 +5477,10 @@ CoinMpsIO::operator=(const CoinMpsIO& rhs)
 void CoinMpsIO::gutsOfDestructor()
 {  
   freeAll();
+  delete nameArena_[0];
+  delete nameArena_[1];
+  nameArena_[0]=NULL;
+  nameArena_[1]=NULL;
   if (defaultHandler_) {
     delete handler_;
     handler_ = NULL;
@@ -5523,10 +5538,8 @@ void CoinMpsIO::releaseRedundantInformation()
   rowsense_=NULL;
   rhs_=NULL;
   rowrange_=NULL;
-  delete [] hash_[0];
-  delete [] hash_[1];
-  hash_[0]=0;
-  hash_[1]=0;
+  stopHash(0);
+  stopHash(1);
   delete matrixByRow_;
   matrixByRow_=NULL;
 }
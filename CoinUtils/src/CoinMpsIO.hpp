@@ -19,6 +19,7 @@
 #include "CoinMessageHandler.hpp"
 #include "CoinFileIO.hpp"
 class CoinModel;
+class CoinMpsNameArena;
 
 /// The following lengths are in decreasing order (for 64 bit etc)
 /// Large enough to contain element index
@@ -676,7 +677,7 @@ public:
 	MPS file
 	<ul>
 	  <li> 0: normal precision (default)
-	  <li> 1: extra accuracy
+	  <li> 1: extra accuracy (shortest string which reads back exactly)
 	  <li> 2: IEEE hex
 	</ul>
 
@@ -893,14 +894,10 @@ protected:
   //@}
 
   
-  // for hashing
-  typedef struct {
-    int index, next;
-  } CoinHashLink;
-
   /**@name Hash table methods */
   //@{
-  /// Creates hash list for names (section = 0 for rows, 1 columns)
+  /** Creates hash list for names (section = 0 for rows, 1 columns).
+      The names are normally stored by addName(). */
   void startHash ( char **names, const int number , int section );
   /// This one does it when names are already in
   void startHash ( int section ) const;
@@ -908,6 +905,9 @@ protected:
   void stopHash ( int section );
   /// Finds match using hash,  -1 not found
   int findHash ( const char *name , int section ) const;
+  /** Copy of name kept in storage for section, which lasts until the
+      names of the section are released */
+  char * addName ( int section, const char * name );
   //@}
 
     /**@name Cached problem information */
@@ -981,6 +981,11 @@ protected:
 	  Linked to hash table sections (0 - row names, 1 column names)
       */
       char **names_[2];
+
+      /** Storage for names (two sections).  Names are copied one after
+	  another into large blocks, not allocated one by one.
+      */
+      CoinMpsNameArena *nameArena_[2];
     //@}
 
     /** @name Hash tables */
@@ -991,8 +996,16 @@ protected:
       /// Number of entries in a hash table section
       int numberHash_[2];
 
-      /// Hash tables (two sections, 0 - row names, 1 - column names)
-      mutable CoinHashLink *hash_[2];
+      /** Hash tables (two sections, 0 - row names, 1 - column names).
+	  Open addressing: each slot is the index of a name or -1.
+      */
+      mutable int *hash_[2];
+
+      /// Number of slots in a hash table section (a power of 2)
+      mutable int hashSize_[2];
+
+      /// Hash value of each name in a hash table section
+      mutable unsigned int *nameHash_[2];
     //@}
 
     /** @name CoinMpsIO object parameters */
@@ -179,6 +179,28 @@ CoinPackedMatrix::setExtraMajor(const double newMajor)
    extraMajor_ = newMajor;
 }
 
+//-----------------------------------------------------------------------------
+
+void
+CoinPackedMatrix::setTombstoneRatio(const double newRatio)
+{
+   if (newRatio < 0)
+      throw CoinError("negative new tombstone ratio",
+		     "setTombstoneRatio", "CoinPackedMatrix");
+   tombstoneRatio_ = newRatio;
+}
+
+//-----------------------------------------------------------------------------
+
+double
+CoinPackedMatrix::getGapRatio() const
+{
+   const CoinBigIndex last = getLastStart();
+   if (!last)
+      return 0.0;
+   return static_cast<double>(last - size_) / static_cast<double>(last);
+}
+
 //#############################################################################
 #ifndef CLP_NO_VECTOR
 void
@@ -853,6 +875,7 @@ CoinPackedMatrix::copyOf(const CoinPackedMatrix& rhs)
 		   rhs.minorDim_, rhs.majorDim_, rhs.size_,
 		   rhs.element_, rhs.index_, rhs.start_, rhs.length_,
 		   rhs.extraMajor_, rhs.extraGap_);
+      tombstoneRatio_ = rhs.tombstoneRatio_;
    }
 }
 
@@ -884,6 +907,7 @@ CoinPackedMatrix::copyReuseArrays(const CoinPackedMatrix& rhs)
     size_ = rhs.size_;
     extraGap_ = rhs.extraGap_;
     extraMajor_ = rhs.extraMajor_;
+    tombstoneRatio_ = rhs.tombstoneRatio_;
     CoinMemcpyN(rhs.length_, majorDim_,length_);
     CoinMemcpyN(rhs.start_, majorDim_+1,start_);
     if (size_==start_[majorDim_]) {
@@ -1078,6 +1102,7 @@ CoinPackedMatrix::operator=(const CoinPackedMatrix& rhs)
       gutsOfDestructor();
       extraGap_=rhs.extraGap_;
       extraMajor_=rhs.extraMajor_;
+      tombstoneRatio_=rhs.tombstoneRatio_;
       gutsOfOpEqual(rhs.colOrdered_,
 		    rhs.minorDim_,  rhs.majorDim_, rhs.size_,
 		    rhs.element_, rhs.index_, rhs.start_, rhs.length_);
@@ -1113,6 +1138,7 @@ CoinPackedMatrix::swap(CoinPackedMatrix& m)
    std::swap(colOrdered_,  m.colOrdered_);
    std::swap(extraGap_,	   m.extraGap_);
    std::swap(extraMajor_,  m.extraMajor_);
+   std::swap(tombstoneRatio_, m.tombstoneRatio_);
    std::swap(element_, 	   m.element_);
    std::swap(index_,	   m.index_);
    std::swap(start_,	   m.start_);
@@ -1632,7 +1658,7 @@ CoinPackedMatrix::deleteMajorVectors(const int numDel,
       return;
    }
 
-   if (!extraGap_&&!extraMajor_) {
+   if (!extraGap_&&!extraMajor_&&!tombstoneRatio_) {
      // See if this is faster
      char * keep = new char[majorDim_];
      memset(keep,1,majorDim_);
@@ -1701,6 +1727,8 @@ CoinPackedMatrix::deleteMajorVectors(const int numDel,
      }
      
      delete[] sortedDelPtr;
+     if (tombstoneRatio_)
+       compactTombstones();
    }
 }
 
@@ -1770,7 +1798,7 @@ CoinPackedMatrix::deleteMinorVectors(const int numDel,
     }
   }
 #endif
-  if (!extraGap_) {
+  if (!extraGap_&&!tombstoneRatio_) {
     // pack down
     size_=0;
     for (i = 0; i < majorDim_; ++i) {
@@ -1810,6 +1838,46 @@ CoinPackedMatrix::deleteMinorVectors(const int numDel,
   delete[] newindexPtr;
 
   minorDim_ -= numDel;
+  if (tombstoneRatio_)
+    compactTombstones();
+}
+
+//-----------------------------------------------------------------------------
+
+bool
+CoinPackedMatrix::compactTombstones()
+{
+  if (getGapRatio() <= tombstoneRatio_)
+    return false;
+  removeGaps();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+int
+CoinPackedMatrix::deletionMap(const bool major,
+			      const int numDel, const int * indDel,
+			      int * newIndex) const
+{
+  const int dim = major ? majorDim_ : minorDim_;
+  CoinZeroN(newIndex, dim);
+  for (int j = 0; j < numDel; ++j) {
+    const int ind = indDel[j];
+    if (ind < 0 || ind >= dim)
+      throw CoinError("out of range index",
+		     "deletionMap", "CoinPackedMatrix");
+    if (newIndex[ind] == -1)
+      throw CoinError("duplicate index",
+		     "deletionMap", "CoinPackedMatrix");
+    newIndex[ind] = -1;
+  }
+  int k = 0;
+  for (int i = 0; i < dim; ++i) {
+    if (newIndex[i] != -1)
+      newIndex[i] = k++;
+  }
+  return k;
 }
 
 //#############################################################################
@@ -1883,6 +1951,7 @@ CoinPackedMatrix::CoinPackedMatrix() :
    colOrdered_(true),
    extraGap_(0.0),
    extraMajor_(0.0),
+   tombstoneRatio_(0.0),
    element_(0), 
    index_(0),
    length_(0),
@@ -1904,6 +1973,7 @@ CoinPackedMatrix::CoinPackedMatrix(const bool colordered,
    colOrdered_(colordered),
    extraGap_(extraGap),
    extraMajor_(extraMajor),
+   tombstoneRatio_(0.0),
    element_(0), 
    index_(0),
    length_(0),
@@ -1929,6 +1999,7 @@ CoinPackedMatrix::CoinPackedMatrix(const bool colordered,
    colOrdered_(colordered),
    extraGap_(extraGap),
    extraMajor_(extraMajor),
+   tombstoneRatio_(0.0),
    element_(NULL),
    index_(NULL),
    start_(NULL),
@@ -1952,6 +2023,7 @@ CoinPackedMatrix::CoinPackedMatrix(const bool colordered,
    colOrdered_(colordered),
    extraGap_(0.0),
    extraMajor_(0.0),
+   tombstoneRatio_(0.0),
    element_(NULL),
    index_(NULL),
    start_(NULL),
@@ -2011,6 +2083,7 @@ CoinPackedMatrix::CoinPackedMatrix(
    colOrdered_(colordered),
      extraGap_(0.0),
      extraMajor_(0.0),
+     tombstoneRatio_(0.0),
      element_(NULL),
      index_(NULL),
      start_(NULL),
@@ -2176,6 +2249,7 @@ CoinPackedMatrix::CoinPackedMatrix (const CoinPackedMatrix & rhs) :
    colOrdered_(true),
    extraGap_(0.0),
    extraMajor_(0.0),
+   tombstoneRatio_(rhs.tombstoneRatio_),
    element_(0), 
    index_(0),
    start_(0),
@@ -2211,6 +2285,7 @@ CoinPackedMatrix::CoinPackedMatrix (const CoinPackedMatrix& rhs,
   :  colOrdered_(rhs.colOrdered_),
    extraGap_(0),
    extraMajor_(0),
+   tombstoneRatio_(0.0),
    element_(0), 
    index_(0),
    start_(0),
@@ -2356,6 +2431,7 @@ CoinPackedMatrix::CoinPackedMatrix (const CoinPackedMatrix & rhs,
    colOrdered_(true),
    extraGap_(0.0),
    extraMajor_(0.0),
+   tombstoneRatio_(0.0),
    element_(NULL), 
    index_(NULL),
    start_(NULL),
@@ -89,6 +89,12 @@ public:
     inline double getExtraGap() const { return extraGap_; }
     /** Return the current setting of the extra major. */
     inline double getExtraMajor() const { return extraMajor_; }
+    /** Return the current tombstone ratio (0.0 means deletions compact
+	the storage immediately). */
+    inline double getTombstoneRatio() const { return tombstoneRatio_; }
+    /** Fraction of the occupied storage (up to the end of the last major
+	vector) which is not used by entries. */
+    double getGapRatio() const;
 
     /** Reserve sufficient space for appending major-ordered vectors. 
 	If create is true, empty columns are created (for column generation) */
@@ -228,6 +234,15 @@ public:
     void setExtraGap(const double newGap);
     /** Set the extra major to be allocated to the specified value. */
     void setExtraMajor(const double newMajor);
+    /*! \brief Set the tombstone ratio.
+
+      If the ratio is positive, deleting major or minor vectors only updates
+      starts and lengths and leaves the freed entries as gaps in the storage.
+      The storage is compacted in bulk (see #compactTombstones) once the
+      fraction of gaps exceeds the ratio. A ratio of 0.0 (the default)
+      compacts on every deletion.
+    */
+    void setTombstoneRatio(const double newRatio);
 #ifndef CLP_NO_VECTOR
     /*! Append a column to the end of the matrix.
     
@@ -611,6 +626,21 @@ public:
       /** Delete the minor-dimension vectors whose indices are listed in
 	  <code>indDel</code>. */
       void deleteMinorVectors(const int numDel, const int * indDel);
+      /** Remove the gaps left by deletions if their fraction of the storage
+	  exceeds the tombstone ratio. Returns true if the storage was
+	  compacted. Use #removeGaps to compact unconditionally. */
+      bool compactTombstones();
+      /*! \brief Old-to-new index map for a deletion.
+
+	Fills \p newIndex (of size majorDim_ if \p major is true, minorDim_
+	otherwise) with the index each vector will have after deleting the
+	vectors listed in \p indDel, or -1 if it is deleted. Returns the
+	dimension after the deletion. Dependent data (solution vectors,
+	CoinWarmStartBasis::remapRows, ...) can be updated from this single
+	array. Throws on out-of-range or duplicate indices.
+      */
+      int deletionMap(const bool major, const int numDel, const int * indDel,
+		      int * newIndex) const;
       //@}
 
       //-----------------------------------------------------------------------
@@ -907,6 +937,9 @@ protected:
        vectors when the matrix is resized. The purpose of these gaps is to
        allow fast addition of new major-dimension vectors. */
    double   extraMajor_;
+   /** If positive, deletions leave gaps which are only removed once they
+       make up more than this fraction of the storage. */
+   double   tombstoneRatio_;
 
    /** List of nonzero element values. The entries in the gaps between
        major-dimension vectors are undefined. */
@@ -0,0 +1,382 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinUtilsConfig.h"
+
+#include <cassert>
+#include <vector>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrixPair.hpp"
+
+#ifndef CLP_NO_VECTOR
+namespace {
+/*
+  Largest index in a set of packed vectors, -1 if they are all empty. Used to
+  grow the minor-ordered copy before a minor append, which (unlike a major
+  append) does not extend the dimension by itself.
+*/
+int maxVectorIndex (const int num, const CoinPackedVectorBase * const * vecs)
+{
+  int maxIndex = -1;
+  for (int i = 0; i < num; ++i) {
+    const int n = vecs[i]->getNumElements();
+    const int * ind = vecs[i]->getIndices();
+    for (int j = 0; j < n; ++j)
+      maxIndex = CoinMax(maxIndex, ind[j]);
+  }
+  return maxIndex;
+}
+
+/*
+  Whether a minor append of the vectors fits in the gaps of the matrix, so
+  that CoinPackedMatrix will not copy the whole matrix to make room.
+*/
+bool roomForMinorVectors (const CoinPackedMatrix & matrix, const int num,
+			  const CoinPackedVectorBase * const * vecs)
+{
+  const int majorDim = matrix.getMajorDim();
+  const CoinBigIndex * start = matrix.getVectorStarts();
+  const int * length = matrix.getVectorLengths();
+  if (num == 1) {
+    const int n = vecs[0]->getNumElements();
+    const int * ind = vecs[0]->getIndices();
+    for (int j = 0; j < n; ++j) {
+      const int k = ind[j];
+      if (k >= majorDim || start[k]+length[k] == start[k+1])
+	return false;
+    }
+    return true;
+  }
+  std::vector<int> added(majorDim, 0);
+  for (int i = 0; i < num; ++i) {
+    const int n = vecs[i]->getNumElements();
+    const int * ind = vecs[i]->getIndices();
+    for (int j = 0; j < n; ++j) {
+      const int k = ind[j];
+      if (k >= majorDim || start[k]+length[k]+(++added[k]) > start[k+1])
+	return false;
+    }
+  }
+  return true;
+}
+}
+#endif
+
+/*
+  Extra space given to copies which are appended to, unless the client
+  asked for some.  Without it every append copies the whole matrix.
+*/
+static const double defaultExtraMajor = 0.25;
+static const double defaultExtraGap = 0.25;
+
+//#############################################################################
+// Query members
+//#############################################################################
+
+int
+CoinPackedMatrixPair::getNumRows() const
+{
+  return byColumnCurrent_ ? byColumn_.getNumRows() : byRow_.getNumRows();
+}
+
+int
+CoinPackedMatrixPair::getNumCols() const
+{
+  return byColumnCurrent_ ? byColumn_.getNumCols() : byRow_.getNumCols();
+}
+
+CoinBigIndex
+CoinPackedMatrixPair::getNumElements() const
+{
+  return byColumnCurrent_ ?
+    byColumn_.getNumElements() : byRow_.getNumElements();
+}
+
+//-----------------------------------------------------------------------------
+
+const CoinPackedMatrix &
+CoinPackedMatrixPair::getByColumn() const
+{
+  if (!byColumnCurrent_) {
+    assert (byRowCurrent_);
+    copyExtraSpace(byRow_, byColumn_);
+    byColumn_.reverseOrderedCopyOf(byRow_);
+    byColumnCurrent_ = true;
+  }
+  return byColumn_;
+}
+
+const CoinPackedMatrix &
+CoinPackedMatrixPair::getByRow() const
+{
+  if (!byRowCurrent_) {
+    assert (byColumnCurrent_);
+    copyExtraSpace(byColumn_, byRow_);
+    byRow_.reverseOrderedCopyOf(byColumn_);
+    byRowCurrent_ = true;
+  }
+  return byRow_;
+}
+
+//#############################################################################
+// Loading the matrix
+//#############################################################################
+
+void
+CoinPackedMatrixPair::setMatrix(const CoinPackedMatrix & matrix)
+{
+  if (matrix.isColOrdered()) {
+    byColumn_.copyOf(matrix);
+    byColumnCurrent_ = true;
+    byRowCurrent_ = false;
+  } else {
+    byRow_.copyOf(matrix);
+    byRowCurrent_ = true;
+    byColumnCurrent_ = false;
+  }
+}
+
+void
+CoinPackedMatrixPair::assignMatrix(CoinPackedMatrix *& matrix)
+{
+  if (matrix->isColOrdered()) {
+    byColumn_.swap(*matrix);
+    byColumnCurrent_ = true;
+    byRowCurrent_ = false;
+  } else {
+    byRow_.swap(*matrix);
+    byRowCurrent_ = true;
+    byColumnCurrent_ = false;
+  }
+  delete matrix;
+  matrix = NULL;
+}
+
+void
+CoinPackedMatrixPair::copyOf(const bool colordered,
+			     const int minor, const int major,
+			     const CoinBigIndex numels,
+			     const double * elem, const int * ind,
+			     const CoinBigIndex * start, const int * len,
+			     const double extraMajor, const double extraGap)
+{
+  if (colordered) {
+    byColumn_.copyOf(true, minor, major, numels, elem, ind, start, len,
+		     extraMajor, extraGap);
+    byColumnCurrent_ = true;
+    byRowCurrent_ = false;
+  } else {
+    byRow_.copyOf(false, minor, major, numels, elem, ind, start, len,
+		  extraMajor, extraGap);
+    byRowCurrent_ = true;
+    byColumnCurrent_ = false;
+  }
+}
+
+void
+CoinPackedMatrixPair::clear()
+{
+  byColumn_.clear();
+  byRow_.clear();
+  byColumnCurrent_ = true;
+  byRowCurrent_ = true;
+}
+
+void
+CoinPackedMatrixPair::setExtraSpace(const double extraMajor,
+				    const double extraGap)
+{
+  byColumn_.setExtraMajor(extraMajor);
+  byColumn_.setExtraGap(extraGap);
+  byRow_.setExtraMajor(extraMajor);
+  byRow_.setExtraGap(extraGap);
+}
+
+void
+CoinPackedMatrixPair::releaseByRow()
+{
+  getByColumn();
+  byRowCurrent_ = false;
+}
+
+void
+CoinPackedMatrixPair::releaseByColumn()
+{
+  getByRow();
+  byColumnCurrent_ = false;
+}
+
+//#############################################################################
+// Modifying the matrix
+//#############################################################################
+
+#ifndef CLP_NO_VECTOR
+void
+CoinPackedMatrixPair::appendCol(const CoinPackedVectorBase & vec)
+{
+  const CoinPackedVectorBase * vecs[1] = { &vec };
+  appendCols(1, vecs);
+}
+
+void
+CoinPackedMatrixPair::appendCols(const int numcols,
+				 const CoinPackedVectorBase * const * cols)
+{
+  if (numcols <= 0)
+    return;
+  ensureExtraSpace();
+  if (byRowCurrent_ && !roomForMinorVectors(byRow_, numcols, cols)) {
+    // Cheaper to rebuild the row copy when it is next asked for
+    getByColumn();
+    byRowCurrent_ = false;
+  }
+  if (byRowCurrent_) {
+    // Adding columns to the row copy is a minor append; make room for any
+    // new rows first so that both copies agree on the dimensions.
+    const int numrows = maxVectorIndex(numcols, cols) + 1;
+    if (numrows > byRow_.getNumRows())
+      byRow_.setDimensions(numrows, -1);
+    byRow_.appendCols(numcols, cols);
+  }
+  if (byColumnCurrent_)
+    byColumn_.appendCols(numcols, cols);
+}
+
+void
+CoinPackedMatrixPair::appendRow(const CoinPackedVectorBase & vec)
+{
+  const CoinPackedVectorBase * vecs[1] = { &vec };
+  appendRows(1, vecs);
+}
+
+void
+CoinPackedMatrixPair::appendRows(const int numrows,
+				 const CoinPackedVectorBase * const * rows)
+{
+  if (numrows <= 0)
+    return;
+  ensureExtraSpace();
+  if (byColumnCurrent_ && !roomForMinorVectors(byColumn_, numrows, rows)) {
+    // Cheaper to rebuild the column copy when it is next asked for
+    getByRow();
+    byColumnCurrent_ = false;
+  }
+  if (byColumnCurrent_) {
+    // CoinPackedMatrix::appendRows adds any missing columns itself
+    byColumn_.appendRows(numrows, rows);
+  }
+  if (byRowCurrent_) {
+    byRow_.appendRows(numrows, rows);
+    if (byColumnCurrent_ && byRow_.getNumCols() < byColumn_.getNumCols())
+      byRow_.setDimensions(-1, byColumn_.getNumCols());
+  }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+void
+CoinPackedMatrixPair::deleteCols(const int numDel, const int * indDel)
+{
+  if (byColumnCurrent_)
+    byColumn_.deleteCols(numDel, indDel);
+  if (byRowCurrent_)
+    byRow_.deleteCols(numDel, indDel);
+}
+
+void
+CoinPackedMatrixPair::deleteRows(const int numDel, const int * indDel)
+{
+  if (byRowCurrent_)
+    byRow_.deleteRows(numDel, indDel);
+  if (byColumnCurrent_)
+    byColumn_.deleteRows(numDel, indDel);
+}
+
+void
+CoinPackedMatrixPair::modifyCoefficient(int row, int column,
+					double newElement, bool keepZero)
+{
+  if (byColumnCurrent_)
+    byColumn_.modifyCoefficient(row, column, newElement, keepZero);
+  if (byRowCurrent_)
+    byRow_.modifyCoefficient(row, column, newElement, keepZero);
+}
+
+//#############################################################################
+// Constructors, destructor and assignment
+//#############################################################################
+
+CoinPackedMatrixPair::CoinPackedMatrixPair() :
+  byColumn_(true, 0.0, 0.0),
+  byRow_(false, 0.0, 0.0),
+  byColumnCurrent_(true),
+  byRowCurrent_(true)
+{
+}
+
+CoinPackedMatrixPair::CoinPackedMatrixPair(const CoinPackedMatrix & matrix) :
+  byColumn_(true, 0.0, 0.0),
+  byRow_(false, 0.0, 0.0),
+  byColumnCurrent_(true),
+  byRowCurrent_(true)
+{
+  setMatrix(matrix);
+}
+
+CoinPackedMatrixPair::CoinPackedMatrixPair(const CoinPackedMatrixPair & rhs) :
+  byColumn_(true, 0.0, 0.0),
+  byRow_(false, 0.0, 0.0),
+  byColumnCurrent_(rhs.byColumnCurrent_),
+  byRowCurrent_(rhs.byRowCurrent_)
+{
+  if (byColumnCurrent_)
+    byColumn_ = rhs.byColumn_;
+  if (byRowCurrent_)
+    byRow_ = rhs.byRow_;
+}
+
+CoinPackedMatrixPair &
+CoinPackedMatrixPair::operator=(const CoinPackedMatrixPair & rhs)
+{
+  if (this != &rhs) {
+    byColumnCurrent_ = rhs.byColumnCurrent_;
+    if (byColumnCurrent_)
+      byColumn_ = rhs.byColumn_;
+    byRowCurrent_ = rhs.byRowCurrent_;
+    if (byRowCurrent_)
+      byRow_ = rhs.byRow_;
+  }
+  return *this;
+}
+
+CoinPackedMatrixPair::~CoinPackedMatrixPair()
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void
+CoinPackedMatrixPair::ensureExtraSpace()
+{
+  if (byColumn_.getExtraMajor() == 0.0 && byColumn_.getExtraGap() == 0.0) {
+    byColumn_.setExtraMajor(defaultExtraMajor);
+    byColumn_.setExtraGap(defaultExtraGap);
+  }
+  if (byRow_.getExtraMajor() == 0.0 && byRow_.getExtraGap() == 0.0) {
+    byRow_.setExtraMajor(defaultExtraMajor);
+    byRow_.setExtraGap(defaultExtraGap);
+  }
+}
+
+void
+CoinPackedMatrixPair::copyExtraSpace(const CoinPackedMatrix & from,
+				     CoinPackedMatrix & to)
+{
+  to.setExtraGap(from.getExtraGap());
+  to.setExtraMajor(from.getExtraMajor());
+}
@@ -0,0 +1,151 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinPackedMatrixPair_H
+#define CoinPackedMatrixPair_H
+
+#include "CoinPackedMatrix.hpp"
+
+/*! \brief A sparse matrix kept in both column- and row-major ordering
+
+  Solver interfaces which hand out both getMatrixByCol() and getMatrixByRow()
+  usually keep one CoinPackedMatrix per ordering and rebuild the stale one
+  with CoinPackedMatrix::reverseOrderedCopyOf whenever the other changes.
+  A cut loop which alternates adding rows and asking for the row copy thus
+  transposes the whole matrix every round.
+
+  This class holds the two copies together. The second ordering is built
+  only when it is first asked for; from then on appends, deletions and
+  coefficient changes are applied to both copies in place. Appending rows is
+  a major append on the row copy and a minor append on the column copy, the
+  latter using the extra gap (CoinPackedMatrix::getExtraGap) of the column
+  vectors. If the new rows do not fit in the gaps, the column copy is
+  dropped rather than copied to make room, and rebuilt when next asked for;
+  a cut loop thus transposes at most once per round. Appending columns is
+  handled the same way. The copy built on demand inherits the extra gap and
+  extra major settings of the copy it is built from. A copy which has no
+  extra space when first appended to is given some (25% of each).
+
+  Compiling with CLP_NO_VECTOR defined removes the methods which take
+  CoinPackedVectorBase arguments, as for CoinPackedMatrix.
+*/
+class CoinPackedMatrixPair {
+public:
+  /**@name Query members */
+  //@{
+    /// Number of rows
+    int getNumRows() const;
+    /// Number of columns
+    int getNumCols() const;
+    /// Number of entries
+    CoinBigIndex getNumElements() const;
+
+    /** Column ordered copy; built from the row copy if it is not current. */
+    const CoinPackedMatrix & getByColumn() const;
+    /** Row ordered copy; built from the column copy if it is not current. */
+    const CoinPackedMatrix & getByRow() const;
+
+    /// Whether the column ordered copy is up to date
+    inline bool isByColumnCurrent() const { return byColumnCurrent_; }
+    /// Whether the row ordered copy is up to date
+    inline bool isByRowCurrent() const { return byRowCurrent_; }
+  //@}
+
+  /**@name Loading the matrix
+
+    Each of these replaces the contents of the pair. Only the copy with the
+    ordering of the argument is current afterwards.
+  */
+  //@{
+    /// Copy \p matrix, including its extra space parameters
+    void setMatrix(const CoinPackedMatrix & matrix);
+    /** Take over \p matrix by swapping its contents in. The matrix object
+	is deleted and the pointer set to NULL. */
+    void assignMatrix(CoinPackedMatrix *& matrix);
+    /// Copy the arguments (see CoinPackedMatrix::copyOf)
+    void copyOf(const bool colordered,
+		const int minor, const int major, const CoinBigIndex numels,
+		const double * elem, const int * ind,
+		const CoinBigIndex * start, const int * len,
+		const double extraMajor=0.0, const double extraGap=0.0);
+    /// Empty both copies. Both are current afterwards.
+    void clear();
+    /** Set the extra space parameters of both copies (see
+	CoinPackedMatrix::setExtraMajor and CoinPackedMatrix::setExtraGap).
+	Loading a matrix replaces them with the settings of the argument, so
+	call this afterwards. They take effect when a copy is next built or
+	reallocated. If both are zero when a copy is first appended to, it is
+	given a default amount. */
+    void setExtraSpace(const double extraMajor, const double extraGap);
+    /** Drop the row ordered copy (it will be rebuilt on demand). The
+	column copy is made current first. */
+    void releaseByRow();
+    /** Drop the column ordered copy (it will be rebuilt on demand). The
+	row copy is made current first. */
+    void releaseByColumn();
+  //@}
+
+  /**@name Modifying the matrix
+
+    Modifications are applied to every copy which is current; a copy which
+    is not current stays so and is rebuilt when next asked for.
+  */
+  //@{
+#ifndef CLP_NO_VECTOR
+    /// Append a column
+    void appendCol(const CoinPackedVectorBase & vec);
+    /// Append a set of columns
+    void appendCols(const int numcols,
+		    const CoinPackedVectorBase * const * cols);
+    /// Append a row
+    void appendRow(const CoinPackedVectorBase & vec);
+    /// Append a set of rows
+    void appendRows(const int numrows,
+		    const CoinPackedVectorBase * const * rows);
+#endif
+    /// Delete the columns listed in \p indDel
+    void deleteCols(const int numDel, const int * indDel);
+    /// Delete the rows listed in \p indDel
+    void deleteRows(const int numDel, const int * indDel);
+    /// Modify one element (see CoinPackedMatrix::modifyCoefficient)
+    void modifyCoefficient(int row, int column, double newElement,
+			   bool keepZero=false);
+  //@}
+
+  /**@name Constructors, destructor and assignment */
+  //@{
+    /// Default constructor; both copies are empty and current
+    CoinPackedMatrixPair();
+    /// Constructor from a matrix (see #setMatrix)
+    CoinPackedMatrixPair(const CoinPackedMatrix & matrix);
+    /// Copy constructor; only copies which are current are copied
+    CoinPackedMatrixPair(const CoinPackedMatrixPair & rhs);
+    /// Assignment operator; only copies which are current are copied
+    CoinPackedMatrixPair & operator=(const CoinPackedMatrixPair & rhs);
+    /// Destructor
+    ~CoinPackedMatrixPair();
+  //@}
+
+private:
+  /// Give each copy which has no extra space the default amount
+  void ensureExtraSpace();
+  /// Set the extra space parameters of \p to from \p from
+  static void copyExtraSpace(const CoinPackedMatrix & from,
+			     CoinPackedMatrix & to);
+
+  /**@name Data members */
+  //@{
+    /// Column ordered copy
+    mutable CoinPackedMatrix byColumn_;
+    /// Row ordered copy
+    mutable CoinPackedMatrix byRow_;
+    /// Whether byColumn_ is up to date
+    mutable bool byColumnCurrent_;
+    /// Whether byRow_ is up to date
+    mutable bool byRowCurrent_;
+  //@}
+};
+
+#endif
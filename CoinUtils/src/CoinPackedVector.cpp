@@ -198,9 +198,11 @@ CoinPackedVector::insert( int index, double element )
 {
    const int s = nElements_;
    if (testForDuplicateIndex()) {
-      std::set<int>& is = *indexSet("insert", "CoinPackedVector");
-      if (! is.insert(index).second)
+      indexSet("insert", "CoinPackedVector");
+      if (! addToIndexSet(index))
 	 throw CoinError("Index already exists", "insert", "CoinPackedVector");
+   } else {
+      clearIndexSet();
    }
 
    if( capacity_ <= s ) {
@@ -222,9 +224,14 @@ CoinPackedVector::append(const CoinPackedVectorBase & caboose)
    if (cs == 0) {
        return;
    }
+   // Only the new indices are checked, against the sorted copy of the
+   // old ones, so building a vector by appending is not quadratic
    if (testForDuplicateIndex()) {
-       // Just to initialize the index heap
-       indexSet("append (1st call)", "CoinPackedVector");
+      indexSet("append", "CoinPackedVector");
+      if (! addToIndexSet(cs, caboose.getIndices()))
+	 throw CoinError("duplicate index", "append", "CoinPackedVector");
+   } else {
+      clearIndexSet();
    }
    const int s = nElements_;
    // Make sure there is enough room for the caboose
@@ -237,13 +244,6 @@ CoinPackedVector::append(const CoinPackedVectorBase & caboose)
    CoinDisjointCopyN(celem, cs, elements_ + s);
    CoinIotaN(origIndices_ + s, cs, s);
    nElements_ += cs;
-   if (testForDuplicateIndex()) {
-      std::set<int>& is = *indexSet("append (2nd call)", "CoinPackedVector");
-      for (int i = 0; i < cs; ++i) {
-	 if (!is.insert(cind[i]).second)
-	    throw CoinError("duplicate index", "append", "CoinPackedVector");
-      }
-   }
 }
 
 //#############################################################################
@@ -3,6 +3,7 @@
 // Corporation and others.  All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
+#include <algorithm>
 #include <numeric>
 
 #include "CoinPackedVectorBase.hpp"
@@ -12,6 +13,68 @@
 
 //#############################################################################
 
+/* Returns true if an index occurs more than once.
+
+   Rows and cuts are checked every time they are built, so this should be
+   cheap.  Short vectors are compared pairwise.  Longer ones mark their
+   indices in a bitmap, or if the indices are spread too thinly for that,
+   sort a copy.  Small bitmaps and copies are on the stack; larger ones
+   are freed before returning, so nothing is kept between calls.
+*/
+static bool
+hasDuplicateIndex(int n, const int * inds)
+{
+   if (n < 16) {
+      for (int j = 1; j < n; ++j) {
+	 const int index = inds[j];
+	 for (int k = 0; k < j; ++k) {
+	    if (inds[k] == index)
+	       return true;
+	 }
+      }
+      return false;
+   }
+   int minIndex = inds[0];
+   int maxIndex = inds[0];
+   for (int j = 1; j < n; ++j) {
+      minIndex = CoinMin(minIndex, inds[j]);
+      maxIndex = CoinMax(maxIndex, inds[j]);
+   }
+   const double range = static_cast<double>(maxIndex) -
+      static_cast<double>(minIndex) + 1.0;
+   bool duplicate = false;
+   if (range <= 64.0 * CoinMax(n, 256)) {
+      const int numberWords = static_cast<int>(range) / 32 + 1;
+      unsigned int localBitmap[512];
+      unsigned int * bitmap = numberWords <= 512 ? localBitmap :
+	 new unsigned int [numberWords];
+      CoinZeroN(bitmap, numberWords);
+      for (int j = 0; j < n; ++j) {
+	 const int offset = inds[j] - minIndex;
+	 const unsigned int bit = 1u << (offset & 31);
+	 unsigned int & word = bitmap[offset >> 5];
+	 if (word & bit) {
+	    duplicate = true;
+	    break;
+	 }
+	 word |= bit;
+      }
+      if (bitmap != localBitmap)
+	 delete [] bitmap;
+   } else {
+      int localSorted[512];
+      int * sorted = n <= 512 ? localSorted : new int [n];
+      CoinDisjointCopyN(inds, n, sorted);
+      std::sort(sorted, sorted + n);
+      duplicate = std::adjacent_find(sorted, sorted + n) != sorted + n;
+      if (sorted != localSorted)
+	 delete [] sorted;
+   }
+   return duplicate;
+}
+
+//#############################################################################
+
 double *
 CoinPackedVectorBase::denseVector(int denseSize) const
 {
@@ -37,19 +100,10 @@ CoinPackedVectorBase::operator[](int i) const
    if (! testedDuplicateIndex_)
       duplicateIndex("operator[]", "CoinPackedVectorBase");
 
-   // Get a reference to a map of full storage indices to 
-   // packed storage location.
-   const std::set<int> & sv = *indexSet("operator[]", "CoinPackedVectorBase");
-#if 1
-   if (sv.find(i) == sv.end())
+   const int * sv = indexSet("operator[]", "CoinPackedVectorBase");
+   if (!std::binary_search(sv, sv + getNumElements(), i))
       return 0.0;
    return getElements()[findIndex(i)];
-#else
-   // LL: suggested change, somthing is wrong with this
-   const size_t ind = std::distance(sv.begin(), sv.find(i));
-   return (ind == sv.size()) ? 0.0 : getElements()[ind];
-#endif
-      
 }
 
 //#############################################################################
@@ -100,8 +154,13 @@ void
 CoinPackedVectorBase::duplicateIndex(const char* methodName,
 				    const char * className) const
 {
-   if (testForDuplicateIndex())
-      indexSet(methodName, className);
+   if (testForDuplicateIndex() && hasDuplicateIndex(getNumElements(),
+						   getIndices())) {
+      testedDuplicateIndex_ = false;
+      throw CoinError("Duplicate index found",
+		      methodName ? methodName : "duplicateIndex",
+		      methodName ? className : "CoinPackedVectorBase");
+   }
    testedDuplicateIndex_ = true;
 }
 
@@ -113,8 +172,8 @@ CoinPackedVectorBase::isExistingIndex(int i) const
    if (! testedDuplicateIndex_)
       duplicateIndex("indexExists", "CoinPackedVectorBase");
 
-   const std::set<int> & sv = *indexSet("indexExists", "CoinPackedVectorBase");
-   return sv.find(i) != sv.end();
+   const int * sv = indexSet("indexExists", "CoinPackedVectorBase");
+   return std::binary_search(sv, sv + getNumElements(), i);
 }
 
 
@@ -245,7 +304,8 @@ CoinPackedVectorBase::sum() const
 CoinPackedVectorBase::CoinPackedVectorBase() :
    maxIndex_(-COIN_INT_MAX/*0*/),
    minIndex_(COIN_INT_MAX/*0*/),
-   indexSetPtr_(NULL),
+   sortedIndices_(NULL),
+   sortedCapacity_(0),
    testForDuplicateIndex_(true),
    testedDuplicateIndex_(false) {}
 
@@ -253,7 +313,7 @@ CoinPackedVectorBase::CoinPackedVectorBase() :
 
 CoinPackedVectorBase::~CoinPackedVectorBase()
 {
-   delete indexSetPtr_;
+   delete [] sortedIndices_;
 }
 
 //#############################################################################
@@ -264,10 +324,10 @@ CoinPackedVectorBase::findMaxMinIndices() const
 {
    if ( getNumElements()==0 ) 
       return;
-   // if indexSet exists then grab begin and rend to get min & max indices
-   else if ( indexSetPtr_ != NULL ) {
-      maxIndex_ = *indexSetPtr_->rbegin();
-      minIndex_ = *indexSetPtr_-> begin();
+   // if indexSet exists then grab first and last to get min & max indices
+   else if ( sortedIndices_ != NULL ) {
+      maxIndex_ = sortedIndices_[getNumElements()-1];
+      minIndex_ = sortedIndices_[0];
    } else {
       // Have to scan through vector to find min and max.
       maxIndex_ = *(std::max_element(getIndices(),
@@ -279,31 +339,117 @@ CoinPackedVectorBase::findMaxMinIndices() const
 
 //-------------------------------------------------------------------
 
-std::set<int> *
+const int *
 CoinPackedVectorBase::indexSet(const char* methodName,
 			      const char * className) const
 {
    testedDuplicateIndex_ = true;
-   if ( indexSetPtr_ == NULL ) {
-      // create a set of the indices
-      indexSetPtr_ = new std::set<int>;
+   if ( sortedIndices_ == NULL ) {
+      // sorted copy of the indices
       const int s = getNumElements();
       const int * inds = getIndices();
-      for (int j=0; j < s; ++j) {
-	 if (!indexSetPtr_->insert(inds[j]).second) {
-	    testedDuplicateIndex_ = false;
-	    delete indexSetPtr_;
-	    indexSetPtr_ = NULL;
-	    if (methodName != NULL) {
-	       throw CoinError("Duplicate index found", methodName, className);
+      sortedCapacity_ = CoinMax(s, 4);
+      sortedIndices_ = new int [sortedCapacity_];
+      CoinDisjointCopyN(inds, s, sortedIndices_);
+      std::sort(sortedIndices_, sortedIndices_ + s);
+      if (std::adjacent_find(sortedIndices_, sortedIndices_ + s) !=
+	  sortedIndices_ + s) {
+	 testedDuplicateIndex_ = false;
+	 delete [] sortedIndices_;
+	 sortedIndices_ = NULL;
+	 if (methodName != NULL) {
+	    throw CoinError("Duplicate index found", methodName, className);
+	 } else {
+	    throw CoinError("Duplicate index found",
+			   "indexSet", "CoinPackedVectorBase");
+	 }
+      }
+   }
+   return sortedIndices_;
+}
+
+//-----------------------------------------------------------------------------
+
+bool
+CoinPackedVectorBase::addToIndexSet(int index) const
+{
+   const int s = getNumElements();
+   int * where = std::lower_bound(sortedIndices_, sortedIndices_ + s, index);
+   if (where != sortedIndices_ + s && *where == index)
+      return false;
+   const int position = static_cast<int>(where - sortedIndices_);
+   if (s >= sortedCapacity_) {
+      sortedCapacity_ = 2 * sortedCapacity_;
+      int * newSorted = new int [sortedCapacity_];
+      CoinDisjointCopyN(sortedIndices_, s, newSorted);
+      delete [] sortedIndices_;
+      sortedIndices_ = newSorted;
+   }
+   // usually index is the largest, so nothing moves
+   CoinCopyN(sortedIndices_ + position, s - position,
+	     sortedIndices_ + position + 1);
+   sortedIndices_[position] = index;
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool
+CoinPackedVectorBase::addToIndexSet(int n, const int * indices) const
+{
+   if (n == 1)
+      return addToIndexSet(indices[0]);
+   if (n <= 0)
+      return true;
+   int localSorted[512];
+   int * sorted = n <= 512 ? localSorted : new int [n];
+   CoinDisjointCopyN(indices, n, sorted);
+   std::sort(sorted, sorted + n);
+   bool added = std::adjacent_find(sorted, sorted + n) == sorted + n;
+   const int s = getNumElements();
+   if (added) {
+      if (s == 0 || sorted[0] > sortedIndices_[s-1]) {
+	 // all go on the end, as when rows are built column by column
+	 if (s + n > sortedCapacity_) {
+	    sortedCapacity_ = CoinMax(2 * sortedCapacity_, s + n);
+	    int * newSorted = new int [sortedCapacity_];
+	    CoinDisjointCopyN(sortedIndices_, s, newSorted);
+	    delete [] sortedIndices_;
+	    sortedIndices_ = newSorted;
+	 }
+	 CoinDisjointCopyN(sorted, n, sortedIndices_ + s);
+      } else {
+	 // merge into a new array, which is dropped if an index is there
+	 const int capacity = CoinMax(sortedCapacity_, s + n);
+	 int * merged = new int [capacity];
+	 int i = 0;
+	 int j = 0;
+	 int put = 0;
+	 while (i < s && j < n) {
+	    if (sortedIndices_[i] < sorted[j]) {
+	       merged[put++] = sortedIndices_[i++];
+	    } else if (sorted[j] < sortedIndices_[i]) {
+	       merged[put++] = sorted[j++];
 	    } else {
-	       throw CoinError("Duplicate index found",
-			      "indexSet", "CoinPackedVectorBase");
+	       added = false;
+	       break;
 	    }
 	 }
+	 if (added) {
+	    CoinDisjointCopyN(sortedIndices_ + i, s - i, merged + put);
+	    put += s - i;
+	    CoinDisjointCopyN(sorted + j, n - j, merged + put);
+	    delete [] sortedIndices_;
+	    sortedIndices_ = merged;
+	    sortedCapacity_ = capacity;
+	 } else {
+	    delete [] merged;
+	 }
       }
    }
-   return indexSetPtr_;
+   if (sorted != localSorted)
+      delete [] sorted;
+   return added;
 }
 
 //-----------------------------------------------------------------------------
@@ -311,8 +457,8 @@ CoinPackedVectorBase::indexSet(const char* methodName,
 void
 CoinPackedVectorBase::clearIndexSet() const
 {
-   delete indexSetPtr_;
-   indexSetPtr_ = NULL;
+   delete [] sortedIndices_;
+   sortedIndices_ = NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -233,11 +233,21 @@ protected:
    /// Find Maximum and Minimum Indices
    void findMaxMinIndices() const;
 
-   /// Return indexSetPtr_ (create it if necessary).
-   std::set<int> * indexSet(const char* methodName = NULL,
-			    const char * className = NULL) const;
-
-   /// Delete the indexSet
+   /** Return the indices in increasing order (create sortedIndices_ if
+       necessary).  Throws if there are duplicate indices. */
+   const int * indexSet(const char* methodName = NULL,
+			const char * className = NULL) const;
+
+   /** Add index to the indices in increasing order, which must exist
+       (see indexSet()), before it is added to the vector.  Returns false,
+       adding nothing, if index is already there. */
+   bool addToIndexSet(int index) const;
+   /** Add n indices (any order) as addToIndexSet(int) does.  Returns
+       false, adding nothing, if any is already there or repeated. */
+   bool addToIndexSet(int n, const int * indices) const;
+   /// True if the vector is known to have no duplicate indices
+   bool testedDuplicateIndex() const { return testedDuplicateIndex_; }
+   /// Delete sortedIndices_
    void clearIndexSet() const;
    void clearBase() const;
    void copyMaxMinIndex(const CoinPackedVectorBase & x) const {
@@ -253,10 +263,13 @@ private:
    mutable int maxIndex_;
    /// Contains minimum index value or infinity
    mutable int minIndex_;
-   /** Store the indices in a set. This set is only created if it is needed.
-       Its primary use is testing for duplicate indices.
+   /** The indices in increasing order. Only created if it is needed to
+       look up indices (isExistingIndex(), operator[] and insert());
+       testing for duplicate indices does not need it.
     */
-   mutable std::set<int> * indexSetPtr_;
+   mutable int * sortedIndices_;
+   /// Room in sortedIndices_
+   mutable int sortedCapacity_;
    /** True if the vector should be tested for duplicate indices when they can
        occur. */
    mutable bool testForDuplicateIndex_;
@@ -21,20 +21,14 @@
 #include "CoinPresolvePsdebug.hpp"
 #endif
 
-#define DSEED2 2147483647.0
-// Can be used from anywhere
+// Can be used from anywhere.  The generator is local and always starts
+// from the same seed, so presolve gives the same answer on any thread.
 void coin_init_random_vec(double *work, int n)
 {
-  double deseed = 12345678.0;
+  CoinRandom random;
 
-  for (int i = 0; i < n; ++i) {
-    deseed *= 16807.;
-    int jseed = static_cast<int> (deseed /    DSEED2);
-    deseed -= static_cast<double> (jseed) * DSEED2;
-    double random = deseed /  DSEED2;
-
-    work[i]=random;
-  }
+  for (int i = 0; i < n; ++i)
+    work[i] = random.randomDouble();
 }
 
 namespace {	// begin unnamed file-local namespace
@@ -1833,7 +1833,7 @@ inline void presolve_delete_from_col2(int row, int col, CoinBigIndex *mcstrt,
 double *presolve_dupmajor(const double *elems, const int *indices,
 			  int length, CoinBigIndex offset, int tgt = -1);
 
-/// Initialize a vector with random numbers
+/// Initialize a vector with random numbers (the same on every call)
 void coin_init_random_vec(double *work, int n);
 
 //@}
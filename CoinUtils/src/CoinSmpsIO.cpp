@@ -0,0 +1,1130 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinUtilsConfig.h"
+
+#include <cassert>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinFileIO.hpp"
+#include "CoinModel.hpp"
+#include "CoinStructuredModel.hpp"
+#include "CoinSmpsIO.hpp"
+
+namespace {
+// How values in a SCENARIOS section modify the core
+enum SmpsMode { smpsReplace=0, smpsAdd, smpsMultiply };
+
+// Maximum length of a line
+const int smpsLineLength = 1024;
+
+/*
+  Split line into blank separated tokens (in place).  Returns number of
+  tokens, at most maxTokens.
+*/
+int splitLine (char * line, char ** token, int maxTokens)
+{
+  int n=0;
+  char * put = line;
+  while (n<maxTokens) {
+    while (*put&&isspace(static_cast<unsigned char>(*put)))
+      put++;
+    if (!*put)
+      break;
+    token[n++]=put;
+    while (*put&&!isspace(static_cast<unsigned char>(*put)))
+      put++;
+    if (*put)
+      *put++='\0';
+  }
+  return n;
+}
+
+// Strip quotes round a name (as in 'ROOT')
+char * unquote (char * name)
+{
+  size_t length = strlen(name);
+  if (length>=2&&name[0]=='\''&&name[length-1]=='\'') {
+    name[length-1]='\0';
+    name++;
+  }
+  return name;
+}
+
+// True if whole token is a number
+bool isNumber (const char * token, double & value)
+{
+  char * after;
+  value = strtod(token,&after);
+  return after!=token&&*after=='\0';
+}
+
+double applyMode (SmpsMode mode, double coreValue, double value)
+{
+  if (mode==smpsAdd)
+    return coreValue+value;
+  else if (mode==smpsMultiply)
+    return coreValue*value;
+  else
+    return value;
+}
+
+CoinFileInput * openFile (const char * filename)
+{
+  std::string name = filename;
+  if (!fileCoinReadable(name))
+    return NULL;
+  CoinFileInput * input = NULL;
+  try {
+    input = CoinFileInput::create(name);
+  } catch (CoinError &) {
+    input = NULL;
+  }
+  return input;
+}
+
+// First of the extensions which gives a readable file (empty if none)
+std::string findFile (const char * base, const char * ext1,
+		      const char * ext2)
+{
+  std::string name = std::string(base)+ext1;
+  if (fileCoinReadable(name))
+    return name;
+  name = std::string(base)+ext2;
+  if (fileCoinReadable(name))
+    return name;
+  return std::string();
+}
+}
+
+//#############################################################################
+// Reading
+//#############################################################################
+
+int
+CoinSmpsIO::readSmps(const char * filename)
+{
+  std::string coreFile = findFile(filename,".cor",".core");
+  std::string timeFile = findFile(filename,".tim",".time");
+  std::string stochFile = findFile(filename,".sto",".stoch");
+  if (coreFile.empty()||timeFile.empty()||stochFile.empty()) {
+    char printBuffer[512];
+    sprintf(printBuffer,"Unable to find SMPS files for %s",filename);
+    handler_->message(COIN_GENERAL_WARNING,messages_)<<printBuffer
+						     <<CoinMessageEol;
+    return -1;
+  }
+  return readSmps(coreFile.c_str(),timeFile.c_str(),stochFile.c_str());
+}
+
+int
+CoinSmpsIO::readSmps(const char * coreFile, const char * timeFile,
+		     const char * stochFile)
+{
+  gutsOfDestructor();
+  int numberErrors = core_.readMps(coreFile,"");
+  if (numberErrors)
+    return numberErrors;
+  readRowTypes(coreFile);
+  numberErrors = readTime(timeFile);
+  if (numberErrors)
+    return numberErrors;
+  return readStoch(stochFile);
+}
+
+void
+CoinSmpsIO::readRowTypes(const char * filename)
+{
+  int numberRows = core_.getNumRows();
+  const char * rowSense = core_.getRowSense();
+  mpsRowType_.assign(rowSense,rowSense+numberRows);
+  bool ranged = false;
+  for (int iRow=0;iRow<numberRows;iRow++) {
+    if (rowSense[iRow]=='R') {
+      // unless the file says otherwise
+      mpsRowType_[iRow]='L';
+      ranged = true;
+    }
+  }
+  if (!ranged)
+    return;
+  /*
+    CoinMpsIO keeps only the bounds of a ranged row, which do not say at
+    which end the right hand side was.  Look at the ROWS and RANGES
+    sections again to find out.
+  */
+  CoinFileInput * input = openFile(filename);
+  if (!input)
+    return;
+  const char * rangeName = core_.getRangeName();
+  enum { otherSection, rowsSection, rangesSection } section = otherSection;
+  char line[smpsLineLength];
+  char * token[5];
+  while (input->gets(line,smpsLineLength)) {
+    if (line[0]=='*')
+      continue;
+    bool header = !isspace(static_cast<unsigned char>(line[0]));
+    int n = splitLine(line,token,5);
+    if (!n)
+      continue;
+    if (header) {
+      if (!strcmp(token[0],"ENDATA"))
+	break;
+      if (!strcmp(token[0],"ROWS"))
+	section = rowsSection;
+      else if (!strcmp(token[0],"RANGES"))
+	section = rangesSection;
+      else
+	section = otherSection;
+      continue;
+    }
+    if (section==rowsSection&&n==2) {
+      // type name
+      int iRow = core_.rowIndex(token[1]);
+      char type = static_cast<char>(toupper(token[0][0]));
+      if (iRow>=0&&iRow<numberRows&&rowSense[iRow]=='R'&&
+	  (type=='L'||type=='G'||type=='E'))
+	mpsRowType_[iRow]=type;
+    } else if (section==rangesSection) {
+      // [set] row value [row value] - only the set CoinMpsIO used
+      int first = n%2;
+      if (first&&rangeName&&strcmp(token[0],rangeName))
+	continue;
+      for (int i=first;i+1<n;i+=2) {
+	int iRow = core_.rowIndex(token[i]);
+	if (iRow>=0&&iRow<numberRows&&mpsRowType_[iRow]=='E'&&
+	    atof(token[i+1])<0.0)
+	  mpsRowType_[iRow]='e';
+      }
+    }
+  }
+  delete input;
+}
+
+int
+CoinSmpsIO::readTime(const char * filename)
+{
+  CoinFileInput * input = openFile(filename);
+  if (!input) {
+    handler_->message(COIN_MPS_FILE,messages_)<<filename<<CoinMessageEol;
+    return -1;
+  }
+  int numberRows = core_.getNumRows();
+  int numberColumns = core_.getNumCols();
+  rowStage_.assign(numberRows,-1);
+  columnStage_.assign(numberColumns,-1);
+  // implicit form - first column and row of each stage
+  std::vector<int> firstColumn;
+  std::vector<int> firstRow;
+  bool implicit = true;
+  int numberErrors=0;
+  int lineNumber=0;
+  enum { noSection, periodsSection, rowsSection, columnsSection } section =
+    noSection;
+  char line[smpsLineLength];
+  char * token[4];
+  while (input->gets(line,smpsLineLength)) {
+    lineNumber++;
+    if (line[0]=='*')
+      continue;
+    bool header = !isspace(static_cast<unsigned char>(line[0]));
+    int n = splitLine(line,token,4);
+    if (!n)
+      continue;
+    if (header) {
+      if (!strcmp(token[0],"ENDATA"))
+	break;
+      if (!strcmp(token[0],"PERIODS")) {
+	section = periodsSection;
+	if (n>1&&!strcmp(token[1],"EXPLICIT"))
+	  implicit = false;
+      } else if (!strcmp(token[0],"ROWS")) {
+	section = rowsSection;
+	implicit = false;
+      } else if (!strcmp(token[0],"COLUMNS")) {
+	section = columnsSection;
+	implicit = false;
+      } else if (strcmp(token[0],"TIME")&&strcmp(token[0],"NAME")) {
+	warning(filename,lineNumber,"unknown section");
+	numberErrors++;
+	section = noSection;
+      }
+      continue;
+    }
+    if (section==periodsSection&&n==3) {
+      // column row period
+      int iColumn = core_.columnIndex(token[0]);
+      int iRow = core_.rowIndex(token[1]);
+      if (iColumn<0||iRow<0||iRow>=numberRows) {
+	warning(filename,lineNumber,"unknown row or column");
+	numberErrors++;
+	continue;
+      }
+      if (!firstColumn.empty()&&
+	  (iColumn<=firstColumn.back()||iRow<=firstRow.back())) {
+	warning(filename,lineNumber,"periods out of order");
+	numberErrors++;
+	continue;
+      }
+      firstColumn.push_back(iColumn);
+      firstRow.push_back(iRow);
+      stageNames_.push_back(token[2]);
+    } else if (section==periodsSection&&n==1) {
+      // explicit form lists the periods
+      stageNames_.push_back(token[0]);
+      implicit = false;
+    } else if ((section==rowsSection||section==columnsSection)&&n==2) {
+      int iStage;
+      for (iStage=0;iStage<getNumStages();iStage++) {
+	if (stageNames_[iStage]==token[1])
+	  break;
+      }
+      if (iStage==getNumStages())
+	stageNames_.push_back(token[1]);
+      if (section==rowsSection) {
+	int iRow = core_.rowIndex(token[0]);
+	if (iRow>=0&&iRow<numberRows) {
+	  rowStage_[iRow]=iStage;
+	  continue;
+	}
+	if (iRow==numberRows)
+	  continue; // objective
+      } else {
+	int iColumn = core_.columnIndex(token[0]);
+	if (iColumn>=0) {
+	  columnStage_[iColumn]=iStage;
+	  continue;
+	}
+      }
+      warning(filename,lineNumber,"unknown row or column");
+      numberErrors++;
+    } else {
+      warning(filename,lineNumber,"bad line");
+      numberErrors++;
+    }
+  }
+  delete input;
+  if (implicit) {
+    int numberStages = getNumStages();
+    if (!numberStages) {
+      warning(filename,lineNumber,"no periods");
+      return numberErrors+1;
+    }
+    int iStage=0;
+    for (int iRow=0;iRow<numberRows;iRow++) {
+      while (iStage+1<numberStages&&iRow>=firstRow[iStage+1])
+	iStage++;
+      rowStage_[iRow]=iStage;
+    }
+    iStage=0;
+    for (int iColumn=0;iColumn<numberColumns;iColumn++) {
+      while (iStage+1<numberStages&&iColumn>=firstColumn[iStage+1])
+	iStage++;
+      columnStage_[iColumn]=iStage;
+    }
+  } else {
+    // anything not mentioned goes in first stage
+    for (int iRow=0;iRow<numberRows;iRow++) {
+      if (rowStage_[iRow]<0)
+	rowStage_[iRow]=0;
+    }
+    for (int iColumn=0;iColumn<numberColumns;iColumn++) {
+      if (columnStage_[iColumn]<0)
+	columnStage_[iColumn]=0;
+    }
+  }
+  return numberErrors;
+}
+
+int
+CoinSmpsIO::readStoch(const char * filename)
+{
+  CoinFileInput * input = openFile(filename);
+  if (!input) {
+    handler_->message(COIN_MPS_FILE,messages_)<<filename<<CoinMessageEol;
+    return -1;
+  }
+  int numberRows = core_.getNumRows();
+  const double infinity = core_.getInfinity();
+  const char * rangeName = core_.getRangeName();
+  int numberErrors=0;
+  int lineNumber=0;
+  SmpsMode mode = smpsReplace;
+  enum { noSection, scenariosSection, skipSection } section = noSection;
+  bool inScenario = false;
+  char line[smpsLineLength];
+  char * token[6];
+  // start of each scenario so far
+  changeStart_.clear();
+  while (input->gets(line,smpsLineLength)) {
+    lineNumber++;
+    if (line[0]=='*')
+      continue;
+    bool header = !isspace(static_cast<unsigned char>(line[0]));
+    int n = splitLine(line,token,6);
+    if (!n)
+      continue;
+    if (header) {
+      if (!strcmp(token[0],"ENDATA"))
+	break;
+      if (!strcmp(token[0],"SCENARIOS")) {
+	section = scenariosSection;
+	mode = smpsReplace;
+	for (int i=1;i<n;i++) {
+	  if (!strcmp(token[i],"ADD"))
+	    mode = smpsAdd;
+	  else if (!strcmp(token[i],"MULTIPLY"))
+	    mode = smpsMultiply;
+	}
+      } else if (!strcmp(token[0],"STOCH")||!strcmp(token[0],"NAME")) {
+	section = noSection;
+      } else {
+	// INDEP and BLOCKS are not supported
+	warning(filename,lineNumber,"section not supported");
+	numberErrors++;
+	section = skipSection;
+      }
+      continue;
+    }
+    if (section==skipSection)
+      continue;
+    if (section!=scenariosSection) {
+      warning(filename,lineNumber,"bad line");
+      numberErrors++;
+      continue;
+    }
+    if (!strcmp(token[0],"SC")) {
+      // SC name parent probability stage
+      double probability=0.0;
+      if (n<5||!isNumber(token[3],probability)) {
+	warning(filename,lineNumber,"bad scenario line");
+	numberErrors++;
+	inScenario = false;
+	continue;
+      }
+      const char * parentName = unquote(token[2]);
+      int parent=-1;
+      if (strcmp(parentName,"ROOT")) {
+	std::map<std::string,int>::const_iterator found =
+	  scenarioIndex_.find(parentName);
+	if (found==scenarioIndex_.end()) {
+	  warning(filename,lineNumber,"unknown parent scenario");
+	  numberErrors++;
+	  inScenario = false;
+	  continue;
+	}
+	parent = found->second;
+      }
+      const char * stageName = unquote(token[4]);
+      int iStage;
+      for (iStage=1;iStage<getNumStages();iStage++) {
+	if (stageNames_[iStage]==stageName)
+	  break;
+      }
+      if (iStage==getNumStages()||(parent<0&&iStage!=1)) {
+	warning(filename,lineNumber,"bad branching stage");
+	numberErrors++;
+	inScenario = false;
+	continue;
+      }
+      scenarioIndex_[token[1]] = getNumScenarios();
+      scenarioNames_.push_back(token[1]);
+      scenarioParent_.push_back(parent);
+      scenarioStage_.push_back(iStage);
+      scenarioProbability_.push_back(probability);
+      changeStart_.push_back(getNumChanges());
+      inScenario = true;
+      continue;
+    }
+    if (!inScenario) {
+      // already reported
+      continue;
+    }
+    // values are relative to what the scenario has so far
+    const int iScenario = getNumScenarios()-1;
+    double value;
+    if ((n==4&&isNumber(token[3],value))||(n==3&&!isNumber(token[2],value))) {
+      // bound - type set column [value]
+      int iColumn = core_.columnIndex(token[2]);
+      if (iColumn<0) {
+	warning(filename,lineNumber,"unknown column");
+	numberErrors++;
+	continue;
+      }
+      const char * type = token[0];
+      const double lower =
+	scenarioValue(iScenario,columnLowerChange,-1,iColumn);
+      const double upper =
+	scenarioValue(iScenario,columnUpperChange,-1,iColumn);
+      if (!strcmp(type,"UP")) {
+	addChange(columnUpperChange,-1,iColumn,applyMode(mode,upper,value));
+      } else if (!strcmp(type,"LO")) {
+	addChange(columnLowerChange,-1,iColumn,applyMode(mode,lower,value));
+      } else if (!strcmp(type,"FX")) {
+	addChange(columnLowerChange,-1,iColumn,applyMode(mode,lower,value));
+	addChange(columnUpperChange,-1,iColumn,applyMode(mode,upper,value));
+      } else if (!strcmp(type,"FR")&&n==3) {
+	addChange(columnLowerChange,-1,iColumn,-COIN_DBL_MAX);
+	addChange(columnUpperChange,-1,iColumn,COIN_DBL_MAX);
+      } else if (!strcmp(type,"MI")&&n==3) {
+	addChange(columnLowerChange,-1,iColumn,-COIN_DBL_MAX);
+      } else if (!strcmp(type,"PL")&&n==3) {
+	addChange(columnUpperChange,-1,iColumn,COIN_DBL_MAX);
+      } else {
+	warning(filename,lineNumber,"bound type not supported");
+	numberErrors++;
+      }
+      continue;
+    }
+    if ((n!=3&&n!=5)||!isNumber(token[2],value)||
+	(n==5&&!isNumber(token[4],value))) {
+      warning(filename,lineNumber,"bad line");
+      numberErrors++;
+      continue;
+    }
+    // name row value [row value] - name is column, RHS set or range set
+    int iColumn = core_.columnIndex(token[0]);
+    bool isRange = iColumn<0&&rangeName&&!strcmp(token[0],rangeName);
+    for (int iPair=0;iPair<n/2;iPair++) {
+      int iRow = core_.rowIndex(token[1+2*iPair]);
+      value = atof(token[2+2*iPair]);
+      if (iRow<0||iRow>numberRows) {
+	warning(filename,lineNumber,"unknown row");
+	numberErrors++;
+      } else if (iColumn>=0) {
+	if (iRow==numberRows)
+	  addChange(objectiveChange,-1,iColumn,
+		    applyMode(mode,scenarioValue(iScenario,objectiveChange,
+						 -1,iColumn),value));
+	else
+	  addChange(coefficientChange,iRow,iColumn,
+		    applyMode(mode,scenarioValue(iScenario,coefficientChange,
+						 iRow,iColumn),value));
+      } else if (iRow==numberRows) {
+	warning(filename,lineNumber,"objective constant not supported");
+	numberErrors++;
+      } else if (mpsRowType_[iRow]!='N') {
+	/*
+	  Work in MPS terms: the right hand side is at one end of the row
+	  (see rhsAtLower) and the range gives the other end.  Changing one
+	  keeps the other.
+	*/
+	const char type = mpsRowType_[iRow];
+	const bool isEqual = type=='E'||type=='e';
+	double lower = scenarioValue(iScenario,rowLowerChange,iRow,-1);
+	double upper = scenarioValue(iScenario,rowUpperChange,iRow,-1);
+	const bool atLower = rhsAtLower(iScenario,iRow);
+	const double oldRhs = atLower ? lower : upper;
+	const bool lowerFinite = lower>-infinity;
+	const bool upperFinite = upper<infinity;
+	if (isRange) {
+	  // no range is infinite for L and G rows, zero for E rows
+	  double oldRange;
+	  if (isEqual)
+	    oldRange = atLower ? upper-lower : lower-upper;
+	  else if (lowerFinite&&upperFinite)
+	    oldRange = upper-lower;
+	  else if (mode==smpsReplace)
+	    oldRange = infinity;
+	  else
+	    continue; // adding to or scaling an infinite range
+	  double newRange = applyMode(mode,oldRange,value);
+	  if (type=='L') {
+	    lower = oldRhs-fabs(newRange);
+	  } else if (type=='G') {
+	    upper = oldRhs+fabs(newRange);
+	  } else {
+	    lower = newRange>=0.0 ? oldRhs : oldRhs+newRange;
+	    upper = newRange>=0.0 ? oldRhs+newRange : oldRhs;
+	    rangeNegative_[std::make_pair(iScenario,iRow)] = newRange<0.0;
+	  }
+	  addChange(rowLowerChange,iRow,-1,lower);
+	  addChange(rowUpperChange,iRow,-1,upper);
+	} else {
+	  double newRhs = applyMode(mode,oldRhs,value);
+	  if (atLower) {
+	    addChange(rowLowerChange,iRow,-1,newRhs);
+	    if (upperFinite)
+	      addChange(rowUpperChange,iRow,-1,newRhs+(upper-lower));
+	  } else {
+	    if (lowerFinite)
+	      addChange(rowLowerChange,iRow,-1,newRhs-(upper-lower));
+	    addChange(rowUpperChange,iRow,-1,newRhs);
+	  }
+	}
+      }
+    }
+  }
+  delete input;
+  if (!getNumScenarios()) {
+    warning(filename,lineNumber,"no scenarios");
+    numberErrors++;
+  }
+  // close last scenario
+  changeStart_.push_back(getNumChanges());
+  rangeNegative_.clear();
+  return numberErrors;
+}
+
+void
+CoinSmpsIO::warning(const char * filename, int lineNumber, const char * text)
+{
+  char printBuffer[512];
+  sprintf(printBuffer,"%s at line %d of %s",text,lineNumber,filename);
+  handler_->message(COIN_GENERAL_WARNING,messages_)<<printBuffer
+						   <<CoinMessageEol;
+}
+
+void
+CoinSmpsIO::addChange(ChangeType type, int row, int column, double value)
+{
+  changeIndex_[ChangeKey(getNumScenarios()-1,type,row,column)] =
+    getNumChanges();
+  changeType_.push_back(static_cast<char>(type));
+  changeRow_.push_back(row);
+  changeColumn_.push_back(column);
+  changeValue_.push_back(value);
+}
+
+//#############################################################################
+// Values
+//#############################################################################
+
+double
+CoinSmpsIO::coreValue(ChangeType type, int row, int column) const
+{
+  switch (type) {
+  case coefficientChange:
+    {
+      const CoinPackedMatrix * matrix = core_.getMatrixByCol();
+      const int * rowIndex = matrix->getIndices();
+      const double * element = matrix->getElements();
+      CoinBigIndex start = matrix->getVectorStarts()[column];
+      CoinBigIndex end = start+matrix->getVectorLengths()[column];
+      for (CoinBigIndex j=start;j<end;j++) {
+	if (rowIndex[j]==row)
+	  return element[j];
+      }
+      return 0.0;
+    }
+  case rowLowerChange:
+    return core_.getRowLower()[row];
+  case rowUpperChange:
+    return core_.getRowUpper()[row];
+  case objectiveChange:
+    return core_.getObjCoefficients()[column];
+  case columnLowerChange:
+    return core_.getColLower()[column];
+  default:
+    return core_.getColUpper()[column];
+  }
+}
+
+bool
+CoinSmpsIO::rhsAtLower(int iScenario, int iRow) const
+{
+  const char type = mpsRowType_[iRow];
+  if (type=='L')
+    return false;
+  if (type!='E'&&type!='e')
+    return true;
+  // E rows - the sign of the latest range decides
+  for (int jScenario=iScenario;jScenario>=0;
+       jScenario=scenarioParent_[jScenario]) {
+    std::map<std::pair<int,int>,bool>::const_iterator found =
+      rangeNegative_.find(std::make_pair(jScenario,iRow));
+    if (found!=rangeNegative_.end())
+      return !found->second;
+  }
+  return type=='E';
+}
+
+int
+CoinSmpsIO::changeStage(CoinBigIndex iChange) const
+{
+  int type = changeType_[iChange];
+  if (type==objectiveChange||type==columnLowerChange||
+      type==columnUpperChange)
+    return columnStage_[changeColumn_[iChange]];
+  else
+    return rowStage_[changeRow_[iChange]];
+}
+
+double
+CoinSmpsIO::scenarioValue(int iScenario, ChangeType type,
+			  int row, int column) const
+{
+  // one probe per generation - the index holds the latest change
+  for (int jScenario=iScenario;jScenario>=0;
+       jScenario=scenarioParent_[jScenario]) {
+    std::map<ChangeKey,CoinBigIndex>::const_iterator found =
+      changeIndex_.find(ChangeKey(jScenario,type,row,column));
+    if (found!=changeIndex_.end())
+      return changeValue_[found->second];
+  }
+  return coreValue(type,row,column);
+}
+
+CoinSmpsIO::ChangeKey::ChangeKey(int iScenario, ChangeType changeType,
+				 int iRow, int iColumn)
+  : scenario(iScenario),
+    type(changeType),
+    row(iRow),
+    column(iColumn)
+{
+  if (changeType==rowLowerChange||changeType==rowUpperChange)
+    column = -1;
+  else if (changeType!=coefficientChange)
+    row = -1;
+}
+
+bool
+CoinSmpsIO::ChangeKey::operator<(const ChangeKey & rhs) const
+{
+  if (scenario!=rhs.scenario)
+    return scenario<rhs.scenario;
+  if (type!=rhs.type)
+    return type<rhs.type;
+  if (row!=rhs.row)
+    return row<rhs.row;
+  return column<rhs.column;
+}
+
+//#############################################################################
+// Deterministic equivalent
+//#############################################################################
+
+int
+CoinSmpsIO::deterministicEquivalent(CoinStructuredModel & model) const
+{
+  int numberStages = getNumStages();
+  int numberScenarios = getNumScenarios();
+  if (numberStages<2||!numberScenarios)
+    return -1;
+  int numberRows = core_.getNumRows();
+  int numberColumns = core_.getNumCols();
+  const int * rowStage = &rowStage_[0];
+  const int * columnStage = &columnStage_[0];
+  const double * rowLower = core_.getRowLower();
+  const double * rowUpper = core_.getRowUpper();
+  const double * objective = core_.getObjCoefficients();
+  const double * columnLower = core_.getColLower();
+  const double * columnUpper = core_.getColUpper();
+  const CoinPackedMatrix * rowCopy = core_.getMatrixByRow();
+  const int * column = rowCopy->getIndices();
+  const double * elementByRow = rowCopy->getElements();
+  const CoinBigIndex * rowStart = rowCopy->getVectorStarts();
+  const int * rowLength = rowCopy->getVectorLengths();
+  // Rows and columns of each stage in order
+  std::vector<int> stageRowStart(numberStages+1,0);
+  std::vector<int> stageColumnStart(numberStages+1,0);
+  for (int iRow=0;iRow<numberRows;iRow++)
+    stageRowStart[rowStage[iRow]+1]++;
+  for (int iColumn=0;iColumn<numberColumns;iColumn++)
+    stageColumnStart[columnStage[iColumn]+1]++;
+  for (int iStage=0;iStage<numberStages;iStage++) {
+    stageRowStart[iStage+1] += stageRowStart[iStage];
+    stageColumnStart[iStage+1] += stageColumnStart[iStage];
+  }
+  std::vector<int> stageRow(numberRows);
+  std::vector<int> rowPosition(numberRows);
+  std::vector<int> stageColumn(numberColumns);
+  std::vector<int> columnPosition(numberColumns);
+  {
+    std::vector<int> put(stageRowStart.begin(),stageRowStart.end()-1);
+    for (int iRow=0;iRow<numberRows;iRow++) {
+      int iStage = rowStage[iRow];
+      rowPosition[iRow] = put[iStage]-stageRowStart[iStage];
+      stageRow[put[iStage]++]=iRow;
+    }
+    put.assign(stageColumnStart.begin(),stageColumnStart.end()-1);
+    for (int iColumn=0;iColumn<numberColumns;iColumn++) {
+      int iStage = columnStage[iColumn];
+      columnPosition[iColumn] = put[iStage]-stageColumnStart[iStage];
+      stageColumn[put[iStage]++]=iColumn;
+    }
+  }
+  /*
+    Nodes of the scenario tree (after the first stage).  A scenario owns
+    the nodes from its branching stage on and shares earlier ones with its
+    parent.  Each scenario which branches at the second stage starts a
+    block.
+  */
+  std::vector<int> scenarioNode(numberScenarios*numberStages,-1);
+  std::vector<int> nodeScenario;
+  std::vector<int> nodeStage;
+  std::vector<int> nodeBlock;
+  std::vector<int> nodeRowOffset;
+  std::vector<int> nodeColumnOffset;
+  std::vector<double> nodeProbability;
+  std::vector<int> blockRows;
+  std::vector<int> blockColumns;
+  std::vector<int> scenarioBlock(numberScenarios);
+  for (int iScenario=0;iScenario<numberScenarios;iScenario++) {
+    int parent = scenarioParent_[iScenario];
+    int branch = scenarioStage_[iScenario];
+    int iBlock;
+    if (branch==1) {
+      iBlock = static_cast<int>(blockRows.size());
+      blockRows.push_back(0);
+      blockColumns.push_back(0);
+    } else {
+      iBlock = scenarioBlock[parent];
+    }
+    scenarioBlock[iScenario]=iBlock;
+    int * node = &scenarioNode[iScenario*numberStages];
+    for (int iStage=1;iStage<numberStages;iStage++) {
+      if (iStage<branch) {
+	node[iStage]=scenarioNode[parent*numberStages+iStage];
+      } else {
+	node[iStage]=static_cast<int>(nodeStage.size());
+	nodeScenario.push_back(iScenario);
+	nodeStage.push_back(iStage);
+	nodeBlock.push_back(iBlock);
+	nodeRowOffset.push_back(blockRows[iBlock]);
+	nodeColumnOffset.push_back(blockColumns[iBlock]);
+	nodeProbability.push_back(0.0);
+	blockRows[iBlock] += stageRowStart[iStage+1]-stageRowStart[iStage];
+	blockColumns[iBlock] +=
+	  stageColumnStart[iStage+1]-stageColumnStart[iStage];
+      }
+      nodeProbability[node[iStage]] += scenarioProbability_[iScenario];
+    }
+  }
+  int numberNodes = static_cast<int>(nodeStage.size());
+  int numberBlocks = static_cast<int>(blockRows.size());
+  int numberMasterRows = stageRowStart[1];
+  int numberMasterColumns = stageColumnStart[1];
+  // Master rows may only use master columns
+  for (int i=0;i<numberMasterRows;i++) {
+    int iRow = stageRow[i];
+    for (CoinBigIndex j=rowStart[iRow];j<rowStart[iRow]+rowLength[iRow];j++) {
+      if (columnStage[column[j]])
+	return -1;
+    }
+  }
+  /*
+    Work arrays.  Row and column bound changes are marked by node in a
+    single array (row lower, row upper, objective, column lower, column
+    upper).  Coefficient changes are marked by row.
+  */
+  int offsetRowUpper = numberRows;
+  int offsetObjective = 2*numberRows;
+  int offsetColumnLower = offsetObjective+numberColumns;
+  int offsetColumnUpper = offsetColumnLower+numberColumns;
+  std::vector<int> mark(2*numberRows+3*numberColumns,-1);
+  std::vector<double> markValue(2*numberRows+3*numberColumns);
+  std::vector<int> columnMark(numberColumns,-1);
+  std::vector<double> columnValue(numberColumns);
+  std::vector<CoinBigIndex> coefficient;
+  std::vector<CoinBigIndex> sortedCoefficient;
+  std::vector<int> newColumn;
+  int rowStamp=0;
+  // Which nodes in each block
+  std::vector<int> blockNodeStart(numberBlocks+1,0);
+  std::vector<int> blockNode(numberNodes);
+  for (int iNode=0;iNode<numberNodes;iNode++)
+    blockNodeStart[nodeBlock[iNode]+1]++;
+  for (int iBlock=0;iBlock<numberBlocks;iBlock++)
+    blockNodeStart[iBlock+1] += blockNodeStart[iBlock];
+  {
+    std::vector<int> put(blockNodeStart.begin(),blockNodeStart.end()-1);
+    for (int iNode=0;iNode<numberNodes;iNode++)
+      blockNode[put[nodeBlock[iNode]]++]=iNode;
+  }
+  model.setObjectiveOffset(core_.objectiveOffset());
+  // Name for master so at beginning
+  model.addColumnBlock(numberMasterColumns,"column_master");
+  CoinPackedMatrix empty;
+  bool badStage = false;
+  for (int iBlock=0;iBlock<numberBlocks&&!badStage;iBlock++) {
+    int numberRow2 = blockRows[iBlock];
+    int numberColumn2 = blockColumns[iBlock];
+    std::vector<double> rowLo(numberRow2), rowUp(numberRow2);
+    std::vector<double> obj(numberColumn2), columnLo(numberColumn2),
+      columnUp(numberColumn2);
+    std::vector<int> whichRow(numberRow2), whichColumn(numberColumn2);
+    // Elements as triples - diagonal and border
+    std::vector<int> diagonalRow, diagonalColumn, borderRow, borderColumn;
+    std::vector<double> diagonalElement, borderElement;
+    for (int k=blockNodeStart[iBlock];k<blockNodeStart[iBlock+1];k++) {
+      int iNode = blockNode[k];
+      int iStage = nodeStage[iNode];
+      int iScenario = nodeScenario[iNode];
+      const int * node = &scenarioNode[iScenario*numberStages];
+      // Changes for this stage - nearest scenario first
+      coefficient.clear();
+      for (int jScenario=iScenario;jScenario>=0;
+	   jScenario=scenarioParent_[jScenario]) {
+	for (CoinBigIndex j=changeStart_[jScenario+1]-1;
+	     j>=changeStart_[jScenario];j--) {
+	  if (changeStage(j)!=iStage)
+	    continue;
+	  int type = changeType_[j];
+	  int slot;
+	  switch (type) {
+	  case coefficientChange:
+	    coefficient.push_back(j);
+	    continue;
+	  case rowLowerChange:
+	    slot = changeRow_[j];
+	    break;
+	  case rowUpperChange:
+	    slot = offsetRowUpper+changeRow_[j];
+	    break;
+	  case objectiveChange:
+	    slot = offsetObjective+changeColumn_[j];
+	    break;
+	  case columnLowerChange:
+	    slot = offsetColumnLower+changeColumn_[j];
+	    break;
+	  default:
+	    slot = offsetColumnUpper+changeColumn_[j];
+	    break;
+	  }
+	  if (mark[slot]!=iNode) {
+	    mark[slot]=iNode;
+	    markValue[slot]=changeValue_[j];
+	  }
+	}
+      }
+      // Coefficient changes by row (stable so nearest stays first)
+      int numberStageRows = stageRowStart[iStage+1]-stageRowStart[iStage];
+      std::vector<int> changeStart(numberStageRows+1,0);
+      for (size_t i=0;i<coefficient.size();i++)
+	changeStart[rowPosition[changeRow_[coefficient[i]]]+1]++;
+      for (int i=0;i<numberStageRows;i++)
+	changeStart[i+1] += changeStart[i];
+      sortedCoefficient.resize(coefficient.size());
+      {
+	std::vector<int> put(changeStart.begin(),changeStart.end()-1);
+	for (size_t i=0;i<coefficient.size();i++)
+	  sortedCoefficient[put[rowPosition[changeRow_[coefficient[i]]]]++] =
+	    coefficient[i];
+      }
+      // Rows
+      for (int i=0;i<numberStageRows;i++) {
+	int iRow = stageRow[stageRowStart[iStage]+i];
+	int row2 = nodeRowOffset[iNode]+i;
+	whichRow[row2]=iRow;
+	rowLo[row2] = mark[iRow]==iNode ? markValue[iRow] : rowLower[iRow];
+	rowUp[row2] = mark[offsetRowUpper+iRow]==iNode ?
+	  markValue[offsetRowUpper+iRow] : rowUpper[iRow];
+	rowStamp++;
+	newColumn.clear();
+	for (int j=changeStart[i];j<changeStart[i+1];j++) {
+	  CoinBigIndex iChange = sortedCoefficient[j];
+	  int iColumn = changeColumn_[iChange];
+	  if (columnMark[iColumn]!=rowStamp) {
+	    columnMark[iColumn]=rowStamp;
+	    columnValue[iColumn]=changeValue_[iChange];
+	    newColumn.push_back(iColumn);
+	  }
+	}
+	// core elements then any new ones
+	CoinBigIndex start = rowStart[iRow];
+	CoinBigIndex end = start+rowLength[iRow];
+	int numberNew = static_cast<int>(newColumn.size());
+	for (CoinBigIndex j=start;j<end+numberNew;j++) {
+	  int iColumn;
+	  double value;
+	  if (j<end) {
+	    iColumn = column[j];
+	    value = elementByRow[j];
+	    if (columnMark[iColumn]==rowStamp) {
+	      value = columnValue[iColumn];
+	      columnMark[iColumn]=-1;
+	    }
+	  } else {
+	    iColumn = newColumn[j-end];
+	    if (columnMark[iColumn]!=rowStamp)
+	      continue;
+	    value = columnValue[iColumn];
+	    columnMark[iColumn]=-1;
+	  }
+	  if (!value)
+	    continue;
+	  int jStage = columnStage[iColumn];
+	  if (jStage>iStage) {
+	    badStage = true;
+	  } else if (!jStage) {
+	    borderRow.push_back(row2);
+	    borderColumn.push_back(columnPosition[iColumn]);
+	    borderElement.push_back(value);
+	  } else {
+	    diagonalRow.push_back(row2);
+	    diagonalColumn.push_back(nodeColumnOffset[node[jStage]]+
+				     columnPosition[iColumn]);
+	    diagonalElement.push_back(value);
+	  }
+	}
+      }
+      // Columns
+      double probability = nodeProbability[iNode];
+      int numberStageColumns =
+	stageColumnStart[iStage+1]-stageColumnStart[iStage];
+      for (int i=0;i<numberStageColumns;i++) {
+	int iColumn = stageColumn[stageColumnStart[iStage]+i];
+	int column2 = nodeColumnOffset[iNode]+i;
+	whichColumn[column2]=iColumn;
+	int slot = offsetObjective+iColumn;
+	obj[column2] = probability *
+	  (mark[slot]==iNode ? markValue[slot] : objective[iColumn]);
+	slot = offsetColumnLower+iColumn;
+	columnLo[column2] = mark[slot]==iNode ? markValue[slot] :
+	  columnLower[iColumn];
+	slot = offsetColumnUpper+iColumn;
+	columnUp[column2] = mark[slot]==iNode ? markValue[slot] :
+	  columnUpper[iColumn];
+      }
+    }
+    if (badStage)
+      break;
+    char rowName[20];
+    sprintf(rowName,"row_%d",iBlock);
+    char columnName[20];
+    sprintf(columnName,"column_%d",iBlock);
+    int numberElements = static_cast<int>(diagonalElement.size());
+    CoinPackedMatrix diagonal(true,
+			      numberElements ? &diagonalRow[0] : NULL,
+			      numberElements ? &diagonalColumn[0] : NULL,
+			      numberElements ? &diagonalElement[0] : NULL,
+			      numberElements);
+    diagonal.setDimensions(numberRow2,numberColumn2);
+    CoinModel * block = new CoinModel(numberRow2,numberColumn2,&empty,
+				      numberRow2 ? &rowLo[0] : NULL,
+				      numberRow2 ? &rowUp[0] : NULL,
+				      numberColumn2 ? &columnLo[0] : NULL,
+				      numberColumn2 ? &columnUp[0] : NULL,
+				      numberColumn2 ? &obj[0] : NULL);
+    block->assignMatrix(diagonal);
+    block->setOriginalIndices(numberRow2 ? &whichRow[0] : NULL,
+			      numberColumn2 ? &whichColumn[0] : NULL);
+    model.addBlock(rowName,columnName,block); // takes ownership
+    // and beginning block
+    numberElements = static_cast<int>(borderElement.size());
+    CoinPackedMatrix border(true,
+			    numberElements ? &borderRow[0] : NULL,
+			    numberElements ? &borderColumn[0] : NULL,
+			    numberElements ? &borderElement[0] : NULL,
+			    numberElements);
+    border.setDimensions(numberRow2,numberMasterColumns);
+    block = new CoinModel(numberRow2,numberMasterColumns,&empty,
+			  NULL,NULL,NULL,NULL,NULL);
+    block->assignMatrix(border);
+    block->setOriginalIndices(numberRow2 ? &whichRow[0] : NULL,
+			      numberMasterColumns ? &stageColumn[0] : NULL);
+    model.addBlock(rowName,"column_master",block); // takes ownership
+  }
+  if (badStage)
+    return -1;
+  // and master
+  std::vector<double> rowLo(numberMasterRows), rowUp(numberMasterRows);
+  std::vector<double> obj(numberMasterColumns), columnLo(numberMasterColumns),
+    columnUp(numberMasterColumns);
+  std::vector<int> masterRow, masterColumn;
+  std::vector<double> masterElement;
+  for (int i=0;i<numberMasterRows;i++) {
+    int iRow = stageRow[i];
+    rowLo[i]=rowLower[iRow];
+    rowUp[i]=rowUpper[iRow];
+    for (CoinBigIndex j=rowStart[iRow];j<rowStart[iRow]+rowLength[iRow];j++) {
+      masterRow.push_back(i);
+      masterColumn.push_back(columnPosition[column[j]]);
+      masterElement.push_back(elementByRow[j]);
+    }
+  }
+  for (int i=0;i<numberMasterColumns;i++) {
+    int iColumn = stageColumn[i];
+    obj[i]=objective[iColumn];
+    columnLo[i]=columnLower[iColumn];
+    columnUp[i]=columnUpper[iColumn];
+  }
+  int numberElements = static_cast<int>(masterElement.size());
+  CoinPackedMatrix master(true,
+			  numberElements ? &masterRow[0] : NULL,
+			  numberElements ? &masterColumn[0] : NULL,
+			  numberElements ? &masterElement[0] : NULL,
+			  numberElements);
+  master.setDimensions(numberMasterRows,numberMasterColumns);
+  CoinModel * block =
+    new CoinModel(numberMasterRows,numberMasterColumns,&empty,
+		  numberMasterRows ? &rowLo[0] : NULL,
+		  numberMasterRows ? &rowUp[0] : NULL,
+		  numberMasterColumns ? &columnLo[0] : NULL,
+		  numberMasterColumns ? &columnUp[0] : NULL,
+		  numberMasterColumns ? &obj[0] : NULL);
+  block->assignMatrix(master);
+  block->setOriginalIndices(numberMasterRows ? &stageRow[0] : NULL,
+			    numberMasterColumns ? &stageColumn[0] : NULL);
+  model.addBlock("row_master","column_master",block); // takes ownership
+  return numberBlocks;
+}
+
+//#############################################################################
+// Message handling
+//#############################################################################
+
+void
+CoinSmpsIO::passInMessageHandler(CoinMessageHandler * handler)
+{
+  if (defaultHandler_)
+    delete handler_;
+  defaultHandler_ = false;
+  handler_ = handler;
+  core_.passInMessageHandler(handler);
+}
+
+void
+CoinSmpsIO::newLanguage(CoinMessages::Language language)
+{
+  messages_ = CoinMessage(language);
+  core_.newLanguage(language);
+}
+
+//#############################################################################
+// Constructors and destructor
+//#############################################################################
+
+CoinSmpsIO::CoinSmpsIO()
+  : changeStart_(1,0),
+    handler_(new CoinMessageHandler()),
+    defaultHandler_(true),
+    messages_(CoinMessage())
+{
+}
+
+CoinSmpsIO::~CoinSmpsIO()
+{
+  if (defaultHandler_)
+    delete handler_;
+}
+
+void
+CoinSmpsIO::gutsOfDestructor()
+{
+  stageNames_.clear();
+  rowStage_.clear();
+  columnStage_.clear();
+  scenarioNames_.clear();
+  scenarioIndex_.clear();
+  scenarioParent_.clear();
+  scenarioStage_.clear();
+  scenarioProbability_.clear();
+  changeStart_.assign(1,0);
+  changeType_.clear();
+  changeRow_.clear();
+  changeColumn_.clear();
+  changeValue_.clear();
+  changeIndex_.clear();
+  mpsRowType_.clear();
+  rangeNegative_.clear();
+}
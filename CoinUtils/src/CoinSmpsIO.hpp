@@ -0,0 +1,265 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinSmpsIO_H
+#define CoinSmpsIO_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CoinMpsIO.hpp"
+#include "CoinMessage.hpp"
+
+class CoinStructuredModel;
+
+/*! \brief Reader for stochastic programs in SMPS format
+
+  An SMPS problem is given by three files:
+  <ul>
+  <li> the core file, a deterministic problem in MPS format (read with
+       CoinMpsIO);
+  <li> the time file, which splits the core rows and columns into stages,
+       either implicitly (PERIODS section giving the first column and row
+       of each stage, in core order) or explicitly (ROWS and COLUMNS
+       sections giving the stage of each);
+  <li> the stoch file, giving the scenarios.
+  </ul>
+
+  Only SCENARIOS sections of the stoch file are read (REPLACE, ADD or
+  MULTIPLY).  Each scenario has a parent (or ROOT), the stage at which it
+  branches from the parent and a probability.  It is the same as its parent
+  except for the values it lists.  The reader keeps a scenario as just that
+  list of changes, so memory grows with the number of changes in the stoch
+  file and not with the number of scenarios times the size of the core.
+  Changes are stored as the value which replaces the core value, whatever
+  the mode of the file (ADD and MULTIPLY are applied to the value the
+  scenario has from its parent).  A change to the right hand side or range
+  of a row is stored as a change to its lower and/or upper bound, following
+  the MPS rules for the row type given in the core file: the right hand side
+  is the upper bound of an L row and the lower bound of a G row, and of an
+  E row the lower bound unless its range is negative.
+
+  deterministicEquivalent() builds the extensive form directly as a block
+  angular CoinStructuredModel.  First stage rows and columns form the
+  master.  Each scenario which branches at the second stage starts a block
+  which holds the tree of nodes below it.  Objective coefficients are
+  weighted by node probability.
+*/
+class CoinSmpsIO {
+
+public:
+  /// What a change applies to
+  enum ChangeType {
+    /// Matrix coefficient
+    coefficientChange=0,
+    /// Row lower bound
+    rowLowerChange,
+    /// Row upper bound
+    rowUpperChange,
+    /// Objective coefficient
+    objectiveChange,
+    /// Column lower bound
+    columnLowerChange,
+    /// Column upper bound
+    columnUpperChange
+  };
+
+  /**@name Reading */
+  //@{
+    /** Read problem from base name.  Tries base.cor and base.core for the
+	core file, base.tim and base.time for the time file and base.sto
+	and base.stoch for the stoch file (compressed versions are found as
+	for CoinMpsIO).  Returns number of errors or -1 if a file could not
+	be opened.
+    */
+    int readSmps(const char * filename);
+    /** Read problem from the three files.
+	Returns number of errors or -1 if a file could not be opened.
+    */
+    int readSmps(const char * coreFile, const char * timeFile,
+		 const char * stochFile);
+  //@}
+
+  /**@name Core problem and stages */
+  //@{
+    /// Core problem
+    inline const CoinMpsIO & core() const { return core_; }
+    /// Number of stages
+    inline int getNumStages() const
+    { return static_cast<int>(stageNames_.size()); }
+    /// Name of stage
+    inline const char * stageName(int iStage) const
+    { return stageNames_[iStage].c_str(); }
+    /// Stage of each core row
+    inline const int * getRowStages() const
+    { return rowStage_.empty() ? NULL : &rowStage_[0]; }
+    /// Stage of each core column
+    inline const int * getColumnStages() const
+    { return columnStage_.empty() ? NULL : &columnStage_[0]; }
+  //@}
+
+  /**@name Scenarios */
+  //@{
+    /// Number of scenarios
+    inline int getNumScenarios() const
+    { return static_cast<int>(scenarioNames_.size()); }
+    /// Name of scenario
+    inline const char * scenarioName(int iScenario) const
+    { return scenarioNames_[iScenario].c_str(); }
+    /// Parent of scenario (-1 for ROOT)
+    inline int scenarioParent(int iScenario) const
+    { return scenarioParent_[iScenario]; }
+    /// Stage at which scenario branches from its parent
+    inline int scenarioStage(int iScenario) const
+    { return scenarioStage_[iScenario]; }
+    /// Probability of scenario
+    inline double scenarioProbability(int iScenario) const
+    { return scenarioProbability_[iScenario]; }
+    /// Total number of changes
+    inline CoinBigIndex getNumChanges() const
+    { return static_cast<CoinBigIndex>(changeValue_.size()); }
+    /** Changes of scenario i are from getChangeStarts()[i] up to (but not
+	including) getChangeStarts()[i+1]. */
+    inline const CoinBigIndex * getChangeStarts() const
+    { return &changeStart_[0]; }
+    /// Type of each change (see ChangeType)
+    inline const char * getChangeTypes() const
+    { return changeType_.empty() ? NULL : &changeType_[0]; }
+    /// Row of each change (-1 for objective and column bounds)
+    inline const int * getChangeRows() const
+    { return changeRow_.empty() ? NULL : &changeRow_[0]; }
+    /// Column of each change (-1 for row bounds)
+    inline const int * getChangeColumns() const
+    { return changeColumn_.empty() ? NULL : &changeColumn_[0]; }
+    /// New value of each change
+    inline const double * getChangeValues() const
+    { return changeValue_.empty() ? NULL : &changeValue_[0]; }
+    /** Value in a scenario, looking through the changes of the scenario
+	and its ancestors before falling back to the core.  row is ignored
+	for column changes and column for row changes.
+    */
+    double scenarioValue(int iScenario, ChangeType type,
+			 int row, int column) const;
+  //@}
+
+  /**@name Deterministic equivalent */
+  //@{
+    /** Build the deterministic equivalent as a block angular model (see
+	class description).  model should be empty.  Returns number of
+	blocks (not counting the master) or -1 if the problem has no
+	scenarios or no second stage, or if a row of some stage uses a
+	column of a later stage.
+    */
+    int deterministicEquivalent(CoinStructuredModel & model) const;
+  //@}
+
+  /**@name Message handling */
+  //@{
+    /** Pass in Message handler
+
+	Supply a custom message handler. It will not be destroyed when the
+	CoinSmpsIO object is destroyed.  It is also used for the core.
+    */
+    void passInMessageHandler(CoinMessageHandler * handler);
+    /// Set the language for messages.
+    void newLanguage(CoinMessages::Language language);
+    /// Return the message handler
+    inline CoinMessageHandler * messageHandler() const {return handler_;}
+  //@}
+
+  /**@name Constructors and destructor */
+  //@{
+    /// Default constructor
+    CoinSmpsIO();
+    /// Destructor
+    ~CoinSmpsIO();
+  //@}
+
+private:
+  /** Where to find a change in changeIndex_.  row is -1 for column
+      changes and column is -1 for row changes. */
+  struct ChangeKey {
+    ChangeKey(int iScenario, ChangeType changeType, int iRow, int iColumn);
+    bool operator<(const ChangeKey & rhs) const;
+    int scenario;
+    int type;
+    int row;
+    int column;
+  };
+  /// Not implemented
+  CoinSmpsIO(const CoinSmpsIO &);
+  /// Not implemented
+  CoinSmpsIO & operator=(const CoinSmpsIO &);
+
+  /// Clear everything except the message handler
+  void gutsOfDestructor();
+  /// Read time file, returns number of errors or -1
+  int readTime(const char * filename);
+  /// Read stoch file, returns number of errors or -1
+  int readStoch(const char * filename);
+  /// Find the row types of ranged rows in the core file (see mpsRowType_)
+  void readRowTypes(const char * filename);
+  /** Whether the right hand side of a row is its lower bound in a
+      scenario (only while reading) */
+  bool rhsAtLower(int iScenario, int iRow) const;
+  /// Warning message
+  void warning(const char * filename, int lineNumber, const char * text);
+  /// Add a change to the current scenario
+  void addChange(ChangeType type, int row, int column, double value);
+  /// Value in the core
+  double coreValue(ChangeType type, int row, int column) const;
+  /// Stage of a change
+  int changeStage(CoinBigIndex iChange) const;
+
+  /**@name Data members */
+  //@{
+    /// Core problem
+    CoinMpsIO core_;
+    /// Stage names
+    std::vector<std::string> stageNames_;
+    /// Stage of each core row
+    std::vector<int> rowStage_;
+    /// Stage of each core column
+    std::vector<int> columnStage_;
+    /// Scenario names
+    std::vector<std::string> scenarioNames_;
+    /// Scenario lookup by name
+    std::map<std::string,int> scenarioIndex_;
+    /// Parent of each scenario
+    std::vector<int> scenarioParent_;
+    /// Branching stage of each scenario
+    std::vector<int> scenarioStage_;
+    /// Probability of each scenario
+    std::vector<double> scenarioProbability_;
+    /// Start of changes for each scenario (one more than scenarios)
+    std::vector<CoinBigIndex> changeStart_;
+    /// Type of each change
+    std::vector<char> changeType_;
+    /// Row of each change
+    std::vector<int> changeRow_;
+    /// Column of each change
+    std::vector<int> changeColumn_;
+    /// Value of each change
+    std::vector<double> changeValue_;
+    /** Type of each row in the core file: 'N', 'L', 'G', 'E', or 'e' for
+	an E row with a negative range */
+    std::vector<char> mpsRowType_;
+    /// Latest change for each scenario, type, row and column
+    std::map<ChangeKey,CoinBigIndex> changeIndex_;
+    /** Whether the latest range change to an E row in a scenario is
+	negative, by scenario and row (only while reading) */
+    std::map<std::pair<int,int>,bool> rangeNegative_;
+    /// Message handler
+    CoinMessageHandler * handler_;
+    /// Whether handler_ is ours
+    bool defaultHandler_;
+    /// Messages
+    CoinMessages messages_;
+  //@}
+};
+
+#endif
@@ -230,6 +230,122 @@ CoinSort_2(S* sfirst, S* slast, T* tfirst)
 {
   CoinSort_2(sfirst, slast, tfirst, CoinFirstLess_2<S,T>());
 }
+//-----------------------------------------------------------------------------
+/** Insertion sort of int keys carrying a second array along.
+    Stable and in place; only sensible for short ranges. */
+template <class T> void
+CoinInsertionSort_2(int* key, int* lastKey, T* array2)
+{
+  const int number = static_cast<int>(coinDistance(key, lastKey));
+  for (int i = 1; i < number; i++) {
+    const int k = key[i];
+    if (k >= key[i-1])
+      continue;
+    const T t = array2[i];
+    int j = i;
+    do {
+      key[j] = key[j-1];
+      array2[j] = array2[j-1];
+      j--;
+    } while (j > 0 && key[j-1] > k);
+    key[j] = k;
+    array2[j] = t;
+  }
+}
+/** Radix sort of int keys carrying a second array along.
+
+    Least significant digit first with 8 bit digits. Keys are taken
+    relative to the smallest key so only as many passes are made as the
+    key range needs, and a pass is skipped when all keys share its digit.
+    Stable. Uses one buffer the size of the input, as std::sort on
+    CoinPair does. */
+template <class T> void
+CoinRadixSort_2(int* key, int* lastKey, T* array2)
+{
+  const size_t number = coinDistance(key, lastKey);
+  if (number <= 1)
+    return;
+  int minKey = key[0];
+  int maxKey = key[0];
+  bool sorted = true;
+  for (size_t i = 1; i < number; i++) {
+    const int k = key[i];
+    if (k < key[i-1])
+      sorted = false;
+    if (k < minKey)
+      minKey = k;
+    else if (k > maxKey)
+      maxKey = k;
+  }
+  if (sorted)
+    return;
+  // unsigned arithmetic maps [minKey,maxKey] onto [0,range] without overflow
+  const unsigned int base = static_cast<unsigned int>(minKey);
+  const unsigned int range = static_cast<unsigned int>(maxKey) - base;
+  int numberDigits = 1;
+  while (numberDigits < 4 && (range >> (8*numberDigits)) != 0)
+    numberDigits++;
+  size_t count[4][256];
+  for (int d = 0; d < numberDigits; d++) {
+    for (int b = 0; b < 256; b++)
+      count[d][b] = 0;
+  }
+  for (size_t i = 0; i < number; i++) {
+    const unsigned int k = static_cast<unsigned int>(key[i]) - base;
+    for (int d = 0; d < numberDigits; d++)
+      count[d][(k >> (8*d)) & 255]++;
+  }
+  int* tempKey = new int[number];
+  T* tempArray = new T[number];
+  int* fromKey = key;
+  T* fromArray = array2;
+  int* toKey = tempKey;
+  T* toArray = tempArray;
+  for (int d = 0; d < numberDigits; d++) {
+    size_t* start = count[d];
+    const int shift = 8*d;
+    const unsigned int digit =
+      ((static_cast<unsigned int>(fromKey[0]) - base) >> shift) & 255;
+    if (start[digit] == number)
+      continue;
+    size_t sum = 0;
+    for (int b = 0; b < 256; b++) {
+      const size_t n = start[b];
+      start[b] = sum;
+      sum += n;
+    }
+    for (size_t i = 0; i < number; i++) {
+      const int k = fromKey[i];
+      const size_t put =
+	start[((static_cast<unsigned int>(k) - base) >> shift) & 255]++;
+      toKey[put] = k;
+      toArray[put] = fromArray[i];
+    }
+    std::swap(fromKey, toKey);
+    std::swap(fromArray, toArray);
+  }
+  if (fromKey != key) {
+    for (size_t i = 0; i < number; i++) {
+      key[i] = fromKey[i];
+      array2[i] = fromArray[i];
+    }
+  }
+  delete [] tempKey;
+  delete [] tempArray;
+}
+/** Sort int keys carrying a second array along.
+    Picks insertion sort, std::sort or radix sort by length. */
+template <class T> void
+CoinSort_2(int* sfirst, int* slast, T* tfirst)
+{
+  const size_t number = coinDistance(sfirst, slast);
+  if (number <= 16)
+    CoinInsertionSort_2(sfirst, slast, tfirst);
+  else if (number < 256)
+    CoinSort_2(sfirst, slast, tfirst, CoinFirstLess_2<int,T>());
+  else
+    CoinRadixSort_2(sfirst, slast, tfirst);
+}
 #else
 //-----------------------------------------------------------------------------
 extern int boundary_sort;
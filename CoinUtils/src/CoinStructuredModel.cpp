@@ -10,6 +10,13 @@
 #include "CoinSort.hpp"
 #include "CoinMpsIO.hpp"
 #include "CoinFloatEqual.hpp"
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+// Most threads used to build blocks in decompose
+#ifndef COIN_DECOMPOSE_THREADS
+#define COIN_DECOMPOSE_THREADS 4
+#endif
+#endif
 
 //#############################################################################
 // Constructors / Destructor / Assignment
@@ -738,13 +745,371 @@ CoinStructuredModel::addBlock(const CoinBaseModel & block)
   return addBlock(block.getRowBlock(),block.getColumnBlock(),
 		  block);
 }
+/*
+  Helpers for decompose.  The blocks are the connected components of the
+  bipartite graph of rows and columns once the linking rows (D-W) or linking
+  columns (Benders) are taken out.  They are written in terms of a major
+  ordered matrix (start, length, index) so that one copy serves both types.
+  Union-find trees are held in a parent array in which a root points to
+  itself.
+*/
+static inline int
+findRoot(int * parent, int i)
+{
+  // path halving
+  while (parent[i]!=i) {
+    parent[i]=parent[parent[i]];
+    i=parent[i];
+  }
+  return i;
+}
+/* One pass of the heuristic which chooses the linking vectors.  Major
+   vectors are taken in the order given by stack and joined into blocks
+   over their minor indices.  Once half of them are in, the best point at
+   which to stop is tracked.  Returns position in stack of that point (or
+   -1) and sets bestDone to number of vectors taken up to it (or -1).
+   parent and size are work arrays of numberMinor.
+*/
+static int
+scanForLinking(int numberMajor, int numberMinor, const int * stack,
+	       const CoinBigIndex * start, const int * length,
+	       const int * index, int * parent, int * size, int & bestDone)
+{
+  CoinFillN(parent,numberMinor,-1);
+  int numberMarked = 0;
+  int numberGoodBlocks=0;
+  int maximumInBlock = 0;
+  int checkAfter = (5*numberMajor)/10+1;
+  double best = COIN_DBL_MAX;
+  int bestMajor = -1;
+  bestDone=-1;
+  for (int kMajor=0;kMajor<numberMajor;kMajor++) {
+    int iMajor = stack[kMajor];
+    CoinBigIndex kStart = start[iMajor];
+    CoinBigIndex kEnd = kStart+length[iMajor];
+    int iRoot=-1;
+    for (CoinBigIndex j=kStart;j<kEnd;j++) {
+      int iMinor = index[j];
+      if (parent[iMinor]>=0) {
+	// already marked
+	int jRoot = findRoot(parent,iMinor);
+	if (iRoot<0) {
+	  iRoot = jRoot;
+	} else if (iRoot != jRoot) {
+	  // join two blocks - smaller under larger
+	  numberGoodBlocks--;
+	  if (size[jRoot]>size[iRoot]) {
+	    int temp=iRoot;
+	    iRoot=jRoot;
+	    jRoot=temp;
+	  }
+	  parent[jRoot]=iRoot;
+	  size[iRoot] += size[jRoot];
+	}
+      }
+    }
+    // If not in block - then start one (unless null)
+    if (iRoot<0&&kEnd>kStart) {
+      iRoot = index[kStart];
+      size[iRoot]=0;
+      numberGoodBlocks++;
+    }
+    // add all to this block if not already in
+    for (CoinBigIndex j=kStart;j<kEnd;j++) {
+      int iMinor = index[j];
+      if (parent[iMinor]<0) {
+	numberMarked++;
+	size[iRoot]++;
+	parent[iMinor]=iRoot;
+      }
+    }
+    int done = kMajor+1;
+    if (iRoot>=0)
+      maximumInBlock = CoinMax(maximumInBlock,size[iRoot]);
+    if (done>=checkAfter) {
+      assert (numberGoodBlocks>0);
+      if (maximumInBlock*10<numberMinor*11&&numberGoodBlocks>1) {
+	double test = maximumInBlock;
+	if(best*static_cast<double>(done) > test) {
+	  best = test/static_cast<double> (done);
+	  bestMajor = kMajor;
+	  bestDone=done;
+	}
+      }
+    }
+  }
+  return bestMajor;
+}
+/* Labels blocks.  On entry minorBlock is -1 for linking minor vectors and
+   -2 for the rest.  On exit each major vector has the block of its non
+   linking entries (-1 if it has none) and minor vectors which are in some
+   major vector have their block.  Blocks are numbered in order of their
+   first major vector.  Returns number of blocks.
+*/
+static int
+labelBlocks(int numberMajor, const CoinBigIndex * start, const int * length,
+	    const int * index, int numberMinor, int * majorBlock,
+	    int * minorBlock)
+{
+  int * parent = new int [2*numberMinor];
+  int * size = parent+numberMinor;
+  for (int i=0;i<numberMinor;i++) {
+    parent[i]=i;
+    size[i]=1;
+  }
+  for (int iMajor=0;iMajor<numberMajor;iMajor++) {
+    int iRoot=-1;
+    for (CoinBigIndex j=start[iMajor];j<start[iMajor]+length[iMajor];j++) {
+      int iMinor = index[j];
+      if (minorBlock[iMinor]!=-1) {
+	int jRoot = findRoot(parent,iMinor);
+	if (iRoot<0) {
+	  iRoot=jRoot;
+	} else if (iRoot!=jRoot) {
+	  if (size[jRoot]>size[iRoot]) {
+	    int temp=iRoot;
+	    iRoot=jRoot;
+	    jRoot=temp;
+	  }
+	  parent[jRoot]=iRoot;
+	  size[iRoot] += size[jRoot];
+	}
+      }
+    }
+  }
+  // sizes not needed any more
+  int * label = size;
+  CoinFillN(label,numberMinor,-1);
+  int numberBlocks=0;
+  for (int iMajor=0;iMajor<numberMajor;iMajor++) {
+    majorBlock[iMajor]=-1;
+    for (CoinBigIndex j=start[iMajor];j<start[iMajor]+length[iMajor];j++) {
+      int iMinor = index[j];
+      if (minorBlock[iMinor]!=-1) {
+	int iRoot = findRoot(parent,iMinor);
+	if (label[iRoot]<0)
+	  label[iRoot]=numberBlocks++;
+	majorBlock[iMajor]=label[iRoot];
+	break;
+      }
+    }
+  }
+  for (int iMinor=0;iMinor<numberMinor;iMinor++) {
+    if (minorBlock[iMinor]!=-1) {
+      int iBlock = label[findRoot(parent,iMinor)];
+      if (iBlock>=0)
+	minorBlock[iMinor]=iBlock;
+    }
+  }
+  delete [] parent;
+  return numberBlocks;
+}
+/* The heuristics pick a contiguous (or sorted) set of linking vectors so
+   some of them may only touch one block.  Such a vector is moved into that
+   block along with any linking minor vectors it meets (which then only
+   touch that block).  Returns number moved.
+*/
+static int
+reduceLinking(int numberMajor, const CoinBigIndex * start, const int * length,
+	      const int * index, int * majorBlock, int * minorBlock)
+{
+  int numberMoved=0;
+  for (int iMajor=0;iMajor<numberMajor;iMajor++) {
+    if (majorBlock[iMajor]!=-1)
+      continue;
+    CoinBigIndex kStart = start[iMajor];
+    CoinBigIndex kEnd = kStart+length[iMajor];
+    int iBlock=-1;
+    CoinBigIndex j;
+    for (j=kStart;j<kEnd;j++) {
+      int jBlock = minorBlock[index[j]];
+      if (jBlock>=0) {
+	if (iBlock<0)
+	  iBlock=jBlock;
+	else if (iBlock!=jBlock)
+	  break;
+      }
+    }
+    if (j<kEnd||iBlock<0)
+      continue;
+    majorBlock[iMajor]=iBlock;
+    for (j=kStart;j<kEnd;j++) {
+      int iMinor = index[j];
+      if (minorBlock[iMinor]==-1)
+	minorBlock[iMinor]=iBlock;
+    }
+    numberMoved++;
+  }
+  return numberMoved;
+}
+/* Sorts 0 .. n-1 into blocks, linking ones (block -1) going last.  On exit
+   list[start[i]] .. list[start[i+1]-1] are the members of block i in
+   order and position gives the place of each within its block.
+*/
+static void
+bucketBlocks(int n, const int * block, int numberBlocks, int * start,
+	     int * list, int * position)
+{
+  CoinZeroN(start,numberBlocks+2);
+  for (int i=0;i<n;i++) {
+    int iBlock = block[i]>=0 ? block[i] : numberBlocks;
+    start[iBlock+1]++;
+  }
+  for (int i=0;i<=numberBlocks;i++)
+    start[i+1] += start[i];
+  for (int i=0;i<n;i++) {
+    int iBlock = block[i]>=0 ? block[i] : numberBlocks;
+    int put = start[iBlock]++;
+    list[put]=i;
+    position[i]=put;
+  }
+  // restore starts
+  for (int i=numberBlocks;i>0;i--)
+    start[i]=start[i-1];
+  start[0]=0;
+  for (int i=0;i<n;i++) {
+    int iBlock = block[i]>=0 ? block[i] : numberBlocks;
+    position[i] -= start[iBlock];
+  }
+}
+/* Submatrix of column ordered matrix made up of the numberColumns2 columns
+   in whichColumn and the rows in block iBlock (renumbered by rowPosition).
+*/
+static void
+blockMatrix(const CoinPackedMatrix & matrix, const int * rowBlock,
+	    const int * rowPosition, int iBlock, int numberRows2,
+	    int numberColumns2, const int * whichColumn,
+	    CoinPackedMatrix & result)
+{
+  const int * row = matrix.getIndices();
+  const int * columnLength = matrix.getVectorLengths();
+  const CoinBigIndex * columnStart = matrix.getVectorStarts();
+  const double * elementByColumn = matrix.getElements();
+  CoinBigIndex numberElements=0;
+  for (int i=0;i<numberColumns2;i++) {
+    int iColumn = whichColumn[i];
+    for (CoinBigIndex j=columnStart[iColumn];
+	 j<columnStart[iColumn]+columnLength[iColumn];j++) {
+      if (rowBlock[row[j]]==iBlock)
+	numberElements++;
+    }
+  }
+  CoinBigIndex * start = new CoinBigIndex [numberColumns2+1];
+  int * index = new int [numberElements];
+  double * element = new double [numberElements];
+  int * length = NULL;
+  numberElements=0;
+  start[0]=0;
+  for (int i=0;i<numberColumns2;i++) {
+    int iColumn = whichColumn[i];
+    for (CoinBigIndex j=columnStart[iColumn];
+	 j<columnStart[iColumn]+columnLength[iColumn];j++) {
+      int iRow = row[j];
+      if (rowBlock[iRow]==iBlock) {
+	index[numberElements]=rowPosition[iRow];
+	element[numberElements++]=elementByColumn[j];
+      }
+    }
+    start[i+1]=numberElements;
+  }
+  result.assignMatrix(true,numberRows2,numberColumns2,numberElements,
+		      element,index,start,length);
+}
+/* Work for building block matrices.  For block i the diagonal matrix is
+   the columns of block i by the rows of block i.  The border matrix is the
+   columns of block i by the linking rows (D-W) or the linking columns by
+   the rows of block i (Benders).  Row and column lists are as produced by
+   bucketBlocks, with the linking ones as block numberBlocks.
+*/
+typedef struct {
+  const CoinPackedMatrix * matrix;
+  const int * rowBlock;
+  const int * rowPosition;
+  const int * rowStart;
+  const int * columnStart;
+  const int * columnList;
+  CoinPackedMatrix * diagonal;
+  CoinPackedMatrix * border;
+  int numberBlocks;
+  int type;
+  int firstBlock;
+  int stride;
+} CoinBlockMatrixInfo;
+
+static void *
+buildBlockMatricesThread(void * voidInfo)
+{
+  CoinBlockMatrixInfo * info = reinterpret_cast<CoinBlockMatrixInfo *>(voidInfo);
+  const int * rowStart = info->rowStart;
+  const int * columnStart = info->columnStart;
+  const int * columnList = info->columnList;
+  int numberBlocks = info->numberBlocks;
+  int numberMasterRows = rowStart[numberBlocks+1]-rowStart[numberBlocks];
+  int numberMasterColumns = columnStart[numberBlocks+1]-columnStart[numberBlocks];
+  for (int iBlock=info->firstBlock;iBlock<numberBlocks;iBlock+=info->stride) {
+    int numberRow2 = rowStart[iBlock+1]-rowStart[iBlock];
+    int numberColumn2 = columnStart[iBlock+1]-columnStart[iBlock];
+    const int * whichColumn = columnList+columnStart[iBlock];
+    blockMatrix(*info->matrix,info->rowBlock,info->rowPosition,iBlock,
+		numberRow2,numberColumn2,whichColumn,info->diagonal[iBlock]);
+    if (info->type==1)
+      blockMatrix(*info->matrix,info->rowBlock,info->rowPosition,-1,
+		  numberMasterRows,numberColumn2,whichColumn,
+		  info->border[iBlock]);
+    else
+      blockMatrix(*info->matrix,info->rowBlock,info->rowPosition,iBlock,
+		  numberRow2,numberMasterColumns,
+		  columnList+columnStart[numberBlocks],info->border[iBlock]);
+  }
+  return NULL;
+}
+/* Builds diagonal and border matrices for all blocks, spread over threads
+   if available.  Blocks only read the matrix and write their own results.
+*/
+static void
+buildBlockMatrices(CoinBlockMatrixInfo & info)
+{
+  int numberThreads = 1;
+#ifdef COINUTILS_PTHREADS
+  numberThreads = CoinMin(COIN_DECOMPOSE_THREADS,info.numberBlocks);
+#endif
+  if (numberThreads<=1) {
+    info.firstBlock=0;
+    info.stride=1;
+    buildBlockMatricesThread(&info);
+    return;
+  }
+#ifdef COINUTILS_PTHREADS
+  CoinBlockMatrixInfo * threadInfo = new CoinBlockMatrixInfo [numberThreads];
+  pthread_t * threadId = new pthread_t [numberThreads];
+  bool * started = new bool [numberThreads];
+  for (int i=0;i<numberThreads;i++) {
+    threadInfo[i]=info;
+    threadInfo[i].firstBlock=i;
+    threadInfo[i].stride=numberThreads;
+    // first share done by this thread
+    started[i] = i>0 &&
+      !pthread_create(threadId+i,NULL,buildBlockMatricesThread,threadInfo+i);
+    if (i>0&&!started[i])
+      buildBlockMatricesThread(threadInfo+i);
+  }
+  buildBlockMatricesThread(threadInfo);
+  for (int i=1;i<numberThreads;i++) {
+    if (started[i])
+      pthread_join(threadId[i],NULL);
+  }
+  delete [] started;
+  delete [] threadId;
+  delete [] threadInfo;
+#endif
+}
 /* Decompose a model specified as arrays + CoinPackedMatrix
    1 - try D-W
    2 - try Benders
    3 - try Staircase
    Returns number of blocks or zero if no structure
 */
-int 
+int
 CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 			       const double * rowLower, const double * rowUpper,
 			       const double * columnLower, const double * columnUpper,
@@ -760,11 +1125,9 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
     const int * row = matrix.getIndices();
     const int * columnLength = matrix.getVectorLengths();
     const CoinBigIndex * columnStart = matrix.getVectorStarts();
-    //const double * elementByColumn = matrix.getElements();
     const int * column = rowCopy.getIndices();
     const int * rowLength = rowCopy.getVectorLengths();
     const CoinBigIndex * rowStart = rowCopy.getVectorStarts();
-    //const double * elementByRow = rowCopy.getElements();
     int numberRows = matrix.getNumRows();
     int * rowBlock = new int[numberRows+1];
     int iRow;
@@ -779,15 +1142,12 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	printf("%d rows have %d elements\n",rowBlock[iRow],iRow);
     }
     bool newWay=true;
-    // to say if column looked at
     int numberColumns = matrix.getNumCols();
     int * columnBlock = new int[numberColumns];
     int iColumn;
-    int * whichRow = new int [numberRows];
     int * whichColumn = new int [numberColumns];
     int * stack = new int [numberRows];
     if (newWay) {
-      //double best2[3]={COIN_DBL_MAX,COIN_DBL_MAX,COIN_DBL_MAX};
       double best2[3]={0.0,0.0,0.0};
       int row2[3]={-1,-1,-1};
       // try forward and backward and sorted
@@ -808,161 +1168,15 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	  }
 	  CoinSort_2(rowBlock,rowBlock+numberRows,stack);
 	}
-	CoinFillN(rowBlock,numberRows,-1);
-	rowBlock[numberRows]=0;
-	CoinFillN(whichRow,numberRows,-1);
-	CoinFillN(columnBlock,numberColumns,-1);
-	CoinFillN(whichColumn,numberColumns,-1);
-	int numberMarkedColumns = 0;
-	numberBlocks=0;
-	int bestRow = -1;
-	int maximumInBlock = 0;
-	int rowsDone=0;
-	int checkAfterRows = (5*numberRows)/10+1;
-#define OSL_WAY
-#ifdef OSL_WAY
-	double best = COIN_DBL_MAX;
-	int bestRowsDone=-1;
-#else
-	double best = 0.0; //COIN_DBL_MAX;
-#endif
-	int numberGoodBlocks=0;
-	
-	for (int kRow=0;kRow<numberRows;kRow++) {
-	  iRow = stack[kRow];
-	  CoinBigIndex start = rowStart[iRow];
-	  CoinBigIndex end = start+rowLength[iRow];
-	  int iBlock=-1;
-	  for (CoinBigIndex j=start;j<end;j++) {
-	    int iColumn = column[j];
-	    if (columnBlock[iColumn]>=0) {
-	      // already marked
-	      if (iBlock<0) {
-		iBlock = columnBlock[iColumn];
-	      } else if (iBlock != columnBlock[iColumn]) {
-		// join two blocks
-		int jBlock = columnBlock[iColumn];
-		numberGoodBlocks--;
-		// Increase count of iBlock
-		rowBlock[iBlock] += rowBlock[jBlock];
-		rowBlock[jBlock]=0;
-		// First column of block jBlock
-		int jColumn = whichRow[jBlock];
-		while (jColumn>=0) {
-		  columnBlock[jColumn]=iBlock;
-		  iColumn = jColumn;
-		  jColumn = whichColumn[jColumn];
-		}
-		whichColumn[iColumn] = whichRow[iBlock];
-		whichRow[iBlock] = whichRow[jBlock];
-		whichRow[jBlock]=-1;
-	      }
-	    }
-	  }
-	  int n=end-start;
-	  // If not in block - then start one
-	  if (iBlock<0) {
-	    // unless null row
-	    if (n) {
-	      iBlock = numberBlocks;
-	      numberBlocks++;
-	      numberGoodBlocks++;
-	      int jColumn = column[start];
-	      columnBlock[jColumn]=iBlock;
-	      whichRow[iBlock]=jColumn;
-	      numberMarkedColumns += n;
-	      rowBlock[iBlock] = n;
-	      for (CoinBigIndex j=start+1;j<end;j++) {
-		int iColumn = column[j];
-		columnBlock[iColumn]=iBlock;
-		whichColumn[jColumn]=iColumn;
-		jColumn=iColumn;
-	      }
-	    } else {
-	      rowBlock[numberRows]++;
-	    }
-	  } else {
-	    // add all to this block if not already in
-	    int jColumn = whichRow[iBlock];
-	    for (CoinBigIndex j=start;j<end;j++) {
-	      int iColumn = column[j];
-	      if (columnBlock[iColumn]<0) {
-		numberMarkedColumns++;
-		rowBlock[iBlock]++;
-		columnBlock[iColumn]=iBlock;
-		whichColumn[iColumn]=jColumn;
-		jColumn=iColumn;
-	      }
-	    }
-	    whichRow[iBlock]=jColumn;
-	  }
-#if 0
-	  {
-	    int nn=0;
-	    int * temp = new int [numberRows];
-	    CoinZeroN(temp,numberRows);
-	    for (int i=0;i<numberColumns;i++) {
-	      int iBlock = columnBlock[i];
-	      if (iBlock>=0) {
-		nn++;
-		assert (iBlock<numberBlocks);
-		temp[iBlock]++;
-	      }
-	    }
-	    for (int i=0;i<numberBlocks;i++)
-	      assert (temp[i]==rowBlock[i]);
-	    assert (nn==numberMarkedColumns);
-	    for (int i=0;i<numberBlocks;i++) {
-	      // First column of block i
-	      int jColumn = whichRow[i];
-	      int n=0;
-	      while (jColumn>=0) {
-		n++;
-		jColumn = whichColumn[jColumn];
-	      }
-	      assert (n==temp[i]);
-	    }
-	    delete [] temp;
-	  }
-#endif
-	  rowsDone++;
-	  if (iBlock>=0) 
-	    maximumInBlock = CoinMax(maximumInBlock,rowBlock[iBlock]);
-	  if (rowsDone>=checkAfterRows) {
-	    assert (numberGoodBlocks>0);
-	    double averageSize = static_cast<double>(numberMarkedColumns)/
-	      static_cast<double>(numberGoodBlocks);
-#ifndef OSL_WAY
-	    double notionalBlocks = static_cast<double>(numberMarkedColumns)/
-	      averageSize;
-	    if (maximumInBlock<3*averageSize&&numberGoodBlocks>2) {
-	      if(best*(numberRows-rowsDone) < notionalBlocks) {
-		best = notionalBlocks/
-		  static_cast<double> (numberRows-rowsDone); 
-		bestRow = kRow;
-	      }
-	    }
-#else
-	    if (maximumInBlock*10<numberColumns*11&&numberGoodBlocks>1) {
-	      double test = maximumInBlock + 0.0*averageSize;
-	      if(best*static_cast<double>(rowsDone) > test) {
-		best = test/static_cast<double> (rowsDone); 
-		bestRow = kRow;
-		bestRowsDone=rowsDone;
-	      }
-	    }
-#endif
-	  }	      
-	}
-#ifndef OSL_WAY
-	best2[iWay]=best;
-#else
+	// whichColumn and columnBlock are work arrays here
+	int bestRowsDone;
+	row2[iWay] = scanForLinking(numberRows,numberColumns,stack,
+				    rowStart,rowLength,column,
+				    whichColumn,columnBlock,bestRowsDone);
 	if (bestRowsDone<numberRows)
 	  best2[iWay]=-(numberRows-bestRowsDone);
 	else
 	  best2[iWay]=-numberRows;
-#endif
-	row2[iWay]=bestRow;
       }
       // mark rows
       int nMaster;
@@ -994,7 +1208,6 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	       nMaster,numberRows);
 	delete [] rowBlock;
 	delete [] columnBlock;
-	delete [] whichRow;
 	delete [] whichColumn;
 	delete [] stack;
 	CoinModel model(numberRows,numberColumns,&matrix, rowLower, rowUpper,
@@ -1044,57 +1257,15 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	  rowBlock[iRow]=-1;
       }
     }
-    numberBlocks=0;
-    CoinFillN(columnBlock,numberColumns,-2);
-    for (iColumn=0;iColumn<numberColumns;iColumn++) {
-      int kstart = columnStart[iColumn];
-      int kend = columnStart[iColumn]+columnLength[iColumn];
-      if (columnBlock[iColumn]==-2) {
-	// column not allocated
-	int j;
-	int nstack=0;
-	for (j=kstart;j<kend;j++) {
-	  int iRow= row[j];
-	  if (rowBlock[iRow]!=-1) {
-	    assert(rowBlock[iRow]==-2);
-	    rowBlock[iRow]=numberBlocks; // mark
-	    stack[nstack++] = iRow;
-	  }
-	}
-	if (nstack) {
-	  // new block - put all connected in
-	  numberBlocks++;
-	  columnBlock[iColumn]=numberBlocks-1;
-	  while (nstack) {
-	    int iRow = stack[--nstack];
-	    int k;
-	    for (k=rowStart[iRow];k<rowStart[iRow]+rowLength[iRow];k++) {
-	      int iColumn = column[k];
-	      int kkstart = columnStart[iColumn];
-	      int kkend = kkstart + columnLength[iColumn];
-	      if (columnBlock[iColumn]==-2) {
-		columnBlock[iColumn]=numberBlocks-1; // mark
-		// column not allocated
-		int jj;
-		for (jj=kkstart;jj<kkend;jj++) {
-		  int jRow= row[jj];
-		  if (rowBlock[jRow]==-2) {
-		    rowBlock[jRow]=numberBlocks-1;
-		    stack[nstack++]=jRow;
-		  }
-		}
-	      } else {
-		assert (columnBlock[iColumn]==numberBlocks-1);
-	      }
-	    }
-	  }
-	} else {
-	  // Only in master
-	  columnBlock[iColumn]=-1;
-	}
-      }
-    }
     delete [] stack;
+    delete [] whichColumn;
+    // Columns only in master get -1, empty rows stay at -2
+    numberBlocks = labelBlocks(numberColumns,columnStart,columnLength,row,
+			       numberRows,columnBlock,rowBlock);
+    int numberMoved = reduceLinking(numberRows,rowStart,rowLength,column,
+				    rowBlock,columnBlock);
+    if (numberMoved)
+      printf("%d rows moved from master to blocks\n",numberMoved);
     int numberMasterRows=0;
     for (iRow=0;iRow<numberRows;iRow++) {
       int iBlock = rowBlock[iRow];
@@ -1129,16 +1300,8 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	numberBlocks=maxBlocks;
       }
     }
-    // make up problems
-    // Create all sub problems
-    // Space for creating
-    double * obj = new double [numberColumns];
-    double * columnLo = new double [numberColumns];
-    double * columnUp = new double [numberColumns];
-    double * rowLo = new double [numberRows];
-    double * rowUp = new double [numberRows];
     // Counts
-    int * rowCount = reinterpret_cast<int *>(rowLo);
+    int * rowCount = new int [2*numberBlocks];
     CoinZeroN(rowCount,numberBlocks);
     for (int i=0;i<numberRows;i++) {
       int iBlock=rowBlock[i];
@@ -1162,7 +1325,7 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	rowCount[iSmall]++;
       }
     }
-    int * columnCount = reinterpret_cast<int *>(rowUp);
+    int * columnCount = rowCount+numberBlocks;
     CoinZeroN(columnCount,numberBlocks);
     for (int i=0;i<numberColumns;i++) {
       int iBlock=columnBlock[i];
@@ -1176,121 +1339,23 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
       int k=2*rowCount[i]+columnCount[i];
       maximumSize = CoinMax(maximumSize,k);
     }
+    delete [] rowCount;
     if (maximumSize*10>4*(2*numberRows+numberColumns)) {
       // No good
       printf("Doesn't look good\n");
       delete [] rowBlock;
       delete [] columnBlock;
-      delete [] whichRow;
-      delete [] whichColumn;
-      delete [] obj ; 
-      delete [] columnLo ; 
-      delete [] columnUp ; 
-      delete [] rowLo ; 
-      delete [] rowUp ; 
       CoinModel model(numberRows,numberColumns,&matrix, rowLower, rowUpper,
 		      columnLower,columnUpper,objective);
       model.setObjectiveOffset(objectiveOffset);
       addBlock("row_master","column_master",model);
       return 0;
     }
-    // Name for master so at top
-    addRowBlock(numberMasterRows,"row_master");
-    // Arrays
-    // get full matrix
-    CoinPackedMatrix fullMatrix = matrix;
-    int numberRow2,numberColumn2;
-    int iBlock;
-    for (iBlock=0;iBlock<numberBlocks;iBlock++) {
-      char rowName[20];
-      sprintf(rowName,"row_%d",iBlock);
-      char columnName[20];
-      sprintf(columnName,"column_%d",iBlock);
-      numberRow2=0;
-      numberColumn2=0;
-      for (iRow=0;iRow<numberRows;iRow++) {
-	if (iBlock==rowBlock[iRow]) {
-	  rowLo[numberRow2]=rowLower[iRow];
-	  rowUp[numberRow2]=rowUpper[iRow];
-	  whichRow[numberRow2++]=iRow;
-	}
-      }
-      for (iColumn=0;iColumn<numberColumns;iColumn++) {
-	if (iBlock==columnBlock[iColumn]) {
-	  obj[numberColumn2]=objective[iColumn];
-	  columnLo[numberColumn2]=columnLower[iColumn];
-	  columnUp[numberColumn2]=columnUpper[iColumn];
-	  whichColumn[numberColumn2++]=iColumn;
-	}
-      }
-      // Diagonal block
-      CoinPackedMatrix mat(fullMatrix,
-			   numberRow2,whichRow,
-			   numberColumn2,whichColumn);
-      // make sure correct dimensions
-      mat.setDimensions(numberRow2,numberColumn2);
-      CoinModel * block = new CoinModel(numberRow2,numberColumn2,&mat,
-					rowLo,rowUp,NULL,NULL,NULL);
-      block->setOriginalIndices(whichRow,whichColumn);
-      addBlock(rowName,columnName,block); // takes ownership
-      // and top block
-      numberRow2=0;
-      // get top matrix
-      for (iRow=0;iRow<numberRows;iRow++) {
-	int iBlock = rowBlock[iRow];
-	if (iBlock==-1) {
-	  whichRow[numberRow2++]=iRow;
-	}
-      }
-      CoinPackedMatrix top(fullMatrix,
-			   numberRow2,whichRow,
-			   numberColumn2,whichColumn);
-      // make sure correct dimensions
-      top.setDimensions(numberRow2,numberColumn2);
-      block = new CoinModel(numberMasterRows,numberColumn2,&top,
-			    NULL,NULL,columnLo,columnUp,obj);
-      block->setOriginalIndices(whichRow,whichColumn);
-      addBlock("row_master",columnName,block); // takes ownership
-    }
-    // and master
-    numberRow2=0;
-    numberColumn2=0;
-    for (iRow=0;iRow<numberRows;iRow++) {
-      int iBlock = rowBlock[iRow];
-      if (iBlock==-1) {
-	rowLo[numberRow2]=rowLower[iRow];
-	rowUp[numberRow2]=rowUpper[iRow];
-	whichRow[numberRow2++]=iRow;
-      }
-    }
-    for (iColumn=0;iColumn<numberColumns;iColumn++) {
-      int iBlock = columnBlock[iColumn];
-      if (iBlock<0) {
-	obj[numberColumn2]=objective[iColumn];
-	columnLo[numberColumn2]=columnLower[iColumn];
-	columnUp[numberColumn2]=columnUpper[iColumn];
-	whichColumn[numberColumn2++]=iColumn;
-      }
-    }
+    // make up problems
+    addDecomposedBlocks(matrix,rowLower,rowUpper,columnLower,columnUpper,
+			objective,type,numberBlocks,rowBlock,columnBlock);
     delete [] rowBlock;
     delete [] columnBlock;
-    CoinPackedMatrix top(fullMatrix,
-			 numberRow2,whichRow,
-			 numberColumn2,whichColumn);
-    // make sure correct dimensions
-    top.setDimensions(numberRow2,numberColumn2);
-    CoinModel * block = new CoinModel(numberRow2,numberColumn2,&top,
-				      rowLo,rowUp,
-				      columnLo,columnUp,obj);
-    block->setOriginalIndices(whichRow,whichColumn);
-    addBlock("row_master","column_master",block); // takes ownership
-    delete [] whichRow;
-    delete [] whichColumn;
-    delete [] obj ; 
-    delete [] columnLo ; 
-    delete [] columnUp ; 
-    delete [] rowLo ; 
-    delete [] rowUp ; 
   } else if (type==2) {
     // get row copy
     CoinPackedMatrix rowCopy = matrix;
@@ -1298,11 +1363,9 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
     const int * row = matrix.getIndices();
     const int * columnLength = matrix.getVectorLengths();
     const CoinBigIndex * columnStart = matrix.getVectorStarts();
-    //const double * elementByColumn = matrix.getElements();
     const int * column = rowCopy.getIndices();
     const int * rowLength = rowCopy.getVectorLengths();
     const CoinBigIndex * rowStart = rowCopy.getVectorStarts();
-    //const double * elementByRow = rowCopy.getElements();
     int numberColumns = matrix.getNumCols();
     int * columnBlock = new int[numberColumns+1];
     int iColumn;
@@ -1317,15 +1380,12 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	printf("%d columns have %d elements\n",columnBlock[iColumn],iColumn);
     }
     bool newWay=false;
-    // to say if row looked at
     int numberRows = matrix.getNumRows();
     int * rowBlock = new int[numberRows];
     int iRow;
     int * whichRow = new int [numberRows];
-    int * whichColumn = new int [numberColumns];
     int * stack = new int [numberColumns];
     if (newWay) {
-      //double best2[3]={COIN_DBL_MAX,COIN_DBL_MAX,COIN_DBL_MAX};
       double best2[3]={0.0,0.0,0.0};
       int column2[3]={-1,-1,-1};
       // try forward and backward and sorted
@@ -1346,131 +1406,15 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	  }
 	  CoinSort_2(columnBlock,columnBlock+numberColumns,stack);
 	}
-	CoinFillN(columnBlock,numberColumns,-1);
-	columnBlock[numberColumns]=0;
-	CoinFillN(whichColumn,numberColumns,-1);
-	CoinFillN(rowBlock,numberRows,-1);
-	CoinFillN(whichRow,numberRows,-1);
-	int numberMarkedRows = 0;
-	numberBlocks=0;
-	int bestColumn = -1;
-	int maximumInBlock = 0;
-	int columnsDone=0;
-	int checkAfterColumns = (5*numberColumns)/10+1;
-#ifdef OSL_WAY
-	double best = COIN_DBL_MAX;
-	int bestColumnsDone=-1;
-#else
-	double best = 0.0; //COIN_DBL_MAX;
-#endif
-	int numberGoodBlocks=0;
-	
-	for (int kColumn=0;kColumn<numberColumns;kColumn++) {
-	  iColumn = stack[kColumn];
-	  CoinBigIndex start = columnStart[iColumn];
-	  CoinBigIndex end = start+columnLength[iColumn];
-	  int iBlock=-1;
-	  for (CoinBigIndex j=start;j<end;j++) {
-	    int iRow = row[j];
-	    if (rowBlock[iRow]>=0) {
-	      // already marked
-	      if (iBlock<0) {
-		iBlock = rowBlock[iRow];
-	      } else if (iBlock != rowBlock[iRow]) {
-		// join two blocks
-		int jBlock = rowBlock[iRow];
-		numberGoodBlocks--;
-		// Increase count of iBlock
-		columnBlock[iBlock] += columnBlock[jBlock];
-		columnBlock[jBlock]=0;
-		// First row of block jBlock
-		int jRow = whichColumn[jBlock];
-		while (jRow>=0) {
-		  rowBlock[jRow]=iBlock;
-		  iRow = jRow;
-		  jRow = whichRow[jRow];
-		}
-		whichRow[iRow] = whichColumn[iBlock];
-		whichColumn[iBlock] = whichColumn[jBlock];
-		whichColumn[jBlock]=-1;
-	      }
-	    }
-	  }
-	  int n=end-start;
-	  // If not in block - then start one
-	  if (iBlock<0) {
-	    // unless null column
-	    if (n) {
-	      iBlock = numberBlocks;
-	      numberBlocks++;
-	      numberGoodBlocks++;
-	      int jRow = row[start];
-	      rowBlock[jRow]=iBlock;
-	      whichColumn[iBlock]=jRow;
-	      numberMarkedRows += n;
-	      columnBlock[iBlock] = n;
-	      for (CoinBigIndex j=start+1;j<end;j++) {
-		int iRow = row[j];
-		rowBlock[iRow]=iBlock;
-		whichRow[jRow]=iRow;
-		jRow=iRow;
-	      }
-	    } else {
-	      columnBlock[numberColumns]++;
-	    }
-	  } else {
-	    // add all to this block if not already in
-	    int jRow = whichColumn[iBlock];
-	    for (CoinBigIndex j=start;j<end;j++) {
-	      int iRow = row[j];
-	      if (rowBlock[iRow]<0) {
-		numberMarkedRows++;
-		columnBlock[iBlock]++;
-		rowBlock[iRow]=iBlock;
-		whichRow[iRow]=jRow;
-		jRow=iRow;
-	      }
-	    }
-	    whichColumn[iBlock]=jRow;
-	  }
-	  columnsDone++;
-	  if (iBlock>=0) 
-	    maximumInBlock = CoinMax(maximumInBlock,columnBlock[iBlock]);
-	  if (columnsDone>=checkAfterColumns) {
-	    assert (numberGoodBlocks>0);
-	    double averageSize = static_cast<double>(numberMarkedRows)/
-	      static_cast<double>(numberGoodBlocks);
-#ifndef OSL_WAY
-	    double notionalBlocks = static_cast<double>(numberMarkedRows)/
-	      averageSize;
-	    if (maximumInBlock<3*averageSize&&numberGoodBlocks>2) {
-	      if(best*(numberColumns-columnsDone) < notionalBlocks) {
-		best = notionalBlocks/
-		  static_cast<double> (numberColumns-columnsDone); 
-		bestColumn = kColumn;
-	      }
-	    }
-#else
-	    if (maximumInBlock*10<numberRows*11&&numberGoodBlocks>1) {
-	      double test = maximumInBlock + 0.0*averageSize;
-	      if(best*static_cast<double>(columnsDone) > test) {
-		best = test/static_cast<double> (columnsDone); 
-		bestColumn = kColumn;
-		bestColumnsDone=columnsDone;
-	      }
-	    }
-#endif
-	  }	      
-	}
-#ifndef OSL_WAY
-	best2[iWay]=best;
-#else
+	// whichRow and rowBlock are work arrays here
+	int bestColumnsDone;
+	column2[iWay] = scanForLinking(numberColumns,numberRows,stack,
+				       columnStart,columnLength,row,
+				       whichRow,rowBlock,bestColumnsDone);
 	if (bestColumnsDone<numberColumns)
 	  best2[iWay]=-(numberColumns-bestColumnsDone);
 	else
 	  best2[iWay]=-numberColumns;
-#endif
-	column2[iWay]=bestColumn;
       }
       // mark columns
       int nMaster;
@@ -1503,7 +1447,6 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	delete [] rowBlock;
 	delete [] columnBlock;
 	delete [] whichRow;
-	delete [] whichColumn;
 	delete [] stack;
 	CoinModel model(numberRows,numberColumns,&matrix, rowLower, rowUpper,
 			columnLower,columnUpper,objective);
@@ -1521,57 +1464,15 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	  columnBlock[iColumn]=-1;
       }
     }
-    numberBlocks=0;
-    CoinFillN(rowBlock,numberRows,-2);
-    for (iRow=0;iRow<numberRows;iRow++) {
-      int kstart = rowStart[iRow];
-      int kend = rowStart[iRow]+rowLength[iRow];
-      if (rowBlock[iRow]==-2) {
-	// row not allocated
-	int j;
-	int nstack=0;
-	for (j=kstart;j<kend;j++) {
-	  int iColumn= column[j];
-	  if (columnBlock[iColumn]!=-1) {
-	    assert(columnBlock[iColumn]==-2);
-	    columnBlock[iColumn]=numberBlocks; // mark
-	    stack[nstack++] = iColumn;
-	  }
-	}
-	if (nstack) {
-	  // new block - put all connected in
-	  numberBlocks++;
-	  rowBlock[iRow]=numberBlocks-1;
-	  while (nstack) {
-	    int iColumn = stack[--nstack];
-	    int k;
-	    for (k=columnStart[iColumn];k<columnStart[iColumn]+columnLength[iColumn];k++) {
-	      int iRow = row[k];
-	      int kkstart = rowStart[iRow];
-	      int kkend = kkstart + rowLength[iRow];
-	      if (rowBlock[iRow]==-2) {
-		rowBlock[iRow]=numberBlocks-1; // mark
-		// row not allocated
-		int jj;
-		for (jj=kkstart;jj<kkend;jj++) {
-		  int jColumn= column[jj];
-		  if (columnBlock[jColumn]==-2) {
-		    columnBlock[jColumn]=numberBlocks-1;
-		    stack[nstack++]=jColumn;
-		  }
-		}
-	      } else {
-		assert (rowBlock[iRow]==numberBlocks-1);
-	      }
-	    }
-	  }
-	} else {
-	  // Only in master
-	  rowBlock[iRow]=-1;
-	}
-      }
-    }
     delete [] stack;
+    delete [] whichRow;
+    // Rows only in master get -1, empty columns stay at -2
+    numberBlocks = labelBlocks(numberRows,rowStart,rowLength,column,
+			       numberColumns,rowBlock,columnBlock);
+    int numberMoved = reduceLinking(numberColumns,columnStart,columnLength,
+				    row,columnBlock,rowBlock);
+    if (numberMoved)
+      printf("%d columns moved from master to blocks\n",numberMoved);
     int numberMasterColumns=0;
     for (iColumn=0;iColumn<numberColumns;iColumn++) {
       int iBlock = columnBlock[iColumn];
@@ -1606,16 +1507,8 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	numberBlocks=maxBlocks;
       }
     }
-    // make up problems
-    // Create all sub problems
-    // Space for creating
-    double * obj = new double [numberColumns];
-    double * rowLo = new double [numberRows];
-    double * rowUp = new double [numberRows];
-    double * columnLo = new double [numberColumns];
-    double * columnUp = new double [numberColumns];
     // Counts
-    int * columnCount = reinterpret_cast<int *>(columnLo);
+    int * columnCount = new int [2*numberBlocks];
     CoinZeroN(columnCount,numberBlocks);
     for (int i=0;i<numberColumns;i++) {
       int iBlock=columnBlock[i];
@@ -1639,7 +1532,7 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
 	columnCount[iSmall]++;
       }
     }
-    int * rowCount = reinterpret_cast<int *>(columnUp);
+    int * rowCount = columnCount+numberBlocks;
     CoinZeroN(rowCount,numberBlocks);
     for (int i=0;i<numberRows;i++) {
       int iBlock=rowBlock[i];
@@ -1653,125 +1546,168 @@ CoinStructuredModel::decompose(const CoinPackedMatrix & matrix,
       int k=2*columnCount[i]+rowCount[i];
       maximumSize = CoinMax(maximumSize,k);
     }
+    delete [] columnCount;
     if (maximumSize*10>4*(2*numberColumns+numberRows)) {
       // No good
       printf("Doesn't look good\n");
       delete [] rowBlock;
       delete [] columnBlock;
-      delete [] whichRow;
-      delete [] whichColumn;
-      delete [] obj ; 
-      delete [] columnLo ; 
-      delete [] columnUp ; 
-      delete [] rowLo ; 
-      delete [] rowUp ; 
       CoinModel model(numberRows,numberColumns,&matrix, rowLower, rowUpper,
 		      columnLower,columnUpper,objective);
       model.setObjectiveOffset(objectiveOffset);
       addBlock("row_master","column_master",model);
       return 0;
     }
-    // Name for master so at beginning
+    // make up problems
+    addDecomposedBlocks(matrix,rowLower,rowUpper,columnLower,columnUpper,
+			objective,type,numberBlocks,rowBlock,columnBlock);
+    delete [] rowBlock;
+    delete [] columnBlock;
+  } else {
+    abort();
+  }
+  return numberBlocks;
+}
+/* Adds blocks found by decompose.  Row and column blocks are -1 for
+   master (linking) ones.  Block matrices are built in one sweep over
+   the columns of each block and handed to the CoinModels without copying.
+*/
+void
+CoinStructuredModel::addDecomposedBlocks(const CoinPackedMatrix & matrix,
+					 const double * rowLower,
+					 const double * rowUpper,
+					 const double * columnLower,
+					 const double * columnUpper,
+					 const double * objective, int type,
+					 int numberBlocks, const int * rowBlock,
+					 const int * columnBlock)
+{
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  // Rows and columns of each block in order, master ones last
+  int * rowStart = new int [numberBlocks+2];
+  int * rowList = new int [numberRows];
+  int * rowPosition = new int [numberRows];
+  bucketBlocks(numberRows,rowBlock,numberBlocks,rowStart,rowList,rowPosition);
+  int * columnStart = new int [numberBlocks+2];
+  int * columnList = new int [numberColumns];
+  int * columnPosition = new int [numberColumns];
+  bucketBlocks(numberColumns,columnBlock,numberBlocks,columnStart,columnList,
+	       columnPosition);
+  delete [] columnPosition;
+  const int * masterRow = rowList+rowStart[numberBlocks];
+  int numberMasterRows = rowStart[numberBlocks+1]-rowStart[numberBlocks];
+  const int * masterColumn = columnList+columnStart[numberBlocks];
+  int numberMasterColumns =
+    columnStart[numberBlocks+1]-columnStart[numberBlocks];
+  // Name for master so at top (D-W) or beginning (Benders)
+  if (type==1)
+    addRowBlock(numberMasterRows,"row_master");
+  else
     addColumnBlock(numberMasterColumns,"column_master");
-    // Arrays
-    // get full matrix
-    CoinPackedMatrix fullMatrix = matrix;
-    int numberRow2,numberColumn2;
-    int iBlock;
-    for (iBlock=0;iBlock<numberBlocks;iBlock++) {
-      char rowName[20];
-      sprintf(rowName,"row_%d",iBlock);
-      char columnName[20];
-      sprintf(columnName,"column_%d",iBlock);
-      numberRow2=0;
-      numberColumn2=0;
-      for (iColumn=0;iColumn<numberColumns;iColumn++) {
-	if (iBlock==columnBlock[iColumn]) {
-	  obj[numberColumn2]=objective[iColumn];
-	  columnLo[numberColumn2]=columnLower[iColumn];
-	  columnUp[numberColumn2]=columnUpper[iColumn];
-	  whichColumn[numberColumn2++]=iColumn;
-	}
-      }
-      for (iRow=0;iRow<numberRows;iRow++) {
-	if (iBlock==rowBlock[iRow]) {
-	  rowLo[numberRow2]=rowLower[iRow];
-	  rowUp[numberRow2]=rowUpper[iRow];
-	  whichRow[numberRow2++]=iRow;
-	}
-      }
+  CoinPackedMatrix * diagonal = new CoinPackedMatrix [numberBlocks];
+  CoinPackedMatrix * border = new CoinPackedMatrix [numberBlocks];
+  CoinBlockMatrixInfo info;
+  info.matrix = &matrix;
+  info.rowBlock = rowBlock;
+  info.rowPosition = rowPosition;
+  info.rowStart = rowStart;
+  info.columnStart = columnStart;
+  info.columnList = columnList;
+  info.diagonal = diagonal;
+  info.border = border;
+  info.numberBlocks = numberBlocks;
+  info.type = type;
+  buildBlockMatrices(info);
+  // Space for bounds
+  double * obj = new double [numberColumns];
+  double * columnLo = new double [numberColumns];
+  double * columnUp = new double [numberColumns];
+  double * rowLo = new double [numberRows];
+  double * rowUp = new double [numberRows];
+  // CoinModels are made from an empty matrix and then given the block
+  CoinPackedMatrix empty;
+  for (int iBlock=0;iBlock<numberBlocks;iBlock++) {
+    char rowName[20];
+    sprintf(rowName,"row_%d",iBlock);
+    char columnName[20];
+    sprintf(columnName,"column_%d",iBlock);
+    const int * whichRow = rowList+rowStart[iBlock];
+    int numberRow2 = rowStart[iBlock+1]-rowStart[iBlock];
+    const int * whichColumn = columnList+columnStart[iBlock];
+    int numberColumn2 = columnStart[iBlock+1]-columnStart[iBlock];
+    for (int i=0;i<numberRow2;i++) {
+      int iRow = whichRow[i];
+      rowLo[i]=rowLower[iRow];
+      rowUp[i]=rowUpper[iRow];
+    }
+    for (int i=0;i<numberColumn2;i++) {
+      int iColumn = whichColumn[i];
+      obj[i]=objective[iColumn];
+      columnLo[i]=columnLower[iColumn];
+      columnUp[i]=columnUpper[iColumn];
+    }
+    if (type==1) {
+      // Diagonal block
+      CoinModel * block = new CoinModel(numberRow2,numberColumn2,&empty,
+					rowLo,rowUp,NULL,NULL,NULL);
+      block->assignMatrix(diagonal[iBlock]);
+      block->setOriginalIndices(whichRow,whichColumn);
+      addBlock(rowName,columnName,block); // takes ownership
+      // and top block
+      block = new CoinModel(numberMasterRows,numberColumn2,&empty,
+			    NULL,NULL,columnLo,columnUp,obj);
+      block->assignMatrix(border[iBlock]);
+      block->setOriginalIndices(masterRow,whichColumn);
+      addBlock("row_master",columnName,block); // takes ownership
+    } else {
       // Diagonal block
-      CoinPackedMatrix mat(fullMatrix,
-			   numberRow2,whichRow,
-			   numberColumn2,whichColumn);
-      // make sure correct dimensions
-      mat.setDimensions(numberRow2,numberColumn2);
-      CoinModel * block = new CoinModel(numberRow2,numberColumn2,&mat,
+      CoinModel * block = new CoinModel(numberRow2,numberColumn2,&empty,
 					rowLo,rowUp,columnLo,columnUp,obj);
+      block->assignMatrix(diagonal[iBlock]);
       block->setOriginalIndices(whichRow,whichColumn);
       addBlock(rowName,columnName,block); // takes ownership
       // and beginning block
-      numberColumn2=0;
-      // get beginning matrix
-      for (iColumn=0;iColumn<numberColumns;iColumn++) {
-	int iBlock = columnBlock[iColumn];
-	if (iBlock==-1) {
-	  whichColumn[numberColumn2++]=iColumn;
-	}
-      }
-      CoinPackedMatrix beginning(fullMatrix,
-			   numberRow2,whichRow,
-			   numberColumn2,whichColumn);
-      // make sure correct dimensions *********
-      beginning.setDimensions(numberRow2,numberColumn2);
-      block = new CoinModel(numberRow2,numberMasterColumns,&beginning,
+      block = new CoinModel(numberRow2,numberMasterColumns,&empty,
 			    NULL,NULL,NULL,NULL,NULL);
-      block->setOriginalIndices(whichRow,whichColumn);
+      block->assignMatrix(border[iBlock]);
+      block->setOriginalIndices(whichRow,masterColumn);
       addBlock(rowName,"column_master",block); // takes ownership
     }
-    // and master
-    numberRow2=0;
-    numberColumn2=0;
-    for (iColumn=0;iColumn<numberColumns;iColumn++) {
-      int iBlock = columnBlock[iColumn];
-      if (iBlock==-1) {
-	obj[numberColumn2]=objective[iColumn];
-	columnLo[numberColumn2]=columnLower[iColumn];
-	columnUp[numberColumn2]=columnUpper[iColumn];
-	whichColumn[numberColumn2++]=iColumn;
-      }
-    }
-    for (iRow=0;iRow<numberRows;iRow++) {
-      int iBlock = rowBlock[iRow];
-      if (iBlock<0) {
-	rowLo[numberRow2]=rowLower[iRow];
-	rowUp[numberRow2]=rowUpper[iRow];
-	whichRow[numberRow2++]=iRow;
-      }
-    }
-    delete [] rowBlock;
-    delete [] columnBlock;
-    CoinPackedMatrix beginning(fullMatrix,
-			 numberRow2,whichRow,
-			 numberColumn2,whichColumn);
-    // make sure correct dimensions
-    beginning.setDimensions(numberRow2,numberColumn2);
-    CoinModel * block = new CoinModel(numberRow2,numberColumn2,&beginning,
-				      rowLo,rowUp,
-				      columnLo,columnUp,obj);
-    block->setOriginalIndices(whichRow,whichColumn);
-    addBlock("row_master","column_master",block); // takes ownership
-    delete [] whichRow;
-    delete [] whichColumn;
-    delete [] obj ; 
-    delete [] columnLo ; 
-    delete [] columnUp ; 
-    delete [] rowLo ; 
-    delete [] rowUp ; 
-  } else {
-    abort();
   }
-  return numberBlocks;
+  delete [] diagonal;
+  delete [] border;
+  // and master
+  for (int i=0;i<numberMasterRows;i++) {
+    int iRow = masterRow[i];
+    rowLo[i]=rowLower[iRow];
+    rowUp[i]=rowUpper[iRow];
+  }
+  for (int i=0;i<numberMasterColumns;i++) {
+    int iColumn = masterColumn[i];
+    obj[i]=objective[iColumn];
+    columnLo[i]=columnLower[iColumn];
+    columnUp[i]=columnUpper[iColumn];
+  }
+  CoinPackedMatrix master;
+  blockMatrix(matrix,rowBlock,rowPosition,-1,numberMasterRows,
+	      numberMasterColumns,masterColumn,master);
+  CoinModel * block = new CoinModel(numberMasterRows,numberMasterColumns,
+				    &empty,rowLo,rowUp,
+				    columnLo,columnUp,obj);
+  block->assignMatrix(master);
+  block->setOriginalIndices(masterRow,masterColumn);
+  addBlock("row_master","column_master",block); // takes ownership
+  delete [] rowStart;
+  delete [] rowList;
+  delete [] rowPosition;
+  delete [] columnStart;
+  delete [] columnList;
+  delete [] obj ;
+  delete [] columnLo ;
+  delete [] columnUp ;
+  delete [] rowLo ;
+  delete [] rowUp ;
 }
 /* Decompose a CoinModel
    1 - try D-W
@@ -216,6 +216,16 @@ private:
   /** Fill in info structure and update counts
   */
   void fillInfo(CoinModelBlockInfo & info,const CoinStructuredModel * block);
+  /** Add blocks found by decompose (type 1 or 2).  rowBlock and
+      columnBlock give the block of each row and column, -1 for master.
+  */
+  void addDecomposedBlocks(const CoinPackedMatrix & matrix,
+			   const double * rowLower, const double * rowUpper,
+			   const double * columnLower,
+			   const double * columnUpper,
+			   const double * objective, int type,
+			   int numberBlocks, const int * rowBlock,
+			   const int * columnBlock);
   /**@name Data members */
    //@{
   /// Current number of row blocks
@@ -283,6 +283,31 @@ CoinWarmStartBasis::deleteRows (int rawTgtCnt, const int *rawTgts)
   }
   return  ; }
 
+/*
+  remapRows takes the old-to-new index map of a row deletion (-1 for deleted
+  rows) and compresses the artificialStatus_ array in place. The map lets a
+  caller which has already worked out the deletion for the matrix and rim
+  vectors reuse it without sorting the target list again.
+*/
+void
+CoinWarmStartBasis::remapRows (const int *newIndex)
+{
+  int keep = 0 ;
+  for (int i = 0 ; i < numArtificial_ ; i++)
+  { if (newIndex[i] >= 0)
+    { assert (newIndex[i] == keep) ;
+      Status stati = getStatus(artificialStatus_,i) ;
+      setStatus(artificialStatus_,keep++,stati) ; }
+#   ifdef COIN_DEBUG
+    else
+    if (getStatus(artificialStatus_,i) != CoinWarmStartBasis::basic)
+    { std::cout << "nonbasic artificial " << i << " deleted." << std::endl ; }
+#   endif
+  }
+  numArtificial_ = keep ;
+
+  return ; }
+
 // Deletes columns
 void 
 CoinWarmStartBasis::deleteColumns(int number, const int * which)
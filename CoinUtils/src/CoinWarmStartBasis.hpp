@@ -225,6 +225,19 @@ public:
 
   virtual void deleteRows(int rawTgtCnt, const int *rawTgts) ;
 
+  /** \brief Delete rows using an old-to-new index map
+
+    \p newIndex holds, for each row of the basis, the index the row has after
+    the deletion or -1 if the row is deleted, as produced by
+    CoinPackedMatrix::deletionMap. Surviving rows must keep their relative
+    order.
+
+    \warning
+    The same validity caveats as for deleteRows() apply.
+  */
+
+  virtual void remapRows(const int *newIndex) ;
+
   /** \brief Delete a set of columns from the basis
 
     \warning
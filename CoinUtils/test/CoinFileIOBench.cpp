@@ -0,0 +1,206 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CoinFileIO.hpp"
+#include "CoinError.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+
+// Models of the Netlib set, as in Data/Netlib
+static const char * netlibNames[] = {
+  "25fv47", "80bau3b", "adlittle", "afiro", "agg", "agg2", "agg3", "bandm",
+  "beaconfd", "blend", "bnl1", "bnl2", "boeing1", "boeing2", "bore3d",
+  "brandy", "capri", "cycle", "czprob", "d2q06c", "d6cube", "degen2",
+  "degen3", "dfl001", "e226", "etamacro", "fffff800", "finnis", "fit1d",
+  "fit1p", "fit2d", "fit2p", "forplan", "ganges", "gfrd-pnc", "greenbea",
+  "greenbeb", "grow15", "grow22", "grow7", "israel", "kb2", "lotfi",
+  "maros-r7", "maros", "modszk1", "nesm", "perold", "pilot", "pilot4",
+  "pilot87", "pilotnov", "recipe", "sc105", "sc205", "sc50a", "sc50b",
+  "scagr25", "scagr7", "scfxm1", "scfxm2", "scfxm3", "scorpion", "scrs8",
+  "scsd1", "scsd6", "scsd8", "sctap1", "sctap2", "sctap3", "seba",
+  "share1b", "share2b", "shell", "ship04l", "ship04s", "ship08l",
+  "ship08s", "ship12l", "ship12s", "sierra", "stair", "standata",
+  "standgub", "standmps", "stocfor1", "stocfor2", "tuff", "vtpbase",
+  "wood1p", "woodw"
+};
+
+// Whole (decompressed) contents of a file
+static bool readWhole (const std::string & fileName, std::string & contents)
+{
+  try {
+    CoinFileInput * input = CoinFileInput::create(fileName);
+    char buffer[65536];
+    int n;
+    contents.clear();
+    while ((n = input->read(buffer,sizeof(buffer))) > 0)
+      contents.append(buffer,n);
+    delete input;
+  }
+  catch (CoinError &) {
+    return false;
+  }
+  return true;
+}
+
+// Write contents a line at a time, as the MPS and Lp writers do
+static void writeLines (CoinFileOutput * output, const std::string & contents)
+{
+  const char * data = contents.data();
+  const char * end = data + contents.size();
+  while (data < end) {
+    const char * next =
+      static_cast<const char *>(memchr(data,'\n',end-data));
+    next = next ? next+1 : end;
+    output->write(data,static_cast<int>(next-data));
+    data = next;
+  }
+}
+
+static long fileSize (const char * fileName)
+{
+  FILE * fp = fopen(fileName,"rb");
+  if (!fp)
+    return 0;
+  fseek(fp,0,SEEK_END);
+  long size = ftell(fp);
+  fclose(fp);
+  return size;
+}
+
+/*
+  Compression throughput of CoinFileOutput on the decompressed Netlib set,
+  for each compression and number of threads.  "per model" writes each
+  model to its own file, as writeMps does; "one stream" writes the whole
+  set to one file, which shows what the threads can do on a large model.
+  Then the same for reading: readMps on the gzip'ed models, and the whole
+  set as one file written on the most threads, read a line at a time.
+  Rates are in MB of uncompressed data per second of wall clock time.
+*/
+void CoinFileIOBenchmark(const std::string & netlibDir,
+			 const std::vector<int> & threads, int repeat)
+{
+  std::vector<std::string> models;
+  std::vector<std::string> fileNames;
+  std::string all;
+  int numberNames = static_cast<int>(sizeof(netlibNames)/sizeof(char *));
+  for (int i = 0; i < numberNames; i++) {
+    std::string fileName = netlibDir+netlibNames[i]+".mps";
+    std::string contents;
+    if (fileCoinReadable(fileName) && readWhole(fileName,contents)) {
+      models.push_back(contents);
+      fileNames.push_back(fileName);
+      all += contents;
+    }
+  }
+  if (models.empty()) {
+    std::cout << "fileio: no Netlib models found in " << netlibDir
+	      << std::endl;
+    return;
+  }
+  double megabytes = all.size()/1.0e6;
+  char line[200];
+  sprintf(line,"fileio: %d Netlib models, %.1f MB decompressed, %d repeats",
+	  static_cast<int>(models.size()),megabytes,repeat);
+  std::cout << line << std::endl;
+  int saveThreads = CoinFileOutput::compressionThreads();
+  for (int type = 1; type <= 2; type++) {
+    CoinFileOutput::Compression compression =
+      static_cast<CoinFileOutput::Compression>(type);
+    if (!CoinFileOutput::compressionSupported(compression))
+      continue;
+    const char * name = type == 1 ? "gzip" : "bzip2";
+    const char * fileName = type == 1 ? "CoinFileIOBench.gz" :
+      "CoinFileIOBench.bz2";
+    for (size_t k = 0; k < threads.size(); k++) {
+      CoinFileOutput::setCompressionThreads(threads[k]);
+      double start = CoinGetTimeOfDay();
+      for (int pass = 0; pass < repeat; pass++) {
+	for (size_t i = 0; i < models.size(); i++) {
+	  CoinFileOutput * output = CoinFileOutput::create(fileName,
+							   compression);
+	  writeLines(output,models[i]);
+	  delete output;
+	}
+      }
+      double perModel = (CoinGetTimeOfDay()-start)/repeat;
+      start = CoinGetTimeOfDay();
+      for (int pass = 0; pass < repeat; pass++) {
+	CoinFileOutput * output = CoinFileOutput::create(fileName,
+							 compression);
+	writeLines(output,all);
+	delete output;
+      }
+      double oneStream = (CoinGetTimeOfDay()-start)/repeat;
+      // check the stream reads back
+      std::string check;
+      bool ok = readWhole(fileName,check) && check == all;
+      sprintf(line,"fileio: %-5s threads %2d  per model %7.3f s %7.1f MB/s"
+	      "  one stream %7.3f s %7.1f MB/s  ratio %.3f%s",
+	      name,threads[k],perModel,megabytes/perModel,
+	      oneStream,megabytes/oneStream,
+	      fileSize(fileName)/static_cast<double>(all.size()),
+	      ok ? "" : "  READ BACK FAILED");
+      std::cout << line << std::endl;
+    }
+    remove(fileName);
+  }
+  if (CoinFileOutput::compressionSupported(CoinFileOutput::COMPRESS_GZIP)) {
+    const char * fileName = "CoinFileIOBench.gz";
+    int mostThreads = 1;
+    for (size_t k = 0; k < threads.size(); k++)
+      mostThreads = CoinMax(mostThreads,threads[k]);
+    CoinFileOutput::setCompressionThreads(mostThreads);
+    CoinFileOutput * output = CoinFileOutput::create(fileName,
+					     CoinFileOutput::COMPRESS_GZIP);
+    writeLines(output,all);
+    delete output;
+    int saveReadThreads = CoinFileInput::decompressionThreads();
+    std::vector<int> readThreads(1,0);
+    readThreads.insert(readThreads.end(),threads.begin(),threads.end());
+    for (size_t k = 0; k < readThreads.size(); k++) {
+      CoinFileInput::setDecompressionThreads(readThreads[k]);
+      double start = CoinGetTimeOfDay();
+      for (int pass = 0; pass < repeat; pass++) {
+	for (size_t i = 0; i < fileNames.size(); i++) {
+	  CoinMpsIO m;
+	  m.messageHandler()->setLogLevel(0);
+	  m.readMps(fileNames[i].c_str(),"");
+	}
+      }
+      double perModel = (CoinGetTimeOfDay()-start)/repeat;
+      start = CoinGetTimeOfDay();
+      double size = 0.0;
+      for (int pass = 0; pass < repeat; pass++) {
+	CoinFileInput * input = CoinFileInput::create(fileName);
+	char buffer[1024];
+	while (input->gets(buffer,sizeof(buffer)))
+	  size += strlen(buffer);
+	delete input;
+      }
+      double oneStream = (CoinGetTimeOfDay()-start)/repeat;
+      sprintf(line,"fileio: read  threads %2d  readMps   %7.3f s %7.1f MB/s"
+	      "  one stream %7.3f s %7.1f MB/s%s",
+	      readThreads[k],perModel,megabytes/perModel,
+	      oneStream,megabytes/oneStream,
+	      size == repeat*static_cast<double>(all.size()) ? "" :
+	      "  READ BACK FAILED");
+      std::cout << line << std::endl;
+    }
+    remove(fileName);
+    CoinFileInput::setDecompressionThreads(saveReadThreads);
+  }
+  CoinFileOutput::setCompressionThreads(saveThreads);
+}
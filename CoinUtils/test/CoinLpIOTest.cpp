@@ -14,6 +14,7 @@
 #include <cassert>
 
 #include "CoinLpIO.hpp"
+#include "CoinFileIO.hpp"
 #include "CoinFloatEqual.hpp"
 #include <string.h>
 //#############################################################################
@@ -174,6 +175,31 @@ CoinLpIOUnitTest(const std::string& lpDir)
          assert( eq( dumSi.getObjCoefficients()[6],  0.0) );
          assert( eq( dumSi.getObjCoefficients()[7],  0.0) );
       }
+      // Read it again through a FILE and a CoinFileInput
+      {
+         CoinLpIO byName;
+         byName.readLp("CoinLpIoTest.lp");
+         CoinLpIO byFile;
+         FILE *fp = fopen("CoinLpIoTest.lp", "r");
+         assert( fp != NULL );
+         byFile.readLp(fp);
+         fclose(fp);
+         CoinLpIO byInput;
+         CoinFileInput *input = CoinFileInput::create("CoinLpIoTest.lp");
+         byInput.readLp(input);
+         delete input;
+         const CoinLpIO * other[2] = { &byFile, &byInput };
+         for (int k = 0; k < 2; k++) {
+            assert( other[k]->getNumCols() == byName.getNumCols() );
+            assert( other[k]->getNumRows() == byName.getNumRows() );
+            assert( other[k]->getMatrixByRow()->
+                    isEquivalent(*byName.getMatrixByRow()) );
+            assert( !memcmp(other[k]->getColLower(), byName.getColLower(),
+                            byName.getNumCols()*sizeof(double)) );
+            assert( !memcmp(other[k]->getRowUpper(), byName.getRowUpper(),
+                            byName.getNumRows()*sizeof(double)) );
+         }
+      }
       // Test matrixByRow method
       {
          const CoinLpIO si(m);
@@ -0,0 +1,66 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "CoinMessageHandler.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+
+// Formats messages but throws them away
+class CoinDiscardMessageHandler : public CoinMessageHandler {
+public:
+  virtual int print() { return 0; }
+};
+
+/* Time a loop of messages with an int, a double and a string.  If there
+   is a ring, empty it every so often as a logging thread would. */
+static double timeMessages (CoinMessageHandler & handler,
+			    const CoinMessages & messages, int number,
+			    CoinMessageRing * ring = NULL)
+{
+  char text[COIN_MESSAGE_HANDLER_MAX_BUFFER_SIZE];
+  double start = CoinGetTimeOfDay();
+  for (int i = 0; i < number; i++) {
+    handler.message(0,messages) << i << 0.5*i << "x1" << CoinMessageEol;
+    if (ring && (i&255) == 255) {
+      while (ring->pop(text)) {}
+    }
+  }
+  return (CoinGetTimeOfDay()-start)*1.0e9/number;
+}
+
+void CoinMessageHandlerBenchmark(int repeat)
+{
+  CoinMessages messages(1);
+  strcpy(messages.source_,"Bnch");
+  CoinOneMessage one(1,3,"Column %d has value %g and name %s");
+  messages.addMessage(0,one);
+  const int number = 1000000;
+  double dropped = 1.0e100;
+  double printed = 1.0e100;
+  double ring = 1.0e100;
+  int dropCount = 0;
+  for (int pass = 0; pass < repeat; pass++) {
+    CoinMessageHandler quiet;
+    quiet.setLogLevel(1);
+    dropped = CoinMin(dropped,timeMessages(quiet,messages,10*number));
+    CoinDiscardMessageHandler discard;
+    discard.setLogLevel(3);
+    printed = CoinMin(printed,timeMessages(discard,messages,number));
+    CoinMessageRing messageRing(1024);
+    CoinRingMessageHandler ringHandler(&messageRing);
+    ringHandler.setLogLevel(3);
+    ring = CoinMin(ring,timeMessages(ringHandler,messages,number,
+				     &messageRing));
+    dropCount += messageRing.numberDropped();
+  }
+  char line[200];
+  sprintf(line,"messages: dropped by log level %7.1f ns  formatted %7.1f ns"
+	  "  through ring %7.1f ns%s",dropped,printed,ring,
+	  dropCount ? "  RING DROPPED MESSAGES" : "");
+  std::cout << line << std::endl;
+}
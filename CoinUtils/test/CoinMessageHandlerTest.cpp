@@ -12,6 +12,7 @@
 
 #include "CoinPragma.hpp"
 #include "CoinMessageHandler.hpp"
+#include <cstdlib>
 #include <cstring>
 
 namespace { // begin file-local namespace
@@ -246,6 +247,78 @@ void advTestsWithMessages (const CoinMessages &testMessages, int &errs)
 
   return ; }
 
+/*
+  Messages dropped by the log level, and the ring sink. A ring handler lets
+  us look at the text of each message which printed, so check that dropped
+  messages in between leave no trace.
+*/
+void ringTestsWithMessages (const CoinMessages &testMessages, int &errs)
+{
+  CoinMessageRing ring(3) ;
+  if (ring.capacity() != 4)
+  { std::cout
+      << "Ring capacity should be rounded up to 4!" << std::endl ;
+    errs++ ; }
+  CoinRingMessageHandler hdl(&ring) ;
+  char text[COIN_MESSAGE_HANDLER_MAX_BUFFER_SIZE] ;
+  int externalNumber ;
+  char severity ;
+
+  hdl.setLogLevel(0) ;
+  if (hdl.wouldPrint(COIN_TST_INT,testMessages))
+  { std::cout
+      << "Message of detail 1 should not print at log level 0!" << std::endl ;
+    errs++ ; }
+  hdl.message(COIN_TST_INT,testMessages) << 42 << CoinMessageEol ;
+  hdl.message(COIN_TST_MULTIPART,testMessages) ;
+  hdl.printing(true) << 42 ;
+  hdl.printing(false) << CoinMessageEol ;
+  if (ring.pop(text) || hdl.currentMessage().externalNumber() != 7)
+  { std::cout
+      << "Dropped message was printed or not recorded!" << std::endl ;
+    errs++ ; }
+
+  hdl.setLogLevel(1) ;
+  if (!hdl.wouldPrint(COIN_TST_INT,testMessages))
+  { std::cout
+      << "Message of detail 1 should print at log level 1!" << std::endl ;
+    errs++ ; }
+  hdl.message(COIN_TST_INT,testMessages) << 42 << CoinMessageEol ;
+  hdl.setLogLevel(0) ;
+  hdl.message(COIN_TST_DBL,testMessages) << 4.2 << CoinMessageEol ;
+  hdl.setLogLevel(1) ;
+  hdl.message(COIN_TST_STRING,testMessages) << "forty-two" << CoinMessageEol ;
+  if (!ring.pop(text,&externalNumber,&severity) ||
+      strcmp(text,"Test0003I This message has an integer field: (42)") ||
+      externalNumber != 3 || severity != 'I')
+  { std::cout
+      << "First ring message wrong!" << std::endl ;
+    errs++ ; }
+  if (!ring.pop(text) ||
+      strcmp(text,"Test0006I This message has a string field: (forty-two)"))
+  { std::cout
+      << "Second ring message wrong!" << std::endl ;
+    errs++ ; }
+/*
+  A clone shares the ring. Go round the ring a few times, then overfill it.
+*/
+  CoinMessageHandler *clone = hdl.clone() ;
+  for (int i = 0 ; i < 10 ; i++)
+  { clone->message(COIN_TST_INT,testMessages) << i << CoinMessageEol ;
+    if (!ring.pop(text) || atoi(strchr(text,'(')+1) != i)
+    { std::cout
+	<< "Ring message " << i << " wrong!" << std::endl ;
+      errs++ ; } }
+  for (int i = 0 ; i < 6 ; i++)
+    clone->message(COIN_TST_INT,testMessages) << i << CoinMessageEol ;
+  delete clone ;
+  if (ring.numberDropped() != 2 || ring.flush(stdout) != 4 || ring.pop(text))
+  { std::cout
+      << "Full ring should drop two messages and flush four!" << std::endl ;
+    errs++ ; }
+
+  return ; }
+
 } // end file-local namespace
 
 bool CoinMessageHandlerUnitTest ()
@@ -281,6 +354,10 @@ bool CoinMessageHandlerUnitTest ()
   Advanced tests with messages. 
 */
   advTestsWithMessages(testMessages,errs) ;
+/*
+  Dropped messages and the ring sink.
+*/
+  ringTestsWithMessages(testMessages,errs) ;
 /*
   Did we make it without error?
 */
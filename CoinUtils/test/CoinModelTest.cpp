@@ -15,6 +15,7 @@
 
 #include "CoinMpsIO.hpp"
 #include "CoinModel.hpp"
+#include "CoinStructuredModel.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinTime.hpp"
 
@@ -682,6 +683,56 @@ CoinModelUnitTest(const std::string & mpsDir,
 	<< time1 << " seconds\n" << std::endl ;
     }
   }
+  // Dantzig-Wolfe decomposition against known block structure
+  {
+    std::string fn = mpsDir+"atm_5_10_1";
+    FILE * fp = fopen((fn+".block").c_str(),"r");
+    if (!fp) {
+      std::cout << "Could not open " << fn << ".block; skipping test." << std::endl ;
+    } else {
+      // each block is "block numberRows" followed by its rows
+      std::vector<std::vector<int> > blockRows;
+      int iBlock,numberRows2;
+      while (fscanf(fp,"%d %d",&iBlock,&numberRows2)==2) {
+	assert (iBlock==static_cast<int>(blockRows.size()));
+	blockRows.push_back(std::vector<int>(numberRows2));
+	for (int i=0;i<numberRows2;i++) {
+	  int n = fscanf(fp,"%d",&blockRows[iBlock][i]);
+	  assert (n==1);
+	}
+      }
+      fclose(fp);
+      int numberBlocks = static_cast<int>(blockRows.size());
+      CoinModel whole((fn+".mps").c_str());
+      CoinStructuredModel structured((fn+".mps").c_str(),1);
+      assert (structured.numberRowBlocks()==numberBlocks+1);
+      assert (structured.numberColumnBlocks()==numberBlocks+1);
+      assert (structured.numberElements()==whole.numberElements());
+      int numberMasterRows = whole.numberRows();
+      for (iBlock=0;iBlock<numberBlocks;iBlock++)
+	numberMasterRows -= static_cast<int>(blockRows[iBlock].size());
+      int numberFound=0;
+      for (int i=0;i<structured.numberElementBlocks();i++) {
+	const CoinModelBlockInfo & info = structured.blockType(i);
+	const CoinModel * block = structured.coinBlock(i);
+	assert (block);
+	const std::string & rowName = structured.getRowBlock(info.rowBlock);
+	if (rowName=="row_master") {
+	  assert (block->numberRows()==numberMasterRows);
+	  continue;
+	}
+	iBlock = atoi(rowName.c_str()+4);
+	assert (iBlock>=0&&iBlock<numberBlocks);
+	int n = static_cast<int>(blockRows[iBlock].size());
+	assert (block->numberRows()==n);
+	const int * originalRows = block->originalRows();
+	for (int j=0;j<n;j++)
+	  assert (originalRows[j]==blockRows[iBlock][j]);
+	numberFound++;
+      }
+      assert (numberFound==numberBlocks);
+    }
+  }
 }
 
 
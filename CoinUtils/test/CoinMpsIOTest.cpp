@@ -14,7 +14,13 @@
 #include <cassert>
 
 #include "CoinMpsIO.hpp"
+#include "CoinSmpsIO.hpp"
+#include "CoinModel.hpp"
+#include "CoinStructuredModel.hpp"
 #include "CoinFloatEqual.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinDoubleFormat.hpp"
+#include "CoinFileIO.hpp"
 
 //#############################################################################
 
@@ -88,6 +94,25 @@ CoinMpsIOUnitTest(const std::string & mpsDir)
       assert( lhs.getNumRows() == m.getNumRows() );      
     }
     
+    // Test names survive copying and are found by hash
+    {
+      CoinMpsIO copy(m);
+      int i;
+      for (i=0;i<m.getNumRows();i++) {
+        assert( !strcmp( copy.rowName(i), m.rowName(i) ) );
+        assert( copy.rowName(i) != m.rowName(i) );
+        assert( copy.rowIndex(m.rowName(i)) == i );
+      }
+      for (i=0;i<m.getNumCols();i++) {
+        assert( !strcmp( copy.columnName(i), m.columnName(i) ) );
+        assert( copy.columnIndex(m.columnName(i)) == i );
+      }
+      assert( !strcmp( copy.rowName(0), "ROW01" ) );
+      assert( !strcmp( copy.columnName(7), "COL08" ) );
+      assert( copy.rowIndex("COL01") == -1 );
+      assert( copy.columnIndex("ROW01") == -1 );
+      assert( copy.columnIndex("") == -1 );
+    }
     
     {    
       CoinMpsIO dumSi(m);
@@ -158,6 +183,116 @@ CoinMpsIOUnitTest(const std::string & mpsDir)
       assert( eq( dumSi.getObjCoefficients()[6],  0.0) );
       assert( eq( dumSi.getObjCoefficients()[7], -1.0) );
     }
+
+    // Number formatting used by the writers
+    {
+      char buffer[32];
+      assert( CoinShortestDouble(0.1,buffer)==3 && !strcmp(buffer,"0.1") );
+      CoinShortestDouble(-2.5e-5,buffer);
+      assert( !strcmp(buffer,"-2.5e-05") );
+      CoinShortestDouble(1.0e16,buffer);
+      assert( !strcmp(buffer,"1e+16") );
+      CoinShortestDouble(123456.0,buffer);
+      assert( !strcmp(buffer,"123456") );
+      assert( CoinFixedDouble(0.125,2,buffer)==4 && !strcmp(buffer,"0.12") );
+      CoinFixedDouble(-0.001,2,buffer);
+      assert( !strcmp(buffer,"-0.00") );
+      CoinFixedDouble(1234.5678,10,buffer);
+      assert( !strcmp(buffer,"1234.5678000000") );
+      assert( CoinFixedDouble(1.0e300,2,buffer)==-1 );
+      assert( CoinReadDouble("0.1")==0.1 );
+      assert( CoinReadDouble("-1.5e3")==-1500.0 );
+      assert( CoinReadDouble("1e-400")==0.0 );
+    }
+
+    // Extra accuracy format must read back exactly
+    {
+      CoinPackedMatrix matrix(*m.getMatrixByCol());
+      double * elements = matrix.getMutableElements();
+      CoinBigIndex numberElements = matrix.getNumElements();
+      for (CoinBigIndex i=0;i<numberElements;i++)
+	elements[i] /= 3.0;
+      int nc = m.getNumCols();
+      int nr = m.getNumRows();
+      double * obj = CoinCopyOfArray(m.getObjCoefficients(),nc);
+      double * rowUpper = CoinCopyOfArray(m.getRowUpper(),nr);
+      obj[0] = 1.0e-10/7.0;
+      obj[2] = 1.0e30/7.0;
+      obj[1] = 0.1+0.2;
+      rowUpper[1] = -1.0/3.0;
+      CoinMpsIO accurate;
+      accurate.setMpsData(matrix,m.getInfinity(),m.getColLower(),m.getColUpper(),
+			  obj,m.integerColumns(),m.getRowLower(),rowUpper,
+			  static_cast<char**>(NULL),static_cast<char**>(NULL));
+      accurate.writeMps("CoinMpsIoTestAccurate.mps",0,1);
+      CoinMpsIO readBack;
+      readBack.messageHandler()->setLogLevel(0);
+      readBack.readMps("CoinMpsIoTestAccurate.mps");
+      assert( readBack.getNumCols()==nc );
+      assert( !memcmp(readBack.getObjCoefficients(),obj,nc*sizeof(double)) );
+      assert( !memcmp(readBack.getRowUpper(),rowUpper,nr*sizeof(double)) );
+      const CoinPackedMatrix * readMatrix = readBack.getMatrixByCol();
+      assert( readMatrix->getNumElements()==numberElements );
+      for (int j=0;j<nc;j++) {
+	CoinShallowPackedVector column = readMatrix->getVector(j);
+	CoinShallowPackedVector original = matrix.getVector(j);
+	assert( column.getNumElements()==original.getNumElements() );
+	for (int k=0;k<column.getNumElements();k++) {
+	  assert( column.getIndices()[k]==original.getIndices()[k] );
+	  assert( column.getElements()[k]==original.getElements()[k] );
+	}
+      }
+      delete [] obj;
+      delete [] rowUpper;
+    }
+
+    // Compressed output on several threads must read back as one file,
+    // also when decompressing ahead
+    {
+      CoinFileOutput::setCompressionThreads(4);
+      for (int type=1;type<=2;type++) {
+	CoinFileOutput::Compression compression =
+	  static_cast<CoinFileOutput::Compression>(type);
+	if (!CoinFileOutput::compressionSupported(compression))
+	  continue;
+	const char * name = type==1 ? "CoinMpsIoTestPieces.gz" :
+	  "CoinMpsIoTestPieces.bz2";
+	// several chunks for both gzip and bzip2
+	const int numberLines = 150000;
+	char line[80];
+	CoinFileOutput * output = CoinFileOutput::create(name,compression);
+	for (int i=0;i<numberLines;i++) {
+	  sprintf(line,"line %d of %d\n",i,numberLines);
+	  assert( output->puts(line) );
+	}
+	delete output;
+	// read directly and ahead on threads
+	for (int threads=0;threads<=3;threads+=3) {
+	  CoinFileInput::setDecompressionThreads(threads);
+	  CoinFileInput * input = CoinFileInput::create(name);
+	  char readLine[80];
+	  for (int i=0;i<numberLines;i++) {
+	    sprintf(line,"line %d of %d\n",i,numberLines);
+	    assert( input->gets(readLine,80)!=NULL );
+	    assert( !strcmp(line,readLine) );
+	  }
+	  assert( input->gets(readLine,80)==NULL );
+	  delete input;
+	}
+	// and through writeMps (on a copy, writing fills in row sense etc.)
+	CoinMpsIO copy(m);
+	copy.writeMps("CoinMpsIoTestPieces.mps",type);
+	std::string written = type==1 ? "CoinMpsIoTestPieces.mps.gz" :
+	  "CoinMpsIoTestPieces.mps.bz2";
+	CoinMpsIO readBack;
+	readBack.messageHandler()->setLogLevel(0);
+	assert( readBack.readMps(written.c_str(),"")==0 );
+	assert( readBack.getNumCols()==m.getNumCols() );
+	assert( readBack.getNumElements()==m.getNumElements() );
+	CoinFileInput::setDecompressionThreads(0);
+      }
+      CoinFileOutput::setCompressionThreads(1);
+    }
     
     // Test matrixByRow method
     { 
@@ -645,6 +780,178 @@ CoinMpsIOUnitTest(const std::string & mpsDir)
     }
 #endif
   }
-
+  // Test SMPS reader
+  {
+    CoinSmpsIO smps;
+    smps.messageHandler()->setLogLevel(0);
+    std::string fn = mpsDir+"bug";
+    int numberErrors = smps.readSmps(fn.c_str());
+    assert (!numberErrors);
+    const CoinMpsIO & core = smps.core();
+    assert (core.getNumRows()==4);
+    assert (core.getNumCols()==6);
+    assert (smps.getNumStages()==2);
+    assert (smps.getNumScenarios()==2);
+    const int * rowStage = smps.getRowStages();
+    assert (rowStage[0]==0&&rowStage[1]==1&&rowStage[3]==1);
+    const int * columnStage = smps.getColumnStages();
+    assert (columnStage[2]==0&&columnStage[3]==1);
+    // REPLACE - each scenario only holds its own right hand sides
+    assert (smps.getNumChanges()==6);
+    assert (smps.getChangeStarts()[1]==3);
+    int iRow = core.rowIndex("C1");
+    assert (smps.scenarioValue(0,CoinSmpsIO::rowLowerChange,iRow,-1)==1.0);
+    assert (smps.scenarioValue(1,CoinSmpsIO::rowLowerChange,iRow,-1)==0.0);
+    assert (smps.scenarioValue(1,CoinSmpsIO::rowUpperChange,iRow,-1)==
+	    core.getRowUpper()[iRow]);
+    CoinStructuredModel model;
+    int numberBlocks = smps.deterministicEquivalent(model);
+    assert (numberBlocks==2);
+    assert (model.numberRowBlocks()==3);
+    assert (model.numberColumnBlocks()==3);
+    int numberFound=0;
+    for (int i=0;i<model.numberElementBlocks();i++) {
+      const CoinModel * block = model.coinBlock(i);
+      const CoinModelBlockInfo & info = model.blockType(i);
+      if (model.getRowBlock(info.rowBlock)!="row_1"||
+	  model.getColumnBlock(info.columnBlock)!="column_1")
+	continue;
+      // second scenario with objective weighted by probability
+      assert (block->numberRows()==3);
+      assert (block->numberColumns()==3);
+      assert (block->getRowLower(0)==0.0);
+      assert (block->getColumnObjective(0)==0.25);
+      assert (block->originalRows()[0]==iRow);
+      numberFound++;
+    }
+    assert (numberFound==1);
+  }
+  {
+    // Multistage with scenarios added to the core
+    CoinSmpsIO smps;
+    smps.messageHandler()->setLogLevel(0);
+    std::string fn = mpsDir+"app0110";
+    int numberErrors = smps.readSmps(fn.c_str());
+    assert (!numberErrors);
+    const CoinMpsIO & core = smps.core();
+    assert (smps.getNumStages()==3);
+    int numberScenarios = smps.getNumScenarios();
+    assert (numberScenarios==9);
+    double totalProbability=0.0;
+    for (int i=0;i<numberScenarios;i++) {
+      totalProbability += smps.scenarioProbability(i);
+      assert (smps.scenarioStage(i)==((i%3) ? 2 : 1));
+      assert (smps.scenarioParent(i)==((i%3) ? i-(i%3) : -1));
+    }
+    assert (fabs(totalProbability-1.0)<0.01);
+    CoinRelFltEq eq;
+    int iRow = core.rowIndex("D00103");
+    assert (smps.getRowStages()[iRow]==2);
+    // own change, added to the value from the parent (2.667+0.333)
+    assert (eq(smps.scenarioValue(1,CoinSmpsIO::rowUpperChange,iRow,-1),
+	       2.333));
+    // inherited from parent
+    iRow = core.rowIndex("D00102");
+    assert (eq(smps.scenarioValue(1,CoinSmpsIO::rowUpperChange,iRow,-1),2.0));
+    // 3 nodes at second stage and 9 at third
+    int stageRows[3]={0,0,0};
+    int stageColumns[3]={0,0,0};
+    for (int i=0;i<core.getNumRows();i++)
+      stageRows[smps.getRowStages()[i]]++;
+    for (int i=0;i<core.getNumCols();i++)
+      stageColumns[smps.getColumnStages()[i]]++;
+    CoinStructuredModel model;
+    assert (smps.deterministicEquivalent(model)==3);
+    assert (model.numberRows()==stageRows[0]+3*stageRows[1]+9*stageRows[2]);
+    assert (model.numberColumns()==
+	    stageColumns[0]+3*stageColumns[1]+9*stageColumns[2]);
+  }
+  {
+    /*
+      Ranged rows and a two level scenario tree.  R1 is G with range 3
+      ([2,5]), R2 is E with range -1 ([3,4]) and R3 is L with range 4
+      ([6,10]).  SCEN2 and SCEN3 branch from SCEN1.
+    */
+    FILE * fp = fopen("CoinSmpsIoTest.cor","w");
+    fprintf(fp,"NAME          RANGED\n"
+	    "ROWS\n N  OBJ\n L  R0\n G  R1\n E  R2\n L  R3\n"
+	    "COLUMNS\n"
+	    "    X1        OBJ       1.0   R0        1.0\n"
+	    "    X1        R1        1.0\n"
+	    "    X2        OBJ       1.0   R1        1.0\n"
+	    "    X2        R2        1.0\n"
+	    "    X3        OBJ       1.0   R2        1.0\n"
+	    "    X3        R3        1.0\n"
+	    "RHS\n"
+	    "    RHS       R0        8.0   R1        2.0\n"
+	    "    RHS       R2        4.0   R3        10.0\n"
+	    "RANGES\n"
+	    "    RNG       R1        3.0   R2        -1.0\n"
+	    "    RNG       R3        4.0\n"
+	    "ENDATA\n");
+    fclose(fp);
+    fp = fopen("CoinSmpsIoTest.tim","w");
+    fprintf(fp,"TIME          RANGED\n"
+	    "PERIODS       LP\n"
+	    "    X1        R0        STAGE1\n"
+	    "    X2        R1        STAGE2\n"
+	    "    X3        R2        STAGE3\n"
+	    "ENDATA\n");
+    fclose(fp);
+    fp = fopen("CoinSmpsIoTest.sto","w");
+    fprintf(fp,"STOCH         RANGED\n"
+	    "SCENARIOS     DISCRETE  REPLACE\n"
+	    " SC SCEN1     ROOT      1.0       STAGE2\n"
+	    "    RHS       R1        3.0\n"
+	    "    RHS       R2        5.0\n"
+	    "SCENARIOS     DISCRETE  ADD\n"
+	    " SC SCEN2     SCEN1     0.5       STAGE3\n"
+	    "    RHS       R2        1.0\n"
+	    "    RNG       R3        -2.0\n"
+	    "SCENARIOS     DISCRETE  MULTIPLY\n"
+	    " SC SCEN3     SCEN1     0.5       STAGE3\n"
+	    "    RHS       R2        2.0\n"
+	    "    RNG       R2        -3.0\n"
+	    "    RHS       R2        1.1\n"
+	    "ENDATA\n");
+    fclose(fp);
+    CoinSmpsIO smps;
+    smps.messageHandler()->setLogLevel(0);
+    int numberErrors = smps.readSmps("CoinSmpsIoTest");
+    assert (!numberErrors);
+    assert (smps.getNumStages()==3);
+    assert (smps.getNumScenarios()==3);
+    assert (smps.scenarioParent(1)==0&&smps.scenarioParent(2)==0);
+    const CoinMpsIO & core = smps.core();
+    int r1 = core.rowIndex("R1");
+    int r2 = core.rowIndex("R2");
+    int r3 = core.rowIndex("R3");
+    CoinRelFltEq eq;
+    const CoinSmpsIO::ChangeType lo = CoinSmpsIO::rowLowerChange;
+    const CoinSmpsIO::ChangeType up = CoinSmpsIO::rowUpperChange;
+    // G row - right hand side is the lower bound
+    assert (eq(smps.scenarioValue(0,lo,r1,-1),3.0));
+    assert (eq(smps.scenarioValue(0,up,r1,-1),6.0));
+    // E row with negative range - right hand side is the upper bound
+    assert (eq(smps.scenarioValue(0,lo,r2,-1),4.0));
+    assert (eq(smps.scenarioValue(0,up,r2,-1),5.0));
+    // added to the parent's value, range kept; R1 inherited
+    assert (eq(smps.scenarioValue(1,lo,r2,-1),5.0));
+    assert (eq(smps.scenarioValue(1,up,r2,-1),6.0));
+    assert (eq(smps.scenarioValue(1,lo,r1,-1),3.0));
+    // L row range 4-2 from its right hand side
+    assert (eq(smps.scenarioValue(1,lo,r3,-1),8.0));
+    assert (eq(smps.scenarioValue(1,up,r3,-1),10.0));
+    assert (eq(smps.scenarioValue(0,lo,r3,-1),6.0));
+    /*
+      Right hand side 10 from the parent's 5, then range -1*-3 puts it at
+      the lower end ([10,13]), then right hand side 11 moves both.
+    */
+    assert (eq(smps.scenarioValue(2,lo,r2,-1),11.0));
+    assert (eq(smps.scenarioValue(2,up,r2,-1),14.0));
+    remove("CoinSmpsIoTest.cor");
+    remove("CoinSmpsIoTest.tim");
+    remove("CoinSmpsIoTest.sto");
+  }
 }
 
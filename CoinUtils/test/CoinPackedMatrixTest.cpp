@@ -16,6 +16,7 @@
 #include "CoinFloatEqual.hpp"
 #include "CoinPackedVector.hpp"
 #include "CoinPackedMatrix.hpp"
+#include "CoinPackedMatrixPair.hpp"
 
 //#############################################################################
 
@@ -625,6 +626,132 @@ CoinPackedMatrixUnitTest()
       assert(globalP->isEquivalent(pmtro));
 
     }
+
+    {
+      // Test tombstone deletion against immediate compaction
+      CoinPackedMatrix compact(*globalP);
+      compact.setExtraGap(0.0);
+      compact.setExtraMajor(0.0);
+      compact.removeGaps();
+      CoinPackedMatrix lazy(compact);
+      lazy.setTombstoneRatio(0.5);
+      assert( eq(lazy.getTombstoneRatio(),0.5) );
+      assert( eq(lazy.getGapRatio(),0.0) );
+
+      int delRows[1] = { 1 };
+      int newIndex[8];
+      assert( lazy.deletionMap(true,1,delRows,newIndex)==4 );
+      assert( newIndex[0]==0 && newIndex[1]==-1 && newIndex[2]==1 );
+      assert( newIndex[3]==2 && newIndex[4]==3 );
+      compact.deleteRows(1,delRows);
+      lazy.deleteRows(1,delRows);
+      // 2 of 14 entries are now holes; below the ratio, so no compaction
+      assert( lazy.hasGaps() );
+      assert( lazy.getNumElements()==12 );
+      assert( lazy.isEquivalent(compact) );
+
+      int delCols[2] = { 7, 3 };
+      assert( lazy.deletionMap(false,2,delCols,newIndex)==6 );
+      assert( newIndex[3]==-1 && newIndex[4]==3 && newIndex[7]==-1 );
+      compact.deleteCols(2,delCols);
+      lazy.deleteCols(2,delCols);
+      assert( lazy.getNumCols()==6 );
+      assert( lazy.isEquivalent(compact) );
+
+      // Deleting two more rows pushes the holes past the ratio
+      int delMore[2] = { 0, 2 };
+      compact.deleteRows(2,delMore);
+      lazy.deleteRows(2,delMore);
+      assert( !lazy.hasGaps() );
+      assert( lazy.isEquivalent(compact) );
+
+      bool errorThrown = false;
+      try {
+        int dup[2] = { 0, 0 };
+        lazy.deletionMap(true,2,dup,newIndex);
+      }
+      catch (CoinError& e) {
+	errorThrown = true;
+      }
+      assert( errorThrown );
+    }
+
+    {
+      // Test that CoinPackedMatrixPair keeps both orderings in step
+      CoinPackedMatrixPair pair(*globalP);
+      pair.setExtraSpace(1.0,1.0);
+      assert( pair.isByRowCurrent() );
+      assert( !pair.isByColumnCurrent() );
+      assert( pair.getNumRows()==5 && pair.getNumCols()==8 );
+      assert( pair.getByColumn().isColOrdered() );
+      assert( pair.isByColumnCurrent() );
+
+      CoinPackedMatrix rowRef(*globalP);
+      CoinPackedMatrix colRef;
+
+      // A new row touching an existing and a new column
+      const int rowInd[2] = { 2, 9 };
+      const double rowEl[2] = { 1.5, -2.0 };
+      CoinPackedVector row(2,rowInd,rowEl);
+      pair.appendRow(row);
+      rowRef.appendRow(row);
+      // the new column has no room, so the column copy is rebuilt later
+      assert( pair.isByRowCurrent() && !pair.isByColumnCurrent() );
+      assert( pair.getNumRows()==6 && pair.getNumCols()==10 );
+      assert( pair.getByRow().isEquivalent(rowRef) );
+      colRef.reverseOrderedCopyOf(rowRef);
+      assert( pair.getByColumn().isEquivalent(colRef) );
+
+      // A row which fits in the gaps is added to both copies
+      const int fitInd[2] = { 0, 9 };
+      const double fitEl[2] = { 1.0, 2.0 };
+      CoinPackedVector fit(2,fitInd,fitEl);
+      pair.appendRow(fit);
+      rowRef.appendRow(fit);
+      assert( pair.isByRowCurrent() && pair.isByColumnCurrent() );
+      assert( pair.getByRow().isEquivalent(rowRef) );
+      colRef.reverseOrderedCopyOf(rowRef);
+      assert( pair.getByColumn().isEquivalent(colRef) );
+      int delFit[1] = { 6 };
+      pair.deleteRows(1,delFit);
+      rowRef.deleteRows(1,delFit);
+      colRef.deleteRows(1,delFit);
+
+      // A new column touching an existing and a new row
+      const int colInd[2] = { 0, 7 };
+      const double colEl[2] = { 3.0, 4.0 };
+      CoinPackedVector col(2,colInd,colEl);
+      pair.appendCol(col);
+      colRef.appendCol(col);
+      // likewise the new row, so the row copy is rebuilt later
+      assert( !pair.isByRowCurrent() && pair.isByColumnCurrent() );
+      assert( pair.getNumRows()==8 && pair.getNumCols()==11 );
+      assert( pair.getByColumn().isEquivalent(colRef) );
+      rowRef.reverseOrderedCopyOf(colRef);
+      assert( pair.getByRow().isEquivalent(rowRef) );
+
+      int delRows[2] = { 5, 1 };
+      int delCols[1] = { 3 };
+      pair.deleteRows(2,delRows);
+      pair.deleteCols(1,delCols);
+      colRef.deleteRows(2,delRows);
+      colRef.deleteCols(1,delCols);
+      rowRef.reverseOrderedCopyOf(colRef);
+      assert( pair.getNumRows()==6 && pair.getNumCols()==10 );
+      assert( pair.getByColumn().isEquivalent(colRef) );
+      assert( pair.getByRow().isEquivalent(rowRef) );
+
+      pair.modifyCoefficient(0,0,7.0);
+      colRef.modifyCoefficient(0,0,7.0);
+      assert( eq(pair.getByRow().getVector(0)[0],7.0) );
+      assert( pair.getByColumn().isEquivalent(colRef) );
+
+      // Copies carry only the current orderings
+      pair.releaseByColumn();
+      CoinPackedMatrixPair pairCopy(pair);
+      assert( !pairCopy.isByColumnCurrent() );
+      assert( pairCopy.getByColumn().isEquivalent(colRef) );
+    }
     
     delete globalP;
   }
@@ -498,6 +498,33 @@ CoinPackedVectorUnitTest()
     
   }
 
+  // Insert many indices out of order; duplicates are still caught
+  {
+    CoinPackedVector v1(true);
+    const int n = 20000;
+    int i;
+    for (i = 0; i < n; i++)
+      v1.insert((7919*i)%n,i);
+    assert( v1.getNumElements()==n );
+    assert( v1.getMinIndex()==0 && v1.getMaxIndex()==n-1 );
+    for (i = 0; i < n; i += 997) {
+      assert( v1.isExistingIndex((7919*i)%n) );
+      assert( v1[(7919*i)%n]==i );
+    }
+    bool errorThrown = false;
+    try {
+      v1.insert(4321,1.0);
+    }
+    catch (CoinError& e) {
+      errorThrown = true;
+    }
+    assert( errorThrown );
+    assert( v1.getNumElements()==n );
+    assert( !v1.isExistingIndex(n) );
+    v1.insert(n,1.0);
+    assert( v1.isExistingIndex(n) && v1[n]==1.0 );
+  }
+
   {
     //Test setConstant and setElement     
     CoinPackedVector v2;
@@ -899,7 +926,89 @@ CoinPackedVectorUnitTest()
     assert( r.findIndex(1)  == 0 );
     assert( r.findIndex(3)  == -1 );
   }  
-#if 0
+  {
+    // Test duplicate detection on short, dense and widely spread indices
+    const int ne = 1000;
+    int * inx = new int[ne];
+    double * el = new double[ne];
+    for ( int spread = 1; spread <= 1000000; spread *= 1000 ) {
+      for ( int n = 2; n <= ne; n *= 5 ) {
+	for ( int i = 0; i < n; i++ ) {
+	  inx[i] = ((i*7919)%n)*spread - 3;
+	  el[i] = i;
+	}
+	CoinPackedVector r(n,inx,el);
+	assert( r.isExistingIndex(inx[n-1]) );
+	assert( !r.isExistingIndex(-4) );
+	inx[n-1] = inx[0];
+	bool errorThrown = false;
+	try {
+	  r.setVector(n,inx,el);
+	}
+	catch (CoinError& e) {
+	  errorThrown = true;
+	}
+	assert( errorThrown );
+	// nothing left over from the failed check
+	r.setVector(n-1,inx,el);
+	assert( r.getNumElements() == n-1 );
+	errorThrown = false;
+	try {
+	  r.insert(inx[0],1.0);
+	}
+	catch (CoinError& e) {
+	  errorThrown = true;
+	}
+	assert( errorThrown );
+	r.insert(n*spread,1.0);
+	assert( r.isExistingIndex(n*spread) );
+      }
+    }
+    delete [] inx;
+    delete [] el;
+  }
+  {
+    // Test duplicate detection when appending, at the end and interleaved
+    CoinPackedVector r;
+    int inx[6] = { 10, 0, 20, 30, 5, 25 };
+    double el[6] = { 1., 2., 3., 4., 5., 6. };
+    for ( int i = 0; i < 2; i++ ) {
+      CoinPackedVector one(1,inx+i,el+i);
+      r.append(one);
+    }
+    CoinPackedVector end(2,inx+2,el+2);
+    r.append(end);
+    CoinPackedVector between(2,inx+4,el+4);
+    r.append(between);
+    assert( r.getNumElements() == 6 );
+    for ( int i = 0; i < 6; i++ )
+      assert( r.isExistingIndex(inx[i]) );
+    assert( !r.isExistingIndex(15) );
+    int dupInx[3] = { 15, 40, 20 };
+    CoinPackedVector dup(3,dupInx,el);
+    bool errorThrown = false;
+    try {
+      r.append(dup);
+    }
+    catch (CoinError& e) {
+      errorThrown = true;
+    }
+    assert( errorThrown );
+    // nothing appended, and the new indices not taken as existing
+    assert( r.getNumElements() == 6 );
+    assert( !r.isExistingIndex(15) && !r.isExistingIndex(40) );
+    CoinPackedVector twice(2,dupInx,el);
+    twice.append(CoinPackedVector(1,dupInx+2,el));
+    errorThrown = false;
+    try {
+      twice.append(CoinPackedVector(1,dupInx+2,el));
+    }
+    catch (CoinError& e) {
+      errorThrown = true;
+    }
+    assert( errorThrown );
+    assert( twice.getNumElements() == 3 );
+  }
   {
     // Test construction with testing for duplicates as false
     const int ne = 4;
@@ -917,9 +1026,7 @@ CoinPackedVectorUnitTest()
     assert( !r.isExistingIndex(0) );
     r.insert(0,1.);
     
-    assert( r.isExistingIndex(-4) );  // This line is failing!!
-                                      // If r is constructed with true,
-                                      // then it does not fail
+    assert( r.isExistingIndex(-4) );
     int neg4Index = r.findIndex(-4);
     assert( neg4Index == 1 );
     r.setElement(neg4Index, r.getElements()[neg4Index] + 20);
@@ -929,7 +1036,6 @@ CoinPackedVectorUnitTest()
 
     assert( r == rT );
   }
-#endif
 
 /*
   Repeat various tests, using the constructor that takes ownership of the
@@ -0,0 +1,651 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CoinFactorization.hpp"
+#include "CoinFileIO.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinPackedVector.hpp"
+#include "CoinShallowPackedVector.hpp"
+#include "CoinSort.hpp"
+#include "CoinTime.hpp"
+#include "CoinWarmStartBasis.hpp"
+
+/*
+  Timings of the primitives the solvers spend their time in, on matrices
+  from the Netlib set.  All inputs are made from the matrices and a
+  CoinRandom with a fixed seed, so the work done is the same on every run
+  and platform.  Each line gives the best and mean time over the repeats
+  for the whole set, and a check value computed from the results; if the
+  check changes between two runs, so did the work and the times can not
+  be compared.
+*/
+
+// Reasonably large models, which all load in a few seconds
+static const char * primitiveNames[] = {
+  "25fv47", "80bau3b", "bnl2", "cycle", "d2q06c", "degen3", "fit2p",
+  "greenbea", "maros-r7", "pilot87", "ship12l", "woodw"
+};
+
+namespace {
+
+struct Model {
+  std::string name;
+  CoinPackedMatrix byColumn;
+  CoinPackedMatrix byRow;
+  /// Random vector, one entry for each column
+  std::vector<double> x;
+  /// Whether the slack of each row is basic
+  std::vector<char> slackBasic;
+  /// Whether each column is basic
+  std::vector<char> columnBasic;
+};
+
+std::vector<Model> models;
+bool modelsLoaded = false;
+
+/*
+  A crash basis: columns, shortest first, take the row where they have
+  their largest element if no column has it already.  Rows left over get
+  their slacks.  If that is singular the columns the factorization throws
+  out are swapped for the slacks of their rows, a few times, and after
+  that an all slack basis is used.
+*/
+void crashBasis (Model & model)
+{
+  const CoinPackedMatrix & matrix = model.byColumn;
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  const int * row = matrix.getIndices();
+  const CoinBigIndex * start = matrix.getVectorStarts();
+  const int * length = matrix.getVectorLengths();
+  const double * element = matrix.getElements();
+  std::vector<int> order(numberColumns);
+  std::vector<int> sortLength(numberColumns);
+  for (int j = 0; j < numberColumns; j++) {
+    order[j] = j;
+    sortLength[j] = length[j];
+  }
+  CoinSort_2(&sortLength[0],&sortLength[0]+numberColumns,&order[0]);
+  std::vector<int> rowOwner(numberRows,-1);
+  std::vector<int> columnRow(numberColumns,-1);
+  for (int k = 0; k < numberColumns; k++) {
+    int j = order[k];
+    int best = -1;
+    double bestValue = 0.0;
+    for (CoinBigIndex i = start[j]; i < start[j]+length[j]; i++) {
+      double value = CoinAbs(element[i]);
+      if (value > bestValue && rowOwner[row[i]] < 0) {
+	best = row[i];
+	bestValue = value;
+      }
+    }
+    if (best >= 0 && bestValue >= 0.1) {
+      rowOwner[best] = j;
+      columnRow[j] = best;
+    }
+  }
+  std::vector<int> rowIsBasic(numberRows);
+  std::vector<int> columnIsBasic(numberColumns);
+  CoinFactorization factorization;
+  for (int attempt = 0; ; attempt++) {
+    for (int i = 0; i < numberRows; i++) {
+      if (attempt == 5)
+	rowOwner[i] = -1;
+      rowIsBasic[i] = rowOwner[i] < 0 ? 1 : -1;
+    }
+    for (int j = 0; j < numberColumns; j++) {
+      if (attempt == 5)
+	columnRow[j] = -1;
+      columnIsBasic[j] = columnRow[j] >= 0 ? 1 : -1;
+    }
+    if (factorization.factorize(matrix,&rowIsBasic[0],&columnIsBasic[0])
+	== 0)
+      break;
+    for (int j = 0; j < numberColumns; j++) {
+      if (columnRow[j] >= 0 && columnIsBasic[j] < 0) {
+	rowOwner[columnRow[j]] = -1;
+	columnRow[j] = -1;
+      }
+    }
+  }
+  model.slackBasic.resize(numberRows);
+  for (int i = 0; i < numberRows; i++)
+    model.slackBasic[i] = rowOwner[i] < 0;
+  model.columnBasic.resize(numberColumns);
+  for (int j = 0; j < numberColumns; j++)
+    model.columnBasic[j] = columnRow[j] >= 0;
+}
+
+// Load the models once for all sections
+bool loadModels (const std::string & netlibDir)
+{
+  if (modelsLoaded)
+    return !models.empty();
+  modelsLoaded = true;
+  CoinRandom random;
+  int numberNames = static_cast<int>(sizeof(primitiveNames)/sizeof(char *));
+  for (int k = 0; k < numberNames; k++) {
+    std::string fileName = netlibDir+primitiveNames[k]+".mps";
+    if (!fileCoinReadable(fileName))
+      continue;
+    CoinMpsIO mps;
+    mps.messageHandler()->setLogLevel(0);
+    if (mps.readMps(fileName.c_str(),"") != 0)
+      continue;
+    models.push_back(Model());
+    Model & model = models.back();
+    model.name = primitiveNames[k];
+    model.byColumn = *mps.getMatrixByCol();
+    model.byRow = *mps.getMatrixByRow();
+    model.x.resize(model.byColumn.getNumCols());
+    for (size_t j = 0; j < model.x.size(); j++)
+      model.x[j] = random.randomDouble()-0.5;
+    crashBasis(model);
+  }
+  if (models.empty()) {
+    std::cout << "primitives: no Netlib models found in " << netlibDir
+	      << std::endl;
+    return false;
+  }
+  int rows = 0;
+  int columns = 0;
+  CoinBigIndex elements = 0;
+  for (size_t k = 0; k < models.size(); k++) {
+    rows += models[k].byColumn.getNumRows();
+    columns += models[k].byColumn.getNumCols();
+    elements += models[k].byColumn.getNumElements();
+  }
+  char line[200];
+  sprintf(line,"primitives: %d Netlib models, %d rows, %d columns,"
+	  " %d elements",static_cast<int>(models.size()),rows,columns,
+	  static_cast<int>(elements));
+  std::cout << line << std::endl;
+  return true;
+}
+
+/* One timed primitive on one model.  Does any setup, then returns the
+   seconds taken by the primitive alone and adds to check. */
+typedef double (*Kernel)(const Model & model, CoinRandom & random,
+			 double & check);
+
+// Best and mean over repeats of the kernel summed over the models
+void timeKernel (const char * section, const char * name, Kernel kernel,
+		 int repeat)
+{
+  double best = COIN_DBL_MAX;
+  double sum = 0.0;
+  double check = 0.0;
+  for (int pass = 0; pass < repeat; pass++) {
+    // the same random numbers each pass
+    CoinRandom random(1);
+    double seconds = 0.0;
+    check = 0.0;
+    for (size_t k = 0; k < models.size(); k++)
+      seconds += kernel(models[k],random,check);
+    best = CoinMin(best,seconds);
+    sum += seconds;
+  }
+  std::string title = std::string(section) + ": " + name;
+  char line[200];
+  sprintf(line,"%-38s best %9.3f ms  mean %9.3f ms  check %.10g",
+	  title.c_str(),1000.0*best,1000.0*sum/repeat,check);
+  std::cout << line << std::endl;
+}
+
+//-------------------------------------------------------------------
+// CoinPackedMatrix
+//-------------------------------------------------------------------
+
+/* Build a column ordered matrix a column at a time.  Without extra major
+   space every append copies the matrix, so leave a quarter spare as
+   column generation codes do. */
+double appendCols (const Model & model, CoinRandom &, double & check)
+{
+  const CoinPackedMatrix & matrix = model.byColumn;
+  const int numberColumns = matrix.getNumCols();
+  const int * row = matrix.getIndices();
+  const CoinBigIndex * start = matrix.getVectorStarts();
+  const int * length = matrix.getVectorLengths();
+  const double * element = matrix.getElements();
+  CoinPackedMatrix copy(true,0.25,0.0);
+  copy.setDimensions(matrix.getNumRows(),0);
+  double time = CoinGetTimeOfDay();
+  for (int j = 0; j < numberColumns; j++)
+    copy.appendCol(length[j],row+start[j],element+start[j]);
+  time = CoinGetTimeOfDay()-time;
+  check += copy.getNumElements();
+  return time;
+}
+
+// Add rows to a column ordered matrix fifty at a time, as cuts are
+double appendRows (const Model & model, CoinRandom &, double & check)
+{
+  const CoinPackedMatrix & matrix = model.byRow;
+  const int numberRows = matrix.getNumRows();
+  std::vector<CoinShallowPackedVector> rows(numberRows);
+  std::vector<const CoinPackedVectorBase *> rowPointers(numberRows);
+  for (int i = 0; i < numberRows; i++) {
+    rows[i] = matrix.getVector(i);
+    rowPointers[i] = &rows[i];
+  }
+  CoinPackedMatrix copy(true,0.0,0.0);
+  copy.setDimensions(0,matrix.getNumCols());
+  double time = CoinGetTimeOfDay();
+  for (int i = 0; i < numberRows; i += 50) {
+    int number = CoinMin(50,numberRows-i);
+    copy.appendRows(number,&rowPointers[i]);
+  }
+  time = CoinGetTimeOfDay()-time;
+  check += copy.getNumElements();
+  return time;
+}
+
+// Delete every seventh row of a column ordered matrix
+double deleteRows (const Model & model, CoinRandom &, double & check)
+{
+  CoinPackedMatrix copy(model.byColumn);
+  std::vector<int> which;
+  for (int i = 3; i < copy.getNumRows(); i += 7)
+    which.push_back(i);
+  double time = CoinGetTimeOfDay();
+  copy.deleteRows(static_cast<int>(which.size()),&which[0]);
+  time = CoinGetTimeOfDay()-time;
+  check += copy.getNumElements();
+  return time;
+}
+
+// Delete every seventh column of a column ordered matrix
+double deleteCols (const Model & model, CoinRandom &, double & check)
+{
+  CoinPackedMatrix copy(model.byColumn);
+  std::vector<int> which;
+  for (int j = 3; j < copy.getNumCols(); j += 7)
+    which.push_back(j);
+  double time = CoinGetTimeOfDay();
+  copy.deleteCols(static_cast<int>(which.size()),&which[0]);
+  time = CoinGetTimeOfDay()-time;
+  check += copy.getNumElements();
+  return time;
+}
+
+// Column ordered to row ordered
+double reverseOrdering (const Model & model, CoinRandom &, double & check)
+{
+  CoinPackedMatrix copy(model.byColumn);
+  double time = CoinGetTimeOfDay();
+  copy.reverseOrdering();
+  time = CoinGetTimeOfDay()-time;
+  check += copy.getVectorLengths()[0];
+  return time;
+}
+
+// Ten products Ax, each fed to the next
+double times (const Model & model, CoinRandom &, double & check)
+{
+  const CoinPackedMatrix & matrix = model.byColumn;
+  std::vector<double> y(matrix.getNumRows());
+  double time = CoinGetTimeOfDay();
+  for (int k = 0; k < 10; k++)
+    matrix.times(&model.x[0],&y[0]);
+  time = CoinGetTimeOfDay()-time;
+  for (size_t i = 0; i < y.size(); i++)
+    check += y[i];
+  return time;
+}
+
+// Ten products A'y
+double transposeTimes (const Model & model, CoinRandom & random,
+		       double & check)
+{
+  const CoinPackedMatrix & matrix = model.byColumn;
+  std::vector<double> y(matrix.getNumRows());
+  for (size_t i = 0; i < y.size(); i++)
+    y[i] = random.randomDouble()-0.5;
+  std::vector<double> z(matrix.getNumCols());
+  double time = CoinGetTimeOfDay();
+  for (int k = 0; k < 10; k++)
+    matrix.transposeTimes(&y[0],&z[0]);
+  time = CoinGetTimeOfDay()-time;
+  for (size_t j = 0; j < z.size(); j++)
+    check += z[j];
+  return time;
+}
+
+//-------------------------------------------------------------------
+// CoinIndexedVector
+//-------------------------------------------------------------------
+
+/* Combinations of ten random rows, as in forming a row of the tableau:
+   scatter the rows into an indexed vector, gather the nonzeros and clear
+   it.  The three are timed separately, kernel says which to return. */
+double indexedVector (const Model & model, CoinRandom & random,
+		      double & check, int kernel)
+{
+  const CoinPackedMatrix & matrix = model.byRow;
+  const int numberRows = matrix.getNumRows();
+  const int * column = matrix.getIndices();
+  const CoinBigIndex * start = matrix.getVectorStarts();
+  const int * length = matrix.getVectorLengths();
+  const double * element = matrix.getElements();
+  CoinIndexedVector vector;
+  vector.reserve(matrix.getNumCols());
+  double seconds[3] = { 0.0, 0.0, 0.0 };
+  const int numberCombinations = CoinMax(100,numberRows/2);
+  for (int k = 0; k < numberCombinations; k++) {
+    int which[10];
+    double multiplier[10];
+    for (int r = 0; r < 10; r++) {
+      which[r] = random.randomInt(numberRows);
+      multiplier[r] = random.randomDouble()-0.5;
+    }
+    double time = CoinGetTimeOfDay();
+    for (int r = 0; r < 10; r++) {
+      int i = which[r];
+      for (CoinBigIndex j = start[i]; j < start[i]+length[i]; j++)
+	vector.add(column[j],multiplier[r]*element[j]);
+    }
+    double time2 = CoinGetTimeOfDay();
+    const int * index = vector.getIndices();
+    const double * dense = vector.denseVector();
+    const int number = vector.getNumElements();
+    double sum = 0.0;
+    for (int j = 0; j < number; j++)
+      sum += dense[index[j]];
+    double time3 = CoinGetTimeOfDay();
+    vector.clear();
+    double time4 = CoinGetTimeOfDay();
+    seconds[0] += time2-time;
+    seconds[1] += time3-time2;
+    seconds[2] += time4-time3;
+    check += sum + number;
+  }
+  return seconds[kernel];
+}
+
+double scatter (const Model & model, CoinRandom & random, double & check)
+{ return indexedVector(model,random,check,0); }
+double gather (const Model & model, CoinRandom & random, double & check)
+{ return indexedVector(model,random,check,1); }
+double clear (const Model & model, CoinRandom & random, double & check)
+{ return indexedVector(model,random,check,2); }
+
+/* Every row copied into a packed vector checked for duplicate indices,
+   as when rows and cuts are built, then looked up in once */
+double packedRows (const Model & model, CoinRandom &, double & check)
+{
+  const CoinPackedMatrix & matrix = model.byRow;
+  const int numberRows = matrix.getNumRows();
+  const int * column = matrix.getIndices();
+  const CoinBigIndex * start = matrix.getVectorStarts();
+  const int * length = matrix.getVectorLengths();
+  const double * element = matrix.getElements();
+  CoinPackedVector vector;
+  double time = CoinGetTimeOfDay();
+  for (int pass = 0; pass < 10; pass++) {
+    for (int i = 0; i < numberRows; i++) {
+      vector.setVector(length[i],column+start[i],element+start[i]);
+      CoinShallowPackedVector shallow(length[i],column+start[i],
+				      element+start[i]);
+      check += vector.getNumElements()+shallow.getNumElements();
+    }
+  }
+  for (int i = 0; i < numberRows; i++) {
+    vector.setVector(length[i],column+start[i],element+start[i]);
+    check += vector.isExistingIndex(i);
+  }
+  time = CoinGetTimeOfDay()-time;
+  return time;
+}
+
+//-------------------------------------------------------------------
+// CoinSort_2
+//-------------------------------------------------------------------
+
+// All the elements of the matrix by value, carrying their row
+double sortDoubleKeys (const Model & model, CoinRandom &, double & check)
+{
+  const CoinPackedMatrix & matrix = model.byColumn;
+  const int number = matrix.getNumElements();
+  std::vector<double> key(matrix.getElements(),
+			  matrix.getElements()+number);
+  std::vector<int> other(matrix.getIndices(),matrix.getIndices()+number);
+  double time = CoinGetTimeOfDay();
+  CoinSort_2(&key[0],&key[0]+number,&other[0]);
+  time = CoinGetTimeOfDay()-time;
+  check += key[number/2] + other[number/2];
+  return time;
+}
+
+// All the elements of the matrix by row, carrying their value
+double sortIntKeys (const Model & model, CoinRandom &, double & check)
+{
+  const CoinPackedMatrix & matrix = model.byColumn;
+  const int number = matrix.getNumElements();
+  std::vector<int> key(matrix.getIndices(),matrix.getIndices()+number);
+  std::vector<double> other(matrix.getElements(),
+			    matrix.getElements()+number);
+  double time = CoinGetTimeOfDay();
+  CoinSort_2(&key[0],&key[0]+number,&other[0]);
+  time = CoinGetTimeOfDay()-time;
+  check += key[number/2] + other[number/2];
+  return time;
+}
+
+// Each column, shuffled, sorted by row (short sorts)
+double sortColumns (const Model & model, CoinRandom & random,
+		    double & check)
+{
+  const CoinPackedMatrix & matrix = model.byColumn;
+  const int numberColumns = matrix.getNumCols();
+  const CoinBigIndex * start = matrix.getVectorStarts();
+  const int * length = matrix.getVectorLengths();
+  const int number = matrix.getNumElements();
+  std::vector<int> key(matrix.getIndices(),matrix.getIndices()+number);
+  std::vector<double> other(matrix.getElements(),
+			    matrix.getElements()+number);
+  for (int j = 0; j < numberColumns; j++) {
+    for (int k = length[j]-1; k > 0; k--) {
+      int swap = start[j] + random.randomInt(k+1);
+      std::swap(key[start[j]+k],key[swap]);
+      std::swap(other[start[j]+k],other[swap]);
+    }
+  }
+  double time = CoinGetTimeOfDay();
+  for (int j = 0; j < numberColumns; j++)
+    CoinSort_2(&key[0]+start[j],&key[0]+start[j]+length[j],
+	       &other[0]+start[j]);
+  time = CoinGetTimeOfDay()-time;
+  for (int j = 0; j < numberColumns; j++) {
+    if (length[j])
+      check += key[start[j]];
+  }
+  return time;
+}
+
+//-------------------------------------------------------------------
+// CoinFactorization
+//-------------------------------------------------------------------
+
+// Factorize the crash basis
+double factorize (const Model & model, CoinRandom &, double & check)
+{
+  const CoinPackedMatrix & matrix = model.byColumn;
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  std::vector<int> rowIsBasic(numberRows);
+  std::vector<int> columnIsBasic(numberColumns);
+  for (int i = 0; i < numberRows; i++)
+    rowIsBasic[i] = model.slackBasic[i] ? 1 : -1;
+  for (int j = 0; j < numberColumns; j++)
+    columnIsBasic[j] = model.columnBasic[j] ? 1 : -1;
+  CoinFactorization factorization;
+  double time = CoinGetTimeOfDay();
+  int status = factorization.factorize(matrix,&rowIsBasic[0],
+				       &columnIsBasic[0]);
+  time = CoinGetTimeOfDay()-time;
+  check += status + factorization.numberElements();
+  return time;
+}
+
+// FTRAN of up to a thousand nonbasic columns
+double updateColumnFT (const Model & model, CoinRandom & random,
+		       double & check)
+{
+  const CoinPackedMatrix & matrix = model.byColumn;
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  const int * row = matrix.getIndices();
+  const CoinBigIndex * start = matrix.getVectorStarts();
+  const int * length = matrix.getVectorLengths();
+  const double * element = matrix.getElements();
+  std::vector<int> rowIsBasic(numberRows);
+  std::vector<int> columnIsBasic(numberColumns);
+  std::vector<int> nonBasic;
+  for (int i = 0; i < numberRows; i++)
+    rowIsBasic[i] = model.slackBasic[i] ? 1 : -1;
+  for (int j = 0; j < numberColumns; j++) {
+    columnIsBasic[j] = model.columnBasic[j] ? 1 : -1;
+    if (!model.columnBasic[j] && length[j])
+      nonBasic.push_back(j);
+  }
+  CoinFactorization factorization;
+  factorization.factorize(matrix,&rowIsBasic[0],&columnIsBasic[0]);
+  CoinIndexedVector region;
+  region.reserve(factorization.maximumRowsExtra());
+  CoinIndexedVector column;
+  column.reserve(factorization.maximumRowsExtra());
+  double time = 0.0;
+  for (int k = 0; k < 1000 && !nonBasic.empty(); k++) {
+    int j = nonBasic[random.randomInt(static_cast<int>(nonBasic.size()))];
+    for (CoinBigIndex i = start[j]; i < start[j]+length[j]; i++)
+      column.insert(row[i],element[i]);
+    double time2 = CoinGetTimeOfDay();
+    factorization.updateColumnFT(&region,&column);
+    time += CoinGetTimeOfDay()-time2;
+    check += column.getNumElements();
+    column.clear();
+  }
+  return time;
+}
+
+//-------------------------------------------------------------------
+// CoinWarmStartBasis
+//-------------------------------------------------------------------
+
+/* The crash basis and a copy with one status in fifty changed, as
+   between two nodes of a search; kernel says which of generateDiff and
+   applyDiff to time (a hundred of each). */
+double basisDiff (const Model & model, CoinRandom & random,
+		  double & check, int kernel)
+{
+  const int numberRows = static_cast<int>(model.slackBasic.size());
+  const int numberColumns = static_cast<int>(model.columnBasic.size());
+  CoinWarmStartBasis oldBasis;
+  oldBasis.setSize(numberColumns,numberRows);
+  for (int i = 0; i < numberRows; i++)
+    oldBasis.setArtifStatus(i,model.slackBasic[i] ?
+			    CoinWarmStartBasis::basic :
+			    CoinWarmStartBasis::atUpperBound);
+  for (int j = 0; j < numberColumns; j++)
+    oldBasis.setStructStatus(j,model.columnBasic[j] ?
+			     CoinWarmStartBasis::basic :
+			     CoinWarmStartBasis::atLowerBound);
+  CoinWarmStartBasis newBasis(oldBasis);
+  for (int k = 0; k < (numberRows+numberColumns)/50; k++) {
+    int which = random.randomInt(numberRows+numberColumns);
+    if (which < numberColumns)
+      newBasis.setStructStatus(which,CoinWarmStartBasis::atUpperBound);
+    else
+      newBasis.setArtifStatus(which-numberColumns,
+			      CoinWarmStartBasis::atLowerBound);
+  }
+  double seconds[2] = { 0.0, 0.0 };
+  for (int k = 0; k < 100; k++) {
+    double time = CoinGetTimeOfDay();
+    CoinWarmStartDiff * diff = newBasis.generateDiff(&oldBasis);
+    double time2 = CoinGetTimeOfDay();
+    CoinWarmStartBasis basis(oldBasis);
+    double time3 = CoinGetTimeOfDay();
+    basis.applyDiff(diff);
+    double time4 = CoinGetTimeOfDay();
+    seconds[0] += time2-time;
+    seconds[1] += time4-time3;
+    if (k == 0)
+      check += basis.numberBasicStructurals() +
+	(basis.getStructStatus(numberColumns/2)+1)*
+	(basis.getArtifStatus(numberRows/2)+1);
+    delete diff;
+  }
+  return seconds[kernel];
+}
+
+double generateDiff (const Model & model, CoinRandom & random,
+		     double & check)
+{ return basisDiff(model,random,check,0); }
+double applyDiff (const Model & model, CoinRandom & random, double & check)
+{ return basisDiff(model,random,check,1); }
+
+}
+
+void CoinPackedMatrixBenchmark(const std::string & netlibDir, int repeat)
+{
+  if (!loadModels(netlibDir))
+    return;
+  timeKernel("matrix","appendCol",appendCols,repeat);
+  timeKernel("matrix","appendRows",appendRows,repeat);
+  timeKernel("matrix","deleteRows",deleteRows,repeat);
+  timeKernel("matrix","deleteCols",deleteCols,repeat);
+  timeKernel("matrix","reverseOrdering",reverseOrdering,repeat);
+  timeKernel("matrix","times",times,repeat);
+  timeKernel("matrix","transposeTimes",transposeTimes,repeat);
+}
+
+void CoinIndexedVectorBenchmark(const std::string & netlibDir, int repeat)
+{
+  if (!loadModels(netlibDir))
+    return;
+  timeKernel("vector","scatter",scatter,repeat);
+  timeKernel("vector","gather",gather,repeat);
+  timeKernel("vector","clear",clear,repeat);
+  timeKernel("vector","packedRows",packedRows,repeat);
+}
+
+void CoinSortBenchmark(const std::string & netlibDir, int repeat)
+{
+  if (!loadModels(netlibDir))
+    return;
+  timeKernel("sort","CoinSort_2 double keys",sortDoubleKeys,repeat);
+  timeKernel("sort","CoinSort_2 int keys",sortIntKeys,repeat);
+  timeKernel("sort","CoinSort_2 short",sortColumns,repeat);
+}
+
+void CoinFactorizationBenchmark(const std::string & netlibDir, int repeat)
+{
+  if (!loadModels(netlibDir))
+    return;
+  timeKernel("factorization","factorize",factorize,repeat);
+  timeKernel("factorization","updateColumnFT",updateColumnFT,repeat);
+}
+
+void CoinWarmStartBasisBenchmark(const std::string & netlibDir, int repeat)
+{
+  if (!loadModels(netlibDir))
+    return;
+  timeKernel("warmstart","generateDiff",generateDiff,repeat);
+  timeKernel("warmstart","applyDiff",applyDiff,repeat);
+}
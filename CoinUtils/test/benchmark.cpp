@@ -0,0 +1,133 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Time CoinUtils on the bundled data
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+
+void CoinFileIOBenchmark(const std::string & netlibDir,
+			 const std::vector<int> & threads, int repeat);
+void CoinMessageHandlerBenchmark(int repeat);
+void CoinPackedMatrixBenchmark(const std::string & netlibDir, int repeat);
+void CoinIndexedVectorBenchmark(const std::string & netlibDir, int repeat);
+void CoinSortBenchmark(const std::string & netlibDir, int repeat);
+void CoinFactorizationBenchmark(const std::string & netlibDir, int repeat);
+void CoinWarmStartBasisBenchmark(const std::string & netlibDir, int repeat);
+
+//----------------------------------------------------------------
+// benchmark [-netlibDir=V1] [-threads=V2] [-repeat=V3] [-sections=V4]
+//
+// where (unix defaults):
+//   -netlibDir: directory containing netlib files
+//       Default value V1="../../Data/Netlib"
+//   -threads: comma separated numbers of threads to try
+//       Default value V2="1,2,4"
+//   -repeat: number of times each measurement is repeated
+//       Default value V3="3"
+//   -sections: comma separated sections to run (fileio, messages,
+//       matrix, vector, sort, factorization, warmstart)
+//       Default value V4="all"
+//
+// All parameters are optional.
+//----------------------------------------------------------------
+
+int main (int argc, const char *argv[])
+{
+  const char dirsep =  CoinFindDirSeparator();
+  std::string dataDir ;
+  if (dirsep == '/')
+    dataDir = "../../Data" ;
+  else
+    dataDir = "..\\..\\Data" ;
+  std::set<std::string> definedKeyWords;
+  definedKeyWords.insert("-netlibDir");
+  definedKeyWords.insert("-threads");
+  definedKeyWords.insert("-repeat");
+  definedKeyWords.insert("-sections");
+  std::string netlibDir = dataDir + dirsep + "Netlib" + dirsep ;
+  std::string threadList = "1,2,4" ;
+  int repeat = 3 ;
+  std::string sections = "all" ;
+  std::map<std::string,std::string> parms;
+  for (int i = 1 ;  i < argc ; i++) {
+    std::string parm(argv[i]);
+    std::string key,value;
+    std::string::size_type eqPos = parm.find('=');
+    if (eqPos == std::string::npos) {
+      key = parm ;
+      value = "" ;
+    }
+    else {
+      key = parm.substr(0,eqPos) ;
+      value = parm.substr(eqPos+1) ;
+    }
+    if (definedKeyWords.find(key) == definedKeyWords.end()) {
+      std::cerr
+	  << "Undefined parameter \"" << key << "\".\n"
+	  << "Correct usage: \n"
+	  << "  benchmark [-netlibDir=V1] [-threads=V2] [-repeat=V3]"
+	  << " [-sections=V4]\n"
+	  << "where:\n"
+	  << "  -netlibDir: directory containing netlib files\n"
+	  << "        Default value V1=\"" << netlibDir << "\"\n"
+	  << "  -threads: comma separated numbers of threads to try\n"
+	  << "        Default value V2=\"" << threadList << "\"\n"
+	  << "  -repeat: number of times each measurement is repeated\n"
+	  << "        Default value V3=\"" << repeat << "\"\n"
+	  << "  -sections: comma separated sections to run"
+	  << " (fileio, messages,\n"
+	  << "        matrix, vector, sort, factorization, warmstart)\n"
+	  << "        Default value V4=\"" << sections << "\"\n";
+      return 1 ;
+    }
+    parms[key] = value ;
+  }
+  if (parms.find("-netlibDir") != parms.end())
+    netlibDir = parms["-netlibDir"] + dirsep;
+  if (parms.find("-threads") != parms.end())
+    threadList = parms["-threads"] ;
+  if (parms.find("-repeat") != parms.end())
+    repeat = CoinMax(atoi(parms["-repeat"].c_str()),1) ;
+  if (parms.find("-sections") != parms.end())
+    sections = parms["-sections"] ;
+  std::vector<int> threads;
+  std::string::size_type start = 0;
+  while (start < threadList.size()) {
+    std::string::size_type comma = threadList.find(',',start);
+    if (comma == std::string::npos)
+      comma = threadList.size();
+    int n = atoi(threadList.substr(start,comma-start).c_str());
+    if (n > 0)
+      threads.push_back(n);
+    start = comma+1;
+  }
+  if (threads.empty())
+    threads.push_back(1);
+
+  sections = "," + sections + "," ;
+  bool all = sections == ",all," ;
+  if (all || sections.find(",fileio,") != std::string::npos)
+    CoinFileIOBenchmark(netlibDir,threads,repeat);
+  if (all || sections.find(",messages,") != std::string::npos)
+    CoinMessageHandlerBenchmark(repeat);
+  if (all || sections.find(",matrix,") != std::string::npos)
+    CoinPackedMatrixBenchmark(netlibDir,repeat);
+  if (all || sections.find(",vector,") != std::string::npos)
+    CoinIndexedVectorBenchmark(netlibDir,repeat);
+  if (all || sections.find(",sort,") != std::string::npos)
+    CoinSortBenchmark(netlibDir,repeat);
+  if (all || sections.find(",factorization,") != std::string::npos)
+    CoinFactorizationBenchmark(netlibDir,repeat);
+  if (all || sections.find(",warmstart,") != std::string::npos)
+    CoinWarmStartBasisBenchmark(netlibDir,repeat);
+  return 0;
+}
@@ -10,6 +10,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <vector>
 
 #include "CoinPragma.hpp"
 #include "CoinFinite.hpp"
@@ -172,6 +173,68 @@ int main (int argc, const char *argv[])
 # endif
 
 
+  testingMessage( "Testing CoinRandom\n" );
+  {
+    // same sequence everywhere for a seed
+    CoinRandom fixed(42);
+    assert( fixed.randomBits()==0x15780b2e0c2ec716ULL );
+    CoinRandom first(17);
+    CoinRandom second(17);
+    CoinRandom jumped(17);
+    jumped.jump();
+    int numberDifferent = 0;
+    for (int i = 0; i < 1000; i++) {
+      double value = first.randomDouble();
+      assert( value > 0.0 && value < 1.0 );
+      assert( value == second.randomDouble() );
+      if (value != jumped.randomDouble())
+	numberDifferent++;
+      int k = first.randomInt(10);
+      assert( k >= 0 && k < 10 );
+      assert( k == second.randomInt(10) );
+    }
+    assert( numberDifferent == 1000 );
+    second.setSeed(17);
+    first.setSeed(17);
+    assert( first.randomBits() == second.randomBits() );
+  }
+
+  testingMessage( "Testing CoinSort_2 on int keys\n" );
+  {
+    // lengths either side of the insertion and radix sort thresholds
+    const int lengths[] = { 0, 1, 2, 10, 16, 17, 100, 255, 256, 1000, 100000 };
+    const int numberLengths = static_cast<int>(sizeof(lengths)/sizeof(int));
+    CoinRandom random(7);
+    for (int l = 0; l < numberLengths; l++) {
+      const int number = lengths[l];
+      for (int pass = 0; pass < 4; pass++) {
+	std::vector<int> key(number+1);
+	std::vector<int> which(number+1);
+	for (int i = 0; i < number; i++) {
+	  if (pass == 0)
+	    key[i] = random.randomInt(number+1);   // duplicates
+	  else if (pass == 1)
+	    key[i] = static_cast<int>(random.randomBits());  // full range
+	  else if (pass == 2)
+	    key[i] = i - number/2;                 // already sorted
+	  else
+	    key[i] = random.randomInt(3) - 1;      // few distinct keys
+	  which[i] = i;
+	}
+	std::vector<int> original(key);
+	std::vector<bool> seen(number+1, false);
+	CoinSort_2(&key[0], &key[0]+number, &which[0]);
+	for (int i = 0; i < number; i++) {
+	  assert( !seen[which[i]] );
+	  seen[which[i]] = true;
+	  // pairs kept together
+	  assert( key[i] == original[which[i]] );
+	  assert( i == 0 || key[i-1] <= key[i] );
+	}
+      }
+    }
+  }
+
   testingMessage( "Testing CoinModel\n" );
   CoinModelUnitTest(mpsDir,netlibDir,testModel);
 
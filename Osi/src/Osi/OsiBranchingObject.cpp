@@ -10,6 +10,8 @@
 #include <cstdlib>
 #include <cmath>
 #include <cfloat>
+#include <cstring>
+#include <typeinfo>
 //#define OSI_DEBUG
 #include "OsiSolverInterface.hpp"
 #include "OsiBranchingObject.hpp"
@@ -651,6 +653,150 @@ OsiSimpleInteger::upEstimate() const
     return infeasibility_;
 }
 
+// Default Constructor
+OsiObjectScan::OsiObjectScan()
+  : numberObjects_(0),
+    objects_(NULL),
+    simple_(NULL),
+    infeasibility_(NULL),
+    whichWay_(NULL),
+    distance_(NULL),
+    numberSimple_(0),
+    which_(NULL)
+{
+}
+
+// Copy constructor
+OsiObjectScan::OsiObjectScan(const OsiObjectScan &)
+  : numberObjects_(0),
+    objects_(NULL),
+    simple_(NULL),
+    infeasibility_(NULL),
+    whichWay_(NULL),
+    distance_(NULL),
+    numberSimple_(0),
+    which_(NULL)
+{
+}
+
+// Assignment operator
+OsiObjectScan &
+OsiObjectScan::operator=(const OsiObjectScan & rhs)
+{
+  if (this != &rhs)
+    gutsOfDelete();
+  return *this;
+}
+
+// Destructor
+OsiObjectScan::~OsiObjectScan()
+{
+  gutsOfDelete();
+}
+
+void
+OsiObjectScan::gutsOfDelete()
+{
+  delete [] objects_;
+  delete [] simple_;
+  delete [] infeasibility_;
+  delete [] whichWay_;
+  delete [] distance_;
+  delete [] which_;
+  numberObjects_ = 0;
+  objects_ = NULL;
+  simple_ = NULL;
+  infeasibility_ = NULL;
+  whichWay_ = NULL;
+  distance_ = NULL;
+  numberSimple_ = 0;
+  which_ = NULL;
+}
+
+void
+OsiObjectScan::gutsOfSetup(int numberObjects, OsiObject ** objects)
+{
+  gutsOfDelete();
+  numberObjects_ = numberObjects;
+  objects_ = CoinCopyOfArray(objects, numberObjects);
+  simple_ = new char [numberObjects];
+  infeasibility_ = new double [numberObjects];
+  whichWay_ = new int [numberObjects];
+  distance_ = new double [numberObjects];
+  which_ = new int [numberObjects];
+  int numberOther = numberObjects;
+  for (int i = 0; i < numberObjects; i++) {
+    // derived classes may have their own infeasibility()
+    if (typeid(*objects[i]) == typeid(OsiSimpleInteger)) {
+      simple_[i] = 1;
+      which_[numberSimple_++] = i;
+    } else {
+      simple_[i] = 0;
+      which_[--numberOther] = i;
+    }
+  }
+}
+
+void
+OsiObjectScan::scan(const OsiBranchingInformation * info,
+		    int numberObjects, OsiObject ** objects)
+{
+  bool same = (numberObjects == numberObjects_);
+  // Same pointers are not enough - an object may have been freed and
+  // another (maybe of another type) allocated at the same address
+  for (int i = 0; same && i < numberObjects; i++) {
+    if (objects[i] != objects_[i] ||
+	(typeid(*objects[i]) == typeid(OsiSimpleInteger)) != (simple_[i] != 0))
+      same = false;
+  }
+  if (!same)
+    gutsOfSetup(numberObjects, objects);
+  if (info->defaultDual_ >= 0.0) {
+    // pseudo shadow prices need the matrix - do one at a time
+    for (int i = 0; i < numberObjects; i++) {
+      infeasibility_[i] = objects[i]->infeasibility(info, whichWay_[i]);
+      if (simple_[i])
+	distance_[i] = objects[i]->infeasibility();
+    }
+    return;
+  }
+  const double * solution = info->solution_;
+  const double * lower = info->lower_;
+  const double * upper = info->upper_;
+  const double integerTolerance = info->integerTolerance_;
+  // Same arithmetic as OsiSimpleInteger::infeasibility
+  for (int k = 0; k < numberSimple_; k++) {
+    const int i = which_[k];
+    OsiSimpleInteger * object = static_cast<OsiSimpleInteger *>(objects[i]);
+    const int iColumn = object->columnNumber_;
+    double value = solution[iColumn];
+    value = CoinMax(value, lower[iColumn]);
+    value = CoinMin(value, upper[iColumn]);
+    const double nearest = floor(value+(1.0-0.5));
+    int whichWay = (nearest > value) ? 1 : 0;
+    const double distance = fabs(value-nearest);
+    double returnValue;
+    if (distance <= integerTolerance) {
+      object->otherInfeasibility_ = 1.0;
+      returnValue = 0.0;
+    } else {
+      object->otherInfeasibility_ = 1.0-distance;
+      returnValue = distance;
+      if (object->preferredWay_ >= 0)
+	whichWay = object->preferredWay_;
+    }
+    object->infeasibility_ = distance;
+    object->whichWay_ = static_cast<short int>(whichWay);
+    infeasibility_[i] = returnValue;
+    whichWay_[i] = whichWay;
+    distance_[i] = distance;
+  }
+  for (int k = numberSimple_; k < numberObjects; k++) {
+    const int i = which_[k];
+    infeasibility_[i] = objects[i]->infeasibility(info, whichWay_[i]);
+  }
+}
+
 // Default Constructor 
 OsiIntegerBranchingObject::OsiIntegerBranchingObject()
   :OsiTwoWayBranchingObject()
@@ -587,6 +587,7 @@ public:
   /// Return true if knows how to deal with Pseudo Shadow Prices
   virtual bool canHandleShadowPrices() const
   { return false;}
+  friend class OsiObjectScan;
 protected:
   /// data
   /// Original lower bound
@@ -597,6 +598,87 @@ protected:
   int columnNumber_;
   
 };
+/** Infeasibility of a whole set of objects.
+
+  Choosing a branching variable asks every object for its infeasibility
+  at every node. For OsiSimpleInteger that is a clamp and a floor at one
+  column, so the virtual call is most of the cost. This class spots the
+  objects that are exactly OsiSimpleInteger, keeps their indices in a flat
+  array, and works out infeasibility, preferred way and up/down estimates
+  for all of them in one tight loop. Other objects, and every object when
+  pseudo shadow prices are on, go through OsiObject::infeasibility().
+  Results and the mutable state left in the objects are the same as
+  calling infeasibility() on each object in turn.
+
+  The set of objects is remembered between calls and checked (addresses
+  and types) against the object array passed in, so the same scan can be
+  used node after node.
+*/
+class OsiObjectScan {
+
+public:
+
+  /// Default Constructor
+  OsiObjectScan ();
+
+  /// Copy constructor (the copy starts empty)
+  OsiObjectScan (const OsiObjectScan &);
+
+  /// Assignment operator (forgets the objects)
+  OsiObjectScan & operator=(const OsiObjectScan & rhs);
+
+  /// Destructor
+  ~OsiObjectScan ();
+
+  /** Compute infeasibility and preferred way for every object.
+      Values are as returned by OsiObject::infeasibility(info,whichWay).
+  */
+  void scan(const OsiBranchingInformation * info,
+	    int numberObjects, OsiObject ** objects);
+
+  /// Infeasibilities from last scan
+  inline const double * infeasibilities() const
+  { return infeasibility_;}
+  /// Preferred ways from last scan
+  inline const int * whichWays() const
+  { return whichWay_;}
+  /// Up estimate of object i after last scan
+  inline double upEstimate(int i) const
+  { if (!simple_[i])
+      return objects_[i]->upEstimate();
+    return whichWay_[i] ? distance_[i] : 1.0-distance_[i];}
+  /// Down estimate of object i after last scan
+  inline double downEstimate(int i) const
+  { if (!simple_[i])
+      return objects_[i]->downEstimate();
+    return whichWay_[i] ? 1.0-distance_[i] : distance_[i];}
+  /// Number of objects handled without a virtual call
+  inline int numberSimple() const
+  { return numberSimple_;}
+
+private:
+  /// Free arrays
+  void gutsOfDelete();
+  /// Find simple integers in a new set of objects
+  void gutsOfSetup(int numberObjects, OsiObject ** objects);
+
+  /// Number of objects
+  int numberObjects_;
+  /// Objects at last setup (not owned)
+  OsiObject ** objects_;
+  /// Nonzero if object is exactly OsiSimpleInteger
+  char * simple_;
+  /// Infeasibility of each object
+  double * infeasibility_;
+  /// Preferred way of each object
+  int * whichWay_;
+  /// Mutable infeasibility_ of each simple integer (gives estimates)
+  double * distance_;
+  /// Number of simple integers
+  int numberSimple_;
+  /// Object index of each simple integer then of each other object
+  int * which_;
+};
 /** Simple branching object for an integer variable
 
   This object can specify a two-way branch on an integer variable. For each
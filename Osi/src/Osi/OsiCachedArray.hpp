@@ -0,0 +1,196 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiCachedArray_H
+#define OsiCachedArray_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+//#############################################################################
+/** A dense array cached by a solver interface from its solver
+
+    Interfaces to solvers which keep their own copy of the problem (CPLEX,
+    Gurobi, ...) cache rim vectors such as column bounds so that getters
+    can return pointers.  Freeing such a cache whenever one entry changes
+    means the next getter fetches all entries again.  An OsiCachedArray
+    instead
+    <ul>
+    <li> is patched in place with set() when the interface knows the new
+	 value,
+    <li> records entries it does not know with markDirty(), so only the
+	 range between dirtyStart() and dirtyEnd() need be fetched again,
+    <li> grows with append() and shrinks with remove() when rows or
+	 columns are added or deleted.
+    </ul>
+    All of these do nothing if nothing is cached, so callers need not
+    check.  A getter then looks like
+    \code
+    if (!lower_.isCached())
+      lower_.allocate(numberColumns);   // all dirty
+    if (lower_.isDirty()) {
+      fetch(lower_.array()+lower_.dirtyStart(),
+	    lower_.dirtyStart(),lower_.dirtyEnd()-1);
+      lower_.markClean();
+    }
+    return lower_.array();
+    \endcode
+    Arrays of size zero are never cached, as the interfaces return NULL
+    for them.
+*/
+template <class T>
+class OsiCachedArray {
+
+public:
+  /**@name Constructors and destructor */
+  //@{
+  /// Default Constructor (nothing cached)
+  OsiCachedArray ()
+    : array_(NULL), size_(0), capacity_(0), dirtyStart_(0), dirtyEnd_(0)
+  {}
+
+  /// Destructor
+  ~OsiCachedArray ()
+  { delete [] array_;}
+  //@}
+
+  /**@name Querying */
+  //@{
+  /// Cached entries, or NULL if nothing is cached
+  inline T * array() const
+  { return array_;}
+  /// Whether anything is cached
+  inline bool isCached() const
+  { return array_ != NULL;}
+  /// Number of entries cached
+  inline int size() const
+  { return size_;}
+  /// Whether some entries are out of date
+  inline bool isDirty() const
+  { return dirtyStart_ < dirtyEnd_;}
+  /// First entry out of date
+  inline int dirtyStart() const
+  { return dirtyStart_;}
+  /// One past last entry out of date
+  inline int dirtyEnd() const
+  { return dirtyEnd_;}
+  //@}
+
+  /**@name Changing */
+  //@{
+  /// Start caching n entries, all out of date.  Returns array (NULL if n 0).
+  T * allocate(int n)
+  {
+    free();
+    if (n > 0) {
+      array_ = new T[n];
+      size_ = n;
+      capacity_ = n;
+      dirtyStart_ = 0;
+      dirtyEnd_ = n;
+    }
+    return array_;
+  }
+  /// Stop caching
+  void free()
+  {
+    delete [] array_;
+    array_ = NULL;
+    size_ = 0;
+    capacity_ = 0;
+    dirtyStart_ = 0;
+    dirtyEnd_ = 0;
+  }
+  /// Entries have been fetched
+  inline void markClean()
+  { dirtyStart_ = 0; dirtyEnd_ = 0;}
+  /// Entries first to last-1 are out of date
+  void markDirty(int first, int last)
+  {
+    if (array_ == NULL || first >= last)
+      return;
+    if (isDirty()) {
+      dirtyStart_ = std::min(dirtyStart_,first);
+      dirtyEnd_ = std::max(dirtyEnd_,last);
+    } else {
+      dirtyStart_ = first;
+      dirtyEnd_ = last;
+    }
+  }
+  /// Entry i is now value
+  inline void set(int i, const T & value)
+  { if (array_ != NULL) array_[i] = value;}
+  /** Add n entries at the end, copied from values, or out of date if
+      values is NULL */
+  void append(int n, const T * values)
+  {
+    if (array_ == NULL || n <= 0)
+      return;
+    if (size_ + n > capacity_) {
+      const int capacity = std::max(size_ + n, 2*capacity_);
+      T * array = new T[capacity];
+      std::copy(array_,array_+size_,array);
+      delete [] array_;
+      array_ = array;
+      capacity_ = capacity;
+    }
+    if (values)
+      std::copy(values,values+n,array_+size_);
+    else
+      markDirty(size_,size_+n);
+    size_ += n;
+  }
+  /** Delete entries (which need not be sorted) and close up the rest.
+      Forgets everything if that leaves none. */
+  void remove(int number, const int * which)
+  {
+    if (array_ == NULL || number <= 0)
+      return;
+    std::vector<char> drop(size_,0);
+    for (int k = 0; k < number; k++)
+      drop[which[k]] = 1;
+    int put = 0;
+    int newStart = -1;
+    int newEnd = 0;
+    for (int i = 0; i < size_; i++) {
+      if (drop[i])
+	continue;
+      if (i >= dirtyStart_ && i < dirtyEnd_) {
+	if (newStart < 0)
+	  newStart = put;
+	newEnd = put+1;
+      }
+      array_[put++] = array_[i];
+    }
+    size_ = put;
+    if (size_ == 0) {
+      free();
+    } else if (newStart >= 0) {
+      dirtyStart_ = newStart;
+      dirtyEnd_ = newEnd;
+    } else {
+      markClean();
+    }
+  }
+  //@}
+
+private:
+  /// Not copyable (interfaces start copies with empty caches)
+  OsiCachedArray (const OsiCachedArray &);
+  OsiCachedArray & operator=(const OsiCachedArray &);
+
+  /// Entries, or NULL if nothing cached
+  T * array_;
+  /// Number of entries
+  int size_;
+  /// Space in array_
+  int capacity_;
+  /// First entry out of date
+  int dirtyStart_;
+  /// One past last entry out of date (not dirty if not above dirtyStart_)
+  int dirtyEnd_;
+};
+
+#endif
@@ -0,0 +1,667 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "CoinPragma.hpp"
+#include "CoinUtilsConfig.h"
+#include "CoinError.hpp"
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "OsiSolverInterface.hpp"
+#include "OsiChooseReliable.hpp"
+
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+#endif
+
+/*
+  Atomic additions for OsiSharedPseudoCosts.  A double is added by compare
+  and swap on its bits.
+*/
+#if defined(_MSC_VER)
+#include <intrin.h>
+#pragma intrinsic(_InterlockedExchangeAdd, _InterlockedCompareExchange64)
+static inline void osiAtomicAdd (int * p, int value)
+{ _InterlockedExchangeAdd(reinterpret_cast<volatile long *>(p),value); }
+static inline void osiAtomicAdd (double * p, double value)
+{
+  volatile __int64 * bits = reinterpret_cast<volatile __int64 *>(p);
+  union { __int64 i; double d; } oldValue, newValue;
+  do {
+    oldValue.i = *bits;
+    newValue.d = oldValue.d+value;
+  } while (_InterlockedCompareExchange64(bits,newValue.i,oldValue.i) !=
+	   oldValue.i);
+}
+#elif defined(__GNUC__)
+static inline void osiAtomicAdd (int * p, int value)
+{ __sync_fetch_and_add(p,value); }
+static inline void osiAtomicAdd (double * p, double value)
+{
+  volatile long long * bits = reinterpret_cast<volatile long long *>(p);
+  union { long long i; double d; } oldValue, newValue;
+  do {
+    oldValue.i = *bits;
+    newValue.d = oldValue.d+value;
+  } while (__sync_val_compare_and_swap(bits,oldValue.i,newValue.i) !=
+	   oldValue.i);
+}
+#else
+// No atomics known - single thread only
+static inline void osiAtomicAdd (int * p, int value)
+{ *p += value; }
+static inline void osiAtomicAdd (double * p, double value)
+{ *p += value; }
+#endif
+
+//#############################################################################
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+OsiSharedPseudoCosts::OsiSharedPseudoCosts ()
+  : total_(NULL),
+    number_(NULL),
+    infeasible_(NULL),
+    strong_(NULL),
+    strongIterations_(NULL),
+    numberObjects_(0)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+OsiSharedPseudoCosts::OsiSharedPseudoCosts (const OsiSharedPseudoCosts & rhs)
+  : total_(NULL),
+    number_(NULL),
+    infeasible_(NULL),
+    strong_(NULL),
+    strongIterations_(NULL),
+    numberObjects_(0)
+{
+  gutsOfCopy(rhs);
+}
+
+//-------------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+OsiSharedPseudoCosts &
+OsiSharedPseudoCosts::operator=(const OsiSharedPseudoCosts & rhs)
+{
+  if (this != &rhs) {
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+OsiSharedPseudoCosts::~OsiSharedPseudoCosts ()
+{
+  gutsOfDelete();
+}
+
+void
+OsiSharedPseudoCosts::gutsOfDelete()
+{
+  delete [] total_;
+  delete [] number_;
+  delete [] infeasible_;
+  delete [] strong_;
+  delete [] strongIterations_;
+  total_ = NULL;
+  number_ = NULL;
+  infeasible_ = NULL;
+  strong_ = NULL;
+  strongIterations_ = NULL;
+  numberObjects_ = 0;
+}
+
+void
+OsiSharedPseudoCosts::gutsOfCopy(const OsiSharedPseudoCosts & rhs)
+{
+  numberObjects_ = rhs.numberObjects_;
+  if (numberObjects_ > 0) {
+    total_ = CoinCopyOfArray(rhs.total_,2*numberObjects_);
+    number_ = CoinCopyOfArray(rhs.number_,2*numberObjects_);
+    infeasible_ = CoinCopyOfArray(rhs.infeasible_,2*numberObjects_);
+    strong_ = CoinCopyOfArray(rhs.strong_,numberObjects_);
+    strongIterations_ = CoinCopyOfArray(rhs.strongIterations_,numberObjects_);
+  }
+}
+
+void
+OsiSharedPseudoCosts::initialize(int n)
+{
+  gutsOfDelete();
+  numberObjects_ = n;
+  if (numberObjects_ > 0) {
+    total_ = new double [2*numberObjects_];
+    number_ = new int [2*numberObjects_];
+    infeasible_ = new int [2*numberObjects_];
+    strong_ = new int [numberObjects_];
+    strongIterations_ = new int [numberObjects_];
+    CoinZeroN(total_,2*numberObjects_);
+    CoinZeroN(number_,2*numberObjects_);
+    CoinZeroN(infeasible_,2*numberObjects_);
+    CoinZeroN(strong_,numberObjects_);
+    CoinZeroN(strongIterations_,numberObjects_);
+  }
+}
+
+void
+OsiSharedPseudoCosts::update(int index, int branch, double changePerUnit)
+{
+  assert (index >= 0 && index < numberObjects_ && branch >= 0 && branch < 2);
+  osiAtomicAdd(total_+2*index+branch,changePerUnit);
+  osiAtomicAdd(number_+2*index+branch,1);
+}
+
+void
+OsiSharedPseudoCosts::updateInfeasible(int index, int branch)
+{
+  assert (index >= 0 && index < numberObjects_ && branch >= 0 && branch < 2);
+  osiAtomicAdd(infeasible_+2*index+branch,1);
+}
+
+void
+OsiSharedPseudoCosts::updateStrong(int index, int iterations)
+{
+  assert (index >= 0 && index < numberObjects_);
+  osiAtomicAdd(strong_+index,1);
+  osiAtomicAdd(strongIterations_+index,iterations);
+}
+
+void
+OsiSharedPseudoCosts::copyTo(OsiPseudoCosts & costs) const
+{
+  if (costs.numberObjects() != numberObjects_) {
+    // initialize() forgets number before trusted
+    const int numberBeforeTrusted = costs.numberBeforeTrusted();
+    costs.initialize(numberObjects_);
+    costs.setNumberBeforeTrusted(numberBeforeTrusted);
+  }
+  double * downTotal = costs.downTotalChange();
+  double * upTotal = costs.upTotalChange();
+  int * downNumber = costs.downNumber();
+  int * upNumber = costs.upNumber();
+  for (int i = 0; i < numberObjects_; i++) {
+    downTotal[i] = total_[2*i];
+    upTotal[i] = total_[2*i+1];
+    downNumber[i] = number_[2*i];
+    upNumber[i] = number_[2*i+1];
+  }
+}
+
+//#############################################################################
+
+namespace {
+
+// Strong branching on one candidate, maybe on a thread of its own
+struct StrongTask {
+  OsiSolverInterface * solver;
+  OsiBranchingInformation * info;
+  OsiChooseVariable * choose;
+  OsiHotInfo * result;
+  int * status;
+#ifdef COINUTILS_PTHREADS
+  pthread_mutex_t * mutex;
+#endif
+};
+
+/* Both branches of task.result from the hot start of task.solver, as in
+   OsiChooseStrong::doStrongBranching.  The results go through the chooser
+   (it may save a solution), so with several threads that is done under
+   the lock. */
+void
+strongBranchTask (StrongTask & task)
+{
+  OsiSolverInterface * solver = task.solver;
+  OsiBranchingInformation * info = task.info;
+  OsiChooseVariable * choose = task.choose;
+  const int numberColumns = solver->getNumCols();
+  double * saveLower = CoinCopyOfArray(solver->getColLower(),numberColumns);
+  double * saveUpper = CoinCopyOfArray(solver->getColUpper(),numberColumns);
+  OsiBranchingObject * branch = task.result->branchingObject();
+  assert (branch->numberBranches()==2);
+  for (int k = 0; k < 2; k++) {
+    OsiSolverInterface * thisSolver = solver;
+    if (branch->boundBranch()) {
+      // ordinary
+      branch->branch(solver);
+      solver->solveFromHotStart();
+    } else {
+      // adding cuts or something
+      thisSolver = solver->clone();
+      branch->branch(thisSolver);
+      // set hot start iterations
+      int limit;
+      thisSolver->getIntParam(OsiMaxNumIterationHotStart,limit);
+      thisSolver->setIntParam(OsiMaxNumIteration,limit);
+      thisSolver->resolve();
+    }
+    const int iBranch = branch->branchIndex()-1;
+#ifdef COINUTILS_PTHREADS
+    if (task.mutex)
+      pthread_mutex_lock(task.mutex);
+#endif
+    int status = task.result->updateInformation(thisSolver,info,choose);
+    if (status==3) {
+      // new solution already saved
+      if (choose->trustStrongForSolution()) {
+	info->cutoff_ = choose->goodObjectiveValue();
+	status=0;
+      }
+    }
+#ifdef COINUTILS_PTHREADS
+    if (task.mutex)
+      pthread_mutex_unlock(task.mutex);
+#endif
+    task.status[iBranch] = status;
+    if (solver!=thisSolver)
+      delete thisSolver;
+    // Restore bounds
+    const double * lower = solver->getColLower();
+    const double * upper = solver->getColUpper();
+    for (int j=0;j<numberColumns;j++) {
+      if (saveLower[j] != lower[j])
+	solver->setColLower(j,saveLower[j]);
+      if (saveUpper[j] != upper[j])
+	solver->setColUpper(j,saveUpper[j]);
+    }
+  }
+  delete [] saveLower;
+  delete [] saveUpper;
+}
+
+#ifdef COINUTILS_PTHREADS
+void *
+strongBranchThread (void * task)
+{
+  strongBranchTask(*static_cast<StrongTask *>(task));
+  return NULL;
+}
+#endif
+
+}
+
+//#############################################################################
+
+#define MAXMIN_CRITERION 0.85
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+OsiChooseReliable::OsiChooseReliable ()
+  : OsiChooseStrong(),
+    ownPseudoCosts_(),
+    sharedPseudoCosts_(NULL),
+    lookahead_(8),
+    numberThreads_(1),
+    numberTrusted_(0)
+{
+  pseudoCosts_.setNumberBeforeTrusted(8);
+}
+
+//-------------------------------------------------------------------
+// Constructor from solver
+//-------------------------------------------------------------------
+OsiChooseReliable::OsiChooseReliable (const OsiSolverInterface * solver)
+  : OsiChooseStrong(solver),
+    ownPseudoCosts_(),
+    sharedPseudoCosts_(NULL),
+    lookahead_(8),
+    numberThreads_(1),
+    numberTrusted_(0)
+{
+  ownPseudoCosts_.initialize(solver_->numberObjects());
+  pseudoCosts_.setNumberBeforeTrusted(8);
+}
+
+//-------------------------------------------------------------------
+// Copy constructor (a copy uses the same shared pseudocosts)
+//-------------------------------------------------------------------
+OsiChooseReliable::OsiChooseReliable (const OsiChooseReliable & rhs)
+  : OsiChooseStrong(rhs),
+    ownPseudoCosts_(rhs.ownPseudoCosts_),
+    sharedPseudoCosts_(rhs.sharedPseudoCosts_),
+    lookahead_(rhs.lookahead_),
+    numberThreads_(rhs.numberThreads_),
+    numberTrusted_(rhs.numberTrusted_)
+{
+}
+
+//-------------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+OsiChooseReliable &
+OsiChooseReliable::operator=(const OsiChooseReliable & rhs)
+{
+  if (this != &rhs) {
+    OsiChooseStrong::operator=(rhs);
+    ownPseudoCosts_ = rhs.ownPseudoCosts_;
+    sharedPseudoCosts_ = rhs.sharedPseudoCosts_;
+    lookahead_ = rhs.lookahead_;
+    numberThreads_ = rhs.numberThreads_;
+    numberTrusted_ = rhs.numberTrusted_;
+  }
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+OsiChooseReliable::~OsiChooseReliable ()
+{
+}
+
+//-------------------------------------------------------------------
+// Clone
+//-------------------------------------------------------------------
+OsiChooseVariable *
+OsiChooseReliable::clone() const
+{
+  return new OsiChooseReliable(*this);
+}
+
+// Rank on pseudocosts as of now
+int
+OsiChooseReliable::setupList ( OsiBranchingInformation *info, bool initialize)
+{
+  const int numberObjects = solver_->numberObjects();
+  OsiSharedPseudoCosts * costs = sharedPseudoCosts();
+  if (numberObjects > costs->numberObjects()) {
+    if (sharedPseudoCosts_)
+      throw CoinError("Shared pseudocosts have too few objects",
+		      "setupList", "OsiChooseReliable");
+    ownPseudoCosts_.initialize(numberObjects);
+  }
+  costs->copyTo(pseudoCosts_);
+  return OsiChooseStrong::setupList(info,initialize);
+}
+
+// Pseudocosts from branching in the tree
+void
+OsiChooseReliable::updateInformation( int index, int branch,
+				      double changeInObjective,
+				      double changeInValue,
+				      int status)
+{
+  OsiChooseVariable::updateInformation(index,branch,changeInObjective,
+				       changeInValue,status);
+  assert (changeInValue>0.0);
+  if (status!=1)
+    sharedPseudoCosts()->update(index,branch,changeInObjective/changeInValue);
+  else
+    sharedPseudoCosts()->updateInfeasible(index,branch);
+}
+
+void
+OsiChooseReliable::strongBranch(OsiSolverInterface ** solvers,
+				OsiBranchingInformation *info,
+				int first, int number, int * status)
+{
+  std::vector<StrongTask> tasks(number);
+  for (int k = 0; k < number; k++) {
+    StrongTask & task = tasks[k];
+    task.solver = solvers[k];
+    task.info = info;
+    task.choose = this;
+    task.result = results_+first+k;
+    task.status = status+2*k;
+#ifdef COINUTILS_PTHREADS
+    task.mutex = NULL;
+#endif
+  }
+#ifdef COINUTILS_PTHREADS
+  if (number > 1) {
+    pthread_mutex_t mutex;
+    pthread_mutex_init(&mutex,NULL);
+    for (int k = 0; k < number; k++)
+      tasks[k].mutex = &mutex;
+    std::vector<pthread_t> threads(number);
+    std::vector<char> started(number,0);
+    for (int k = 1; k < number; k++)
+      started[k] = !pthread_create(&threads[k],NULL,strongBranchThread,
+				   &tasks[k]);
+    strongBranchTask(tasks[0]);
+    for (int k = 1; k < number; k++) {
+      if (started[k])
+	pthread_join(threads[k],NULL);
+      else
+	strongBranchTask(tasks[k]);
+    }
+    pthread_mutex_destroy(&mutex);
+    return;
+  }
+#endif
+  for (int k = 0; k < number; k++)
+    strongBranchTask(tasks[k]);
+}
+
+/* Choose a variable
+   Returns as OsiChooseStrong::chooseVariable()
+*/
+int
+OsiChooseReliable::chooseVariable( OsiSolverInterface * solver,
+				   OsiBranchingInformation *info,
+				   bool fixVariables)
+{
+  numberTrusted_ = 0;
+  if (!numberUnsatisfied_)
+    return 1;
+  OsiSharedPseudoCosts & costs = *sharedPseudoCosts();
+  int numberBeforeTrusted = pseudoCosts_.numberBeforeTrusted();
+  // As OsiChooseStrong
+  if (!numberBeforeTrusted) {
+    numberBeforeTrusted=5;
+    pseudoCosts_.setNumberBeforeTrusted(numberBeforeTrusted);
+  }
+  OsiObject ** object = solver->objects();
+  const int numberObjects = solver->numberObjects();
+  // Averages stand in for missing pseudocosts
+  double sumDown = 0.0;
+  double sumUp = 0.0;
+  int numberDown = 0;
+  int numberUp = 0;
+  for (int i = 0; i < numberObjects; i++) {
+    sumDown += costs.total(i,0);
+    numberDown += costs.number(i,0);
+    sumUp += costs.total(i,1);
+    numberUp += costs.number(i,1);
+  }
+  const double averageDown = numberDown ? sumDown/numberDown : 1.0;
+  const double averageUp = numberUp ? sumUp/numberUp : 1.0;
+  bestObjectIndex_ = -1;
+  bestWhichWay_ = -1;
+  firstForcedObjectIndex_ = -1;
+  firstForcedWhichWay_ =-1;
+  const int numberLeft = CoinMin(numberStrong_-numberStrongDone_,
+				 numberOnList_);
+  if (numberLeft <= 0) {
+    bestObjectIndex_ = list_[0];
+    bestWhichWay_ = object[bestObjectIndex_]->whichWay();
+    return 0;
+  }
+  // Score trusted candidates; the others wait in rank order
+  double bestScore = -COIN_DBL_MAX;
+  bool bestStrong = false;
+  std::vector<int> untrusted;
+  std::vector<double> pseudoScore(numberLeft);
+  std::vector<int> pseudoWay(numberLeft);
+  for (int i = 0; i < numberLeft; i++) {
+    const int iObject = list_[i];
+    const OsiObject * obj = object[iObject];
+    const double downEstimate =
+      costs.average(iObject,0,averageDown)*obj->downEstimate();
+    const double upEstimate =
+      costs.average(iObject,1,averageUp)*obj->upEstimate();
+    pseudoScore[i] = MAXMIN_CRITERION*CoinMin(upEstimate,downEstimate) +
+      (1.0-MAXMIN_CRITERION)*CoinMax(upEstimate,downEstimate);
+    pseudoWay[i] = upEstimate>downEstimate ? 0 : 1;
+    if (costs.number(iObject,0)<numberBeforeTrusted ||
+	costs.number(iObject,1)<numberBeforeTrusted) {
+      untrusted.push_back(i);
+    } else {
+      numberTrusted_++;
+      if (pseudoScore[i] > bestScore) {
+	bestScore = pseudoScore[i];
+	bestObjectIndex_ = iObject;
+	bestWhichWay_ = pseudoWay[i];
+      }
+    }
+  }
+  /*
+    Strong branch on untrusted candidates, numberThreads_ at a time, until
+    lookahead_ in a row have not improved the best or one can be fixed.
+  */
+  const int numberUntrusted = static_cast<int>(untrusted.size());
+  std::vector<char> evaluated(numberLeft,0);
+  int returnCode = 0;
+  int numberFixed = 0;
+  // (object,way) to fix afterwards
+  std::vector<int> fixObject;
+  std::vector<int> fixWay;
+  if (numberUntrusted) {
+    /* Branches are made as we go, after the solver has moved on from the
+       solution info points at */
+    const double * saveSolution = info->solution_;
+    double * solution = CoinCopyOfArray(saveSolution,solver->getNumCols());
+    info->solution_ = solution;
+    resetResults(numberUntrusted);
+    const int numberSolvers = CoinMin(numberThreads_,numberUntrusted);
+    std::vector<OsiSolverInterface *> solvers(numberSolvers);
+    solvers[0] = solver;
+    for (int k = 1; k < numberSolvers; k++)
+      solvers[k] = solver->clone();
+    for (int k = 0; k < numberSolvers; k++)
+      solvers[k]->markHotStart();
+    std::vector<int> status(2*numberSolvers);
+    const double timeStart = CoinCpuTime();
+    int numberNotImproving = 0;
+    int numberDone = 0;
+    bool fixable = false;
+    while (numberDone < numberUntrusted && numberNotImproving < lookahead_) {
+      const int number = CoinMin(numberSolvers,numberUntrusted-numberDone);
+      for (int k = 0; k < number; k++)
+	results_[numResults_+k] =
+	  OsiHotInfo(solver,info,object,list_[untrusted[numberDone+k]]);
+      strongBranch(&solvers[0],info,numResults_,number,&status[0]);
+      for (int k = 0; k < number; k++) {
+	const OsiHotInfo & result = results_[numResults_++];
+	const int i = untrusted[numberDone+k];
+	const int iObject = list_[i];
+	const OsiObject * obj = object[iObject];
+	evaluated[i] = 1;
+	numberStrongDone_++;
+	const int iterations = result.iterationCount(0)+result.iterationCount(1);
+	numberStrongIterations_ += iterations;
+	costs.updateStrong(iObject,iterations);
+	const int status0 = status[2*k];
+	const int status1 = status[2*k+1];
+	double estimate[2];
+	for (int way = 0; way < 2; way++) {
+	  const int thisStatus = way ? status1 : status0;
+	  const double distance = way ? obj->upEstimate() : obj->downEstimate();
+	  if (thisStatus!=1) {
+	    assert (thisStatus>=0);
+	    estimate[way] = result.change(way);
+	    if (distance > 0.0)
+	      costs.update(iObject,way,estimate[way]/distance);
+	  } else {
+	    // infeasible - just say expensive
+	    costs.updateInfeasible(iObject,way);
+	    if (info->cutoff_<1.0e50)
+	      estimate[way] = 2.0*(info->cutoff_-info->objectiveValue_);
+	    else
+	      estimate[way] = 2.0*fabs(info->objectiveValue_);
+	  }
+	}
+	if (status0==1&&status1==1) {
+	  // infeasible
+	  returnCode=-1;
+	  continue;
+	} else if (status0==1||status1==1) {
+	  // branch the feasible way
+	  const int way = status0==1 ? 1 : 0;
+	  numberStrongFixed_++;
+	  numberFixed++;
+	  if (firstForcedObjectIndex_ <0) {
+	    firstForcedObjectIndex_ = iObject;
+	    firstForcedWhichWay_ = way;
+	  }
+	  fixObject.push_back(iObject);
+	  fixWay.push_back(way);
+	  fixable = true;
+	}
+	const double value = MAXMIN_CRITERION*CoinMin(estimate[0],estimate[1]) +
+	  (1.0-MAXMIN_CRITERION)*CoinMax(estimate[0],estimate[1]);
+	if (value > bestScore) {
+	  bestScore = value;
+	  bestObjectIndex_ = iObject;
+	  bestWhichWay_ = estimate[1]>estimate[0] ? 0 : 1;
+	  bestStrong = true;
+	  // but override if there is a preferred way
+	  if (obj->preferredWay()>=0&&obj->infeasibility())
+	    bestWhichWay_ = obj->preferredWay();
+	  numberNotImproving = 0;
+	} else {
+	  numberNotImproving++;
+	}
+      }
+      numberDone += number;
+      if (returnCode==-1 || fixable)
+	break;
+      if (CoinCpuTime()-timeStart > info->timeRemaining_)
+	break;
+    }
+    for (int k = 0; k < numberSolvers; k++)
+      solvers[k]->unmarkHotStart();
+    for (int k = 1; k < numberSolvers; k++)
+      delete solvers[k];
+    info->solution_ = saveSolution;
+    delete [] solution;
+  }
+  if (returnCode==-1)
+    return -1;
+  // Untrusted candidates not strong branched on compete on pseudocosts
+  for (int j = 0; j < numberUntrusted; j++) {
+    const int i = untrusted[j];
+    if (!evaluated[i] && pseudoScore[i] > bestScore) {
+      bestScore = pseudoScore[i];
+      bestObjectIndex_ = list_[i];
+      bestWhichWay_ = pseudoWay[i];
+      bestStrong = false;
+    }
+  }
+  if (numberFixed) {
+    if (bestObjectIndex_<0)
+      returnCode = 4;
+    else
+      returnCode = bestStrong ? 2 : 3;
+    if (fixVariables) {
+      for (size_t k = 0; k < fixObject.size(); k++) {
+	const OsiObject * obj = object[fixObject[k]];
+	OsiBranchingObject * branch =
+	  obj->createBranch(solver,info,fixWay[k]);
+	branch->branch(solver);
+	delete branch;
+      }
+    }
+  }
+  if ( bestObjectIndex_ >=0 ) {
+    OsiObject * obj = object[bestObjectIndex_];
+    obj->setWhichWay(bestWhichWay_);
+  }
+  if (numberFixed==numberUnsatisfied_&&numberFixed)
+    returnCode=4;
+  return returnCode;
+}
@@ -0,0 +1,202 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiChooseReliable_H
+#define OsiChooseReliable_H
+
+#include "OsiChooseVariable.hpp"
+
+//#############################################################################
+/** Pseudocosts which several choosers may share
+
+    Holds, for each object, the total and number of changes in objective
+    per unit change down and up, as OsiPseudoCosts does, together with
+    statistics on how reliable they are: the number of strong branchings
+    done on the object, the simplex iterations they took and the number
+    of branches found infeasible.
+
+    Updates are atomic additions (on compilers where we know how), so the
+    workers of a parallel tree search, each with its own OsiChooseReliable,
+    can point them all at one set of pseudocosts without locking.  A
+    reader running at the same time as an update may see the new total
+    before the new count.  initialize() and the copy and assignment
+    operators are not safe to run while others use the object.
+*/
+class OsiSharedPseudoCosts {
+
+public:
+  /**@name Constructors and destructor */
+  //@{
+  /// Default Constructor
+  OsiSharedPseudoCosts ();
+
+  /// Copy constructor
+  OsiSharedPseudoCosts (const OsiSharedPseudoCosts &);
+
+  /// Assignment operator
+  OsiSharedPseudoCosts & operator=(const OsiSharedPseudoCosts & rhs);
+
+  /// Destructor
+  ~OsiSharedPseudoCosts ();
+  //@}
+
+  /// Initialize with n objects, all empty
+  void initialize(int n);
+  /// Number of objects
+  inline int numberObjects() const
+  { return numberObjects_;}
+
+  /**@name Updates (may be called from several threads at once) */
+  //@{
+  /** Branch (0 down, 1 up) on object index changed the objective by
+      changePerUnit per unit change in the object */
+  void update(int index, int branch, double changePerUnit);
+  /// Branch on object index was infeasible
+  void updateInfeasible(int index, int branch);
+  /// Strong branching was done on object index taking some iterations
+  void updateStrong(int index, int iterations);
+  //@}
+
+  /**@name Pseudocosts and statistics (branch is 0 down, 1 up) */
+  //@{
+  /// Total of changes per unit
+  inline double total(int index, int branch) const
+  { return total_[2*index+branch];}
+  /// Number of changes
+  inline int number(int index, int branch) const
+  { return number_[2*index+branch];}
+  /// Average change per unit, or value if none yet
+  inline double average(int index, int branch, double value) const
+  { const int n = number_[2*index+branch];
+    return n ? total_[2*index+branch]/n : value;}
+  /// Number of branches found infeasible
+  inline int numberInfeasible(int index, int branch) const
+  { return infeasible_[2*index+branch];}
+  /// Number of strong branchings done
+  inline int numberStrong(int index) const
+  { return strong_[index];}
+  /// Iterations taken by strong branching
+  inline int numberStrongIterations(int index) const
+  { return strongIterations_[index];}
+  /** Copy pseudocosts into an OsiPseudoCosts (e.g. that of an
+      OsiChooseStrong), keeping its number before trusted */
+  void copyTo(OsiPseudoCosts & costs) const;
+  //@}
+
+private:
+  void gutsOfDelete();
+  void gutsOfCopy(const OsiSharedPseudoCosts & rhs);
+
+  /// Totals of changes per unit, down and up for each object
+  double * total_;
+  /// Numbers of changes, down and up for each object
+  int * number_;
+  /// Numbers of infeasible branches, down and up for each object
+  int * infeasible_;
+  /// Number of strong branchings on each object
+  int * strong_;
+  /// Iterations of strong branching on each object
+  int * strongIterations_;
+  /// Number of objects
+  int numberObjects_;
+};
+
+//#############################################################################
+/** This class chooses a variable to branch on by reliability branching
+
+    Candidates are ranked by pseudocost, as in OsiChooseStrong.  An object
+    whose pseudocosts have been updated fewer than numberBeforeTrusted()
+    times in either direction is not trusted and is strong branched on,
+    in order of rank, which also updates its pseudocosts.  Strong branching
+    stops when lookahead() candidates in a row have not improved on the
+    best score so far, or when a variable can be fixed.  Candidates not
+    strong branched on are scored by their pseudocosts, with averages over
+    all objects standing in for missing ones.
+
+    With numberThreads() above one, that many candidates at a time are
+    strong branched on, each on its own clone of the solver; the clones
+    run on threads if CoinUtils was built with thread support.
+
+    Pseudocosts are held in an OsiSharedPseudoCosts, by default one of
+    the chooser's own.  Several choosers can be given the same one with
+    setSharedPseudoCosts().
+*/
+class OsiChooseReliable : public OsiChooseStrong {
+
+public:
+  /// Default Constructor
+  OsiChooseReliable ();
+
+  /// Constructor from solver (so we can set up arrays etc)
+  OsiChooseReliable (const OsiSolverInterface * solver);
+
+  /// Copy constructor
+  OsiChooseReliable (const OsiChooseReliable &);
+
+  /// Assignment operator
+  OsiChooseReliable & operator= (const OsiChooseReliable & rhs);
+
+  /// Clone
+  virtual OsiChooseVariable * clone() const;
+
+  /// Destructor
+  virtual ~OsiChooseReliable ();
+
+  /** Sets up strong list and clears all if initialize is true.
+      Returns number of infeasibilities.
+      If returns -1 then has worked out node is infeasible!
+  */
+  virtual int setupList ( OsiBranchingInformation *info, bool initialize);
+  /** Choose a variable
+      Returns as OsiChooseStrong::chooseVariable()
+  */
+  virtual int chooseVariable( OsiSolverInterface * solver, OsiBranchingInformation *info, bool fixVariables);
+  /// Given a branch fill in useful information e.g. estimates
+  virtual void updateInformation( int whichObject, int branch,
+				  double changeInObjective, double changeInValue,
+				  int status);
+
+  /// Pseudocosts in use
+  inline OsiSharedPseudoCosts * sharedPseudoCosts() const
+  { return sharedPseudoCosts_ ? sharedPseudoCosts_ : &ownPseudoCosts_;}
+  /** Use costs (which must outlive the chooser and be initialized for
+      all objects) rather than the chooser's own.  NULL goes back to own. */
+  inline void setSharedPseudoCosts(OsiSharedPseudoCosts * costs)
+  { sharedPseudoCosts_ = costs;}
+  /// Untrusted candidates in a row not improving best before stopping
+  inline int lookahead() const
+  { return lookahead_;}
+  inline void setLookahead(int value)
+  { lookahead_ = value;}
+  /// Candidates strong branched on at once
+  inline int numberThreads() const
+  { return numberThreads_;}
+  inline void setNumberThreads(int value)
+  { numberThreads_ = value > 1 ? value : 1;}
+  /// Candidates scored by trusted pseudocosts in last chooseVariable()
+  inline int numberTrusted() const
+  { return numberTrusted_;}
+
+protected:
+  /** Strong branch on results_[first] to results_[first+number-1], one on
+      each of solvers (number of them, hot start marked).  Fills in results
+      and status (two per candidate, down then up). */
+  void strongBranch(OsiSolverInterface ** solvers,
+		    OsiBranchingInformation *info,
+		    int first, int number, int * status);
+
+private:
+  /// Pseudocosts if not shared
+  mutable OsiSharedPseudoCosts ownPseudoCosts_;
+  /// Shared pseudocosts (not owned) or NULL
+  OsiSharedPseudoCosts * sharedPseudoCosts_;
+  /// Untrusted candidates in a row not improving best before stopping
+  int lookahead_;
+  /// Candidates strong branched on at once
+  int numberThreads_;
+  /// Candidates scored by trusted pseudocosts in last chooseVariable()
+  int numberTrusted_;
+};
+
+#endif
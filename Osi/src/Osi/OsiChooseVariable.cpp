@@ -205,11 +205,12 @@ OsiChooseVariable::setupList ( OsiBranchingInformation *info, bool initialize)
     useful_[i]=0.0;
   }
   OsiObject ** object = info->solver_->objects();
+  scan_.scan(info,numberObjects,object);
+  const double * infeasibility = scan_.infeasibilities();
   // Say feasible
   bool feasible = true;
   for ( i=0;i<numberObjects;i++) {
-    int way;
-    double value = object[i]->infeasibility(info,way);
+    double value = infeasibility[i];
     if (value>0.0) {
       numberUnsatisfied_++;
       if (value==COIN_DBL_MAX) {
@@ -754,9 +755,10 @@ OsiChooseStrong::setupList ( OsiBranchingInformation *info, bool initialize)
   int pri[]={10,1000,10000};
   int priCount[]={0,0,0};
 #endif
+  scan_.scan(info,numberObjects,object);
+  const double * infeasibility = scan_.infeasibilities();
   for ( i=0;i<numberObjects;i++) {
-    int way;
-    double value = object[i]->infeasibility(info,way);
+    double value = infeasibility[i];
     if (value>0.0) {
       numberUnsatisfied_++;
       if (value==COIN_DBL_MAX) {
@@ -792,8 +794,8 @@ OsiChooseStrong::setupList ( OsiBranchingInformation *info, bool initialize)
 	numberUp = upNumber[i];
 	sumDown = downTotalChange[i]+1.0e-30;
 	numberDown = downNumber[i];
-	double upEstimate = object[i]->upEstimate();
-	double downEstimate = object[i]->downEstimate();
+	double upEstimate = scan_.upEstimate(i);
+	double downEstimate = scan_.downEstimate(i);
 	if (shadowPossible<2) {
 	  upEstimate = numberUp ? ((upEstimate*sumUp)/numberUp) : (upEstimate*upMultiplier);
 	  if (numberUp<numberBeforeTrusted)
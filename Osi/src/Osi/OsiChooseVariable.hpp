@@ -230,6 +230,8 @@ protected:
   bool trustStrongForBound_;
   /// Trust results from strong branching for valid solution
   bool trustStrongForSolution_;
+  /// Infeasibilities of all objects (rebuilt when the objects change)
+  OsiObjectScan scan_;
 };
 
 /** This class is the placeholder for the pseudocosts used by OsiChooseStrong.
@@ -0,0 +1,291 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "CoinPragma.hpp"
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinSort.hpp"
+#include "OsiCutPool.hpp"
+#include "OsiCuts.hpp"
+#include "OsiRowCut.hpp"
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+OsiCutPool::OsiCutPool ()
+  : start_(1,0),
+    clock_(0),
+    policy_(evictLeastRecentlyUsed),
+    maximumCuts_(COIN_INT_MAX),
+    maximumAge_(COIN_INT_MAX)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+OsiCutPool::OsiCutPool (const OsiCutPool & rhs)
+  : start_(rhs.start_),
+    index_(rhs.index_),
+    element_(rhs.element_),
+    lower_(rhs.lower_),
+    upper_(rhs.upper_),
+    info_(rhs.info_),
+    clock_(rhs.clock_),
+    policy_(rhs.policy_),
+    maximumCuts_(rhs.maximumCuts_),
+    maximumAge_(rhs.maximumAge_)
+{
+}
+
+//-------------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+OsiCutPool &
+OsiCutPool::operator=(const OsiCutPool & rhs)
+{
+  if (this != &rhs) {
+    start_ = rhs.start_;
+    index_ = rhs.index_;
+    element_ = rhs.element_;
+    lower_ = rhs.lower_;
+    upper_ = rhs.upper_;
+    info_ = rhs.info_;
+    clock_ = rhs.clock_;
+    policy_ = rhs.policy_;
+    maximumCuts_ = rhs.maximumCuts_;
+    maximumAge_ = rhs.maximumAge_;
+  }
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+OsiCutPool::~OsiCutPool ()
+{
+}
+
+int
+OsiCutPool::insert(int numberElements, const int * columns,
+		   const double * elements, double lb, double ub,
+		   double efficacy, int generator)
+{
+  index_.insert(index_.end(),columns,columns+numberElements);
+  element_.insert(element_.end(),elements,elements+numberElements);
+  start_.push_back(start_.back()+numberElements);
+  lower_.push_back(lb);
+  upper_.push_back(ub);
+  CutInfo info;
+  info.efficacy = efficacy;
+  info.age = 0;
+  info.activity = 0;
+  info.generator = generator;
+  info.lastUsed = ++clock_;
+  info_.push_back(info);
+  return numberCuts()-1;
+}
+
+int
+OsiCutPool::insert(const OsiRowCut & cut, int generator)
+{
+  const CoinPackedVector & row = cut.row();
+  return insert(row.getNumElements(),row.getIndices(),row.getElements(),
+		cut.lb(),cut.ub(),cut.effectiveness(),generator);
+}
+
+void
+OsiCutPool::insert(const OsiCuts & cuts, int generator)
+{
+  const int numberRowCuts = cuts.sizeRowCuts();
+  int numberElements = 0;
+  for (int i = 0; i < numberRowCuts; i++)
+    numberElements += cuts.rowCutPtr(i)->row().getNumElements();
+  index_.reserve(index_.size()+numberElements);
+  element_.reserve(element_.size()+numberElements);
+  start_.reserve(start_.size()+numberRowCuts);
+  lower_.reserve(lower_.size()+numberRowCuts);
+  upper_.reserve(upper_.size()+numberRowCuts);
+  info_.reserve(info_.size()+numberRowCuts);
+  for (int i = 0; i < numberRowCuts; i++)
+    insert(*cuts.rowCutPtr(i),generator);
+}
+
+void
+OsiCutPool::remove(int numberRemove, const int * which)
+{
+  const int numberCuts = this->numberCuts();
+  std::vector<char> drop(numberCuts,0);
+  for (int k = 0; k < numberRemove; k++)
+    drop[which[k]] = 1;
+  // squeeze arena and cut data down in place
+  int put = 0;
+  int putElement = 0;
+  for (int i = 0; i < numberCuts; i++) {
+    const int start = start_[i];
+    const int end = start_[i+1];
+    if (drop[i])
+      continue;
+    if (putElement != start) {
+      std::copy(index_.begin()+start,index_.begin()+end,
+		index_.begin()+putElement);
+      std::copy(element_.begin()+start,element_.begin()+end,
+		element_.begin()+putElement);
+    }
+    lower_[put] = lower_[i];
+    upper_[put] = upper_[i];
+    info_[put] = info_[i];
+    start_[put] = putElement;
+    putElement += end-start;
+    put++;
+  }
+  start_[put] = putElement;
+  start_.resize(put+1);
+  lower_.resize(put);
+  upper_.resize(put);
+  info_.resize(put);
+  index_.resize(putElement);
+  element_.resize(putElement);
+}
+
+void
+OsiCutPool::clear()
+{
+  start_.resize(1);
+  index_.clear();
+  element_.clear();
+  lower_.clear();
+  upper_.clear();
+  info_.clear();
+}
+
+int
+OsiCutPool::evict()
+{
+  const int numberCuts = this->numberCuts();
+  std::vector<int> which;
+  // (primary key,secondary key),index - smallest go first
+  std::vector<std::pair<std::pair<double,int>,int> > candidates;
+  candidates.reserve(numberCuts);
+  for (int i = 0; i < numberCuts; i++) {
+    const CutInfo & info = info_[i];
+    if (info.age > maximumAge_) {
+      which.push_back(i);
+    } else if (policy_ == evictLeastRecentlyUsed) {
+      candidates.push_back(std::make_pair(
+	std::make_pair(static_cast<double>(info.lastUsed),0),i));
+    } else {
+      candidates.push_back(std::make_pair(
+	std::make_pair(-static_cast<double>(info.age),info.activity),i));
+    }
+  }
+  const int numberOver = static_cast<int>(candidates.size())-maximumCuts_;
+  if (numberOver > 0) {
+    std::nth_element(candidates.begin(),candidates.begin()+(numberOver-1),
+		     candidates.end());
+    for (int k = 0; k < numberOver; k++)
+      which.push_back(candidates[k].second);
+  }
+  const int numberRemove = static_cast<int>(which.size());
+  if (numberRemove)
+    remove(numberRemove,&which[0]);
+  return numberRemove;
+}
+
+void
+OsiCutPool::ageCuts()
+{
+  const int numberCuts = this->numberCuts();
+  for (int i = 0; i < numberCuts; i++)
+    info_[i].age++;
+}
+
+void
+OsiCutPool::markActive(int i)
+{
+  CutInfo & info = info_[i];
+  info.age = 0;
+  info.activity++;
+  info.lastUsed = ++clock_;
+}
+
+int
+OsiCutPool::selectViolated(const double * solution, double minimumEfficacy,
+			   int maximumCuts, int * which)
+{
+  const int numberCuts = this->numberCuts();
+  std::vector<double> sortKey;
+  std::vector<int> sortIndex;
+  for (int i = 0; i < numberCuts; i++) {
+    double sum = 0.0;
+    double norm = 0.0;
+    for (int j = start_[i]; j < start_[i+1]; j++) {
+      const double value = element_[j];
+      sum += value*solution[index_[j]];
+      norm += value*value;
+    }
+    CutInfo & info = info_[i];
+    const double violation = CoinMax(lower_[i]-sum,sum-upper_[i]);
+    info.efficacy = (violation > 0.0 && norm > 0.0) ?
+      violation/sqrt(norm) : 0.0;
+    if (info.efficacy > 0.0 && info.efficacy >= minimumEfficacy) {
+      sortKey.push_back(-info.efficacy);
+      sortIndex.push_back(i);
+    }
+  }
+  int numberSelected = CoinMin(maximumCuts,static_cast<int>(sortKey.size()));
+  if (numberSelected > 0) {
+    CoinSort_2(&sortKey[0],&sortKey[0]+sortKey.size(),&sortIndex[0]);
+    for (int k = 0; k < numberSelected; k++) {
+      which[k] = sortIndex[k];
+      info_[sortIndex[k]].lastUsed = ++clock_;
+    }
+  } else {
+    numberSelected = 0;
+  }
+  return numberSelected;
+}
+
+OsiRowCut
+OsiCutPool::rowCut(int i) const
+{
+  OsiRowCut cut;
+  const int start = start_[i];
+  cut.setRow(length(i),indices()+start,elements()+start,false);
+  cut.setLb(lower_[i]);
+  cut.setUb(upper_[i]);
+  cut.setEffectiveness(info_[i].efficacy);
+  return cut;
+}
+
+size_t
+OsiCutPool::memoryUsed() const
+{
+  return start_.capacity()*sizeof(int)+index_.capacity()*sizeof(int)+
+    (element_.capacity()+lower_.capacity()+upper_.capacity())*sizeof(double)+
+    info_.capacity()*sizeof(CutInfo);
+}
+
+double
+OsiCutPool::bytesPerCut() const
+{
+  const int numberCuts = this->numberCuts();
+  return numberCuts ?
+    static_cast<double>(memoryUsed())/static_cast<double>(numberCuts) : 0.0;
+}
+
+void
+OsiCutPool::shrink()
+{
+  std::vector<int>(start_).swap(start_);
+  std::vector<int>(index_).swap(index_);
+  std::vector<double>(element_).swap(element_);
+  std::vector<double>(lower_).swap(lower_);
+  std::vector<double>(upper_).swap(upper_);
+  std::vector<CutInfo>(info_).swap(info_);
+}
@@ -0,0 +1,207 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiCutPool_H
+#define OsiCutPool_H
+
+#include <cstddef>
+#include <vector>
+
+class OsiCuts;
+class OsiRowCut;
+
+//#############################################################################
+/** A pool of row cuts for long branch-and-cut runs
+
+    OsiCuts holds each cut as its own OsiRowCut with its own packed vector.
+    A pool keeps all coefficients in one arena in row ordered (CSR) form,
+    so a cut costs its elements plus a few words of bookkeeping, and a
+    selection of cuts can be handed to
+    OsiSolverInterface::applyCutPool()
+    without copying coefficients.
+
+    Each cut carries
+    <ul>
+    <li> age: rounds since it was last active (see ageCuts() and
+	 markActive())
+    <li> activity: number of times it has been marked active
+    <li> efficacy: violation divided by the norm of the cut at the last
+	 selectViolated(), or as given on insert
+    <li> generator: an id chosen by the caller, e.g. the index of the cut
+	 generator which found it
+    </ul>
+
+    Cuts are numbered 0 to numberCuts()-1 in order of insertion.  Removing
+    cuts (remove(), evict(), clear()) renumbers the ones that are left, so
+    indices held by the caller are only good until the next removal.
+
+    evict() throws out cuts older than the maximum age and then, if there
+    are still more than the maximum number of cuts, the least recently
+    used or the oldest, depending on the policy.  The pool never evicts on
+    its own.
+*/
+class OsiCutPool {
+
+public:
+  /// Which cuts go first when the pool is over its maximum size
+  enum EvictionPolicy {
+    /// Cuts least recently inserted, selected or marked active
+    evictLeastRecentlyUsed = 0,
+    /// Cuts with the largest age, fewest activations breaking ties
+    evictOldest
+  };
+
+  /**@name Constructors and destructor */
+  //@{
+  /// Default Constructor
+  OsiCutPool ();
+
+  /// Copy constructor
+  OsiCutPool (const OsiCutPool &);
+
+  /// Assignment operator
+  OsiCutPool & operator=(const OsiCutPool & rhs);
+
+  /// Destructor
+  ~OsiCutPool ();
+  //@}
+
+  /**@name Adding and removing cuts */
+  //@{
+  /** Add a cut and return its index.
+      Duplicate columns are not checked for. */
+  int insert(int numberElements, const int * columns, const double * elements,
+	     double lb, double ub, double efficacy = 0.0, int generator = -1);
+  /// Add a row cut, taking its effectiveness as efficacy
+  int insert(const OsiRowCut & cut, int generator = -1);
+  /// Add all the row cuts of a collection
+  void insert(const OsiCuts & cuts, int generator = -1);
+  /// Remove cuts (which need not be sorted) and renumber the rest
+  void remove(int numberRemove, const int * which);
+  /// Remove all cuts
+  void clear();
+  /** Remove cuts by policy (see class description).
+      Returns number removed. */
+  int evict();
+  //@}
+
+  /**@name Aging and selection */
+  //@{
+  /// Start a new round: every cut gets one older
+  void ageCuts();
+  /// Cut was useful (e.g. binding at the LP optimum)
+  void markActive(int i);
+  /** Compute efficacy of every cut at solution and put the indices of the
+      most effective, at least minimumEfficacy and at most maximumCuts of
+      them, in which in order of decreasing efficacy.  Selected cuts count
+      as used for the least recently used policy.
+      Returns number selected. */
+  int selectViolated(const double * solution, double minimumEfficacy,
+		     int maximumCuts, int * which);
+  //@}
+
+  /**@name Eviction parameters */
+  //@{
+  inline EvictionPolicy evictionPolicy() const
+  { return policy_;}
+  inline void setEvictionPolicy(EvictionPolicy value)
+  { policy_ = value;}
+  /// Cuts kept by evict() (default no limit)
+  inline int maximumCuts() const
+  { return maximumCuts_;}
+  inline void setMaximumCuts(int value)
+  { maximumCuts_ = value;}
+  /// Cuts older than this are evicted (default no limit)
+  inline int maximumAge() const
+  { return maximumAge_;}
+  inline void setMaximumAge(int value)
+  { maximumAge_ = value;}
+  //@}
+
+  /**@name Cut data */
+  //@{
+  /// Number of cuts
+  inline int numberCuts() const
+  { return static_cast<int>(info_.size());}
+  /// Number of elements in all cuts
+  inline int numberElements() const
+  { return start_.back();}
+  /// Start of each cut in indices() and elements(), numberCuts()+1 entries
+  inline const int * starts() const
+  { return &start_[0];}
+  /// Column indices of all cuts
+  inline const int * indices() const
+  { return index_.empty() ? NULL : &index_[0];}
+  /// Coefficients of all cuts
+  inline const double * elements() const
+  { return element_.empty() ? NULL : &element_[0];}
+  /// Number of elements in cut i
+  inline int length(int i) const
+  { return start_[i+1]-start_[i];}
+  /// Lower bounds of all cuts
+  inline const double * lowerBounds() const
+  { return lower_.empty() ? NULL : &lower_[0];}
+  /// Upper bounds of all cuts
+  inline const double * upperBounds() const
+  { return upper_.empty() ? NULL : &upper_[0];}
+  inline double lb(int i) const
+  { return lower_[i];}
+  inline double ub(int i) const
+  { return upper_[i];}
+  inline double efficacy(int i) const
+  { return info_[i].efficacy;}
+  inline int age(int i) const
+  { return info_[i].age;}
+  inline int activity(int i) const
+  { return info_[i].activity;}
+  inline int generator(int i) const
+  { return info_[i].generator;}
+  /// Cut i as an OsiRowCut
+  OsiRowCut rowCut(int i) const;
+  //@}
+
+  /**@name Memory */
+  //@{
+  /// Bytes allocated by the pool
+  size_t memoryUsed() const;
+  /// Bytes allocated per cut (0 if empty)
+  double bytesPerCut() const;
+  /// Give back memory not needed for the current cuts
+  void shrink();
+  //@}
+
+private:
+  /// Per cut data
+  struct CutInfo {
+    double efficacy;
+    int age;
+    int activity;
+    int generator;
+    /// Value of clock_ when last used
+    unsigned int lastUsed;
+  };
+
+  /// Starts in arena, numberCuts()+1 entries
+  std::vector<int> start_;
+  /// Column indices of all cuts
+  std::vector<int> index_;
+  /// Coefficients of all cuts
+  std::vector<double> element_;
+  /// Lower bounds
+  std::vector<double> lower_;
+  /// Upper bounds
+  std::vector<double> upper_;
+  /// Per cut data
+  std::vector<CutInfo> info_;
+  /// Counts uses for least recently used
+  unsigned int clock_;
+  /// Eviction policy
+  EvictionPolicy policy_;
+  /// Maximum number of cuts kept by evict()
+  int maximumCuts_;
+  /// Maximum age kept by evict()
+  int maximumAge_;
+};
+
+#endif
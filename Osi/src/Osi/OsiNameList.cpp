@@ -0,0 +1,161 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include <cstring>
+
+#include "OsiNameList.hpp"
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+OsiNameList::OsiNameList ()
+  : garbage_(0),
+    changes_(0)
+{}
+
+int
+OsiNameList::numberNames() const
+{
+  int n = 0;
+  for (int i = 0; i < size(); i++) {
+    if (start_[i] >= 0)
+      n++;
+  }
+  return n;
+}
+
+void
+OsiNameList::set(int ndx, const std::string & name)
+{
+  if (ndx < 0)
+    return;
+  changes_++;
+  if (ndx >= size())
+    resize(ndx+1);
+  discard(ndx);
+  start_[ndx] = -1;
+  if (name.length()) {
+    start_[ndx] = static_cast<int>(text_.size());
+    text_.insert(text_.end(), name.begin(), name.end());
+    text_.push_back('\0');
+  }
+  compactIfWorthIt();
+}
+
+void
+OsiNameList::set(int ndx, const char * name)
+{
+  if (ndx < 0)
+    return;
+  if (name && !text_.empty() && name >= &text_[0] &&
+      name < &text_[0]+text_.size()) {
+    // one of our own names, which may move
+    set(ndx, std::string(name));
+    return;
+  }
+  changes_++;
+  if (ndx >= size())
+    resize(ndx+1);
+  discard(ndx);
+  start_[ndx] = -1;
+  if (name && name[0]) {
+    const int length = static_cast<int>(strlen(name))+1;
+    start_[ndx] = static_cast<int>(text_.size());
+    text_.insert(text_.end(), name, name+length);
+  }
+  compactIfWorthIt();
+}
+
+void
+OsiNameList::resize(int n)
+{
+  if (n < 0)
+    n = 0;
+  changes_++;
+  for (int i = n; i < size(); i++)
+    discard(i);
+  start_.resize(n, -1);
+  compactIfWorthIt();
+}
+
+void
+OsiNameList::erase(int first, int len)
+{
+  if (first < 0 || first >= size() || len <= 0)
+    return;
+  if (first+len > size())
+    len = size()-first;
+  changes_++;
+  for (int i = first; i < first+len; i++)
+    discard(i);
+  start_.erase(start_.begin()+first, start_.begin()+first+len);
+  compactIfWorthIt();
+}
+
+void
+OsiNameList::erase(int num, const int * which)
+{
+  const int n = size();
+  std::vector<char> deleted(n, 0);
+  int numberDeleted = 0;
+  for (int k = 0; k < num; k++) {
+    const int i = which[k];
+    if (i >= 0 && i < n && !deleted[i]) {
+      deleted[i] = 1;
+      discard(i);
+      numberDeleted++;
+    }
+  }
+  if (!numberDeleted)
+    return;
+  changes_++;
+  int put = 0;
+  for (int i = 0; i < n; i++) {
+    if (!deleted[i])
+      start_[put++] = start_[i];
+  }
+  start_.resize(put);
+  compactIfWorthIt();
+}
+
+void
+OsiNameList::clear()
+{
+  std::vector<int>().swap(start_);
+  std::vector<char>().swap(text_);
+  garbage_ = 0;
+  changes_++;
+}
+
+void
+OsiNameList::discard(int ndx)
+{
+  if (start_[ndx] >= 0)
+    garbage_ += static_cast<int>(strlen(&text_[start_[ndx]]))+1;
+}
+
+void
+OsiNameList::compactIfWorthIt()
+{
+  const int used = static_cast<int>(text_.size());
+  if (garbage_ < 4096 || 2*garbage_ < used)
+    return;
+  // Names are in order of setting, not of index, so copy each one live
+  std::vector<char> text;
+  text.reserve(used-garbage_);
+  for (int i = 0; i < size(); i++) {
+    if (start_[i] >= 0) {
+      const char * name = &text_[start_[i]];
+      start_[i] = static_cast<int>(text.size());
+      text.insert(text.end(), name, name+strlen(name)+1);
+    }
+  }
+  text_.swap(text);
+  garbage_ = 0;
+}
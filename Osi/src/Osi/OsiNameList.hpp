@@ -0,0 +1,89 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiNameList_H
+#define OsiNameList_H
+
+#include <string>
+#include <vector>
+
+//#############################################################################
+/** Row or column names supplied by the client
+
+    OsiSolverInterface used to keep names as a vector of std::string, with
+    generated default names (R0000123) filling the holes once a full vector
+    had been asked for.  On large models that is one string object, often
+    with its own allocation, per row and column.  This list keeps only the
+    names the client supplied, copied one after another into one block of
+    text, with the offset of each name in an int vector.  An entry with no
+    name (or an empty one) has no text at all; the default name for it is
+    generated when someone asks.
+
+    Deleting entries moves only the offsets.  The text of deleted and
+    replaced names is reclaimed when it is more than half of the block.
+*/
+class OsiNameList {
+
+public:
+  /**@name Querying */
+  //@{
+  /// Number of entries (one past the last name set, holes included)
+  inline int size() const
+  { return static_cast<int>(start_.size());}
+  /// Name of entry ndx, or NULL if it has none (or ndx is out of range)
+  inline const char * name(int ndx) const
+  {
+    return (ndx >= 0 && ndx < size() && start_[ndx] >= 0) ?
+      &text_[start_[ndx]] : NULL;
+  }
+  /// Number of entries which have a name
+  int numberNames() const;
+  /** Count of changes so far, so that something built from the list can
+      tell when it is out of date */
+  inline int changes() const
+  { return changes_;}
+  //@}
+
+  /**@name Changing */
+  //@{
+  /** Set name of entry ndx, growing the list if needed.  An empty name
+      leaves the entry without one. */
+  void set(int ndx, const std::string & name);
+  /** Set name of entry ndx from a C string (which may be NULL). */
+  void set(int ndx, const char * name);
+  /// Truncate or extend (with entries without names) to n entries
+  void resize(int n);
+  /** Delete len entries starting at first; later entries move down.
+      Entries past the end are ignored. */
+  void erase(int first, int len);
+  /** Delete the entries in which (any order, duplicates allowed) in one
+      pass; later entries move down.  Entries past the end are ignored. */
+  void erase(int num, const int * which);
+  /// Delete everything and give back the space
+  void clear();
+  //@}
+
+  /**@name Constructors and destructor */
+  //@{
+  /// Default Constructor
+  OsiNameList ();
+  //@}
+
+private:
+  /// Text of deleted entry ndx is no longer needed
+  void discard(int ndx);
+  /// Close up the text if enough of it is no longer needed
+  void compactIfWorthIt();
+
+  /// Offset of each name in text_, -1 if none
+  std::vector<int> start_;
+  /// Names, each followed by '\0'
+  std::vector<char> text_;
+  /// Bytes of text_ no longer used
+  int garbage_;
+  /// Count of changes
+  int changes_;
+};
+
+#endif
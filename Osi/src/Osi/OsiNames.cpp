@@ -6,10 +6,12 @@
 #  pragma warning(disable:4786)
 #endif
 
+#include <cstdio>
 #include <sstream>
 #include <iomanip>
 
 #include "OsiSolverInterface.hpp"
+#include "CoinHelperFunctions.hpp"
 #include "CoinLpIO.hpp"
 #include "CoinMpsIO.hpp"
 #include "CoinModel.hpp"
@@ -24,10 +26,10 @@
     1: Lazy names: Name information supplied by the client is retained.
        rowNames_ and colNames_ are sized to be large enough to hold names
        supplied by the client, and no larger. If the client has left holes,
-       those entries will contain a null string. Requests for individual names
-       will return the name supplied by the client, or a generated name.
-       Requests for a vector of names will return a reference to rowNames_ or
-       colNames_, with no modification.
+       those entries have no name. Requests for individual names will return
+       the name supplied by the client, or a generated name. Requests for a
+       vector of names will return a vector (rowNameVec_ or colNameVec_)
+       copied from rowNames_ or colNames_, with null strings in the holes.
 
        This mode is intended for applications like branch-and-cut, where the
        client is only interested in the original constraint system and could
@@ -41,8 +43,9 @@
        is always sized to match the constraint system and all entries have
        names (either supplied or generated). Internally, full names looks just
        like lazy names, with the exception that if the client requests one of
-       the name vectors, we generate the full version on the spot and keep it
-       around for further use.
+       the name vectors, we generate the full version on the spot. Generated
+       names are never stored in rowNames_ or colNames_, so a model with
+       default names costs nothing until someone asks for them.
 
        This approach sidesteps some ugly implementation issues. The base
        routines to add a row or column, or load a problem from matrices, are
@@ -88,39 +91,6 @@ std::string invRowColName (char rcd, int ndx)
 
   return (buildName.str()) ; }
 
-/*
-  Adjust the allocated capacity of the name vectors, if they're sufficiently
-  far off (more than 1000 elements). Use this routine only if you don't need
-  the current contents of the vectors. The `assignment & swap' bit is a trick
-  lifted from Stroustrop 16.3.8 to make sure we really give back some space.
-*/
-void reallocRowColNames (OsiSolverInterface::OsiNameVec &rowNames, int m,
-			 OsiSolverInterface::OsiNameVec &colNames, int n)
-
-{ int rowCap = static_cast<int>(rowNames.capacity()) ;
-  int colCap = static_cast<int>(colNames.capacity()) ;
-
-  if (rowCap-m > 1000)
-  { rowNames.resize(m) ;
-    OsiSolverInterface::OsiNameVec tmp = rowNames ;
-    rowNames.swap(tmp) ; }
-  else
-  if (rowCap < m)
-  { rowNames.reserve(m) ; }
-  assert(rowNames.capacity() >= static_cast<unsigned>(m)) ;
-
-  if (colCap-n > 1000)
-  { colNames.resize(n) ;
-    OsiSolverInterface::OsiNameVec tmp = colNames ;
-    colNames.swap(tmp) ; }
-  else
-  if (colCap < n)
-  { colNames.reserve(n) ; }
-  assert(colNames.capacity() >= static_cast<unsigned>(n)) ;
-
-  return ; }
-
-
 /*
   It's handy to have a 0-length name vector hanging around to use as a return
   value when the name discipline = auto. Then we don't have to worry
@@ -156,6 +126,14 @@ OsiSolverInterface::dfltRowColName (char rc, int ndx, unsigned digits) const
   
   if (digits <= 0)
   { digits = 7 ; }
+/*
+  Default names are generated every time one is asked for, so avoid the
+  stream for the usual widths.
+*/
+  if (rc != 'o' && digits <= 20)
+  { char name[32] ;
+    sprintf(name,"%c%0*d",(rc == 'r')?'R':'C',static_cast<int>(digits),ndx) ;
+    return std::string(name) ; }
 
   if (rc == 'o')
   { std::string dfltObjName = "OBJECTIVE" ;
@@ -220,10 +198,10 @@ std::string OsiSolverInterface::getRowName (int ndx, unsigned maxLen) const
       break ; }
     case 1:
     case 2:
-    { name = "" ;
-      if (static_cast<unsigned>(ndx) < rowNames_.size())
-	name = rowNames_[ndx] ;
-      if (name.length() == 0)
+    { const char *supplied = rowNames_.name(ndx) ;
+      if (supplied)
+	name = supplied ;
+      else
 	name = dfltRowColName('r',ndx) ;
       break ; }
     default:
@@ -240,9 +218,8 @@ std::string OsiSolverInterface::getRowName (int ndx, unsigned maxLen) const
   Return the vector of row names. The vector we need depends on the name
   discipline:
     0: return a vector of length 0
-    1: return rowNames_, no tweaking required
-    2: Check that rowNames_ is complete. Generate a complete vector on
-       the spot if we need it.
+    1: return a copy of rowNames_, null strings in the holes
+    2: return a complete vector, generating names for the holes
 */
 const OsiSolverInterface::OsiNameVec &OsiSolverInterface::getRowNames ()
 
@@ -256,25 +233,51 @@ const OsiSolverInterface::OsiNameVec &OsiSolverInterface::getRowNames ()
   if (recognisesOsiNames == false)
   { nameDiscipline = 0 ; }
 /*
-  Return the proper vector, as described at the head of the routine. If we
-  need to generate a full vector, resize the existing vector and scan, filling
-  in entries as required.
+  Return the proper vector, as described at the head of the routine. The
+  vector is rebuilt only when the names or the number of rows have changed
+  since it was last built. Only the objective name is refreshed otherwise,
+  as setObjName doesn't touch rowNames_.
 */
   switch (nameDiscipline)
   { case 0:
     { return (zeroLengthNameVec) ; }
     case 1:
-    { return (rowNames_) ; }
+    { if (rowNameVecChanges_ == rowNames_.changes() && rowNameVecRows_ == -1)
+      { return (rowNameVec_) ; }
+      int size = rowNames_.size() ;
+      rowNameVec_.resize(size) ;
+      for (int i = 0 ; i < size ; i++)
+      { const char *supplied = rowNames_.name(i) ;
+	if (supplied)
+	{ rowNameVec_[i] = supplied ; }
+	else
+	{ rowNameVec_[i].clear() ; } }
+      rowNameVecChanges_ = rowNames_.changes() ;
+      rowNameVecRows_ = -1 ;
+      return (rowNameVec_) ; }
     case 2:
     { int m = getNumRows() ;
-      if (rowNames_.size() < static_cast<unsigned>(m+1))
-      { rowNames_.resize(m+1) ; }
-      for (int i = 0 ; i < m ; i++)
-      { if (rowNames_[i].length() == 0)
-	{ rowNames_[i] = dfltRowColName('r',i) ; } }
-      if (rowNames_[m].length() == 0)
-      { rowNames_[m] = getObjName() ; }
-      return (rowNames_) ; }
+      if (rowNameVecChanges_ == rowNames_.changes() && rowNameVecRows_ == m)
+      { if (!rowNames_.name(m))
+	{ rowNameVec_[m] = getObjName() ; }
+	return (rowNameVec_) ; }
+      int size = CoinMax(rowNames_.size(),m+1) ;
+      rowNameVec_.resize(size) ;
+      for (int i = 0 ; i < size ; i++)
+      { const char *supplied = rowNames_.name(i) ;
+	if (supplied)
+	{ rowNameVec_[i] = supplied ; }
+	else
+	if (i < m)
+	{ rowNameVec_[i] = dfltRowColName('r',i) ; }
+	else
+	if (i == m)
+	{ rowNameVec_[i] = getObjName() ; }
+	else
+	{ rowNameVec_[i].clear() ; } }
+      rowNameVecChanges_ = rowNames_.changes() ;
+      rowNameVecRows_ = m ;
+      return (rowNameVec_) ; }
     default:
     { /* quietly fail */
       return (zeroLengthNameVec) ; } }
@@ -318,10 +321,10 @@ std::string OsiSolverInterface::getColName (int ndx, unsigned maxLen) const
       break ; }
     case 1:
     case 2:
-    { name = "" ;
-      if (static_cast<unsigned>(ndx) < colNames_.size())
-	name = colNames_[ndx] ;
-      if (name.length() == 0)
+    { const char *supplied = colNames_.name(ndx) ;
+      if (supplied)
+	name = supplied ;
+      else
 	name = dfltRowColName('c',ndx) ;
       break ; }
     default:
@@ -338,9 +341,8 @@ std::string OsiSolverInterface::getColName (int ndx, unsigned maxLen) const
   Return the vector of column names. The vector we need depends on the name
   discipline:
     0: return a vector of length 0
-    1: return colNames_, no tweaking required
-    2: Check that colNames_ is complete. Generate a complete vector on
-       the spot if we need it.
+    1: return a copy of colNames_, null strings in the holes
+    2: return a complete vector, generating names for the holes
 */
 const OsiSolverInterface::OsiNameVec &OsiSolverInterface::getColNames ()
 
@@ -354,23 +356,32 @@ const OsiSolverInterface::OsiNameVec &OsiSolverInterface::getColNames ()
   if (recognisesOsiNames == false)
   { nameDiscipline = 0 ; }
 /*
-  Return the proper vector, as described at the head of the routine. If we
-  need to generate a full vector, resize the existing vector and scan, filling
-  in entries as required.
+  Return the proper vector, as described at the head of the routine. The
+  vector is rebuilt only when the names or the number of columns have
+  changed since it was last built.
 */
   switch (nameDiscipline)
   { case 0:
     { return (zeroLengthNameVec) ; }
     case 1:
-    { return (colNames_) ; }
     case 2:
-    { int n = getNumCols() ;
-      if (colNames_.size() < static_cast<unsigned>(n))
-      { colNames_.resize(n) ; }
-      for (int j = 0 ; j < n ; j++)
-      { if (colNames_[j].length() == 0)
-	{ colNames_[j] = dfltRowColName('c',j) ; } }
-      return (colNames_) ; }
+    { int n = (nameDiscipline == 2) ? getNumCols() : -1 ;
+      if (colNameVecChanges_ == colNames_.changes() && colNameVecColumns_ == n)
+      { return (colNameVec_) ; }
+      colNameVecChanges_ = colNames_.changes() ;
+      colNameVecColumns_ = n ;
+      int size = CoinMax(colNames_.size(),n) ;
+      colNameVec_.resize(size) ;
+      for (int j = 0 ; j < size ; j++)
+      { const char *supplied = colNames_.name(j) ;
+	if (supplied)
+	{ colNameVec_[j] = supplied ; }
+	else
+	if (j < n)
+	{ colNameVec_[j] = dfltRowColName('c',j) ; }
+	else
+	{ colNameVec_[j].clear() ; } }
+      return (colNameVec_) ; }
     default:
     { /* quietly fail */
       return (zeroLengthNameVec) ; } }
@@ -412,12 +423,7 @@ void OsiSolverInterface::setRowName (int ndx, std::string name)
     { break ; }
     case 1:
     case 2:
-    { if (static_cast<unsigned>(ndx) > rowNames_.capacity())
-      { rowNames_.resize(ndx+1) ; }
-      else
-      if (static_cast<unsigned>(ndx) >= rowNames_.size())
-      { rowNames_.resize(ndx+1) ; }
-      rowNames_[ndx] = name ;
+    { rowNames_.set(ndx,name) ;
       break ; }
     default:
     { break ; } }
@@ -501,12 +507,29 @@ void OsiSolverInterface::deleteRowNames (int tgtStart, int len)
   if (tgtStart+len > lastNdx)
   { len = lastNdx-tgtStart ; }
 /*
-  Erase the names.
+  Erase the names. Only the offsets move; the text stays where it is.
+*/
+  rowNames_.erase(tgtStart,len) ;
+
+  return ; }
+
+/*
+  Delete the names of a set of rows, as given to deleteRows.
 */
-  OsiNameVec::iterator firstIter,lastIter ;
-  firstIter = rowNames_.begin()+tgtStart ;
-  lastIter = firstIter+len ;
-  rowNames_.erase(firstIter,lastIter) ;
+void OsiSolverInterface::deleteRowNames (int num, const int *indices)
+
+{ int nameDiscipline ;
+
+  bool recognisesOsiNames = getIntParam(OsiNameDiscipline,nameDiscipline) ;
+  if (recognisesOsiNames == false)
+  { nameDiscipline = 0 ; }
+  if (nameDiscipline == 0)
+  { return ; }
+/*
+  Indices past the last name are ignored, so with lazy names there is
+  usually little to do.
+*/
+  rowNames_.erase(num,indices) ;
 
   return ; }
   
@@ -541,12 +564,7 @@ void OsiSolverInterface::setColName (int ndx, std::string name)
     { break ; }
     case 1:
     case 2:
-    { if (static_cast<unsigned>(ndx) > colNames_.capacity())
-      { colNames_.resize(ndx+1) ; }
-      else
-      if (static_cast<unsigned>(ndx) >= colNames_.size())
-      { colNames_.resize(ndx+1) ; }
-      colNames_[ndx] = name ;
+    { colNames_.set(ndx,name) ;
       break ; }
     default:
     { break ; } }
@@ -632,12 +650,29 @@ void OsiSolverInterface::deleteColNames (int tgtStart, int len)
   if (tgtStart+len > lastNdx)
   { len = lastNdx-tgtStart ; }
 /*
-  Erase the names.
+  Erase the names. Only the offsets move; the text stays where it is.
+*/
+  colNames_.erase(tgtStart,len) ;
+
+  return ; }
+
+/*
+  Delete the names of a set of columns, as given to deleteCols.
+*/
+void OsiSolverInterface::deleteColNames (int num, const int *indices)
+
+{ int nameDiscipline ;
+
+  bool recognisesOsiNames = getIntParam(OsiNameDiscipline,nameDiscipline) ;
+  if (recognisesOsiNames == false)
+  { nameDiscipline = 0 ; }
+  if (nameDiscipline == 0)
+  { return ; }
+/*
+  Indices past the last name are ignored, so with lazy names there is
+  usually little to do.
 */
-  OsiNameVec::iterator firstIter,lastIter ;
-  firstIter = colNames_.begin()+tgtStart ;
-  lastIter = firstIter+len ;
-  colNames_.erase(firstIter,lastIter) ;
+  colNames_.erase(num,indices) ;
 
   return ; }
 
@@ -656,28 +691,24 @@ void OsiSolverInterface::setRowColNames (const CoinMpsIO &mps)
   if (recognisesOsiNames == false)
   { nameDiscipline = 0 ; }
 /*
-  Whatever happens, we're about to clean out the current name vectors. Decide
-  on an appropriate size and call reallocRowColNames to adjust capacity.
+  Whatever happens, we're about to clean out the current names.
 */
-  if (nameDiscipline == 0)
-  { m = 0 ;
-    n = 0 ; }
-  else
-  { m = mps.getNumRows() ;
-    n = mps.getNumCols() ; }
-  reallocRowColNames(rowNames_,m,colNames_,n) ;
+  rowNames_.clear() ;
+  colNames_.clear() ;
 /*
   If name discipline is auto, we're done already. Otherwise, load 'em
   up. If I understand MPS correctly, names are required.
 */
   if (nameDiscipline != 0)
-  { rowNames_.resize(m) ;
+  { m = mps.getNumRows() ;
+    n = mps.getNumCols() ;
+    rowNames_.resize(m) ;
     for (int i = 0 ; i < m ; i++)
-    { rowNames_[i] = mps.rowName(i) ; }
+    { rowNames_.set(i,mps.rowName(i)) ; }
     objName_ = mps.getObjectiveName() ;
     colNames_.resize(n) ;
     for (int j = 0 ; j < n ; j++)
-    { colNames_[j] = mps.columnName(j) ; } }
+    { colNames_.set(j,mps.columnName(j)) ; } }
 
   return ; }
 
@@ -699,45 +730,27 @@ void OsiSolverInterface::setRowColNames (CoinModel &mod)
   if (recognisesOsiNames == false)
   { nameDiscipline = 0 ; }
 /*
-  Whatever happens, we're about to clean out the current name vectors. Decide
-  on an appropriate size and call reallocRowColNames to adjust capacity.
+  Whatever happens, we're about to clean out the current names.
 */
-  if (nameDiscipline == 0)
-  { m = 0 ;
-    n = 0 ; }
-  else
-  { m = mod.rowNames()->numberItems() ;
-    n = mod.columnNames()->numberItems() ; }
-  reallocRowColNames(rowNames_,m,colNames_,n) ;
+  rowNames_.clear() ;
+  colNames_.clear() ;
 /*
   If name discipline is auto, we're done already. Otherwise, load 'em
   up. As best I can see, there's no guarantee that we'll have names for all
-  rows and columns, so we need to pay attention.
+  rows and columns, so we need to pay attention. Missing names are left as
+  holes; the default name is generated when asked for, even for full names.
 */
   if (nameDiscipline != 0)
-  { int maxRowNdx=-1, maxColNdx=-1 ;
+  { m = mod.rowNames()->numberItems() ;
+    n = mod.columnNames()->numberItems() ;
     const char *const *names = mod.rowNames()->names() ;
-    rowNames_.resize(m) ;
     for (int i = 0 ; i < m ; i++)
-    { std::string nme = names[i] ;
-      if (nme.length() == 0)
-      { if (nameDiscipline == 2)
-	{ nme = dfltRowColName('r',i) ; } }
-      if (nme.length() > 0)
-      { maxRowNdx = i ; }
-      rowNames_[i] = nme ; }
-    rowNames_.resize(maxRowNdx+1) ;
+    { if (names[i] && names[i][0])
+      { rowNames_.set(i,names[i]) ; } }
     names = mod.columnNames()->names() ;
-    colNames_.resize(n) ;
     for (int j = 0 ; j < n ; j++)
-    { std::string nme = names[j] ;
-      if (nme.length() == 0)
-      { if (nameDiscipline == 2)
-	{ nme = dfltRowColName('c',j) ; } }
-      if (nme.length() > 0)
-      { maxColNdx = j ; }
-      colNames_[j] = nme ; }
-    colNames_.resize(maxColNdx+1) ; }
+    { if (names[j] && names[j][0])
+      { colNames_.set(j,names[j]) ; } } }
 /*
   And we're done.
 */
@@ -761,48 +774,66 @@ void OsiSolverInterface::setRowColNames (CoinLpIO &mod)
   if (recognisesOsiNames == false)
   { nameDiscipline = 0 ; }
 /*
-  Whatever happens, we're about to clean out the current name vectors. Decide
-  on an appropriate size and call reallocRowColNames to adjust capacity.
+  Whatever happens, we're about to clean out the current names.
 */
-  if (nameDiscipline == 0)
-  { m = 0 ;
-    n = 0 ; }
-  else
-  { m = mod.getNumRows() ;
-    n = mod.getNumCols() ; }
-  reallocRowColNames(rowNames_,m,colNames_,n) ;
+  rowNames_.clear() ;
+  colNames_.clear() ;
 /*
   If name discipline is auto, we're done already. Otherwise, load 'em
   up. I have no idea whether we can guarantee valid names for all rows and
-  columns, so we need to pay attention.
+  columns, so we need to pay attention. Missing names are left as holes, as
+  above.
 */
   if (nameDiscipline != 0)
-  { int maxRowNdx=-1, maxColNdx=-1 ;
+  { m = mod.getNumRows() ;
+    n = mod.getNumCols() ;
     const char *const *names = mod.getRowNames() ;
-    rowNames_.resize(m) ;
     for (int i = 0 ; i < m ; i++)
-    { std::string nme = names[i] ;
-      if (nme.length() == 0)
-      { if (nameDiscipline == 2)
-	{ nme = dfltRowColName('r',i) ; } }
-      if (nme.length() > 0)
-      { maxRowNdx = i ; }
-      rowNames_[i] = nme ; }
-    rowNames_.resize(maxRowNdx+1) ;
+    { if (names[i] && names[i][0])
+      { rowNames_.set(i,names[i]) ; } }
     objName_ = mod.getObjName() ;
     names = mod.getColNames() ;
-    colNames_.resize(n) ;
     for (int j = 0 ; j < n ; j++)
-    { std::string nme = names[j] ;
-      if (nme.length() == 0)
-      { if (nameDiscipline == 2)
-	{ nme = dfltRowColName('c',j) ; } }
-      if (nme.length() > 0)
-      { maxColNdx = j ; }
-      colNames_[j] = nme ; }
-    colNames_.resize(maxColNdx+1) ; }
+    { if (names[j] && names[j][0])
+      { colNames_.set(j,names[j]) ; } } }
 /*
   And we're done.
 */
   return ; }
 
+
+/*
+  Pointers to all row or column names, for the writers. Supplied names are
+  used where they are; default names are generated one after another into
+  buffer. The buffer may move as it grows, so its entries are first recorded
+  as offsets (with NULL in names) and turned into pointers at the end.
+*/
+void OsiSolverInterface::getRowColNamePointers (char rc,
+					std::vector<const char *> &names,
+					std::vector<char> &buffer) const
+
+{ int nameDiscipline ;
+
+  bool recognisesOsiNames = getIntParam(OsiNameDiscipline,nameDiscipline) ;
+  if (recognisesOsiNames == false)
+  { nameDiscipline = 0 ; }
+
+  const OsiNameList &supplied = (rc == 'r') ? rowNames_ : colNames_ ;
+  int number = (rc == 'r') ? getNumRows() : getNumCols() ;
+  names.assign(number,static_cast<const char *>(NULL)) ;
+  buffer.clear() ;
+  std::vector<int> offset(number,-1) ;
+  for (int i = 0 ; i < number ; i++)
+  { const char *name = (nameDiscipline == 0) ? NULL : supplied.name(i) ;
+    if (name)
+    { names[i] = name ; }
+    else
+    { std::string dflt = dfltRowColName(rc,i) ;
+      offset[i] = static_cast<int>(buffer.size()) ;
+      buffer.insert(buffer.end(),dflt.begin(),dflt.end()) ;
+      buffer.push_back('\0') ; } }
+  for (int i = 0 ; i < number ; i++)
+  { if (offset[i] >= 0)
+    { names[i] = &buffer[offset[i]] ; } }
+
+  return ; }
@@ -0,0 +1,1077 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+#include <vector>
+
+#include "CoinPragma.hpp"
+#include "CoinUtilsConfig.h"
+#include "CoinError.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinWarmStart.hpp"
+#include "OsiColCut.hpp"
+#include "OsiRowCut.hpp"
+#include "OsiRacingSolverInterface.hpp"
+
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+#endif
+
+//#############################################################################
+// Threads
+//#############################################################################
+
+/* One solver and the thread, if any, solving with it.  Runners are
+   allocated one by one so their addresses stay put while threads use
+   them, even if solvers are added. */
+struct OsiRaceRunner {
+  OsiRaceState * state;
+  OsiSolverInterface * solver;
+  int index;
+  int type;
+  /// Number of the race it was last entered in
+  int race;
+  /// Thread started and not yet joined
+  bool running;
+  /// Solve finished (changed under the lock while running)
+  bool done;
+  /// Solve threw (set before done)
+  bool failed;
+  /// What it threw if that was a CoinError
+  CoinError * error;
+#ifdef COINUTILS_PTHREADS
+  pthread_t thread;
+#endif
+  OsiRaceRunner() : failed(false), error(NULL) {}
+  ~OsiRaceRunner() { delete error;}
+};
+
+struct OsiRaceState {
+  std::vector<OsiRaceRunner *> runners;
+  /// Runners in the order they finished (under the lock)
+  std::vector<int> finished;
+  /// Number of the current race
+  int race;
+#ifdef COINUTILS_PTHREADS
+  pthread_mutex_t mutex;
+  pthread_cond_t condition;
+#endif
+};
+
+namespace {
+
+// same as OsiRacingSolverInterface::RaceType, which is private
+enum { raceInitial = 0, raceResolve, raceBranchAndBound };
+
+void
+solveOne (OsiSolverInterface * solver, int type)
+{
+  switch (type) {
+  case raceInitial:
+    solver->initialSolve();
+    break;
+  case raceResolve:
+    solver->resolve();
+    break;
+  default:
+    solver->branchAndBound();
+    break;
+  }
+}
+
+inline bool
+isProven (const OsiSolverInterface * solver)
+{
+  return solver->isProvenOptimal() || solver->isProvenPrimalInfeasible() ||
+    solver->isProvenDualInfeasible();
+}
+
+#ifdef COINUTILS_PTHREADS
+/* Solve, keeping any exception in the runner; race() passes it on if no
+   entrant finishes normally */
+void
+runOne (OsiRaceRunner * runner)
+{
+  runner->failed = false;
+  delete runner->error;
+  runner->error = NULL;
+  try {
+    solveOne(runner->solver,runner->type);
+  } catch (CoinError & error) {
+    runner->failed = true;
+    runner->error = new CoinError(error);
+  } catch (...) {
+    runner->failed = true;
+  }
+}
+
+void *
+raceThread (void * arg)
+{
+  OsiRaceRunner * runner = static_cast<OsiRaceRunner *>(arg);
+  OsiRaceState * state = runner->state;
+  runOne(runner);
+  pthread_mutex_lock(&state->mutex);
+  runner->done = true;
+  state->finished.push_back(runner->index);
+  pthread_cond_broadcast(&state->condition);
+  pthread_mutex_unlock(&state->mutex);
+  return NULL;
+}
+#endif
+
+}
+
+//#############################################################################
+// Solvers
+//#############################################################################
+
+void
+OsiRacingSolverInterface::addSolver(OsiSolverInterface * solver)
+{
+  OsiRaceRunner * runner = new OsiRaceRunner;
+  runner->state = state_;
+  runner->solver = solver;
+  runner->index = numberSolvers();
+  runner->type = raceInitial;
+  runner->race = -1;
+  runner->running = false;
+  runner->done = true;
+  state_->runners.push_back(runner);
+  solvers_.push_back(solver);
+  outOfDate_.push_back(0);
+  if (runner->index > 0 &&
+      (leader()->getNumCols() > 0 || leader()->getNumRows() > 0))
+    syncSolver(runner->index);
+}
+
+bool
+OsiRacingSolverInterface::isRunning(int i) const
+{
+  OsiRaceRunner * runner = state_->runners[i];
+  if (!runner->running)
+    return false;
+#ifdef COINUTILS_PTHREADS
+  pthread_mutex_lock(&state_->mutex);
+  const bool done = runner->done;
+  pthread_mutex_unlock(&state_->mutex);
+  if (!done)
+    return true;
+  pthread_join(runner->thread,NULL);
+#endif
+  runner->running = false;
+  return false;
+}
+
+void
+OsiRacingSolverInterface::waitForAll()
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    OsiRaceRunner * runner = state_->runners[i];
+#ifdef COINUTILS_PTHREADS
+    if (runner->running)
+      pthread_join(runner->thread,NULL);
+#endif
+    runner->running = false;
+    runner->done = true;
+    if (outOfDate_[i])
+      syncSolver(i);
+  }
+}
+
+bool
+OsiRacingSolverInterface::available(int i)
+{
+  if (isRunning(i))
+    outOfDate_[i] = 1;
+  return !outOfDate_[i];
+}
+
+void
+OsiRacingSolverInterface::syncSolver(int i)
+{
+  assert (i != leader_ && !isRunning(i));
+  const OsiSolverInterface * from = leader();
+  OsiSolverInterface * to = solvers_[i];
+  const int numberColumns = from->getNumCols();
+  const int numberRows = from->getNumRows();
+  std::vector<double> work[4];
+  to->loadProblem(*from->getMatrixByCol(),
+		  bounds(i,from->getColLower(),numberColumns,work[0]),
+		  bounds(i,from->getColUpper(),numberColumns,work[1]),
+		  from->getObjCoefficients(),
+		  bounds(i,from->getRowLower(),numberRows,work[2]),
+		  bounds(i,from->getRowUpper(),numberRows,work[3]));
+  to->setObjSense(from->getObjSense());
+  std::vector<int> integers;
+  for (int j = 0; j < numberColumns; j++) {
+    if (!from->isContinuous(j))
+      integers.push_back(j);
+  }
+  if (!integers.empty())
+    to->setInteger(&integers[0],static_cast<int>(integers.size()));
+  // parameters changed here while it was running
+  for (int key = 0; key < OsiLastIntParam; key++) {
+    if (intParamSet_[key]) {
+      int value = 0;
+      if (OsiSolverInterface::getIntParam(static_cast<OsiIntParam>(key),value))
+	to->setIntParam(static_cast<OsiIntParam>(key),value);
+    }
+  }
+  for (int key = 0; key < OsiLastDblParam; key++) {
+    if (dblParamSet_[key]) {
+      double value = 0.0;
+      if (OsiSolverInterface::getDblParam(static_cast<OsiDblParam>(key),value))
+	to->setDblParam(static_cast<OsiDblParam>(key),value);
+    }
+  }
+  for (int key = 0; key < OsiLastStrParam; key++) {
+    if (strParamSet_[key]) {
+      std::string value;
+      if (OsiSolverInterface::getStrParam(static_cast<OsiStrParam>(key),value))
+	to->setStrParam(static_cast<OsiStrParam>(key),value);
+    }
+  }
+  outOfDate_[i] = 0;
+}
+
+double
+OsiRacingSolverInterface::bound(int i, double value) const
+{
+  const double infinity = getInfinity();
+  const double solverInfinity = solvers_[i]->getInfinity();
+  if (infinity == solverInfinity)
+    return value;
+  if (value >= infinity)
+    return solverInfinity;
+  else if (value <= -infinity)
+    return -solverInfinity;
+  else
+    return value;
+}
+
+const double *
+OsiRacingSolverInterface::bounds(int i, const double * values, int n,
+				 std::vector<double> & work) const
+{
+  if (!values || getInfinity() == solvers_[i]->getInfinity())
+    return values;
+  work.resize(n);
+  for (int j = 0; j < n; j++)
+    work[j] = bound(i,values[j]);
+  return n ? &work[0] : values;
+}
+
+//#############################################################################
+// Solve methods
+//#############################################################################
+
+void
+OsiRacingSolverInterface::race(RaceType type)
+{
+  const int numberSolvers = this->numberSolvers();
+  if (!numberSolvers)
+    throw CoinError("No solvers","race","OsiRacingSolverInterface");
+  std::vector<int> entrants;
+  for (int i = 0; i < numberSolvers; i++) {
+    if (isRunning(i))
+      continue;
+    if (outOfDate_[i])
+      syncSolver(i);
+    entrants.push_back(i);
+  }
+  assert (!entrants.empty());
+  const int numberEntrants = static_cast<int>(entrants.size());
+  const int thisRace = ++state_->race;
+#ifdef COINUTILS_PTHREADS
+  if (numberEntrants > 1) {
+    pthread_mutex_lock(&state_->mutex);
+    state_->finished.clear();
+    for (int k = 0; k < numberEntrants; k++) {
+      OsiRaceRunner * runner = state_->runners[entrants[k]];
+      runner->type = type;
+      runner->race = thisRace;
+      runner->done = false;
+    }
+    pthread_mutex_unlock(&state_->mutex);
+    for (int k = 0; k < numberEntrants; k++) {
+      OsiRaceRunner * runner = state_->runners[entrants[k]];
+      runner->running = !pthread_create(&runner->thread,NULL,raceThread,
+					runner);
+      if (!runner->running) {
+	// no thread - run it here
+	runOne(runner);
+	pthread_mutex_lock(&state_->mutex);
+	runner->done = true;
+	state_->finished.push_back(runner->index);
+	pthread_mutex_unlock(&state_->mutex);
+      }
+    }
+    /* first proven result, else first to finish normally once all have;
+       if they all threw, the first to throw gives the error */
+    pthread_mutex_lock(&state_->mutex);
+    int winner = -1;
+    int firstFailed = -1;
+    while (winner < 0) {
+      int first = -1;
+      int numberDone = 0;
+      const int numberFinished = static_cast<int>(state_->finished.size());
+      for (int k = 0; k < numberFinished; k++) {
+	const OsiRaceRunner * runner = state_->runners[state_->finished[k]];
+	if (runner->race != thisRace)
+	  continue;  // loser of an earlier race
+	numberDone++;
+	if (runner->failed) {
+	  if (firstFailed < 0)
+	    firstFailed = runner->index;
+	  continue;
+	}
+	if (first < 0)
+	  first = runner->index;
+	if (isProven(runner->solver)) {
+	  winner = runner->index;
+	  break;
+	}
+      }
+      if (winner < 0 && numberDone == numberEntrants) {
+	if (first < 0)
+	  break;
+	winner = first;
+      }
+      if (winner < 0)
+	pthread_cond_wait(&state_->condition,&state_->mutex);
+    }
+    pthread_mutex_unlock(&state_->mutex);
+    if (winner < 0) {
+      // all have finished
+      for (int k = 0; k < numberEntrants; k++)
+	isRunning(entrants[k]);
+      const OsiRaceRunner * runner = state_->runners[firstFailed];
+      if (runner->error)
+	throw CoinError(*runner->error);
+      throw CoinError("All solvers failed","race","OsiRacingSolverInterface");
+    }
+    leader_ = winner;
+    isRunning(winner);  // join
+    return;
+  }
+#endif
+  // one after another
+  leader_ = entrants[0];
+  for (int k = 0; k < numberEntrants; k++) {
+    OsiRaceRunner * runner = state_->runners[entrants[k]];
+    runner->race = thisRace;
+    solveOne(runner->solver,type);
+    if (isProven(runner->solver)) {
+      leader_ = runner->index;
+      break;
+    }
+  }
+}
+
+void
+OsiRacingSolverInterface::initialSolve()
+{
+  race(raceInitial);
+}
+
+void
+OsiRacingSolverInterface::resolve()
+{
+  race(raceResolve);
+}
+
+void
+OsiRacingSolverInterface::branchAndBound()
+{
+  race(raceBranchAndBound);
+}
+
+//#############################################################################
+// Parameters
+//#############################################################################
+
+bool
+OsiRacingSolverInterface::setIntParam(OsiIntParam key, int value)
+{
+  if (!OsiSolverInterface::setIntParam(key,value))
+    return false;
+  intParamSet_[key] = 1;
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setIntParam(key,value);
+  }
+  return true;
+}
+
+bool
+OsiRacingSolverInterface::setDblParam(OsiDblParam key, double value)
+{
+  if (!OsiSolverInterface::setDblParam(key,value))
+    return false;
+  dblParamSet_[key] = 1;
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setDblParam(key,value);
+  }
+  return true;
+}
+
+bool
+OsiRacingSolverInterface::setStrParam(OsiStrParam key,
+				      const std::string & value)
+{
+  if (!OsiSolverInterface::setStrParam(key,value))
+    return false;
+  strParamSet_[key] = 1;
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setStrParam(key,value);
+  }
+  return true;
+}
+
+//#############################################################################
+// Queries (of the leader)
+//#############################################################################
+
+bool
+OsiRacingSolverInterface::isAbandoned() const
+{ return leader()->isAbandoned(); }
+bool
+OsiRacingSolverInterface::isProvenOptimal() const
+{ return leader()->isProvenOptimal(); }
+bool
+OsiRacingSolverInterface::isProvenPrimalInfeasible() const
+{ return leader()->isProvenPrimalInfeasible(); }
+bool
+OsiRacingSolverInterface::isProvenDualInfeasible() const
+{ return leader()->isProvenDualInfeasible(); }
+bool
+OsiRacingSolverInterface::isPrimalObjectiveLimitReached() const
+{ return leader()->isPrimalObjectiveLimitReached(); }
+bool
+OsiRacingSolverInterface::isDualObjectiveLimitReached() const
+{ return leader()->isDualObjectiveLimitReached(); }
+bool
+OsiRacingSolverInterface::isIterationLimitReached() const
+{ return leader()->isIterationLimitReached(); }
+
+CoinWarmStart *
+OsiRacingSolverInterface::getEmptyWarmStart () const
+{ return leader()->getEmptyWarmStart(); }
+CoinWarmStart *
+OsiRacingSolverInterface::getWarmStart() const
+{ return leader()->getWarmStart(); }
+
+bool
+OsiRacingSolverInterface::setWarmStart(const CoinWarmStart* warmstart)
+{
+  bool accepted = false;
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i) && solvers_[i]->setWarmStart(warmstart))
+      accepted = true;
+  }
+  return accepted;
+}
+
+int
+OsiRacingSolverInterface::getNumCols() const
+{ return solvers_.empty() ? 0 : leader()->getNumCols(); }
+int
+OsiRacingSolverInterface::getNumRows() const
+{ return solvers_.empty() ? 0 : leader()->getNumRows(); }
+int
+OsiRacingSolverInterface::getNumElements() const
+{ return solvers_.empty() ? 0 : leader()->getNumElements(); }
+const double *
+OsiRacingSolverInterface::getColLower() const
+{ return leader()->getColLower(); }
+const double *
+OsiRacingSolverInterface::getColUpper() const
+{ return leader()->getColUpper(); }
+const char *
+OsiRacingSolverInterface::getRowSense() const
+{ return leader()->getRowSense(); }
+const double *
+OsiRacingSolverInterface::getRightHandSide() const
+{ return leader()->getRightHandSide(); }
+const double *
+OsiRacingSolverInterface::getRowRange() const
+{ return leader()->getRowRange(); }
+const double *
+OsiRacingSolverInterface::getRowLower() const
+{ return leader()->getRowLower(); }
+const double *
+OsiRacingSolverInterface::getRowUpper() const
+{ return leader()->getRowUpper(); }
+const double *
+OsiRacingSolverInterface::getObjCoefficients() const
+{ return leader()->getObjCoefficients(); }
+double
+OsiRacingSolverInterface::getObjSense() const
+{ return leader()->getObjSense(); }
+bool
+OsiRacingSolverInterface::isContinuous(int colIndex) const
+{ return leader()->isContinuous(colIndex); }
+const CoinPackedMatrix *
+OsiRacingSolverInterface::getMatrixByRow() const
+{ return leader()->getMatrixByRow(); }
+const CoinPackedMatrix *
+OsiRacingSolverInterface::getMatrixByCol() const
+{ return leader()->getMatrixByCol(); }
+double
+OsiRacingSolverInterface::getInfinity() const
+{ return solvers_.empty() ? COIN_DBL_MAX : leader()->getInfinity(); }
+
+const double *
+OsiRacingSolverInterface::getColSolution() const
+{ return leader()->getColSolution(); }
+const double *
+OsiRacingSolverInterface::getRowPrice() const
+{ return leader()->getRowPrice(); }
+const double *
+OsiRacingSolverInterface::getReducedCost() const
+{ return leader()->getReducedCost(); }
+const double *
+OsiRacingSolverInterface::getRowActivity() const
+{ return leader()->getRowActivity(); }
+double
+OsiRacingSolverInterface::getObjValue() const
+{ return leader()->getObjValue(); }
+int
+OsiRacingSolverInterface::getIterationCount() const
+{ return leader()->getIterationCount(); }
+std::vector<double*>
+OsiRacingSolverInterface::getDualRays(int maxNumRays, bool fullRay) const
+{ return leader()->getDualRays(maxNumRays,fullRay); }
+std::vector<double*>
+OsiRacingSolverInterface::getPrimalRays(int maxNumRays) const
+{ return leader()->getPrimalRays(maxNumRays); }
+
+void
+OsiRacingSolverInterface::writeMps(const char *filename,
+				   const char *extension,
+				   double objSense) const
+{ leader()->writeMps(filename,extension,objSense); }
+
+//#############################################################################
+// Modifications (of all solvers not running)
+//#############################################################################
+
+void
+OsiRacingSolverInterface::setObjCoeff( int elementIndex, double elementValue )
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setObjCoeff(elementIndex,elementValue);
+  }
+}
+
+void
+OsiRacingSolverInterface::setObjSense(double s)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setObjSense(s);
+  }
+}
+
+void
+OsiRacingSolverInterface::setColLower( int elementIndex, double elementValue )
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setColLower(elementIndex,bound(i,elementValue));
+  }
+}
+
+void
+OsiRacingSolverInterface::setColUpper( int elementIndex, double elementValue )
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setColUpper(elementIndex,bound(i,elementValue));
+  }
+}
+
+void
+OsiRacingSolverInterface::setColBounds( int elementIndex,
+					double lower, double upper )
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setColBounds(elementIndex,bound(i,lower),bound(i,upper));
+  }
+}
+
+void
+OsiRacingSolverInterface::setRowLower( int elementIndex, double elementValue )
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setRowLower(elementIndex,bound(i,elementValue));
+  }
+}
+
+void
+OsiRacingSolverInterface::setRowUpper( int elementIndex, double elementValue )
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setRowUpper(elementIndex,bound(i,elementValue));
+  }
+}
+
+void
+OsiRacingSolverInterface::setRowBounds( int elementIndex,
+					double lower, double upper )
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setRowBounds(elementIndex,bound(i,lower),bound(i,upper));
+  }
+}
+
+void
+OsiRacingSolverInterface::setRowType(int index, char sense,
+				     double rightHandSide, double range)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setRowType(index,sense,rightHandSide,range);
+  }
+}
+
+void
+OsiRacingSolverInterface::setColSolution(const double *colsol)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setColSolution(colsol);
+  }
+}
+
+void
+OsiRacingSolverInterface::setRowPrice(const double * rowprice)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setRowPrice(rowprice);
+  }
+}
+
+void
+OsiRacingSolverInterface::setContinuous(int index)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setContinuous(index);
+  }
+}
+
+void
+OsiRacingSolverInterface::setInteger(int index)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->setInteger(index);
+  }
+}
+
+void
+OsiRacingSolverInterface::addCol(const CoinPackedVectorBase& vec,
+				 const double collb, const double colub,
+				 const double obj)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->addCol(vec,bound(i,collb),bound(i,colub),obj);
+  }
+}
+
+void
+OsiRacingSolverInterface::addCols(const int numcols,
+				  const CoinPackedVectorBase * const * cols,
+				  const double* collb, const double* colub,
+				  const double* obj)
+{
+  std::vector<double> work[2];
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->addCols(numcols,cols,
+			   bounds(i,collb,numcols,work[0]),
+			   bounds(i,colub,numcols,work[1]),obj);
+  }
+}
+
+void
+OsiRacingSolverInterface::deleteCols(const int num, const int * colIndices)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->deleteCols(num,colIndices);
+  }
+}
+
+void
+OsiRacingSolverInterface::addRow(const CoinPackedVectorBase& vec,
+				 const double rowlb, const double rowub)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->addRow(vec,bound(i,rowlb),bound(i,rowub));
+  }
+}
+
+void
+OsiRacingSolverInterface::addRow(const CoinPackedVectorBase& vec,
+				 const char rowsen, const double rowrhs,
+				 const double rowrng)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->addRow(vec,rowsen,rowrhs,rowrng);
+  }
+}
+
+void
+OsiRacingSolverInterface::addRows(const int numrows,
+				  const CoinPackedVectorBase * const * rows,
+				  const double* rowlb, const double* rowub)
+{
+  std::vector<double> work[2];
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->addRows(numrows,rows,
+			   bounds(i,rowlb,numrows,work[0]),
+			   bounds(i,rowub,numrows,work[1]));
+  }
+}
+
+void
+OsiRacingSolverInterface::addRows(const int numrows,
+				  const CoinPackedVectorBase * const * rows,
+				  const char* rowsen, const double* rowrhs,
+				  const double* rowrng)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->addRows(numrows,rows,rowsen,rowrhs,rowrng);
+  }
+}
+
+void
+OsiRacingSolverInterface::deleteRows(const int num, const int * rowIndices)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->deleteRows(num,rowIndices);
+  }
+}
+
+void
+OsiRacingSolverInterface::applyRowCut(const OsiRowCut& rc)
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->applyRowCuts(1,&rc);
+  }
+}
+
+void
+OsiRacingSolverInterface::applyColCut(const OsiColCut& cc)
+{
+  // tighten bounds through the public methods
+  const double * lower = getColLower();
+  const double * upper = getColUpper();
+  const CoinPackedVector & lbs = cc.lbs();
+  const CoinPackedVector & ubs = cc.ubs();
+  std::vector<int> which;
+  std::vector<double> value;
+  for (int k = 0; k < lbs.getNumElements(); k++) {
+    const int j = lbs.getIndices()[k];
+    if (lbs.getElements()[k] > lower[j]) {
+      which.push_back(j);
+      value.push_back(lbs.getElements()[k]);
+    }
+  }
+  const int numberLower = static_cast<int>(which.size());
+  for (int k = 0; k < ubs.getNumElements(); k++) {
+    const int j = ubs.getIndices()[k];
+    if (ubs.getElements()[k] < upper[j]) {
+      which.push_back(j);
+      value.push_back(ubs.getElements()[k]);
+    }
+  }
+  const int numberChanged = static_cast<int>(which.size());
+  for (int k = 0; k < numberChanged; k++) {
+    if (k < numberLower)
+      setColLower(which[k],value[k]);
+    else
+      setColUpper(which[k],value[k]);
+  }
+}
+
+//#############################################################################
+// Loading problems (into all solvers)
+//#############################################################################
+
+void
+OsiRacingSolverInterface::loadProblem(const CoinPackedMatrix& matrix,
+				      const double* collb, const double* colub,
+				      const double* obj,
+				      const double* rowlb, const double* rowub)
+{
+  const int numberColumns = matrix.getNumCols();
+  const int numberRows = matrix.getNumRows();
+  std::vector<double> work[4];
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->loadProblem(matrix,
+			       bounds(i,collb,numberColumns,work[0]),
+			       bounds(i,colub,numberColumns,work[1]),obj,
+			       bounds(i,rowlb,numberRows,work[2]),
+			       bounds(i,rowub,numberRows,work[3]));
+  }
+}
+
+void
+OsiRacingSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
+					double*& collb, double*& colub,
+					double*& obj,
+					double*& rowlb, double*& rowub)
+{
+  loadProblem(*matrix,collb,colub,obj,rowlb,rowub);
+  delete matrix;   matrix = NULL;
+  delete[] collb;  collb = NULL;
+  delete[] colub;  colub = NULL;
+  delete[] obj;    obj = NULL;
+  delete[] rowlb;  rowlb = NULL;
+  delete[] rowub;  rowub = NULL;
+}
+
+void
+OsiRacingSolverInterface::loadProblem(const CoinPackedMatrix& matrix,
+				      const double* collb, const double* colub,
+				      const double* obj,
+				      const char* rowsen, const double* rowrhs,
+				      const double* rowrng)
+{
+  const int numberColumns = matrix.getNumCols();
+  std::vector<double> work[2];
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->loadProblem(matrix,
+			       bounds(i,collb,numberColumns,work[0]),
+			       bounds(i,colub,numberColumns,work[1]),obj,
+			       rowsen,rowrhs,rowrng);
+  }
+}
+
+void
+OsiRacingSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
+					double*& collb, double*& colub,
+					double*& obj,
+					char*& rowsen, double*& rowrhs,
+					double*& rowrng)
+{
+  loadProblem(*matrix,collb,colub,obj,rowsen,rowrhs,rowrng);
+  delete matrix;   matrix = NULL;
+  delete[] collb;  collb = NULL;
+  delete[] colub;  colub = NULL;
+  delete[] obj;    obj = NULL;
+  delete[] rowsen; rowsen = NULL;
+  delete[] rowrhs; rowrhs = NULL;
+  delete[] rowrng; rowrng = NULL;
+}
+
+void
+OsiRacingSolverInterface::loadProblem(const int numcols, const int numrows,
+				      const CoinBigIndex * start,
+				      const int* index, const double* value,
+				      const double* collb, const double* colub,
+				      const double* obj,
+				      const double* rowlb, const double* rowub)
+{
+  std::vector<double> work[4];
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->loadProblem(numcols,numrows,start,index,value,
+			       bounds(i,collb,numcols,work[0]),
+			       bounds(i,colub,numcols,work[1]),obj,
+			       bounds(i,rowlb,numrows,work[2]),
+			       bounds(i,rowub,numrows,work[3]));
+  }
+}
+
+void
+OsiRacingSolverInterface::loadProblem(const int numcols, const int numrows,
+				      const CoinBigIndex * start,
+				      const int* index, const double* value,
+				      const double* collb, const double* colub,
+				      const double* obj,
+				      const char* rowsen, const double* rowrhs,
+				      const double* rowrng)
+{
+  std::vector<double> work[2];
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    if (available(i))
+      solvers_[i]->loadProblem(numcols,numrows,start,index,value,
+			       bounds(i,collb,numcols,work[0]),
+			       bounds(i,colub,numcols,work[1]),obj,
+			       rowsen,rowrhs,rowrng);
+  }
+}
+
+//#############################################################################
+// Constructors, destructor, clone and assignment
+//#############################################################################
+
+OsiRacingSolverInterface::OsiRacingSolverInterface ()
+  : OsiSolverInterface(),
+    intParamSet_(OsiLastIntParam,0),
+    dblParamSet_(OsiLastDblParam,0),
+    strParamSet_(OsiLastStrParam,0),
+    state_(new OsiRaceState),
+    leader_(0)
+{
+  state_->race = 0;
+#ifdef COINUTILS_PTHREADS
+  pthread_mutex_init(&state_->mutex,NULL);
+  pthread_cond_init(&state_->condition,NULL);
+#endif
+}
+
+OsiSolverInterface *
+OsiRacingSolverInterface::clone(bool copyData) const
+{
+  if (copyData) {
+    return new OsiRacingSolverInterface(*this);
+  } else {
+    OsiRacingSolverInterface * racer = new OsiRacingSolverInterface();
+    const int numberSolvers = this->numberSolvers();
+    for (int i = 0; i < numberSolvers; i++) {
+      // a running solver can not be cloned, so clone the leader
+      const OsiSolverInterface * solver =
+	isRunning(i) ? leader() : solvers_[i];
+      racer->addSolver(solver->clone(false));
+    }
+    return racer;
+  }
+}
+
+OsiRacingSolverInterface::OsiRacingSolverInterface (
+  const OsiRacingSolverInterface & rhs)
+  : OsiSolverInterface(rhs),
+    state_(new OsiRaceState),
+    leader_(0)
+{
+  state_->race = 0;
+#ifdef COINUTILS_PTHREADS
+  pthread_mutex_init(&state_->mutex,NULL);
+  pthread_cond_init(&state_->condition,NULL);
+#endif
+  gutsOfCopy(rhs);
+}
+
+OsiRacingSolverInterface &
+OsiRacingSolverInterface::operator=(const OsiRacingSolverInterface& rhs)
+{
+  if (this != &rhs) {
+    OsiSolverInterface::operator=(rhs);
+    gutsOfDestructor();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+OsiRacingSolverInterface::~OsiRacingSolverInterface ()
+{
+  gutsOfDestructor();
+#ifdef COINUTILS_PTHREADS
+  pthread_mutex_destroy(&state_->mutex);
+  pthread_cond_destroy(&state_->condition);
+#endif
+  delete state_;
+}
+
+void
+OsiRacingSolverInterface::gutsOfCopy(const OsiRacingSolverInterface & rhs)
+{
+  intParamSet_ = rhs.intParamSet_;
+  dblParamSet_ = rhs.dblParamSet_;
+  strParamSet_ = rhs.strParamSet_;
+  const int numberSolvers = rhs.numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    // a running solver can not be cloned, so take the leader and sync
+    // it when it races
+    const bool running = rhs.isRunning(i);
+    const OsiSolverInterface * solver =
+      running ? rhs.leader() : rhs.solvers_[i];
+    OsiRaceRunner * runner = new OsiRaceRunner;
+    runner->state = state_;
+    runner->solver = solver->clone();
+    runner->index = i;
+    runner->type = raceInitial;
+    runner->race = -1;
+    runner->running = false;
+    runner->done = true;
+    state_->runners.push_back(runner);
+    solvers_.push_back(runner->solver);
+    outOfDate_.push_back(rhs.outOfDate_[i] || running);
+  }
+  leader_ = rhs.leader_;
+}
+
+void
+OsiRacingSolverInterface::gutsOfDestructor()
+{
+  const int numberSolvers = this->numberSolvers();
+  for (int i = 0; i < numberSolvers; i++) {
+    OsiRaceRunner * runner = state_->runners[i];
+#ifdef COINUTILS_PTHREADS
+    if (runner->running)
+      pthread_join(runner->thread,NULL);
+#endif
+    delete runner;
+    delete solvers_[i];
+  }
+  state_->runners.clear();
+  state_->finished.clear();
+  solvers_.clear();
+  outOfDate_.clear();
+  leader_ = 0;
+}
@@ -0,0 +1,293 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiRacingSolverInterface_H
+#define OsiRacingSolverInterface_H
+
+#include <vector>
+
+#include "OsiSolverInterface.hpp"
+
+struct OsiRaceState;
+
+//#############################################################################
+/** Solver interface which races several solvers on the same problem
+
+    Which solver, or which algorithm of one solver, is fastest varies from
+    problem to problem.  This interface holds several solvers, for example
+    clones of different interfaces or of one interface given different
+    hints (OsiDoDualInInitial, OsiDoDualInResolve, ...), and keeps the same
+    problem in all of them.  initialSolve(), resolve() and branchAndBound()
+    start all of them, each on its own thread if CoinUtils was built with
+    thread support, and return as soon as one has a proven result (optimal
+    or infeasible).  If none does, the first to finish wins.
+
+    The winner leads until the next race: all queries, of the problem as
+    well as of the solution, go to it, and getInfinity() is its infinity.
+    Infinite bounds given to this interface are passed on as each solver's
+    own infinity.
+
+    Osi has no way to interrupt a solve, so the losers of a race run on to
+    the end in the background.  A modification while a loser is still
+    running is not applied to it.  Instead the loser is marked out of date,
+    and before it next races it is given a fresh copy of the problem (not
+    the basis) from the leader.  A loser still running at the next race is
+    left out of it.  The destructor waits for all of them.
+
+    A solver which throws counts as finished without a result.  If all
+    of them throw, the first exception to be thrown (a CoinError) is
+    passed on.
+
+    Without thread support the solvers are tried one after another, in
+    the order they were added, until one has a proven result; an
+    exception is passed on at once.
+
+    Integer, double and string parameters are passed on to all solvers.
+    Hints are not, as giving the solvers different hints is the point;
+    set them on the solvers before adding them.  Names are kept here, not
+    in the solvers.
+*/
+class OsiRacingSolverInterface : virtual public OsiSolverInterface {
+
+public:
+  /**@name Solvers */
+  //@{
+  /** Add a solver to race, taking ownership.  It is given a copy of the
+      current problem if there is one (see syncSolver()). */
+  void addSolver(OsiSolverInterface * solver);
+  /// Number of solvers
+  inline int numberSolvers() const
+  { return static_cast<int>(solvers_.size());}
+  /** Solver i.  Only safe to use while no race is running on it
+      (see isRunning()); changing it puts it out of step with the rest. */
+  inline OsiSolverInterface * solver(int i) const
+  { return solvers_[i];}
+  /// Index of the solver which won the last race (0 before any)
+  inline int winner() const
+  { return leader_;}
+  /// Whether solver i is still running the solve of an earlier race
+  bool isRunning(int i) const;
+  /// Wait for all solvers to finish and bring them up to date
+  void waitForAll();
+  //@}
+
+  /**@name Solve methods */
+  //@{
+  /// Solve initial LP relaxation with all solvers, first to finish wins
+  virtual void initialSolve();
+  /// Resolve an LP relaxation with all solvers, first to finish wins
+  virtual void resolve();
+  /// Branch and bound with all solvers, first to finish wins
+  virtual void branchAndBound();
+  //@}
+
+  /**@name Parameter set/get methods (passed on to all solvers) */
+  //@{
+  virtual bool setIntParam(OsiIntParam key, int value);
+  virtual bool setDblParam(OsiDblParam key, double value);
+  virtual bool setStrParam(OsiStrParam key, const std::string & value);
+  //@}
+
+  /**@name Methods returning info on how the solution process terminated
+     (of the winner) */
+  //@{
+  virtual bool isAbandoned() const;
+  virtual bool isProvenOptimal() const;
+  virtual bool isProvenPrimalInfeasible() const;
+  virtual bool isProvenDualInfeasible() const;
+  virtual bool isPrimalObjectiveLimitReached() const;
+  virtual bool isDualObjectiveLimitReached() const;
+  virtual bool isIterationLimitReached() const;
+  //@}
+
+  /**@name Warm start methods */
+  //@{
+  /// Empty warm start object of the leader
+  virtual CoinWarmStart *getEmptyWarmStart () const;
+  /// Warm start of the leader
+  virtual CoinWarmStart* getWarmStart() const;
+  /** Set warm start in all solvers which accept it.
+      Returns true if any did. */
+  virtual bool setWarmStart(const CoinWarmStart* warmstart);
+  //@}
+
+  /**@name Problem query methods (of the leader) */
+  //@{
+  virtual int getNumCols() const;
+  virtual int getNumRows() const;
+  virtual int getNumElements() const;
+  virtual const double * getColLower() const;
+  virtual const double * getColUpper() const;
+  virtual const char * getRowSense() const;
+  virtual const double * getRightHandSide() const;
+  virtual const double * getRowRange() const;
+  virtual const double * getRowLower() const;
+  virtual const double * getRowUpper() const;
+  virtual const double * getObjCoefficients() const;
+  virtual double getObjSense() const;
+  virtual bool isContinuous(int colIndex) const;
+  virtual const CoinPackedMatrix * getMatrixByRow() const;
+  virtual const CoinPackedMatrix * getMatrixByCol() const;
+  virtual double getInfinity() const;
+  //@}
+
+  /**@name Solution query methods (of the winner) */
+  //@{
+  virtual const double * getColSolution() const;
+  virtual const double * getRowPrice() const;
+  virtual const double * getReducedCost() const;
+  virtual const double * getRowActivity() const;
+  virtual double getObjValue() const;
+  virtual int getIterationCount() const;
+  virtual std::vector<double*> getDualRays(int maxNumRays,
+					   bool fullRay = false) const;
+  virtual std::vector<double*> getPrimalRays(int maxNumRays) const;
+  //@}
+
+  /**@name Problem modifying methods (applied to all solvers) */
+  //@{
+  virtual void setObjCoeff( int elementIndex, double elementValue );
+  virtual void setObjSense(double s);
+  virtual void setColLower( int elementIndex, double elementValue );
+  virtual void setColUpper( int elementIndex, double elementValue );
+  virtual void setColBounds( int elementIndex,
+			     double lower, double upper );
+  virtual void setRowLower( int elementIndex, double elementValue );
+  virtual void setRowUpper( int elementIndex, double elementValue );
+  virtual void setRowBounds( int elementIndex,
+			     double lower, double upper );
+  virtual void setRowType(int index, char sense, double rightHandSide,
+			  double range);
+  virtual void setColSolution(const double *colsol);
+  virtual void setRowPrice(const double * rowprice);
+  virtual void setContinuous(int index);
+  virtual void setInteger(int index);
+
+  virtual void addCol(const CoinPackedVectorBase& vec,
+		      const double collb, const double colub,
+		      const double obj);
+  virtual void addCols(const int numcols,
+		       const CoinPackedVectorBase * const * cols,
+		       const double* collb, const double* colub,
+		       const double* obj);
+  virtual void deleteCols(const int num, const int * colIndices);
+  virtual void addRow(const CoinPackedVectorBase& vec,
+		      const double rowlb, const double rowub);
+  virtual void addRow(const CoinPackedVectorBase& vec,
+		      const char rowsen, const double rowrhs,
+		      const double rowrng);
+  virtual void addRows(const int numrows,
+		       const CoinPackedVectorBase * const * rows,
+		       const double* rowlb, const double* rowub);
+  virtual void addRows(const int numrows,
+		       const CoinPackedVectorBase * const * rows,
+		       const char* rowsen, const double* rowrhs,
+		       const double* rowrng);
+  virtual void deleteRows(const int num, const int * rowIndices);
+  //@}
+
+  /**@name Methods to input a problem (into all solvers) */
+  //@{
+  virtual void loadProblem(const CoinPackedMatrix& matrix,
+			   const double* collb, const double* colub,
+			   const double* obj,
+			   const double* rowlb, const double* rowub);
+  virtual void assignProblem(CoinPackedMatrix*& matrix,
+			     double*& collb, double*& colub, double*& obj,
+			     double*& rowlb, double*& rowub);
+  virtual void loadProblem(const CoinPackedMatrix& matrix,
+			   const double* collb, const double* colub,
+			   const double* obj,
+			   const char* rowsen, const double* rowrhs,
+			   const double* rowrng);
+  virtual void assignProblem(CoinPackedMatrix*& matrix,
+			     double*& collb, double*& colub, double*& obj,
+			     char*& rowsen, double*& rowrhs,
+			     double*& rowrng);
+  virtual void loadProblem(const int numcols, const int numrows,
+			   const CoinBigIndex * start, const int* index,
+			   const double* value,
+			   const double* collb, const double* colub,
+			   const double* obj,
+			   const double* rowlb, const double* rowub);
+  virtual void loadProblem(const int numcols, const int numrows,
+			   const CoinBigIndex * start, const int* index,
+			   const double* value,
+			   const double* collb, const double* colub,
+			   const double* obj,
+			   const char* rowsen, const double* rowrhs,
+			   const double* rowrng);
+  /// Write the problem of the leader
+  virtual void writeMps(const char *filename,
+			const char *extension = "mps",
+			double objSense=0.0) const;
+  //@}
+
+  /**@name Constructors and destructor */
+  //@{
+  /// Default Constructor (no solvers)
+  OsiRacingSolverInterface ();
+
+  /** Clone (clones all solvers; one still running is replaced by a clone
+      of the leader) */
+  virtual OsiSolverInterface * clone(bool copyData = true) const;
+
+  /// Copy constructor
+  OsiRacingSolverInterface (const OsiRacingSolverInterface &);
+
+  /// Assignment operator
+  OsiRacingSolverInterface & operator=(const OsiRacingSolverInterface& rhs);
+
+  /// Destructor (waits for solvers still running)
+  virtual ~OsiRacingSolverInterface ();
+  //@}
+
+protected:
+  /**@name Protected methods */
+  //@{
+  /// Apply a row cut to all solvers
+  virtual void applyRowCut(const OsiRowCut& rc);
+  /// Apply a column cut to all solvers
+  virtual void applyColCut(const OsiColCut& cc);
+  //@}
+
+private:
+  /// Which solve a race runs
+  enum RaceType { raceInitial = 0, raceResolve, raceBranchAndBound };
+
+  /// Run a race and set leader_
+  void race(RaceType type);
+  /** Whether solver i can be changed now.  If it is still running it is
+      marked out of date and false returned. */
+  bool available(int i);
+  /// Give solver i the problem of the leader
+  void syncSolver(int i);
+  /// Bound for solver i given bound value from the caller
+  double bound(int i, double value) const;
+  /** Bounds for solver i given array from the caller (which is returned
+      if no change is needed, work is used otherwise) */
+  const double * bounds(int i, const double * values, int n,
+			std::vector<double> & work) const;
+  void gutsOfDestructor();
+  void gutsOfCopy(const OsiRacingSolverInterface & rhs);
+
+  /// Leading solver
+  inline OsiSolverInterface * leader() const
+  { return solvers_[leader_];}
+
+  /// Parameters set here, to pass on to solvers brought up to date
+  std::vector<char> intParamSet_;
+  std::vector<char> dblParamSet_;
+  std::vector<char> strParamSet_;
+  /// Solvers (owned)
+  std::vector<OsiSolverInterface *> solvers_;
+  /// Solvers which missed modifications while running
+  std::vector<char> outOfDate_;
+  /// Threads and their state
+  OsiRaceState * state_;
+  /// Winner of last race
+  int leader_;
+};
+
+#endif
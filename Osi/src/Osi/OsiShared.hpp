@@ -0,0 +1,178 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiShared_H
+#define OsiShared_H
+
+#include <cstddef>
+
+#include "CoinUtilsConfig.h"
+
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+#endif
+
+//#############################################################################
+/** Reference counted, copy-on-write handle to problem data
+
+    Cloning a solver interface copies its whole problem: matrix, bounds,
+    objective.  Strong branching, racing and parallel tree search make many
+    clones of one model, most of which change only a few bounds.  An
+    interface can instead keep its problem data in OsiShared handles, which
+    clones copy by pointing to the same object.  The object is copied only
+    when a holder asks to change it while others still hold it
+    (getMutable()), so a clone changing bounds copies the bounds and still
+    shares the matrix.
+
+    Holders in different threads may copy, change and drop their handles
+    concurrently; the count is protected by a mutex if CoinUtils was built
+    with thread support.  The object itself must not be changed behind the
+    handle's back, so anything an object builds lazily in const methods
+    (such as the second ordering of a CoinPackedMatrixPair) should be built
+    before it is first shared.
+
+    T needs a copy constructor, used to unshare.
+*/
+template <class T>
+class OsiShared {
+
+public:
+  /**@name Constructors and destructor */
+  //@{
+  /// Default Constructor (no object)
+  OsiShared ()
+    : block_(NULL)
+  {}
+
+  /// Constructor taking ownership of object (which may be NULL)
+  explicit OsiShared (T * object)
+    : block_(NULL)
+  { reset(object);}
+
+  /// Copy constructor (shares the object)
+  OsiShared (const OsiShared & rhs)
+    : block_(rhs.block_)
+  { acquire();}
+
+  /// Assignment operator (shares the object)
+  OsiShared & operator=(const OsiShared & rhs)
+  {
+    if (block_ != rhs.block_) {
+      release();
+      block_ = rhs.block_;
+      acquire();
+    }
+    return *this;
+  }
+
+  /// Destructor (deletes the object if the last holder)
+  ~OsiShared ()
+  { release();}
+  //@}
+
+  /**@name Querying */
+  //@{
+  /// Object, or NULL
+  inline const T * get() const
+  { return block_ ? block_->object : NULL;}
+  inline const T * operator->() const
+  { return get();}
+  inline const T & operator*() const
+  { return *get();}
+  /// Number of handles holding the object (0 if none)
+  int useCount() const
+  {
+    if (!block_)
+      return 0;
+#ifdef COINUTILS_PTHREADS
+    pthread_mutex_lock(&block_->mutex);
+    const int count = block_->count;
+    pthread_mutex_unlock(&block_->mutex);
+    return count;
+#else
+    return block_->count;
+#endif
+  }
+  /// Whether other handles hold the object too
+  inline bool isShared() const
+  { return useCount() > 1;}
+  //@}
+
+  /**@name Changing */
+  //@{
+  /** Object which this handle alone holds, copying it first if it is
+      shared.  Pointers got from get() before are no longer valid. */
+  T * getMutable()
+  {
+    if (!block_)
+      return NULL;
+    if (isShared())
+      reset(new T(*block_->object));
+    return block_->object;
+  }
+  /// Hold object instead (taking ownership; may be NULL).  Returns object.
+  T * reset(T * object)
+  {
+    release();
+    if (object) {
+      block_ = new Block;
+      block_->object = object;
+      block_->count = 1;
+#ifdef COINUTILS_PTHREADS
+      pthread_mutex_init(&block_->mutex,NULL);
+#endif
+    }
+    return object;
+  }
+  //@}
+
+private:
+  /// The object and the number of handles holding it
+  struct Block {
+    T * object;
+    int count;
+#ifdef COINUTILS_PTHREADS
+    pthread_mutex_t mutex;
+#endif
+  };
+
+  void acquire()
+  {
+    if (!block_)
+      return;
+#ifdef COINUTILS_PTHREADS
+    pthread_mutex_lock(&block_->mutex);
+    block_->count++;
+    pthread_mutex_unlock(&block_->mutex);
+#else
+    block_->count++;
+#endif
+  }
+
+  void release()
+  {
+    if (!block_)
+      return;
+#ifdef COINUTILS_PTHREADS
+    pthread_mutex_lock(&block_->mutex);
+    const bool last = --block_->count == 0;
+    pthread_mutex_unlock(&block_->mutex);
+#else
+    const bool last = --block_->count == 0;
+#endif
+    if (last) {
+#ifdef COINUTILS_PTHREADS
+      pthread_mutex_destroy(&block_->mutex);
+#endif
+      delete block_->object;
+      delete block_;
+    }
+    block_ = NULL;
+  }
+
+  /// Shared block, or NULL
+  Block * block_;
+};
+
+#endif
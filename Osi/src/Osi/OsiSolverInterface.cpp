@@ -13,12 +13,15 @@
 #ifdef COIN_SNAPSHOT
 #include "CoinSnapshot.hpp"
 #endif
+#include "CoinShallowPackedVector.hpp"
 
 #include "OsiSolverInterface.hpp"
+#include "OsiSolverStatistics.hpp"
 #ifdef CBC_NEXT_VERSION
 #include "OsiSolverBranch.hpp"
 #endif
 #include "OsiCuts.hpp"
+#include "OsiCutPool.hpp"
 #include "OsiRowCut.hpp"
 #include "OsiColCut.hpp"
 #include "OsiRowCutDebugger.hpp"
@@ -43,6 +46,7 @@ void OsiSolverInterface::markHotStart()
 
 void OsiSolverInterface::solveFromHotStart()
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::hotStartEvent);
   setWarmStart(ws_);
   resolve();
 }
@@ -563,6 +567,7 @@ OsiSolverInterface::addRows(const int numrows, const int* rowStarts,
 			    const int* columns, const double* elements,
 			    const double* rowlb, const double* rowub)
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
   double infinity = getInfinity();
   for (int i = 0; i < numrows; ++i) {
     int start = rowStarts[i];
@@ -578,6 +583,7 @@ OsiSolverInterface::addRows(const int numrows,
 			    const CoinPackedVectorBase* const* rows,
 			    const double* rowlb, const double* rowub)
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
   for (int i = 0; i < numrows; ++i) {
     addRow(*rows[i], rowlb[i], rowub[i]);
   }
@@ -589,6 +595,7 @@ OsiSolverInterface::addRows(const int numrows,
 			    const char* rowsen, const double* rowrhs,   
 			    const double* rowrng)
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
   for (int i = 0; i < numrows; ++i) {
     addRow(*rows[i], rowsen[i], rowrhs[i], rowrng[i]);
   }
@@ -828,6 +835,7 @@ double OsiSolverInterface::getObjValue() const
 OsiSolverInterface::ApplyCutsReturnCode
 OsiSolverInterface::applyCuts( const OsiCuts & cs, double effectivenessLb ) 
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::applyCutsEvent);
   OsiSolverInterface::ApplyCutsReturnCode retVal;
   int i;
 
@@ -898,6 +906,30 @@ OsiSolverInterface::applyRowCuts(int numberCuts, const OsiRowCut ** cuts)
     applyRowCut(*cuts[i]);
   }
 }
+// And from a pool
+void 
+OsiSolverInterface::applyCutPool(const OsiCutPool & pool, int numberCuts,
+				 const int * which)
+{
+  if (numberCuts<=0)
+    return;
+  std::vector<CoinShallowPackedVector> rows(numberCuts);
+  std::vector<const CoinPackedVectorBase *> rowPointers(numberCuts);
+  std::vector<double> rowLower(numberCuts);
+  std::vector<double> rowUpper(numberCuts);
+  const int * starts = pool.starts();
+  for (int i=0;i<numberCuts;i++) {
+    int iCut = which ? which[i] : i;
+    int start = starts[iCut];
+    rows[i].setVector(pool.length(iCut),pool.indices()+start,
+		      pool.elements()+start,false);
+    rowPointers[i] = &rows[i];
+    rowLower[i] = pool.lb(iCut);
+    rowUpper[i] = pool.ub(iCut);
+  }
+  // the form of addRows solvers implement themselves
+  addRows(numberCuts,&rowPointers[0],&rowLower[0],&rowUpper[0]);
+}
 //#############################################################################
 // Set/Get Application Data
 // This is a pointer that the application can store into and retrieve
@@ -994,6 +1026,7 @@ OsiSolverInterface::OsiSolverInterface () :
   defaultHandler_(true),
   columnType_(NULL),
   appDataEtc_(NULL),
+  statistics_(NULL),
   ws_(NULL)
 {
   setInitialData();
@@ -1044,8 +1077,12 @@ OsiSolverInterface::setInitialData()
   object_=NULL;
 
   // names
-  rowNames_ = OsiNameVec(0) ;
-  colNames_ = OsiNameVec(0) ;
+  rowNames_.clear() ;
+  colNames_.clear() ;
+  rowNameVecChanges_ = -1 ;
+  rowNameVecRows_ = -1 ;
+  colNameVecChanges_ = -1 ;
+  colNameVecColumns_ = -1 ;
   objName_ = "" ;
 }
 
@@ -1054,6 +1091,7 @@ OsiSolverInterface::setInitialData()
 //-------------------------------------------------------------------
 OsiSolverInterface::OsiSolverInterface (const OsiSolverInterface & rhs) :
   rowCutDebugger_(NULL),
+  statistics_(rhs.statistics_),
   ws_(NULL)
 {  
   appDataEtc_ = rhs.appDataEtc_->clone();
@@ -1084,6 +1122,10 @@ OsiSolverInterface::OsiSolverInterface (const OsiSolverInterface & rhs) :
   // names
   rowNames_ = rhs.rowNames_ ;
   colNames_ = rhs.colNames_ ;
+  rowNameVecChanges_ = -1 ;
+  rowNameVecRows_ = -1 ;
+  colNameVecChanges_ = -1 ;
+  colNameVecColumns_ = -1 ;
   objName_ = rhs.objName_ ;
   // NULL as number of columns not known
   columnType_ = NULL;
@@ -1119,6 +1161,7 @@ OsiSolverInterface::operator=(const OsiSolverInterface& rhs)
   if (this != &rhs) {
     delete appDataEtc_;
     appDataEtc_ = rhs.appDataEtc_->clone();
+    statistics_ = rhs.statistics_;
     delete rowCutDebugger_;
     if ( rhs.rowCutDebugger_!=NULL )
       rowCutDebugger_ = new OsiRowCutDebugger(*rhs.rowCutDebugger_);
@@ -1158,6 +1201,10 @@ OsiSolverInterface::operator=(const OsiSolverInterface& rhs)
     // names
     rowNames_ = rhs.rowNames_ ;
     colNames_ = rhs.colNames_ ;
+    OsiNameVec().swap(rowNameVec_) ;
+    OsiNameVec().swap(colNameVec_) ;
+    rowNameVecChanges_ = -1 ;
+    colNameVecChanges_ = -1 ;
     objName_ = rhs.objName_ ;
     delete [] columnType_;
     // NULL as number of columns not known
@@ -1369,37 +1416,26 @@ void OsiSolverInterface::writeLp(const char * filename,
     fullname = f;
   }
 
-	char** colnames;
-	char** rownames;
   int nameDiscipline;
   if (!getIntParam(OsiNameDiscipline,nameDiscipline))
      nameDiscipline = 0;
-	if (useRowNames && nameDiscipline==2) {
-		colnames = new char*[getNumCols()];
-		rownames = new char*[getNumRows()+1];
-		for (int i = 0; i < getNumCols(); ++i)
-			colnames[i] = strdup(getColName(i).c_str());
-		for (int i = 0; i < getNumRows(); ++i)
-			rownames[i] = strdup(getRowName(i).c_str());
-		rownames[getNumRows()] = strdup(getObjName().c_str());
-	} else {
-		colnames = NULL;
-		rownames = NULL;
-	}
+  // Names point at the stored ones; only default names are generated
+  std::vector<const char *> colnames, rownames;
+  std::vector<char> colBuffer, rowBuffer;
+  std::string objName;
+  if (useRowNames && nameDiscipline==2) {
+    getRowColNamePointers('c',colnames,colBuffer);
+    getRowColNamePointers('r',rownames,rowBuffer);
+    objName = getObjName();
+    rownames.push_back(objName.c_str());
+  }
 
   // Fall back on Osi version
   OsiSolverInterface::writeLpNative(fullname.c_str(), 
-				    rownames, colnames, epsilon, numberAcross,
+				    rownames.empty() ? NULL : &rownames[0],
+				    colnames.empty() ? NULL : &colnames[0],
+				    epsilon, numberAcross,
 				    decimals, objSense, useRowNames);
-
-	if (useRowNames && nameDiscipline==2) {
-		for (int i = 0; i < getNumCols(); ++i)
-			free(colnames[i]);
-		for (int i = 0; i < getNumRows()+1; ++i)
-			free(rownames[i]);
-		delete[] colnames;
-		delete[] rownames;
-	}
 }
 
 /*************************************************************************/
@@ -1410,36 +1446,26 @@ void OsiSolverInterface::writeLp(FILE *fp,
 				  double objSense,
 				  bool useRowNames) const
 {
-	char** colnames;
-	char** rownames;
   int nameDiscipline;
-  getIntParam(OsiNameDiscipline,nameDiscipline) ;
-	if (useRowNames && nameDiscipline==2) {
-		colnames = new char*[getNumCols()];
-		rownames = new char*[getNumRows()+1];
-		for (int i = 0; i < getNumCols(); ++i)
-			colnames[i] = strdup(getColName(i).c_str());
-		for (int i = 0; i < getNumRows(); ++i)
-			rownames[i] = strdup(getRowName(i).c_str());
-      rownames[getNumRows()] = strdup(getObjName().c_str());
-	} else {
-		colnames = NULL;
-		rownames = NULL;
-	}
+  if (!getIntParam(OsiNameDiscipline,nameDiscipline))
+     nameDiscipline = 0;
+  // Names point at the stored ones; only default names are generated
+  std::vector<const char *> colnames, rownames;
+  std::vector<char> colBuffer, rowBuffer;
+  std::string objName;
+  if (useRowNames && nameDiscipline==2) {
+    getRowColNamePointers('c',colnames,colBuffer);
+    getRowColNamePointers('r',rownames,rowBuffer);
+    objName = getObjName();
+    rownames.push_back(objName.c_str());
+  }
 
   // Fall back on Osi version
   OsiSolverInterface::writeLpNative(fp, 
-				    rownames, colnames, epsilon, numberAcross,
+				    rownames.empty() ? NULL : &rownames[0],
+				    colnames.empty() ? NULL : &colnames[0],
+				    epsilon, numberAcross,
 				    decimals, objSense, useRowNames);
-
-	if (useRowNames && nameDiscipline==2) {
-		for (int i = 0; i < getNumCols(); ++i)
-			free(colnames[i]);
-		for (int i = 0; i < getNumRows()+1; ++i)
-			free(rownames[i]);
-		delete[] colnames;
-		delete[] rownames;
-	}
 }
 
 /***********************************************************************/
@@ -18,6 +18,7 @@
 #include "CoinError.hpp"
 
 #include "OsiCollections.hpp"
+#include "OsiNameList.hpp"
 #include "OsiSolverParameters.hpp"
 
 class CoinSnapshot;
@@ -25,6 +26,7 @@ class CoinLpIO;
 class CoinMpsIO;
 
 class OsiCuts;
+class OsiCutPool;
 class OsiAuxInfo;
 class OsiRowCut;
 class OsiRowCutDebugger;
@@ -34,6 +36,7 @@ class CoinModel;
 class OsiSolverBranch;
 class OsiSolverResult;
 class OsiObject;
+class OsiSolverStatistics;
 
 
 //#############################################################################
@@ -948,6 +951,13 @@ public:
       included in the vector for lazy names. If the name discipline is
       full, the vector will have getNumRows() names, either supplied or
       generated, plus one additional entry for the objective name.
+      Generated names follow the current row index, so after deleteRows()
+      a row without a supplied name has the name of its new index.
+
+      The vector is built when asked for, and is not updated by later
+      changes until asked for again; it is rebuilt only if the names or
+      the number of rows have changed.  Where single names will do,
+      getRowName() avoids building it.
     */
     virtual const OsiNameVec &getRowNames() ;
 
@@ -973,6 +983,14 @@ public:
       copied down to close the gap.
     */
     virtual void deleteRowNames(int tgtStart, int len) ;
+
+    /*! \brief Delete the names of num row indices
+
+      As deleteRows() takes them: any order, duplicates allowed.  The
+      remaining row names are copied down in one pass.  For use by
+      implementations of deleteRows().
+    */
+    void deleteRowNames(int num, const int * indices) ;
   
     /*! \brief Return the name of the column
 
@@ -990,7 +1008,14 @@ public:
       vector will contain only names supplied by the client and will be no
       larger than needed to hold those names; entries not supplied will be
       null strings. If the name discipline is full, the vector will have
-      getNumCols() names, either supplied or generated.
+      getNumCols() names, either supplied or generated. Generated names
+      follow the current column index, so after deleteCols() a column
+      without a supplied name has the name of its new index.
+
+      The vector is built when asked for, and is not updated by later
+      changes until asked for again; it is rebuilt only if the names or
+      the number of columns have changed.  Where single names will do,
+      getColName() avoids building it.
     */
     virtual const OsiNameVec &getColNames() ;
 
@@ -1016,6 +1041,26 @@ public:
       are copied down to close the gap.
     */
     virtual void deleteColNames(int tgtStart, int len) ;
+
+    /*! \brief Delete the names of num column indices
+
+      As deleteCols() takes them: any order, duplicates allowed.  The
+      remaining column names are copied down in one pass.  For use by
+      implementations of deleteCols().
+    */
+    void deleteColNames(int num, const int * indices) ;
+
+    /*! \brief Row or column names as C strings, for the writers
+
+      Sets \p names to getNumRows() (\p rc = 'r') or getNumCols()
+      (\p rc = 'c') pointers to the names getRowName() or getColName()
+      would return.  Names supplied by the client are not copied; default
+      names are generated into \p buffer, which must be kept (and not
+      changed) while \p names is used.  The objective name is not
+      included.
+    */
+    void getRowColNamePointers(char rc, std::vector<const char *> &names,
+			       std::vector<char> &buffer) const ;
   
 
     /*! \brief Set row and column names from a CoinMpsIO object.
@@ -1290,6 +1335,15 @@ public:
     */
     virtual void applyRowCuts(int numberCuts, const OsiRowCut ** cuts);
 
+    /** Apply cuts from a pool.
+	Adds the cuts in which, or the first numberCuts cuts in the pool if
+	which is NULL. The rows handed to addRows() are shallow packed
+	vectors pointing into the pool, so coefficients are not copied on
+	the way. Not virtual: solvers take the rows through addRows().
+    */
+    void applyCutPool(const OsiCutPool & pool, int numberCuts,
+		      const int * which = NULL);
+
     /// Deletes branching information before columns deleted
     void deleteBranchingInfo(int numberDeleted, const int * which);
 
@@ -1635,6 +1689,22 @@ public:
   { return defaultHandler_;}
   //@}
   //---------------------------------------------------------------------------
+
+  /**@name Instrumentation
+
+    See OsiSolverStatistics.
+  */
+  //@{
+  /** Attach statistics to be updated by instrumented calls (NULL to
+      detach).  The statistics are not owned; clones share them.
+  */
+  inline void setStatistics(OsiSolverStatistics * statistics)
+  { statistics_ = statistics;}
+  /// Return the attached statistics (NULL if none)
+  inline OsiSolverStatistics * statistics() const
+  { return statistics_;}
+  //@}
+  //---------------------------------------------------------------------------
   /**@name Methods for dealing with discontinuities other than integers.
   
      Osi should be able to know about SOS and other types.  This is an optional
@@ -2041,6 +2111,8 @@ private:
   //@{
     /// Pointer to user-defined data structure - and more if user wants
     OsiAuxInfo * appDataEtc_;
+    /// Statistics for instrumented calls (not owned)
+    OsiSolverStatistics * statistics_;
     /// Array of integer parameters
     int intParam_[OsiLastIntParam];
     /// Array of double parameters
@@ -2057,10 +2129,21 @@ private:
     /// Column solution satisfying lower and upper column bounds
     std::vector<double> strictColSolution_;
 
-    /// Row names
-    OsiNameVec rowNames_ ;
-    /// Column names
-    OsiNameVec colNames_ ;
+    /// Row names supplied by the client
+    OsiNameList rowNames_ ;
+    /// Column names supplied by the client
+    OsiNameList colNames_ ;
+    /** Vectors of row and column names, built by getRowNames() and
+	getColNames() when asked for */
+    OsiNameVec rowNameVec_ ;
+    OsiNameVec colNameVec_ ;
+    /** What rowNameVec_ and colNameVec_ were last built from: changes() of
+	the name list (-1 if never built) and the number of rows or columns
+	given default names (-1 for none) */
+    int rowNameVecChanges_ ;
+    int rowNameVecRows_ ;
+    int colNameVecChanges_ ;
+    int colNameVecColumns_ ;
     /// Objective name
     std::string objName_ ;
 
@@ -39,6 +39,11 @@ enum OsiIntParam {
 	 supplied by the client. Requests for a vector of names return a
 	 vector sized to match the constraint system, and all entries will
 	 contain either the name specified by the client or a generated name.
+    Only names supplied by the client are kept; a generated name always
+    follows the current index. When rows or columns are deleted, a
+    supplied name moves with its row or column, but a generated one
+    changes to match the new index (R0000005 becomes R0000004 when row 0
+    is deleted).
   */
   OsiNameDiscipline,
   /*! \brief End marker.
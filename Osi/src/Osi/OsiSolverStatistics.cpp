@@ -0,0 +1,132 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <string>
+
+#include "CoinPragma.hpp"
+#include "OsiSolverStatistics.hpp"
+
+static const char * eventNames[OsiSolverStatistics::numberEvents] = {
+  "initialSolve", "resolve", "solveFromHotStart", "applyCuts",
+  "addRows", "deleteRows", "getMatrix", "getSolution"
+};
+
+// Write a string as a JSON string
+static void writeJsonString (FILE * fp, const std::string & value)
+{
+  putc('"',fp);
+  for (size_t i = 0; i < value.size(); i++) {
+    unsigned char c = static_cast<unsigned char>(value[i]);
+    if (c == '"' || c == '\\')
+      fprintf(fp,"\\%c",c);
+    else if (c < ' ')
+      fprintf(fp,"\\u%4.4x",c);
+    else
+      putc(c,fp);
+  }
+  putc('"',fp);
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+OsiSolverStatistics::OsiSolverStatistics ()
+  : startTime_(0.0),
+    stream_(NULL),
+    streamGetters_(false)
+{
+  reset();
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+OsiSolverStatistics::~OsiSolverStatistics ()
+{
+}
+
+void
+OsiSolverStatistics::reset()
+{
+  for (int i = 0; i < numberEvents; i++) {
+    counter_[i].calls = 0;
+    counter_[i].seconds = 0.0;
+    counter_[i].maxSeconds = 0.0;
+    counter_[i].iterations = 0.0;
+  }
+  startTime_ = CoinGetTimeOfDay();
+}
+
+void
+OsiSolverStatistics::setEventStream(FILE * fp, bool getters)
+{
+  stream_ = fp;
+  streamGetters_ = getters;
+}
+
+const char *
+OsiSolverStatistics::eventName(Event event)
+{
+  return eventNames[event];
+}
+
+void
+OsiSolverStatistics::record(const OsiSolverInterface * solver, Event event,
+			    double seconds)
+{
+  Counter & counter = counter_[event];
+  counter.calls++;
+  counter.seconds += seconds;
+  if (seconds > counter.maxSeconds)
+    counter.maxSeconds = seconds;
+  bool solve = event <= hotStartEvent;
+  int iterations = 0;
+  if (solve) {
+    iterations = solver->getIterationCount();
+    counter.iterations += iterations;
+  }
+  if (stream_ && (streamGetters_ || event < getMatrixEvent)) {
+    std::string name;
+    solver->getStrParam(OsiSolverName,name);
+    fprintf(stream_,"{\"event\":\"%s\",\"solver\":",eventNames[event]);
+    writeJsonString(stream_,name);
+    fprintf(stream_,",\"time\":%.6f,\"seconds\":%.6g,"
+	    "\"rows\":%d,\"columns\":%d",
+	    CoinGetTimeOfDay()-startTime_,seconds,
+	    solver->getNumRows(),solver->getNumCols());
+    if (solve) {
+      const char * status;
+      if (solver->isAbandoned())
+	status = "abandoned";
+      else if (solver->isProvenOptimal())
+	status = "optimal";
+      else if (solver->isProvenPrimalInfeasible())
+	status = "infeasible";
+      else if (solver->isProvenDualInfeasible())
+	status = "unbounded";
+      else
+	status = "other";
+      fprintf(stream_,",\"iterations\":%d,\"status\":\"%s\"",
+	      iterations,status);
+    }
+    fprintf(stream_,"}\n");
+  }
+}
+
+void
+OsiSolverStatistics::writeSnapshot(FILE * fp) const
+{
+  fprintf(fp,"{\"time\":%.6f",CoinGetTimeOfDay()-startTime_);
+  for (int i = 0; i < numberEvents; i++) {
+    const Counter & counter = counter_[i];
+    if (!counter.calls)
+      continue;
+    fprintf(fp,",\"%s\":{\"calls\":%d,\"seconds\":%.6g,\"maxSeconds\":%.6g",
+	    eventNames[i],counter.calls,counter.seconds,counter.maxSeconds);
+    if (i <= hotStartEvent)
+      fprintf(fp,",\"iterations\":%.0f",counter.iterations);
+    putc('}',fp);
+  }
+  fprintf(fp,"}\n");
+}
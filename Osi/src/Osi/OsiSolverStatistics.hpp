@@ -0,0 +1,154 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiSolverStatistics_H
+#define OsiSolverStatistics_H
+
+#include <cstdio>
+
+#include "CoinTime.hpp"
+#include "OsiSolverInterface.hpp"
+
+//#############################################################################
+/** Timers and counters for the main calls of a solver interface
+
+    Attach an OsiSolverStatistics object to one or more solver interfaces
+    with OsiSolverInterface::setStatistics().  Each instrumented call then
+    adds to a counter for its event: number of calls, total and longest
+    wall clock time and, for solves, simplex iterations.  Calls nest (for
+    example applyCuts includes the addRows it does and solveFromHotStart
+    may include a resolve), so times are inclusive.
+
+    The counters can be read directly or written as one JSON object with
+    writeSnapshot().  With setEventStream() each call is also written as it
+    finishes, one JSON object per line, giving the solver name, the time
+    since the statistics were reset, the time taken and the problem size.
+
+    Without statistics attached an instrumented call costs one test of a
+    null pointer.  The statistics object is owned by the client and shared
+    by clones of the solver; it is not thread safe, so give each thread
+    its own.
+*/
+class OsiSolverStatistics {
+
+public:
+  /// Instrumented calls
+  enum Event {
+    /// initialSolve()
+    initialSolveEvent = 0,
+    /// resolve()
+    resolveEvent,
+    /// solveFromHotStart()
+    hotStartEvent,
+    /// applyCuts()
+    applyCutsEvent,
+    /// addRows() (all forms which do work)
+    addRowsEvent,
+    /// deleteRows()
+    deleteRowsEvent,
+    /// getMatrixByRow() and getMatrixByCol()
+    getMatrixEvent,
+    /// getColSolution(), getRowPrice(), getReducedCost() and getRowActivity()
+    getSolutionEvent,
+    /// Number of events
+    numberEvents
+  };
+
+  /** Times one call.  Declare at the start of an instrumented method;
+      does nothing unless the solver has statistics attached. */
+  class Timer {
+  public:
+    inline Timer(const OsiSolverInterface * solver, Event event)
+      : statistics_(solver->statistics()),
+	solver_(solver),
+	event_(event),
+	start_(0.0)
+    { if (statistics_) start_ = CoinGetTimeOfDay(); }
+    inline ~Timer()
+    {
+      if (statistics_)
+	statistics_->record(solver_,event_,CoinGetTimeOfDay()-start_);
+    }
+  private:
+    /// Not implemented
+    Timer(const Timer &);
+    /// Not implemented
+    Timer & operator=(const Timer &);
+    OsiSolverStatistics * statistics_;
+    const OsiSolverInterface * solver_;
+    Event event_;
+    double start_;
+  };
+
+  /**@name Recording */
+  //@{
+    /** Record one call of \p event on \p solver taking \p seconds
+	(normally done by Timer). */
+    void record(const OsiSolverInterface * solver, Event event,
+		double seconds);
+    /// Zero all counters and restart the clock
+    void reset();
+    /** Write each call as a line of JSON to fp (NULL to stop).  Getter
+	calls are frequent, so are only written if \p getters is true.
+	The stream is not owned. */
+    void setEventStream(FILE * fp, bool getters = false);
+  //@}
+
+  /**@name Counters */
+  //@{
+    /// Number of calls
+    inline int numberCalls(Event event) const
+    { return counter_[event].calls; }
+    /// Total seconds
+    inline double seconds(Event event) const
+    { return counter_[event].seconds; }
+    /// Longest call in seconds
+    inline double maxSeconds(Event event) const
+    { return counter_[event].maxSeconds; }
+    /// Total iterations (solve events only)
+    inline double iterations(Event event) const
+    { return counter_[event].iterations; }
+    /// Name of event (as used in JSON output)
+    static const char * eventName(Event event);
+    /** Write all counters as one JSON object (and a newline), events with
+	no calls are left out. */
+    void writeSnapshot(FILE * fp) const;
+  //@}
+
+  /**@name Constructors and destructor */
+  //@{
+    /// Default constructor
+    OsiSolverStatistics();
+    /// Destructor
+    ~OsiSolverStatistics();
+  //@}
+
+private:
+  /// Not implemented
+  OsiSolverStatistics(const OsiSolverStatistics &);
+  /// Not implemented
+  OsiSolverStatistics & operator=(const OsiSolverStatistics &);
+
+  /// Counters for one event
+  struct Counter {
+    int calls;
+    double seconds;
+    double maxSeconds;
+    double iterations;
+  };
+
+  /**@name Private member data */
+  //@{
+    /// Counters
+    Counter counter_[numberEvents];
+    /// Time of last reset
+    double startTime_;
+    /// Event stream (not owned)
+    FILE * stream_;
+    /// Whether getter calls are streamed
+    bool streamGetters_;
+  //@}
+};
+
+#endif
@@ -0,0 +1,87 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include "OsiUnitTests.hpp"
+
+#include "OsiCachedArray.hpp"
+
+//--------------------------------------------------------------------------
+void
+OsiCachedArrayUnitTest()
+{
+  // Nothing cached: changes are ignored
+  {
+    OsiCachedArray<double> a;
+    OSIUNITTEST_ASSERT_ERROR(!a.isCached(), {}, "osicachedarray", "default constructor");
+    OSIUNITTEST_ASSERT_ERROR(a.array() == NULL, {}, "osicachedarray", "default constructor");
+    a.set(3,1.0);
+    a.markDirty(0,5);
+    double value = 2.0;
+    a.append(1,&value);
+    OSIUNITTEST_ASSERT_ERROR(!a.isCached() && !a.isDirty() && a.size() == 0, {}, "osicachedarray", "changes when not cached");
+    OSIUNITTEST_ASSERT_ERROR(a.allocate(0) == NULL && !a.isCached(), {}, "osicachedarray", "allocate none");
+  }
+
+  // Fetch, patch, append and remove
+  {
+    OsiCachedArray<double> a;
+    double * array = a.allocate(6);
+    OSIUNITTEST_ASSERT_ERROR(a.isCached() && a.size() == 6, {}, "osicachedarray", "allocate");
+    OSIUNITTEST_ASSERT_ERROR(a.isDirty() && a.dirtyStart() == 0 && a.dirtyEnd() == 6, {}, "osicachedarray", "allocate");
+    for (int i = 0; i < 6; i++)
+      array[i] = i;
+    a.markClean();
+    OSIUNITTEST_ASSERT_ERROR(!a.isDirty(), {}, "osicachedarray", "markClean");
+
+    a.set(2,20.0);
+    OSIUNITTEST_ASSERT_ERROR(a.array()[2] == 20.0 && !a.isDirty(), {}, "osicachedarray", "set");
+
+    a.markDirty(4,5);
+    a.markDirty(1,2);
+    OSIUNITTEST_ASSERT_ERROR(a.dirtyStart() == 1 && a.dirtyEnd() == 5, {}, "osicachedarray", "markDirty widens");
+    a.markClean();
+
+    // grow past capacity, known and unknown entries
+    double values[3] = {6.0, 7.0, 8.0};
+    a.append(3,values);
+    OSIUNITTEST_ASSERT_ERROR(a.size() == 9 && !a.isDirty(), {}, "osicachedarray", "append values");
+    OSIUNITTEST_ASSERT_ERROR(a.array()[2] == 20.0 && a.array()[8] == 8.0, {}, "osicachedarray", "append values");
+    a.append(2,NULL);
+    OSIUNITTEST_ASSERT_ERROR(a.size() == 11 && a.dirtyStart() == 9 && a.dirtyEnd() == 11, {}, "osicachedarray", "append unknown");
+    a.array()[9] = 9.0;
+    a.array()[10] = 10.0;
+
+    // remove unsorted, with a duplicate; dirty range follows the entries
+    int which[4] = {10, 0, 3, 0};
+    a.remove(4,which);
+    OSIUNITTEST_ASSERT_ERROR(a.size() == 8, {}, "osicachedarray", "remove");
+    const double expected[8] = {1.0, 20.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+    bool same = true;
+    for (int i = 0; i < 8; i++)
+      same = same && a.array()[i] == expected[i];
+    OSIUNITTEST_ASSERT_ERROR(same, {}, "osicachedarray", "remove");
+    OSIUNITTEST_ASSERT_ERROR(a.dirtyStart() == 7 && a.dirtyEnd() == 8, {}, "osicachedarray", "remove keeps dirty range");
+
+    int rest[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    a.remove(8,rest);
+    OSIUNITTEST_ASSERT_ERROR(!a.isCached() && !a.isDirty(), {}, "osicachedarray", "remove all");
+  }
+
+  // Other types
+  {
+    OsiCachedArray<char> sense;
+    sense.allocate(2);
+    sense.array()[0] = 'L';
+    sense.array()[1] = 'G';
+    sense.markClean();
+    char e = 'E';
+    sense.append(1,&e);
+    sense.set(0,'R');
+    OSIUNITTEST_ASSERT_ERROR(sense.size() == 3 && sense.array()[0] == 'R' && sense.array()[2] == 'E', {}, "osicachedarray", "char array");
+    sense.free();
+    OSIUNITTEST_ASSERT_ERROR(!sense.isCached() && sense.size() == 0, {}, "osicachedarray", "free");
+  }
+}
@@ -2,11 +2,14 @@
 // Corporation and others.  All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
+#include <cmath>
+
 #include "CoinPragma.hpp"
 
 #include "OsiUnitTests.hpp"
 
 #include "OsiCuts.hpp"
+#include "OsiCutPool.hpp"
 
 //--------------------------------------------------------------------------
 void
@@ -249,3 +252,87 @@ OsiCutsUnitTest()
     }
   }
 }
+
+//--------------------------------------------------------------------------
+void
+OsiCutPoolUnitTest(const OsiSolverInterface * baseSiP)
+{
+  // Three columns, one row x0+x1+x2 <= 3
+  const int columns[] = { 0, 1, 2 };
+  const double ones[] = { 1.0, 1.0, 1.0 };
+  const double solution[] = { 1.0, 0.5, 0.25 };
+
+  OsiCutPool pool;
+  OSIUNITTEST_ASSERT_ERROR(pool.numberCuts() == 0 && pool.numberElements() == 0, {}, "osicutpool", "default constructor");
+  // x0 <= 0.5 (violated by 0.5), x0+x1 <= 1 (by 0.5), x0+x1+x2 >= 2 (by 0.25)
+  pool.insert(1, columns, ones, -COIN_DBL_MAX, 0.5, 0.0, 1);
+  pool.insert(2, columns, ones, -COIN_DBL_MAX, 1.0, 0.0, 2);
+  pool.insert(3, columns, ones, 2.0, COIN_DBL_MAX, 0.0, 2);
+  {
+    OsiRowCut cut;
+    cut.setRow(2, columns+1, ones);
+    cut.setUb(5.0);
+    cut.setEffectiveness(7.0);
+    OsiCuts cuts;
+    cuts.insert(cut);
+    pool.insert(cuts, 3);
+  }
+  OSIUNITTEST_ASSERT_ERROR(pool.numberCuts() == 4 && pool.numberElements() == 8, {}, "osicutpool", "insert");
+  OSIUNITTEST_ASSERT_ERROR(pool.starts()[3] == 6 && pool.length(3) == 2 && pool.indices()[6] == 1, {}, "osicutpool", "insert");
+  OSIUNITTEST_ASSERT_ERROR(pool.efficacy(3) == 7.0 && pool.generator(3) == 3 && pool.ub(3) == 5.0, {}, "osicutpool", "insert");
+  {
+    OsiRowCut cut = pool.rowCut(1);
+    OSIUNITTEST_ASSERT_ERROR(cut.row().getNumElements() == 2 && cut.ub() == 1.0, {}, "osicutpool", "rowCut");
+  }
+
+  // Most effective first; x0+x1+x2 >= 2 has efficacy 0.25/sqrt(3)
+  int which[4];
+  int numberSelected = pool.selectViolated(solution, 0.0, 4, which);
+  OSIUNITTEST_ASSERT_ERROR(numberSelected == 3 && which[0] == 0 && which[1] == 1 && which[2] == 2, {}, "osicutpool", "selectViolated");
+  OSIUNITTEST_ASSERT_ERROR(fabs(pool.efficacy(1)-0.5/sqrt(2.0)) < 1.0e-12 && pool.efficacy(3) == 0.0, {}, "osicutpool", "selectViolated");
+  numberSelected = pool.selectViolated(solution, 0.2, 4, which);
+  OSIUNITTEST_ASSERT_ERROR(numberSelected == 2, {}, "osicutpool", "selectViolated minimum efficacy");
+
+  // Apply a selection and the whole pool
+  {
+    OsiSolverInterface * si = baseSiP->clone();
+    const int starts[] = { 0, 1, 2, 3 };
+    const int rows[] = { 0, 0, 0 };
+    const double lower[] = { 0.0, 0.0, 0.0 };
+    const double upper[] = { 1.0, 1.0, 1.0 };
+    const double rowLower[] = { -si->getInfinity() };
+    const double rowUpper[] = { 3.0 };
+    si->loadProblem(3, 1, starts, rows, ones, lower, upper, ones,
+		    rowLower, rowUpper);
+    const int selection[] = { 2, 0 };
+    si->applyCutPool(pool, 2, selection);
+    OSIUNITTEST_ASSERT_ERROR(si->getNumRows() == 3 && si->getRowLower()[1] == 2.0 && si->getRowUpper()[2] == 0.5, {}, "osicutpool", "applyCutPool selection");
+    OSIUNITTEST_ASSERT_ERROR(si->getMatrixByRow()->getVectorSize(1) == 3, {}, "osicutpool", "applyCutPool selection");
+    si->applyCutPool(pool, pool.numberCuts());
+    OSIUNITTEST_ASSERT_ERROR(si->getNumRows() == 7 && si->getNumElements() == 3+4+8, {}, "osicutpool", "applyCutPool all");
+    delete si;
+  }
+
+  // Aging and eviction
+  pool.ageCuts();
+  pool.ageCuts();
+  pool.markActive(2);
+  pool.markActive(2);
+  pool.ageCuts();
+  OSIUNITTEST_ASSERT_ERROR(pool.age(0) == 3 && pool.age(2) == 1 && pool.activity(2) == 2, {}, "osicutpool", "aging");
+  OsiCutPool copy(pool);
+  pool.setMaximumAge(2);
+  OSIUNITTEST_ASSERT_ERROR(pool.evict() == 3 && pool.numberCuts() == 1 && pool.numberElements() == 3 && pool.lb(0) == 2.0, {}, "osicutpool", "evict by age");
+  // copy: 1 and 3 were least recently used
+  copy.markActive(0);
+  copy.setMaximumCuts(2);
+  OSIUNITTEST_ASSERT_ERROR(copy.evict() == 2 && copy.numberCuts() == 2 && copy.ub(0) == 0.5 && copy.length(1) == 3, {}, "osicutpool", "evict least recently used");
+  // the cut marked active twice is now the oldest
+  copy.insert(1, columns+2, ones, 0.0, 0.0);
+  copy.setEvictionPolicy(OsiCutPool::evictOldest);
+  OSIUNITTEST_ASSERT_ERROR(copy.evict() == 1 && copy.numberCuts() == 2 && copy.ub(0) == 0.5 && copy.lb(1) == 0.0, {}, "osicutpool", "evict oldest");
+  copy.shrink();
+  OSIUNITTEST_ASSERT_ERROR(copy.bytesPerCut() > 0.0 && copy.memoryUsed() < 200, {}, "osicutpool", "memory");
+  copy.clear();
+  OSIUNITTEST_ASSERT_ERROR(copy.numberCuts() == 0 && copy.numberElements() == 0, {}, "osicutpool", "clear");
+}
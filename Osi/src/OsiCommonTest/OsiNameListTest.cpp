@@ -0,0 +1,106 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include "OsiUnitTests.hpp"
+
+#include "OsiNameList.hpp"
+
+//--------------------------------------------------------------------------
+void
+OsiNameListUnitTest()
+{
+  // Names and holes
+  {
+    OsiNameList l;
+    OSIUNITTEST_ASSERT_ERROR(l.size() == 0 && l.name(0) == NULL, {}, "osinamelist", "default constructor");
+    l.set(3,"c3");
+    l.set(1,std::string("c1"));
+    l.set(0,"");
+    OSIUNITTEST_ASSERT_ERROR(l.size() == 4 && l.numberNames() == 2, {}, "osinamelist", "set grows");
+    OSIUNITTEST_ASSERT_ERROR(l.name(0) == NULL && l.name(2) == NULL && l.name(4) == NULL && l.name(-1) == NULL, {}, "osinamelist", "holes");
+    OSIUNITTEST_ASSERT_ERROR(!strcmp(l.name(1),"c1") && !strcmp(l.name(3),"c3"), {}, "osinamelist", "set");
+    l.set(1,std::string());
+    OSIUNITTEST_ASSERT_ERROR(l.name(1) == NULL && l.numberNames() == 1, {}, "osinamelist", "set empty");
+    l.set(1,l.name(3));
+    OSIUNITTEST_ASSERT_ERROR(!strcmp(l.name(1),"c3"), {}, "osinamelist", "set from own name");
+    l.resize(2);
+    OSIUNITTEST_ASSERT_ERROR(l.size() == 2 && l.name(3) == NULL, {}, "osinamelist", "resize down");
+    l.resize(5);
+    OSIUNITTEST_ASSERT_ERROR(l.size() == 5 && l.name(4) == NULL && !strcmp(l.name(1),"c3"), {}, "osinamelist", "resize up");
+    l.clear();
+    OSIUNITTEST_ASSERT_ERROR(l.size() == 0 && l.numberNames() == 0, {}, "osinamelist", "clear");
+  }
+
+  // Deletion
+  {
+    OsiNameList l;
+    char name[20];
+    for (int i = 0; i < 10; i++) {
+      if (i != 5) {
+	sprintf(name,"n%d",i);
+	l.set(i,name);
+      }
+    }
+    l.erase(2,3);
+    OSIUNITTEST_ASSERT_ERROR(l.size() == 7 && !strcmp(l.name(1),"n1") && l.name(2) == NULL && !strcmp(l.name(3),"n6"), {}, "osinamelist", "erase range");
+    l.erase(5,10);
+    OSIUNITTEST_ASSERT_ERROR(l.size() == 5 && !strcmp(l.name(4),"n7"), {}, "osinamelist", "erase past end");
+    // unsorted, with a duplicate and one out of range
+    int which[5] = {4, 0, 2, 0, 17};
+    l.erase(5,which);
+    OSIUNITTEST_ASSERT_ERROR(l.size() == 2 && !strcmp(l.name(0),"n1") && !strcmp(l.name(1),"n6"), {}, "osinamelist", "erase list");
+  }
+
+  // Every change is counted, and nothing else
+  {
+    OsiNameList l;
+    int changes = l.changes();
+    l.set(2,"a");
+    bool ok = l.changes() != changes;
+    changes = l.changes();
+    ok = ok && l.name(2) && l.numberNames() == 1 && l.changes() == changes;
+    l.set(0,std::string("b"));
+    ok = ok && l.changes() != changes;
+    changes = l.changes();
+    l.erase(0,1);
+    ok = ok && l.changes() != changes;
+    changes = l.changes();
+    int which[1] = {0};
+    l.erase(1,which);
+    ok = ok && l.changes() != changes;
+    changes = l.changes();
+    which[0] = 7;
+    l.erase(1,which);
+    ok = ok && l.changes() == changes;
+    l.resize(4);
+    ok = ok && l.changes() != changes;
+    changes = l.changes();
+    l.clear();
+    ok = ok && l.changes() != changes;
+    OSIUNITTEST_ASSERT_ERROR(ok, {}, "osinamelist", "changes counted");
+  }
+
+  // Text of replaced names is reclaimed
+  {
+    OsiNameList l;
+    char name[40];
+    for (int k = 0; k < 200; k++) {
+      for (int i = 0; i < 50; i++) {
+	sprintf(name,"name_%d_%d",i,k);
+	l.set(i,name);
+      }
+    }
+    bool ok = l.size() == 50 && l.numberNames() == 50;
+    for (int i = 0; i < 50 && ok; i++) {
+      sprintf(name,"name_%d_199",i);
+      ok = !strcmp(l.name(i),name);
+    }
+    OSIUNITTEST_ASSERT_ERROR(ok, {}, "osinamelist", "names survive compaction");
+  }
+}
@@ -66,6 +66,15 @@ void OsiRowCutDebuggerUnitTest
 /** A function that tests the methods in the OsiCuts class. */
 void OsiCutsUnitTest();
 
+/** A function that tests the methods in the OsiCutPool class. */
+void OsiCutPoolUnitTest(const OsiSolverInterface * baseSiP);
+
+/** A function that tests the methods in the OsiCachedArray class. */
+void OsiCachedArrayUnitTest();
+
+/** A function that tests the methods in the OsiNameList class. */
+void OsiNameListUnitTest();
+
 /// A namespace so we can define a few `global' variables to use during tests.
 namespace OsiUnitTest {
 
@@ -18,6 +18,7 @@
 #include "CoinPragma.hpp"
 
 #include "OsiCpxSolverInterface.hpp"
+#include "OsiSolverStatistics.hpp"
 
 #include "cplex.h"
 
@@ -48,15 +49,6 @@ inline void freeCacheDouble( double*& ptr )
     }
 }
 
-inline void freeCacheChar( char*& ptr )
-{
-  if( ptr != NULL )
-    {
-      delete [] ptr;
-      ptr = NULL;
-    }
-}
-
 inline void freeCacheMatrix( CoinPackedMatrix*& ptr )
 {
   if( ptr != NULL )
@@ -80,6 +72,35 @@ checkCPXerror( int err, std::string cpxfuncname, std::string osimethod )
     }
 }
 
+/* Removes all but the last of several changes to the same bound (type
+   not NULL) or objective coefficient, keeping the order of the rest, and
+   returns how many are left.  CPLEX does not promise which would win. */
+static int
+removeOverwrittenChanges( int n, int* index, char* type, double* value, int numberColumns )
+{
+  std::vector<int> last( type ? 2*numberColumns : numberColumns, -1 );
+  int i;
+  for( i = 0; i < n; ++i )
+    {
+      if( index[i] < 0 || index[i] >= numberColumns )
+	return n; // let CPLEX complain
+      last[type ? 2*index[i] + (type[i] == 'U') : index[i]] = i;
+    }
+  int put = 0;
+  for( i = 0; i < n; ++i )
+    {
+      if( last[type ? 2*index[i] + (type[i] == 'U') : index[i]] == i )
+	{
+	  index[put] = index[i];
+	  if( type )
+	    type[put] = type[i];
+	  value[put] = value[i];
+	  ++put;
+	}
+    }
+  return put;
+}
+
 static bool incompletemessage = false;
 
 static
@@ -251,6 +272,8 @@ OsiCpxSolverInterface::freeColType()
 void OsiCpxSolverInterface::initialSolve()
 {
   debugMessage("OsiCpxSolverInterface::initialSolve()\n");
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::initialSolveEvent);
   
   switchToLP();
 
@@ -381,6 +404,7 @@ void OsiCpxSolverInterface::initialSolve()
 void OsiCpxSolverInterface::resolve()
 {
   debugMessage("OsiCpxSolverInterface::resolve()\n");
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::resolveEvent);
 
   switchToLP();
 
@@ -1041,6 +1065,7 @@ void OsiCpxSolverInterface::markHotStart()
 void OsiCpxSolverInterface::solveFromHotStart()
 {
   debugMessage("OsiCpxSolverInterface::solveFromHotStart()\n");
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::hotStartEvent);
 
   int err;
   int maxiter;
@@ -1081,13 +1106,18 @@ int OsiCpxSolverInterface::getNumCols() const
 {
   debugMessage("OsiCpxSolverInterface::getNumCols()\n");
 
-  return CPXgetnumcols( env_, getMutableLpPtr() );
+  if( lp_ == NULL )
+    return CPXgetnumcols( env_, getMutableLpPtr() );
+  // no need to pass on queued changes just to count them
+  return CPXgetnumcols( env_, lp_ ) + static_cast<int>(pendingObj_.size());
 }
 int OsiCpxSolverInterface::getNumRows() const
 {
   debugMessage("OsiCpxSolverInterface::getNumRows()\n");
 
-  return CPXgetnumrows( env_, getMutableLpPtr() );
+  if( lp_ == NULL )
+    return CPXgetnumrows( env_, getMutableLpPtr() );
+  return CPXgetnumrows( env_, lp_ ) + static_cast<int>(pendingSense_.size());
 }
 int OsiCpxSolverInterface::getNumElements() const
 {
@@ -1104,173 +1134,173 @@ const double * OsiCpxSolverInterface::getColLower() const
 {
   debugMessage("OsiCpxSolverInterface::getColLower()\n");
 
-  if( collower_ == NULL )
+  if( !collower_.isCached() )
+    collower_.allocate( CPXgetnumcols( env_, getMutableLpPtr() ) );
+  if( collower_.isDirty() )
     {
-      int ncols = CPXgetnumcols( env_, getMutableLpPtr() );
-      if( ncols > 0 )
-	{
-	  collower_ = new double[ncols];
-	  CPXgetlb( env_, getMutableLpPtr(), collower_, 0, ncols-1 );
-	}
+      const int first = collower_.dirtyStart();
+      CPXgetlb( env_, getMutableLpPtr(), collower_.array() + first, first, collower_.dirtyEnd()-1 );
+      collower_.markClean();
     }
-  return collower_;
+  return collower_.array();
 }
 //------------------------------------------------------------------
 const double * OsiCpxSolverInterface::getColUpper() const
 {
   debugMessage("OsiCpxSolverInterface::getColUpper()\n");
 
-  if( colupper_ == NULL )
+  if( !colupper_.isCached() )
+    colupper_.allocate( CPXgetnumcols( env_, getMutableLpPtr() ) );
+  if( colupper_.isDirty() )
     {
-      int ncols = CPXgetnumcols( env_, getMutableLpPtr() );
-      if( ncols > 0 )
-	{
-	  colupper_ = new double[ncols];
-	  CPXgetub( env_, getMutableLpPtr(), colupper_, 0, ncols-1 );
-	}
+      const int first = colupper_.dirtyStart();
+      CPXgetub( env_, getMutableLpPtr(), colupper_.array() + first, first, colupper_.dirtyEnd()-1 );
+      colupper_.markClean();
     }
-  return colupper_;
+  return colupper_.array();
 }
 //------------------------------------------------------------------
 const char * OsiCpxSolverInterface::getRowSense() const
 {
   debugMessage("OsiCpxSolverInterface::getRowSense()\n");
 
-  if ( rowsense_==NULL )
+  if ( !rowsense_.isCached() || rowsense_.isDirty() )
     {      
       // rowsense is determined with rhs, so invoke rhs
       getRightHandSide();
-      assert( rowsense_!=NULL || getNumRows() == 0 );
+      assert( rowsense_.isCached() || getNumRows() == 0 );
     }
-  return rowsense_;
+  return rowsense_.array();
 }
 //------------------------------------------------------------------
 const double * OsiCpxSolverInterface::getRightHandSide() const
 {
   debugMessage("OsiCpxSolverInterface::getRightHandSide()\n");
 
-  if ( rhs_==NULL )
+  if ( !rhs_.isCached() )
     {
-      CPXLPptr lp = getMutableLpPtr();
       int nrows = getNumRows();
-      if( nrows > 0 ) 
-	{
-	  rhs_ = new double[nrows];
-	  CPXgetrhs( env_, lp, rhs_, 0, nrows-1 );
-	  
-	  assert( rowrange_ == NULL );
-	  rowrange_ = new double[nrows];
-	  CPXgetrngval( env_, lp, rowrange_, 0, nrows-1 );
-	  
-	  assert( rowsense_ == NULL );
-	  rowsense_ = new char[nrows];
-	  CPXgetsense( env_, lp, rowsense_, 0, nrows-1 );
+      assert( !rowrange_.isCached() && !rowsense_.isCached() );
+      rhs_.allocate( nrows );
+      rowrange_.allocate( nrows );
+      rowsense_.allocate( nrows );
+    }
+  if ( rhs_.isDirty() )
+    {
+      // only rows changed since last time (all if none were cached)
+      CPXLPptr lp = getMutableLpPtr();
+      const int first = rhs_.dirtyStart();
+      const int last = rhs_.dirtyEnd()-1;
+      double *rhs = rhs_.array();
+      double *rowrange = rowrange_.array();
+      char *rowsense = rowsense_.array();
+      CPXgetrhs( env_, lp, rhs + first, first, last );
+      CPXgetrngval( env_, lp, rowrange + first, first, last );
+      CPXgetsense( env_, lp, rowsense + first, first, last );
 	  
-	  double inf = getInfinity();
-	  int i;
-	  for ( i = 0; i < nrows; ++i ) 
-	    {  
-	      if ( rowsense_[i] != 'R' ) 
-		rowrange_[i]=0.0;
-	      else
+      double inf = getInfinity();
+      int i;
+      for ( i = first; i <= last; ++i ) 
+	{  
+	  if ( rowsense[i] != 'R' ) 
+	    rowrange[i]=0.0;
+	  else
+	    {
+	      if ( rhs[i] <= -inf ) 
 		{
-		  if ( rhs_[i] <= -inf ) 
-		    {
-		      rowsense_[i] = 'N';
-		      rowrange_[i] = 0.0;
-		      rhs_[i] = 0.0;
-		    } 
-		  else 
-		    {
-		      if( rowrange_[i] >= 0.0 )
-			rhs_[i] = rhs_[i] + rowrange_[i];
-		      else
-			rowrange_[i] = -rowrange_[i];
-		    }
+		  rowsense[i] = 'N';
+		  rowrange[i] = 0.0;
+		  rhs[i] = 0.0;
+		} 
+	      else 
+		{
+		  if( rowrange[i] >= 0.0 )
+		    rhs[i] = rhs[i] + rowrange[i];
+		  else
+		    rowrange[i] = -rowrange[i];
 		}
 	    }
 	}
+      rhs_.markClean();
+      rowrange_.markClean();
+      rowsense_.markClean();
     }
-  return rhs_;
+  return rhs_.array();
 }
 //------------------------------------------------------------------
 const double * OsiCpxSolverInterface::getRowRange() const
 {
   debugMessage("OsiCpxSolverInterface::getRowRange()\n");
 
-  if ( rowrange_==NULL ) 
+  if ( !rowrange_.isCached() || rowrange_.isDirty() ) 
     {
       // rowrange is determined with rhs, so invoke rhs
       getRightHandSide();
-      assert( rowrange_!=NULL || getNumRows() == 0 );
+      assert( rowrange_.isCached() || getNumRows() == 0 );
     }
-  return rowrange_;
+  return rowrange_.array();
 }
 //------------------------------------------------------------------
 const double * OsiCpxSolverInterface::getRowLower() const
 {
   debugMessage("OsiCpxSolverInterface::getRowLower()\n");
 
-  if ( rowlower_ == NULL )
+  if ( !rowlower_.isCached() )
+    rowlower_.allocate( getNumRows() );
+  if ( rowlower_.isDirty() )
     {
-      int     nrows = getNumRows();
       const   char    *rowsense = getRowSense();
       const   double  *rhs      = getRightHandSide();
       const   double  *rowrange = getRowRange();
-    
-      if ( nrows > 0 )
-	{
-	  rowlower_ = new double[nrows];
-	  
-	  double dum1;
-	  for ( int i = 0;  i < nrows;  i++ )
-	    convertSenseToBound( rowsense[i], rhs[i], rowrange[i],
-				 rowlower_[i], dum1 );
-	}
+      double  *bound = rowlower_.array();
+      
+      double dum1;
+      for ( int i = rowlower_.dirtyStart();  i < rowlower_.dirtyEnd();  i++ )
+	convertSenseToBound( rowsense[i], rhs[i], rowrange[i],
+			     bound[i], dum1 );
+      rowlower_.markClean();
     }
-  return rowlower_;
+  
+  return rowlower_.array();
 }
 //------------------------------------------------------------------
 const double * OsiCpxSolverInterface::getRowUpper() const
 {  
   debugMessage("OsiCpxSolverInterface::getRowUpper()\n");
 
-  if ( rowupper_ == NULL )
+  if ( !rowupper_.isCached() )
+    rowupper_.allocate( getNumRows() );
+  if ( rowupper_.isDirty() )
     {
-      int     nrows = getNumRows();
       const   char    *rowsense = getRowSense();
       const   double  *rhs      = getRightHandSide();
       const   double  *rowrange = getRowRange();
+      double  *bound = rowupper_.array();
       
-      if ( nrows > 0 ) 
-	{
-	  rowupper_ = new double[nrows];
-	  
-	  double dum1;
-	  for ( int i = 0;  i < nrows;  i++ )
-	    convertSenseToBound( rowsense[i], rhs[i], rowrange[i],
-				 dum1, rowupper_[i] );
-	}
+      double dum1;
+      for ( int i = rowupper_.dirtyStart();  i < rowupper_.dirtyEnd();  i++ )
+	convertSenseToBound( rowsense[i], rhs[i], rowrange[i],
+			     dum1, bound[i] );
+      rowupper_.markClean();
     }
   
-  return rowupper_;
+  return rowupper_.array();
 }
 //------------------------------------------------------------------
 const double * OsiCpxSolverInterface::getObjCoefficients() const
 {
   debugMessage("OsiCpxSolverInterface::getObjCoefficients()\n");
 
-  if ( obj_==NULL )
+  if ( !obj_.isCached() )
+    obj_.allocate( CPXgetnumcols( env_, getMutableLpPtr() ) );
+  if ( obj_.isDirty() )
     {
-      int ncols = CPXgetnumcols( env_, getMutableLpPtr() );
-      if( ncols > 0 )
-	{
-	  obj_ = new double[ncols];
-	  int err = CPXgetobj( env_, getMutableLpPtr(), obj_, 0, ncols-1 );
-	  checkCPXerror( err, "CPXgetobj", "getObjCoefficients" );
-	}
+      const int first = obj_.dirtyStart();
+      int err = CPXgetobj( env_, getMutableLpPtr(), obj_.array() + first, first, obj_.dirtyEnd()-1 );
+      checkCPXerror( err, "CPXgetobj", "getObjCoefficients" );
+      obj_.markClean();
     }
-  return obj_;
+  return obj_.array();
 }
 //------------------------------------------------------------------
 double OsiCpxSolverInterface::getObjSense() const
@@ -1301,6 +1331,7 @@ bool OsiCpxSolverInterface::isContinuous( int colNumber ) const
 const CoinPackedMatrix * OsiCpxSolverInterface::getMatrixByRow() const
 {
   debugMessage("OsiCpxSolverInterface::getMatrixByRow()\n");
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
 
   if ( matrixByRow_ == NULL ) 
     {
@@ -1324,7 +1355,8 @@ const CoinPackedMatrix * OsiCpxSolverInterface::getMatrixByRow() const
 		       &requiredSpace, 0, nrows-1 );
       assert( requiredSpace == 0 );
             
-      matrixByRow_ = new CoinPackedMatrix();
+      // extra major space so that added rows rarely copy the matrix
+      matrixByRow_ = new CoinPackedMatrix( false, 0.25, 0.0 );
       
       // Should be able to pass null for length of packed matrix,
       // assignMatrix does not seem to allow (even though documentation
@@ -1347,6 +1379,7 @@ const CoinPackedMatrix * OsiCpxSolverInterface::getMatrixByRow() const
 const CoinPackedMatrix * OsiCpxSolverInterface::getMatrixByCol() const
 {
   debugMessage("OsiCpxSolverInterface::getMatrixByCol()\n");
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
 
   if ( matrixByCol_ == NULL )
     {
@@ -1370,7 +1403,8 @@ const CoinPackedMatrix * OsiCpxSolverInterface::getMatrixByCol() const
 		       &requiredSpace, 0, ncols-1 );
       assert( requiredSpace == 0);
       
-      matrixByCol_ = new CoinPackedMatrix();
+      // extra major space so that added columns rarely copy the matrix
+      matrixByCol_ = new CoinPackedMatrix( true, 0.25, 0.0 );
       
       // Should be able to pass null for length of packed matrix,
       // assignMatrix does not seem to allow (even though documentation
@@ -1408,6 +1442,8 @@ double OsiCpxSolverInterface::getInfinity() const
 const double * OsiCpxSolverInterface::getColSolution() const
 {
   debugMessage("OsiCpxSolverInterface::getColSolution()\n");
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 
   if( colsol_==NULL )
   {
@@ -1462,6 +1498,8 @@ const double * OsiCpxSolverInterface::getColSolution() const
 const double * OsiCpxSolverInterface::getRowPrice() const
 {
   debugMessage("OsiCpxSolverInterface::getRowPrice()\n");
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 
   if( rowsol_==NULL )
   {
@@ -1495,6 +1533,8 @@ const double * OsiCpxSolverInterface::getRowPrice() const
 const double * OsiCpxSolverInterface::getReducedCost() const
 {
   debugMessage("OsiCpxSolverInterface::getReducedCost()\n");
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 
   if( redcost_==NULL )
   {
@@ -1528,6 +1568,8 @@ const double * OsiCpxSolverInterface::getReducedCost() const
 const double * OsiCpxSolverInterface::getRowActivity() const
 {
   debugMessage("OsiCpxSolverInterface::getRowActivity()\n");
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 
   if( rowact_==NULL )
   {
@@ -1759,12 +1801,10 @@ void OsiCpxSolverInterface::setObjCoeff( int elementIndex, double elementValue )
 {
   debugMessage("OsiCpxSolverInterface::setObjCoeff(%d, %g)\n", elementIndex, elementValue);
 
-  //  int err = CPXchgobj(env_, getLpPtr( OsiCpxSolverInterface::FREECACHED_COLUMN ), 1, &elementIndex, &elementValue);
-  int err = CPXchgobj(env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_PROBLEM ), 1, &elementIndex, &elementValue);
-  checkCPXerror(err, "CPXchgobj", "setObjCoeff");
-  if(obj_ != NULL) {
-    obj_[elementIndex] = elementValue;
-  }
+  freeCachedData( OsiCpxSolverInterface::KEEPCACHED_PROBLEM );
+  pendingObjIndex_.push_back( elementIndex );
+  pendingObjValue_.push_back( elementValue );
+  obj_.set( elementIndex, elementValue );
 }
 //-----------------------------------------------------------------------------
 void OsiCpxSolverInterface::setObjCoeffSet(const int* indexFirst,
@@ -1774,19 +1814,12 @@ void OsiCpxSolverInterface::setObjCoeffSet(const int* indexFirst,
   debugMessage("OsiCpxSolverInterface::setObjCoeffSet(%p, %p, %p)\n", (void*)indexFirst, (void*)indexLast, (void*)coeffList);
 
    const long int cnt = indexLast - indexFirst;
-   //   int err = CPXchgobj(env_,
-   //		       getLpPtr(OsiCpxSolverInterface::FREECACHED_COLUMN), cnt,
-   //		       const_cast<int*>(indexFirst),
-   //		       const_cast<double*>(coeffList));
-   int err = CPXchgobj(env_,
-		       getLpPtr(OsiCpxSolverInterface::KEEPCACHED_PROBLEM), 
-		       static_cast<int>(cnt),
-		       const_cast<int*>(indexFirst),
-		       const_cast<double*>(coeffList));
-   checkCPXerror(err, "CPXchgobj", "setObjCoeffSet");
-   if (obj_ != NULL) {
+   freeCachedData( OsiCpxSolverInterface::KEEPCACHED_PROBLEM );
+   pendingObjIndex_.insert( pendingObjIndex_.end(), indexFirst, indexLast );
+   pendingObjValue_.insert( pendingObjValue_.end(), coeffList, coeffList + cnt );
+   if (obj_.isCached()) {
        for (int i = 0; i < cnt; ++i) {
-	   obj_[indexFirst[i]] = coeffList[i];
+	   obj_.set( indexFirst[i], coeffList[i] );
        }
    }
 }
@@ -1795,56 +1828,37 @@ void OsiCpxSolverInterface::setColLower(int elementIndex, double elementValue)
 {
   debugMessage("OsiCpxSolverInterface::setColLower(%d, %g)\n", elementIndex, elementValue);
 
-  char c = 'L';
-  //  int err = CPXchgbds( env_, getLpPtr( OsiCpxSolverInterface::FREECACHED_COLUMN ), 1, &elementIndex, &c, &elementValue );
-  int err = CPXchgbds( env_, 
-		       getLpPtr( OsiCpxSolverInterface::KEEPCACHED_PROBLEM ), 
-		       1, &elementIndex, &c, &elementValue );
-  checkCPXerror( err, "CPXchgbds", "setColLower" );
-  if(collower_ != NULL) {
-    collower_[elementIndex] = elementValue;
-  }
+  freeCachedData( OsiCpxSolverInterface::KEEPCACHED_PROBLEM );
+  pendingBoundIndex_.push_back( elementIndex );
+  pendingBoundType_.push_back( 'L' );
+  pendingBoundValue_.push_back( elementValue );
+  collower_.set( elementIndex, elementValue );
 }
 //-----------------------------------------------------------------------------
 void OsiCpxSolverInterface::setColUpper(int elementIndex, double elementValue)
 {  
   debugMessage("OsiCpxSolverInterface::setColUpper(%d, %g)\n", elementIndex, elementValue);
 
-  char c = 'U';
-  //  int err = CPXchgbds( env_, getLpPtr( OsiCpxSolverInterface::FREECACHED_COLUMN ), 1, &elementIndex, &c, &elementValue );
-  int err = CPXchgbds( env_, 
-		       getLpPtr( OsiCpxSolverInterface::KEEPCACHED_PROBLEM ), 
-		       1, &elementIndex, &c, &elementValue );
-  checkCPXerror( err, "CPXchgbds", "setColUpper" );
-  if(colupper_ != NULL) {
-    colupper_[elementIndex] = elementValue;
-  }
+  freeCachedData( OsiCpxSolverInterface::KEEPCACHED_PROBLEM );
+  pendingBoundIndex_.push_back( elementIndex );
+  pendingBoundType_.push_back( 'U' );
+  pendingBoundValue_.push_back( elementValue );
+  colupper_.set( elementIndex, elementValue );
 } 
 //-----------------------------------------------------------------------------
 void OsiCpxSolverInterface::setColBounds( int elementIndex, double lower, double upper )
 {
   debugMessage("OsiCpxSolverInterface::setColBounds(%d, %g, %g)\n", elementIndex, lower, upper);
 
-  char c[2] = { 'L', 'U' };
-  int ind[2];
-  double bd[2];
-  int err;
-
-  ind[0] = elementIndex;
-  ind[1] = elementIndex;
-  bd[0] = lower;
-  bd[1] = upper;
-  //  err = CPXchgbds( env_, getLpPtr( OsiCpxSolverInterface::FREECACHED_COLUMN ), 2, ind, c, bd );
-  err = CPXchgbds( env_, 
-		   getLpPtr( OsiCpxSolverInterface::KEEPCACHED_PROBLEM ), 
-		   2, ind, c, bd );
-  checkCPXerror( err, "CPXchgbds", "setColBounds" );
-  if(collower_ != NULL) {
-    collower_[elementIndex] = lower;
-  }
-  if(colupper_ != NULL) {
-    colupper_[elementIndex] = upper;
-  }
+  freeCachedData( OsiCpxSolverInterface::KEEPCACHED_PROBLEM );
+  pendingBoundIndex_.push_back( elementIndex );
+  pendingBoundType_.push_back( 'L' );
+  pendingBoundValue_.push_back( lower );
+  pendingBoundIndex_.push_back( elementIndex );
+  pendingBoundType_.push_back( 'U' );
+  pendingBoundValue_.push_back( upper );
+  collower_.set( elementIndex, lower );
+  colupper_.set( elementIndex, upper );
 }
 //-----------------------------------------------------------------------------
 void OsiCpxSolverInterface::setColSetBounds(const int* indexFirst,
@@ -1857,33 +1871,18 @@ void OsiCpxSolverInterface::setColSetBounds(const int* indexFirst,
    if (cnt <= 0)
       return;
 
-   char* c = new char[2*cnt];
-   int* ind = new int[2*cnt];
+   freeCachedData( OsiCpxSolverInterface::KEEPCACHED_PROBLEM );
    for (int i = 0; i < cnt; ++i) {
-      register const int j = 2 * i;
-      c[j] = 'L';
-      c[j+1] = 'U';
       const int colind = indexFirst[i];
-      ind[j] = colind;
-      ind[j+1] = colind;
+      pendingBoundIndex_.push_back( colind );
+      pendingBoundType_.push_back( 'L' );
+      pendingBoundIndex_.push_back( colind );
+      pendingBoundType_.push_back( 'U' );
 
-      if(collower_ != NULL) {
-	collower_[colind] = boundList[2 * i];
-      }
-      if(colupper_ != NULL) {
-	colupper_[colind] = boundList[2 * i + 1];
-      }
+      collower_.set( colind, boundList[2 * i] );
+      colupper_.set( colind, boundList[2 * i + 1] );
    }
-   //   int err = CPXchgbds( env_,
-   //			getLpPtr(OsiCpxSolverInterface::FREECACHED_ROW ),
-   //                            2*cnt, ind, c, 
-   //                            const_cast<double*>(boundList) );
-   int err = CPXchgbds( env_,
-			getLpPtr(OsiCpxSolverInterface::KEEPCACHED_PROBLEM),
-			2*static_cast<int>(cnt), ind, c, const_cast<double*>(boundList) );
-   checkCPXerror( err, "CPXchgbds", "setColSetBounds" );
-   delete[] ind;
-   delete[] c;
+   pendingBoundValue_.insert( pendingBoundValue_.end(), boundList, boundList + 2*cnt );
    // OsiSolverInterface::setColSetBounds( indexFirst, indexLast, boundList );
 }
 //-----------------------------------------------------------------------------
@@ -1940,6 +1939,7 @@ OsiCpxSolverInterface::setRowType(int i, char sense, double rightHandSide,
   debugMessage("OsiCpxSolverInterface::setRowType(%d, %c, %g, %g)\n", i, sense, rightHandSide, range);
 
   int err;
+  cacheRowType( i, sense, rightHandSide, range );
 
   // in CPLEX, ranged constraints are interpreted as rhs <= coeff*x <= rhs+range, which is different from Osi
   double cpxrhs = rightHandSide;
@@ -1969,31 +1969,14 @@ OsiCpxSolverInterface::setRowType(int i, char sense, double rightHandSide,
 		     getLpPtr( OsiCpxSolverInterface::KEEPCACHED_PROBLEM ),
 		     1, &i, &sense );
   checkCPXerror( err, "CPXchgsense", "setRowType" );
-  if(rowsense_ != NULL) {
-    rowsense_[i] = sense;
-  }
 
   err = CPXchgrhs( env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_PROBLEM ),
 		   1, &i, &cpxrhs );
   checkCPXerror( err, "CPXchgrhs", "setRowType" );
-  if(rhs_ != NULL) {
-    rhs_[i] = rightHandSide;
-  }
   err = CPXchgrngval( env_, 
 		      getLpPtr( OsiCpxSolverInterface::KEEPCACHED_PROBLEM ),
 		      1, &i, &range );
   checkCPXerror( err, "CPXchgrngval", "setRowType" );
-  if(rowrange_ != NULL) {
-    rowrange_[i] = range;
-  }
-  
-  if (rowlower_ != NULL || rowupper_ != NULL)
-  {
-  	double dummy;
-  	convertSenseToBound(sense, rightHandSide, range, 
-  			rowlower_ ? rowlower_[i] : dummy,
-  			rowupper_ ? rowupper_[i] : dummy);
-  }
 }
 //-----------------------------------------------------------------------------
 void OsiCpxSolverInterface::setRowSetBounds(const int* indexFirst,
@@ -2071,32 +2054,19 @@ OsiCpxSolverInterface::setRowSetTypes(const int* indexFirst,
    checkCPXerror( err, "CPXchgrngval", "setRowSetTypes" );
    ********************/
 
-   err = CPXchgsense(env_, getLpPtr(OsiCpxSolverInterface::KEEPCACHED_ROW),
+   err = CPXchgsense(env_, getLpPtr(OsiCpxSolverInterface::KEEPCACHED_PROBLEM),
       static_cast<int>(cnt), const_cast<int*>(indexFirst), sense);
    checkCPXerror( err, "CPXchgsense", "setRowSetTypes" );
-   err = CPXchgrhs(env_, getLpPtr(OsiCpxSolverInterface::FREECACHED_ROW),
+   err = CPXchgrhs(env_, getLpPtr(OsiCpxSolverInterface::KEEPCACHED_PROBLEM),
 		   static_cast<int>(cnt), const_cast<int*>(indexFirst), rhs);
    checkCPXerror( err, "CPXchgrhs", "setRowSetTypes" );
-   err = CPXchgrngval(env_, getLpPtr(OsiCpxSolverInterface::FREECACHED_ROW),
+   err = CPXchgrngval(env_, getLpPtr(OsiCpxSolverInterface::KEEPCACHED_PROBLEM),
 		      rangecnt, rangeind, range);
    checkCPXerror( err, "CPXchgrngval", "setRowSetTypes" );
 
-   int j;
-   if(rowsense_ != NULL) {
-     for(j=0; j<cnt; j++) {
-       rowsense_[indexFirst[j]] = sense[j];
-     }
-   }
-   if(rhs_ != NULL) {
-     for(j=0; j<cnt; j++) {
-       rhs_[indexFirst[j]] = rhs[j];
-     }
-   }
-   if(rowrange_ != NULL) {
-     for(j=0; j<rangecnt; j++) {
-       rowrange_[rangeind[j]] = range[j];
-     }
-   }
+   for (int j = 0; j < cnt; ++j)
+     cacheRowType( indexFirst[j], senseList[j], rhsList[j],
+		   senseList[j] == 'R' ? rangeList[j] : 0.0 );
    delete[] rangeind;
    delete[] range;
    delete[] rhs;
@@ -2256,17 +2226,8 @@ OsiCpxSolverInterface::addCol(const CoinPackedVectorBase& vec,
   resizeColType(nc + 1);
   coltype_[nc] = 'C';
 
-  int err;
-  int cmatbeg[2] = {0, vec.getNumElements()};
-
-  err = CPXaddcols( env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_ROW ),
-		    1, vec.getNumElements(), const_cast<double*>(&obj),
-		    cmatbeg,
-		    const_cast<int*>(vec.getIndices()),
-		    const_cast<double*>(vec.getElements()),
-		    const_cast<double*>(&collb),
-		    const_cast<double*>(&colub), NULL );
-  checkCPXerror( err, "CPXaddcols", "addCol" );
+  queueColumn( vec.getNumElements(), vec.getIndices(), vec.getElements(),
+	       obj, collb, colub );
 }
 //-----------------------------------------------------------------------------
 void 
@@ -2283,39 +2244,11 @@ OsiCpxSolverInterface::addCols(const int numcols,
   resizeColType(nc + numcols);
   CoinFillN(&coltype_[nc], numcols, 'C');
 
-  int i;
-  int nz = 0;
-  for (i = 0; i < numcols; ++i)
-    nz += cols[i]->getNumElements();
-
-  int* index = new int[nz];
-  double* elem = new double[nz];
-  int* start = new int[numcols+1];
-
-  nz = 0;
-  start[0] = 0;
-  for (i = 0; i < numcols; ++i) {
+  for (int i = 0; i < numcols; ++i) {
     const CoinPackedVectorBase* col = cols[i];
-    const int len = col->getNumElements();
-    CoinDisjointCopyN(col->getIndices(), len, index+nz);
-    CoinDisjointCopyN(col->getElements(), len, elem+nz);
-    nz += len;
-    start[i+1] = nz;
+    queueColumn( col->getNumElements(), col->getIndices(), col->getElements(),
+		 obj[i], collb[i], colub[i] );
   }
-  int err = CPXaddcols(env_, getLpPtr(OsiCpxSolverInterface::KEEPCACHED_ROW),
-		       numcols, nz, const_cast<double*>(obj),
-		       start, index, elem, 
-		       const_cast<double*>(collb),
-		       const_cast<double*>(colub), NULL );
-  checkCPXerror( err, "CPXaddcols", "addCols" );
-
-  delete[] start;
-  delete[] elem;
-  delete[] index;
-
-//    int i;
-//    for( i = 0; i < numcols; ++i )
-//      addCol( *(cols[i]), collb[i], colub[i], obj[i] );
 }
 //-----------------------------------------------------------------------------
 void 
@@ -2328,11 +2261,33 @@ OsiCpxSolverInterface::deleteCols(const int num, const int * columnIndices)
   int i, err;
 
   CoinFillN(delstat, ncols, 0);
+  int ndistinct = 0;
   for( i = 0; i < num; ++i )
-    delstat[columnIndices[i]] = 1;
-  err = CPXdelsetcols( env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_ROW ), delstat );
+    if( !delstat[columnIndices[i]] )
+      {
+	delstat[columnIndices[i]] = 1;
+	++ndistinct;
+      }
+  err = CPXdelsetcols( env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_PROBLEM ), delstat );
   checkCPXerror( err, "CPXdelsetcols", "deleteCols" );
 
+  obj_.remove( num, columnIndices );
+  collower_.remove( num, columnIndices );
+  colupper_.remove( num, columnIndices );
+  // CoinPackedMatrix does not allow duplicates (and loses the number of
+  // rows if all columns go)
+  if( ndistinct == num && ndistinct < ncols )
+    {
+      if( matrixByRow_ )
+	matrixByRow_->deleteCols( num, columnIndices );
+      if( matrixByCol_ )
+	matrixByCol_->deleteCols( num, columnIndices );
+    }
+  else
+    {
+      freeCachedMatrix();
+    }
+
   for( i = 0; i < ncols; ++i )
   {
      assert(delstat[i] <= i);
@@ -2393,8 +2348,6 @@ OsiCpxSolverInterface::addRow(const CoinPackedVectorBase& vec,
 {
   debugMessage("OsiCpxSolverInterface::addRow(%p, %c, %g, %g)\n", (void*)&vec, rowsen, rowrhs, rowrng);
 
-  int err;
-  int rmatbeg = 0;
   double rhs;
   double range;
   char sense = rowsen;
@@ -2416,20 +2369,8 @@ OsiCpxSolverInterface::addRow(const CoinPackedVectorBase& vec,
       range = 0.0;
     }
 
-  err = CPXaddrows( env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_COLUMN ), 0, 1, vec.getNumElements(), 
-		    &rhs,
-		    &sense,
-		    &rmatbeg,
-		    const_cast<int*>(vec.getIndices()),
-		    const_cast<double*>(vec.getElements()),
-		    NULL, NULL );
-  checkCPXerror( err, "CPXaddrows", "addRow" );
-  if( sense == 'R' )
-    {
-      int row = getNumRows() - 1;
-      err = CPXchgrngval( env_, getLpPtr( OsiCpxSolverInterface::FREECACHED_ROW ), 1, &row, &range );
-      checkCPXerror( err, "CPXchgrngval", "addRow" );
-    }
+  queueRow( vec.getNumElements(), vec.getIndices(), vec.getElements(),
+	    sense, rhs, range );
 }
 //-----------------------------------------------------------------------------
 void 
@@ -2438,6 +2379,7 @@ OsiCpxSolverInterface::addRows(const int numrows,
 			       const double* rowlb, const double* rowub)
 {
   debugMessage("OsiCpxSolverInterface::addRows(%d, %p, %p, %p)\n", numrows, (void*)rows, (void*)rowlb, (void*)rowub);
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
 
   int i;
 
@@ -2452,6 +2394,7 @@ OsiCpxSolverInterface::addRows(const int numrows,
 			       const double* rowrng)
 {
   debugMessage("OsiCpxSolverInterface::addRows(%d, %p, %p, %p, %p)\n", numrows, (void*)rows, (void*)rowsen, (void*)rowrhs, (void*)rowrng);
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
 
   int i;
 
@@ -2463,18 +2406,43 @@ void
 OsiCpxSolverInterface::deleteRows(const int num, const int * rowIndices)
 {
   debugMessage("OsiCpxSolverInterface::deleteRows(%d, %p)\n", num, (void*)rowIndices);
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::deleteRowsEvent);
 
   int nrows = getNumRows();
   int *delstat = new int[nrows];
   int i, err;
 
   CoinFillN( delstat, nrows, 0 );
+  int ndistinct = 0;
   for( i = 0; i < num; ++i )
-    delstat[rowIndices[i]] = 1;
-  err = CPXdelsetrows( env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_COLUMN ), delstat );
+    if( !delstat[rowIndices[i]] )
+      {
+	delstat[rowIndices[i]] = 1;
+	++ndistinct;
+      }
+  err = CPXdelsetrows( env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_PROBLEM ), delstat );
   checkCPXerror( err, "CPXdelsetrows", "deleteRows" );
   delete[] delstat;
 
+  rowsense_.remove( num, rowIndices );
+  rhs_.remove( num, rowIndices );
+  rowrange_.remove( num, rowIndices );
+  rowlower_.remove( num, rowIndices );
+  rowupper_.remove( num, rowIndices );
+  // CoinPackedMatrix does not allow duplicates (and loses the number of
+  // columns if all rows go)
+  if( ndistinct == num && ndistinct < nrows )
+    {
+      if( matrixByRow_ )
+	matrixByRow_->deleteRows( num, rowIndices );
+      if( matrixByCol_ )
+	matrixByCol_->deleteRows( num, rowIndices );
+    }
+  else
+    {
+      freeCachedMatrix();
+    }
+
   //---
   //--- SV: took from OsiClp for updating names
   //---
@@ -3027,14 +2995,6 @@ OsiCpxSolverInterface::OsiCpxSolverInterface()
     hotStartRStat_(NULL),
     hotStartRStatSize_(0),
     hotStartMaxIteration_(1000000), // ??? default iteration limit for strong branching is large
-    obj_(NULL),
-    collower_(NULL),
-    colupper_(NULL),
-    rowsense_(NULL),
-    rhs_(NULL),
-    rowrange_(NULL),
-    rowlower_(NULL),
-    rowupper_(NULL),
     colsol_(NULL),
     rowsol_(NULL),
     redcost_(NULL),
@@ -3075,14 +3035,6 @@ OsiCpxSolverInterface::OsiCpxSolverInterface( const OsiCpxSolverInterface & sour
     hotStartRStat_(NULL),
     hotStartRStatSize_(0),
     hotStartMaxIteration_(source.hotStartMaxIteration_),
-    obj_(NULL),
-    collower_(NULL),
-    colupper_(NULL),
-    rowsense_(NULL),
-    rhs_(NULL),
-    rowrange_(NULL),
-    rowlower_(NULL),
-    rowupper_(NULL),
     colsol_(NULL),
     rowsol_(NULL),
     redcost_(NULL),
@@ -3158,7 +3110,6 @@ void OsiCpxSolverInterface::applyRowCut( const OsiRowCut & rowCut )
 {
   debugMessage("OsiCpxSolverInterface::applyRowCut(%p)\n", (void*)&rowCut);
 
-  int err = 0;
   double rhs = 0.0;
   double rng = 0.0;
   char sns;
@@ -3191,20 +3142,9 @@ void OsiCpxSolverInterface::applyRowCut( const OsiRowCut & rowCut )
       rng = ub - lb;
       sns = 'R';
     }
-  int rmatbeg = 0;
-  err = CPXaddrows( env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_COLUMN ), 0, 1, rowCut.row().getNumElements(),
-		    &rhs, &sns, &rmatbeg, 
-		    const_cast<int*>( rowCut.row().getIndices() ), 
-		    const_cast<double*>( rowCut.row().getElements() ),
-		    NULL, NULL );
-  checkCPXerror( err, "CPXaddrows", "applyRowCut" );
-  if( sns == 'R' )
-    {
-      err = CPXchgcoef( env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_COLUMN ), 
-			CPXgetnumrows(env_, getLpPtr( OsiCpxSolverInterface::KEEPCACHED_COLUMN ))-1,
-			-2, rng );
-      checkCPXerror( err, "CPXchgcoef", "applyRowCut" );
-    }
+  const CoinPackedVector & row = rowCut.row();
+  queueRow( row.getNumElements(), row.getIndices(), row.getElements(),
+	    sns, rhs, rng );
 }
 
 //#############################################################################
@@ -3235,9 +3175,180 @@ CPXLPptr OsiCpxSolverInterface::getMutableLpPtr() const
 //      checkCPXerror( err, "CPXchgprobtype", "getMutableLpPtr" );
       assert( lp_ != NULL ); 
     }
+  if ( hasPendingChanges() )
+    flushPendingChanges();
   return lp_;
 }
 
+//-------------------------------------------------------------------
+// Queued changes.
+// Bound and objective changes and added rows or columns are kept here
+// until something needs the CPLEX problem, and then passed on with one
+// call of each kind.  Rows and columns are never queued at the same
+// time, as a row may refer to a queued column or the other way round.
+//------------------------------------------------------------------- 
+void OsiCpxSolverInterface::flushPendingChanges() const
+{
+  assert( lp_ != NULL );
+  int err;
+  const int numberRows = static_cast<int>(pendingSense_.size());
+  const int numberColumns = static_cast<int>(pendingObj_.size());
+  if ( numberRows )
+    {
+      const int first = CPXgetnumrows( env_, lp_ );
+      err = CPXaddrows( env_, lp_, 0, numberRows,
+			static_cast<int>(pendingIndex_.size()),
+			&pendingRhs_[0], &pendingSense_[0], &pendingStart_[0],
+			pendingIndex_.empty() ? NULL : &pendingIndex_[0],
+			pendingElement_.empty() ? NULL : &pendingElement_[0],
+			NULL, NULL );
+      checkCPXerror( err, "CPXaddrows", "flushPendingChanges" );
+      std::vector<int> which;
+      std::vector<double> range;
+      for ( int i = 0; i < numberRows; ++i )
+	if ( pendingSense_[i] == 'R' )
+	  {
+	    which.push_back( first + i );
+	    range.push_back( pendingRange_[i] );
+	  }
+      if ( !which.empty() )
+	{
+	  err = CPXchgrngval( env_, lp_, static_cast<int>(which.size()),
+			      &which[0], &range[0] );
+	  checkCPXerror( err, "CPXchgrngval", "flushPendingChanges" );
+	}
+    }
+  else if ( numberColumns )
+    {
+      err = CPXaddcols( env_, lp_, numberColumns,
+			static_cast<int>(pendingIndex_.size()),
+			&pendingObj_[0], &pendingStart_[0],
+			pendingIndex_.empty() ? NULL : &pendingIndex_[0],
+			pendingElement_.empty() ? NULL : &pendingElement_[0],
+			&pendingLower_[0], &pendingUpper_[0], NULL );
+      checkCPXerror( err, "CPXaddcols", "flushPendingChanges" );
+    }
+  if ( !pendingBoundIndex_.empty() )
+    {
+      const int n = removeOverwrittenChanges(
+	static_cast<int>(pendingBoundIndex_.size()), &pendingBoundIndex_[0],
+	&pendingBoundType_[0], &pendingBoundValue_[0],
+	CPXgetnumcols( env_, lp_ ) );
+      err = CPXchgbds( env_, lp_, n, &pendingBoundIndex_[0],
+		       &pendingBoundType_[0], &pendingBoundValue_[0] );
+      checkCPXerror( err, "CPXchgbds", "flushPendingChanges" );
+    }
+  if ( !pendingObjIndex_.empty() )
+    {
+      const int n = removeOverwrittenChanges(
+	static_cast<int>(pendingObjIndex_.size()), &pendingObjIndex_[0],
+	NULL, &pendingObjValue_[0], CPXgetnumcols( env_, lp_ ) );
+      err = CPXchgobj( env_, lp_, n, &pendingObjIndex_[0],
+		       &pendingObjValue_[0] );
+      checkCPXerror( err, "CPXchgobj", "flushPendingChanges" );
+    }
+  clearPendingChanges();
+}
+
+//-------------------------------------------------------------------
+void OsiCpxSolverInterface::clearPendingChanges() const
+{
+  pendingBoundIndex_.clear();
+  pendingBoundType_.clear();
+  pendingBoundValue_.clear();
+  pendingObjIndex_.clear();
+  pendingObjValue_.clear();
+  pendingStart_.clear();
+  pendingIndex_.clear();
+  pendingElement_.clear();
+  pendingSense_.clear();
+  pendingRhs_.clear();
+  pendingRange_.clear();
+  pendingObj_.clear();
+  pendingLower_.clear();
+  pendingUpper_.clear();
+}
+
+//-------------------------------------------------------------------
+void OsiCpxSolverInterface::queueRow( int numberElements, const int* indices,
+				      const double* elements, char sense,
+				      double rhs, double range )
+{
+  if ( !pendingObj_.empty() )
+    getMutableLpPtr();
+  freeCachedData( OsiCpxSolverInterface::KEEPCACHED_PROBLEM );
+  // row data is fetched when next asked for.  The row ordered matrix is
+  // extended now; the column ordered one has no room for a row and is
+  // fetched again when next asked for.
+  rowsense_.append( 1, NULL );
+  rhs_.append( 1, NULL );
+  rowrange_.append( 1, NULL );
+  rowlower_.append( 1, NULL );
+  rowupper_.append( 1, NULL );
+  if ( matrixByRow_ )
+    matrixByRow_->appendRow( numberElements, indices, elements );
+  freeCacheMatrix( matrixByCol_ );
+  if ( pendingStart_.empty() )
+    pendingStart_.push_back( 0 );
+  pendingIndex_.insert( pendingIndex_.end(), indices, indices + numberElements );
+  pendingElement_.insert( pendingElement_.end(), elements, elements + numberElements );
+  pendingStart_.push_back( static_cast<int>(pendingIndex_.size()) );
+  pendingSense_.push_back( sense );
+  pendingRhs_.push_back( rhs );
+  pendingRange_.push_back( range );
+}
+
+//-------------------------------------------------------------------
+void OsiCpxSolverInterface::queueColumn( int numberElements, const int* indices,
+					 const double* elements, double obj,
+					 double lower, double upper )
+{
+  if ( !pendingSense_.empty() )
+    getMutableLpPtr();
+  freeCachedData( OsiCpxSolverInterface::KEEPCACHED_PROBLEM );
+  // as for rows, only the column ordered matrix is extended
+  obj_.append( 1, &obj );
+  collower_.append( 1, &lower );
+  colupper_.append( 1, &upper );
+  if ( matrixByCol_ )
+    matrixByCol_->appendCol( numberElements, indices, elements );
+  freeCacheMatrix( matrixByRow_ );
+  if ( pendingStart_.empty() )
+    pendingStart_.push_back( 0 );
+  pendingIndex_.insert( pendingIndex_.end(), indices, indices + numberElements );
+  pendingElement_.insert( pendingElement_.end(), elements, elements + numberElements );
+  pendingStart_.push_back( static_cast<int>(pendingIndex_.size()) );
+  pendingObj_.push_back( obj );
+  pendingLower_.push_back( lower );
+  pendingUpper_.push_back( upper );
+}
+
+//-------------------------------------------------------------------
+void OsiCpxSolverInterface::cacheRowType( int i, char sense, double rhs,
+					  double range )
+{
+  // as getRightHandSide() would find them
+  if ( sense == 'N' )
+    {
+      rhs = 0.0;
+      range = 0.0;
+    }
+  else if ( sense != 'R' )
+    {
+      range = 0.0;
+    }
+  rowsense_.set( i, sense );
+  rhs_.set( i, rhs );
+  rowrange_.set( i, range );
+  if ( rowlower_.isCached() || rowupper_.isCached() )
+    {
+      double lower, upper;
+      convertSenseToBound( sense, rhs, range, lower, upper );
+      rowlower_.set( i, lower );
+      rowupper_.set( i, upper );
+    }
+}
+
 //-------------------------------------------------------------------
 
 void OsiCpxSolverInterface::gutsOfCopy( const OsiCpxSolverInterface & source )
@@ -3373,6 +3484,7 @@ void OsiCpxSolverInterface::gutsOfConstructor()
 //-------------------------------------------------------------------
 void OsiCpxSolverInterface::gutsOfDestructor()
 {  
+  clearPendingChanges();
   if ( lp_ != NULL )
     {
       int err = CPXfreeprob( env_, &lp_ );
@@ -3390,14 +3502,14 @@ void OsiCpxSolverInterface::gutsOfDestructor()
 
   assert( lp_==NULL );
   assert( env_==NULL );
-  assert( obj_==NULL );
-  assert( collower_==NULL );
-  assert( colupper_==NULL );
-  assert( rowsense_==NULL );
-  assert( rhs_==NULL );
-  assert( rowrange_==NULL );
-  assert( rowlower_==NULL );
-  assert( rowupper_==NULL );
+  assert( !obj_.isCached() );
+  assert( !collower_.isCached() );
+  assert( !colupper_.isCached() );
+  assert( !rowsense_.isCached() );
+  assert( !rhs_.isCached() );
+  assert( !rowrange_.isCached() );
+  assert( !rowlower_.isCached() );
+  assert( !rowupper_.isCached() );
   assert( colsol_==NULL );
   assert( rowsol_==NULL );
   assert( redcost_==NULL );
@@ -3413,26 +3525,18 @@ void OsiCpxSolverInterface::gutsOfDestructor()
 
 void OsiCpxSolverInterface::freeCachedColRim()
 {
-  freeCacheDouble( obj_ );  
-  freeCacheDouble( collower_ ); 
-  freeCacheDouble( colupper_ ); 
-  assert( obj_==NULL );
-  assert( collower_==NULL );
-  assert( colupper_==NULL );
+  obj_.free();
+  collower_.free();
+  colupper_.free();
 }
 
 void OsiCpxSolverInterface::freeCachedRowRim()
 {
-  freeCacheChar( rowsense_ );
-  freeCacheDouble( rhs_ );
-  freeCacheDouble( rowrange_ );
-  freeCacheDouble( rowlower_ );
-  freeCacheDouble( rowupper_ );
-  assert( rowsense_==NULL ); 
-  assert( rhs_==NULL ); 
-  assert( rowrange_==NULL ); 
-  assert( rowlower_==NULL ); 
-  assert( rowupper_==NULL );
+  rowsense_.free();
+  rhs_.free();
+  rowrange_.free();
+  rowlower_.free();
+  rowupper_.free();
  }
 
 void OsiCpxSolverInterface::freeCachedMatrix()
@@ -3480,6 +3584,7 @@ void OsiCpxSolverInterface::freeAllMemory()
   hotStartRStat_     = NULL;
   hotStartRStatSize_ = 0;
   freeColType();
+  clearPendingChanges();
 }
 
 //#############################################################################
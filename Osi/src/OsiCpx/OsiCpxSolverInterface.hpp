@@ -13,7 +13,10 @@
 #ifndef OsiCpxSolverInterface_H
 #define OsiCpxSolverInterface_H
 
+#include <vector>
+
 #include "OsiSolverInterface.hpp"
+#include "OsiCachedArray.hpp"
 #include "CoinWarmStartBasis.hpp"
 #include "OsiColCut.hpp"
 #include "OsiRowCut.hpp"
@@ -610,6 +613,10 @@ public:
   //@{
   /** Get pointer to CPLEX model and free all specified cached data entries
       (combined with logical or-operator '|' ):
+
+      Changes to bounds and objective and new rows and columns are queued
+      and only passed to CPLEX when the model is needed, so errors such as
+      bad indices may be reported by a later method.
   */
   enum keepCachedFlag
   {
@@ -776,8 +783,30 @@ private:
   /**@name Private methods */
   //@{
   
-  /// Get LP Pointer for const methods
+  /// Get LP Pointer for const methods (passing on queued changes)
   CPXLPptr getMutableLpPtr() const;
+
+  /// Whether there are changes queued for CPLEX
+  inline bool hasPendingChanges() const
+  { return !pendingBoundIndex_.empty() || !pendingObjIndex_.empty() ||
+      !pendingSense_.empty() || !pendingObj_.empty();}
+
+  /// Pass queued changes to CPLEX, one call for each kind
+  void flushPendingChanges() const;
+
+  /// Forget queued changes
+  void clearPendingChanges() const;
+
+  /// Queue a new row (sense, rhs and range as for CPXaddrows)
+  void queueRow( int numberElements, const int* indices, const double* elements,
+		 char sense, double rhs, double range );
+
+  /// Queue a new column
+  void queueColumn( int numberElements, const int* indices, const double* elements,
+		    double obj, double lower, double upper );
+
+  /// Patch cached row data for row i set to sense, rhs and range (Osi meaning)
+  void cacheRowType( int i, char sense, double rhs, double range );
   
   /// The real work of a copy constructor (used by copy and assignment)
   void gutsOfCopy( const OsiCpxSolverInterface & source );
@@ -816,6 +845,29 @@ private:
   /// CPLEX model represented by this class instance
   mutable CPXLPptr lp_;
 
+  /**@name Changes queued for CPLEX (see flushPendingChanges()) */
+  //@{
+  /// Column bound changes: index, 'L' or 'U', and value
+  mutable std::vector<int> pendingBoundIndex_;
+  mutable std::vector<char> pendingBoundType_;
+  mutable std::vector<double> pendingBoundValue_;
+  /// Objective changes: index and value
+  mutable std::vector<int> pendingObjIndex_;
+  mutable std::vector<double> pendingObjValue_;
+  /// Starts, indices and elements of new rows, or of new columns (never both)
+  mutable std::vector<int> pendingStart_;
+  mutable std::vector<int> pendingIndex_;
+  mutable std::vector<double> pendingElement_;
+  /// Sense, right hand side and range of new rows
+  mutable std::vector<char> pendingSense_;
+  mutable std::vector<double> pendingRhs_;
+  mutable std::vector<double> pendingRange_;
+  /// Objective and bounds of new columns
+  mutable std::vector<double> pendingObj_;
+  mutable std::vector<double> pendingLower_;
+  mutable std::vector<double> pendingUpper_;
+  //@}
+
   /// Hotstart information
   int *hotStartCStat_;
   int hotStartCStatSize_;
@@ -823,31 +875,41 @@ private:
   int hotStartRStatSize_;
   int hotStartMaxIteration_;
 
-  /**@name Cached information derived from the CPLEX model */
+  /**@name Cached information derived from the CPLEX model
+
+     Rim vectors are patched in place or marked out of date entry by entry
+     (see OsiCachedArray), and the matrices are kept up to date when rows
+     or columns are deleted, so changing the model rarely means fetching
+     all of it again.  Added rows are appended only to the row ordered
+     matrix and added columns only to the column ordered one; the other
+     ordering would have to be copied to make room, so it is dropped and
+     fetched again when next asked for.  rowsense_, rhs_ and rowrange_ are always
+     fetched together and so are cached and out of date together.
+  */
   //@{
-  /// Pointer to objective vector
-  mutable double  *obj_;
+  /// Objective vector
+  mutable OsiCachedArray<double> obj_;
   
-  /// Pointer to dense vector of variable lower bounds
-  mutable double  *collower_;
+  /// Dense vector of variable lower bounds
+  mutable OsiCachedArray<double> collower_;
   
-  /// Pointer to dense vector of variable lower bounds
-  mutable double  *colupper_;
+  /// Dense vector of variable upper bounds
+  mutable OsiCachedArray<double> colupper_;
   
-  /// Pointer to dense vector of row sense indicators
-  mutable char    *rowsense_;
+  /// Dense vector of row sense indicators
+  mutable OsiCachedArray<char> rowsense_;
   
-  /// Pointer to dense vector of row right-hand side values
-  mutable double  *rhs_;
+  /// Dense vector of row right-hand side values
+  mutable OsiCachedArray<double> rhs_;
   
-  /// Pointer to dense vector of slack upper bounds for range constraints (undefined for non-range rows)
-  mutable double  *rowrange_;
+  /// Dense vector of slack upper bounds for range constraints (undefined for non-range rows)
+  mutable OsiCachedArray<double> rowrange_;
   
-  /// Pointer to dense vector of row lower bounds
-  mutable double  *rowlower_;
+  /// Dense vector of row lower bounds
+  mutable OsiCachedArray<double> rowlower_;
   
-  /// Pointer to dense vector of row upper bounds
-  mutable double  *rowupper_;
+  /// Dense vector of row upper bounds
+  mutable OsiCachedArray<double> rowupper_;
   
   /// Pointer to primal solution vector
   mutable double  *colsol_;
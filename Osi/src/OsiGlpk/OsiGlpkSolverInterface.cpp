@@ -87,6 +87,7 @@ extern "C" {
 #include "OsiGlpkSolverInterface.hpp"
 #include "OsiRowCut.hpp"
 #include "OsiColCut.hpp"
+#include "OsiSolverStatistics.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinWarmStartBasis.hpp"
 
@@ -152,6 +153,8 @@ inline void checkGLPKerror (int err, std::string glpkfuncname,
 */
 void OGSI::initialSolve()
 { 
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::initialSolveEvent);
 # if OGSI_TRACK_FRESH > 0
   std::cout
     << "OGSI(" << std::hex << this << std::dec
@@ -252,6 +255,7 @@ void OGSI::initialSolve()
 
 void OGSI::resolve()
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::resolveEvent);
 # if OGSI_TRACK_FRESH > 0
   std::cout
     << "OGSI(" << std::hex << this << std::dec
@@ -1144,6 +1148,7 @@ void OGSI::markHotStart()
 
 void OGSI::solveFromHotStart()
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::hotStartEvent);
 #     if OGSI_TRACK_FRESH > 0
       std::cout
 	<< "OGSI(" << std::hex << this << std::dec
@@ -1450,6 +1455,7 @@ bool OGSI::isContinuous( int colNumber ) const
 
 const CoinPackedMatrix * OGSI::getMatrixByRow() const
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
 	if( matrixByRow_ == NULL )
 	{
 	        LPX *model = getMutableModelPtr();
@@ -1489,6 +1495,7 @@ const CoinPackedMatrix * OGSI::getMatrixByRow() const
 
 const CoinPackedMatrix * OGSI::getMatrixByCol() const
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
 	if( matrixByCol_ == NULL )
 	{
    	        LPX *model = getMutableModelPtr();
@@ -1544,6 +1551,8 @@ double OGSI::getInfinity() const
 const double *OGSI::getColSolution() const
 
 { 
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 /*
   Use the cached solution vector, if present. If we have no constraint system,
   return 0.
@@ -1622,6 +1631,8 @@ const double *OGSI::getColSolution() const
 const double *OGSI::getRowPrice() const
 
 { 
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 /*
   If we have a cached solution, use it. If the constraint system is empty,
   return 0. Otherwise, allocate a new vector.
@@ -1663,6 +1674,8 @@ const double *OGSI::getRowPrice() const
 */
 const double * OGSI::getReducedCost() const
 {
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 /*
   Return the cached copy, if it exists.
 */
@@ -1713,6 +1726,8 @@ const double * OGSI::getReducedCost() const
 const double *OGSI::getRowActivity() const
 
 {
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 /*
   Return the cached copy, if it exists.
 */
@@ -2324,8 +2339,8 @@ OGSI::deleteCols(const int num, const int * columnIndices)
 	for( int i = 0; i < num; i++ )
 	{
 		columnIndicesPlus1[i+1]=columnIndices[i]+1;
-		deleteColNames(columnIndices[i],1);
 	}
+	deleteColNames(num,columnIndices);
 	lpx_del_cols(model,num,columnIndicesPlus1);
 	delete [] columnIndicesPlus1;
 
@@ -2410,6 +2425,7 @@ OGSI::addRows(const int numrows,
 				const CoinPackedVectorBase * const * rows,
 				const double* rowlb, const double* rowub)
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
   // ??? Could do this more efficiently now
 	// Could be in OsiSolverInterfaceImpl.
 	int i;
@@ -2425,6 +2441,7 @@ OGSI::addRows(const int numrows,
 				const char* rowsen, const double* rowrhs,
 				const double* rowrng)
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
 	// Could be in OsiSolverInterfaceImpl.
 	int i;
 	for( i = 0; i < numrows; ++i )
@@ -2442,18 +2459,19 @@ OGSI::addRows(const int numrows,
 void OGSI::deleteRows (const int num, const int *osiIndices)
 
 { int *glpkIndices = new int[num+1] ;
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::deleteRowsEvent);
   int i,ndx ;
 /*
   Arguably, column results remain valid across row deletion.
 */
   freeCachedData(OGSI::KEEPCACHED_COLUMN) ;
 /*
-  Glpk uses 1-based indexing, so convert the array of indices. While we're
-  doing that, delete the row names.
+  Glpk uses 1-based indexing, so convert the array of indices. Then delete
+  the row names, all in one go.
 */
   for (ndx = 0 ; ndx < num ; ndx++)
-  { glpkIndices[ndx+1] = osiIndices[ndx]+1 ;
-    deleteRowNames(osiIndices[ndx],1) ; }
+  { glpkIndices[ndx+1] = osiIndices[ndx]+1 ; }
+  deleteRowNames(num,osiIndices) ;
 /*
   See if we're about to do damage. If we delete a row with a nonbasic slack,
   we'll have an excess of basic variables.
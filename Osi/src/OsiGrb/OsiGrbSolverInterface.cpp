@@ -24,6 +24,7 @@
 #include "OsiCuts.hpp"
 #include "OsiRowCut.hpp"
 #include "OsiColCut.hpp"
+#include "OsiSolverStatistics.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinWarmStartBasis.hpp"
 
@@ -121,7 +122,10 @@ OsiGrbSolverInterface::switchToLP( void )
      char* contattr = new char[nc];
      CoinFillN(contattr, nc, 'C');
      
+     if( pendingCols_ || pendingDeletes_ )
+       updateModel( "switchToLP" );
      GUROBI_CALL( "switchToLP", GRBsetcharattrarray(lp, GRB_CHAR_ATTR_VTYPE, 0, nc, contattr) );
+     updatePending_ = true;
      
      delete[] contattr;
 
@@ -141,7 +145,10 @@ OsiGrbSolverInterface::switchToMIP( void )
 
      assert(coltype_ != NULL);
 
+     if( pendingCols_ || pendingDeletes_ )
+       updateModel( "switchToMIP" );
      GUROBI_CALL( "switchToMIP", GRBsetcharattrarray(lp, GRB_CHAR_ATTR_VTYPE, 0, nc, coltype_) );
+     updatePending_ = true;
 
      probtypemip_ = true;
   }
@@ -263,6 +270,8 @@ void OsiGrbSolverInterface::resizeAuxColIndSpace()
 void OsiGrbSolverInterface::initialSolve()
 {
   debugMessage("OsiGrbSolverInterface::initialSolve()\n");
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::initialSolveEvent);
   bool takeHint;
   OsiHintStrength strength;
   int prevalgorithm = -1;
@@ -270,6 +279,8 @@ void OsiGrbSolverInterface::initialSolve()
   switchToLP();
   
   GRBmodel* lp = getLpPtr( OsiGrbSolverInterface::FREECACHED_RESULTS );
+  /* GRBoptimize would update the model behind our back */
+  updateModel( "initialSolve" );
 
   /* set whether dual or primal, if hint has been given */
   getHintParam(OsiDoDualInInitial,takeHint,strength);
@@ -311,6 +322,7 @@ void OsiGrbSolverInterface::initialSolve()
 void OsiGrbSolverInterface::resolve()
 {
   debugMessage("OsiGrbSolverInterface::resolve()\n");
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::resolveEvent);
   bool takeHint;
   OsiHintStrength strength;
   int prevalgorithm = -1;
@@ -318,6 +330,8 @@ void OsiGrbSolverInterface::resolve()
   switchToLP();
   
   GRBmodel* lp = getLpPtr( OsiGrbSolverInterface::FREECACHED_RESULTS );
+  /* GRBoptimize would update the model behind our back */
+  updateModel( "resolve" );
 
   /* set whether primal or dual */
   getHintParam(OsiDoDualInResolve,takeHint,strength);
@@ -378,6 +392,7 @@ void OsiGrbSolverInterface::branchAndBound()
     }
     assert(j == getNumIntegers());
 
+    updateModel( "branchAndBound" );
     GUROBI_CALL( "branchAndBound", GRBsetdblattrlist(getMutableLpPtr(), GRB_DBL_ATTR_START, getNumIntegers(), discridx, discrval) );
 
     delete[] discridx;
@@ -385,6 +400,7 @@ void OsiGrbSolverInterface::branchAndBound()
   }
 
   GRBmodel* lp = getLpPtr( OsiGrbSolverInterface::FREECACHED_RESULTS );
+  updateModel( "branchAndBound" );
 
   GUROBI_CALL( "branchAndBound", GRBsetintparam(GRBgetenv(lp), GRB_INT_PAR_OUTPUTFLAG, (messageHandler()->logLevel() > 0)) );
 
@@ -518,7 +534,7 @@ OsiGrbSolverInterface::getIntParam(OsiIntParam key, int& value) const
   {
     case OsiMaxNumIteration:
     	double dblval;
-      GUROBI_CALL( "getIntParam", GRBupdatemodel(getMutableLpPtr()) );
+      updateModel( "getIntParam" );
       GUROBI_CALL( "getIntParam", GRBgetdblparam(GRBgetenv(getMutableLpPtr()), GRB_DBL_PAR_ITERATIONLIMIT, &dblval) );
     	value = (int) dblval;
       return true;
@@ -544,7 +560,7 @@ OsiGrbSolverInterface::getDblParam(OsiDblParam key, double& value) const
 {
   debugMessage("OsiGrbSolverInterface::getDblParam(%d)\n", key);
 
-  GUROBI_CALL( "getDblParam", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "getDblParam" );
 
   switch (key) 
   {
@@ -602,7 +618,7 @@ OsiGrbSolverInterface::getHintParam(OsiHintParam key, bool& yesNo, OsiHintStreng
   if( key == OsiDoScale )
   {
     OsiSolverInterface::getHintParam(key, yesNo, strength, otherInformation);
-    GUROBI_CALL( "getHintParam", GRBupdatemodel(getMutableLpPtr()) );
+    updateModel( "getHintParam" );
     int value;
     GUROBI_CALL( "getHintParam", GRBgetintparam(GRBgetenv(getMutableLpPtr()), GRB_INT_PAR_SCALEFLAG, &value) );
     yesNo = value;
@@ -620,7 +636,7 @@ OsiGrbSolverInterface::getHintParam(OsiHintParam key, bool& yesNo, OsiHintStreng
   if( key == OsiDoScale )
   {
     OsiSolverInterface::getHintParam(key, yesNo, strength);
-    GUROBI_CALL( "getHintParam", GRBupdatemodel(getMutableLpPtr()) );
+    updateModel( "getHintParam" );
     int value;
     GUROBI_CALL( "getHintParam", GRBgetintparam(GRBgetenv(getMutableLpPtr()), GRB_INT_PAR_SCALEFLAG, &value) );
     yesNo = value;
@@ -638,7 +654,7 @@ OsiGrbSolverInterface::getHintParam(OsiHintParam key, bool& yesNo) const
   if( key == OsiDoScale )
   {
     OsiSolverInterface::getHintParam(key, yesNo);
-    GUROBI_CALL( "getHintParam", GRBupdatemodel(getMutableLpPtr()) );
+    updateModel( "getHintParam" );
     int value;
     GUROBI_CALL( "getHintParam", GRBgetintparam(GRBgetenv(getMutableLpPtr()), GRB_INT_PAR_SCALEFLAG, &value) );
     yesNo = value;
@@ -656,7 +672,7 @@ bool OsiGrbSolverInterface::isAbandoned() const
 {
   debugMessage("OsiGrbSolverInterface::isAbandoned()\n");
 
-  GUROBI_CALL( "isAbandoned", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "isAbandoned" );
 
   int stat;
   GUROBI_CALL( "isAbandoned", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_STATUS, &stat) );
@@ -672,7 +688,7 @@ bool OsiGrbSolverInterface::isProvenOptimal() const
 {
   debugMessage("OsiGrbSolverInterface::isProvenOptimal()\n");
 
-  GUROBI_CALL( "isProvenOptimal", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "isProvenOptimal" );
 
   int stat;
   GUROBI_CALL( "isProvenOptimal", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_STATUS, &stat) );
@@ -684,7 +700,7 @@ bool OsiGrbSolverInterface::isProvenPrimalInfeasible() const
 {
   debugMessage("OsiGrbSolverInterface::isProvenPrimalInfeasible()\n");
 
-  GUROBI_CALL( "isProvenPrimalInfeasible", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "isProvenPrimalInfeasible" );
 
   int stat;
   GUROBI_CALL( "isProvenPrimalInfeasible", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_STATUS, &stat) );
@@ -696,7 +712,7 @@ bool OsiGrbSolverInterface::isProvenDualInfeasible() const
 {
   debugMessage("OsiGrbSolverInterface::isProvenDualInfeasible()\n");
 
-  GUROBI_CALL( "isProvenDualInfeasible", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "isProvenDualInfeasible" );
 
   int stat;
   GUROBI_CALL( "isProvenDualInfeasible", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_STATUS, &stat) );
@@ -722,7 +738,7 @@ bool OsiGrbSolverInterface::isIterationLimitReached() const
 {
   debugMessage("OsiGrbSolverInterface::isIterationLimitReached()\n");
 
-  GUROBI_CALL( "isIterationLimitReached", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "isIterationLimitReached" );
 
   int stat;
   GUROBI_CALL( "isIterationLimitReached", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_STATUS, &stat) );
@@ -771,7 +787,7 @@ CoinWarmStart* OsiGrbSolverInterface::getWarmStart() const
     ws->setStructStatus( i, CoinWarmStartBasis::Status(cstat[i]) );
 
 #else
-  GUROBI_CALL( "getWarmStart", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "getWarmStart" );
 
   GUROBI_CALL( "getWarmStart", GRBgetintattrarray(getMutableLpPtr(), GRB_INT_ATTR_VBASIS, 0, numcols, cstat) );
   GUROBI_CALL( "getWarmStart", GRBgetintattrarray(getMutableLpPtr(), GRB_INT_ATTR_CBASIS, 0, numrows, rstat) );
@@ -851,6 +867,7 @@ bool OsiGrbSolverInterface::setWarmStart(const CoinWarmStart* warmstart)
     return false;
 
   switchToLP();
+  updateModel( "setWarmStart" );
 
   stat = new int[numcols + nauxcols > numrows ? numcols + nauxcols : numrows];
   for( i = 0; i < numrows; ++i )
@@ -955,7 +972,7 @@ void OsiGrbSolverInterface::markHotStart()
   	hotStartRStat_ = new int[hotStartRStatSize_];
   }
 
-  GUROBI_CALL( "markHotStart", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "markHotStart" );
 
   GUROBI_CALL( "markHotStart", GRBgetintattrarray(getMutableLpPtr(), GRB_INT_ATTR_VBASIS, 0, numcols + nauxcols, hotStartCStat_) );
   GUROBI_CALL( "markHotStart", GRBgetintattrarray(getMutableLpPtr(), GRB_INT_ATTR_CBASIS, 0, numrows, hotStartRStat_) );
@@ -964,6 +981,7 @@ void OsiGrbSolverInterface::markHotStart()
 void OsiGrbSolverInterface::solveFromHotStart()
 {
   debugMessage("OsiGrbSolverInterface::solveFromHotStart()\n");
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::hotStartEvent);
 
   double maxiter;
 
@@ -972,7 +990,7 @@ void OsiGrbSolverInterface::solveFromHotStart()
   assert( getNumCols() <= hotStartCStatSize_ );
   assert( getNumRows() <= hotStartRStatSize_ );
 
-  GUROBI_CALL( "solveFromHotStart", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "solveFromHotStart" );
 
   GUROBI_CALL( "solveFromHotStart", GRBsetintattrarray(getLpPtr(OsiGrbSolverInterface::FREECACHED_RESULTS), GRB_INT_ATTR_CBASIS, 0, getNumRows(), hotStartRStat_ ) );
   GUROBI_CALL( "solveFromHotStart", GRBsetintattrarray(getLpPtr(OsiGrbSolverInterface::FREECACHED_RESULTS), GRB_INT_ATTR_VBASIS, 0, getNumCols() + nauxcols, hotStartCStat_ ) );
@@ -1005,11 +1023,10 @@ int OsiGrbSolverInterface::getNumCols() const
   
   int numcols;
 
-  GUROBI_CALL( "getNumCols", GRBupdatemodel(getMutableLpPtr()) );
-
+  // Gurobi counts only columns it has seen in an update
   GUROBI_CALL( "getNumCols", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_NUMVARS, &numcols) );
 
-  numcols -= nauxcols;
+  numcols += pendingCols_ - nauxcols;
 
   return numcols;
 }
@@ -1020,11 +1037,9 @@ int OsiGrbSolverInterface::getNumRows() const
 
   int numrows;
 
-  GUROBI_CALL( "getNumRows", GRBupdatemodel(getMutableLpPtr()) );
-
   GUROBI_CALL( "getNumRows", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_NUMCONSTRS, &numrows) );
 
-  return numrows;
+  return numrows + pendingRows_;
 }
 
 int OsiGrbSolverInterface::getNumElements() const
@@ -1033,7 +1048,7 @@ int OsiGrbSolverInterface::getNumElements() const
 
   int numnz;
 
-  GUROBI_CALL( "getNumElements", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "getNumElements" );
 
   GUROBI_CALL( "getNumElements", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_NUMNZS, &numnz) );
 
@@ -1057,7 +1072,7 @@ const double * OsiGrbSolverInterface::getColLower() const
   	if( ncols > 0 )
   	{
   		collower_ = new double[ncols];
-  		GUROBI_CALL( "getColLower", GRBupdatemodel(getMutableLpPtr()) );
+  		updateModel( "getColLower" );
 
   		if( nauxcols )
         GUROBI_CALL( "getColLower", GRBgetdblattrlist(getMutableLpPtr(), GRB_DBL_ATTR_LB, ncols, colmap_O2G, collower_) );
@@ -1080,7 +1095,7 @@ const double * OsiGrbSolverInterface::getColUpper() const
   	if( ncols > 0 )
   	{
   		colupper_ = new double[ncols];
-  		GUROBI_CALL( "getColUpper", GRBupdatemodel(getMutableLpPtr()) );
+  		updateModel( "getColUpper" );
 
   		if( nauxcols )
         GUROBI_CALL( "getColUpper", GRBgetdblattrlist(getMutableLpPtr(), GRB_DBL_ATTR_UB, ncols, colmap_O2G, colupper_) );
@@ -1103,7 +1118,7 @@ const char * OsiGrbSolverInterface::getRowSense() const
   	if( nrows > 0 )
   	{
   		rowsense_ = new char[nrows];
-  		GUROBI_CALL( "getRowSense", GRBupdatemodel(getMutableLpPtr()) );
+  		updateModel( "getRowSense" );
 
   		GUROBI_CALL( "getRowSense", GRBgetcharattrarray(getMutableLpPtr(), GRB_CHAR_ATTR_SENSE, 0, nrows, rowsense_) );
   	  
@@ -1145,7 +1160,7 @@ const double * OsiGrbSolverInterface::getRightHandSide() const
   	if( nrows > 0 )
   	{
   		rhs_ = new double[nrows];
-  		GUROBI_CALL( "getRightHandSide", GRBupdatemodel(getMutableLpPtr()) );
+  		updateModel( "getRightHandSide" );
 
   		GUROBI_CALL( "getRightHandSide", GRBgetdblattrarray(getMutableLpPtr(), GRB_DBL_ATTR_RHS, 0, nrows, rhs_) );
 
@@ -1268,7 +1283,7 @@ const double * OsiGrbSolverInterface::getObjCoefficients() const
   	if( ncols > 0 )
   	{
   		obj_ = new double[ncols];
-  		GUROBI_CALL( "getObjCoefficients", GRBupdatemodel(getMutableLpPtr()) );
+  		updateModel( "getObjCoefficients" );
 
     if( nauxcols )
       GUROBI_CALL( "getObjCoefficients", GRBgetdblattrlist(getMutableLpPtr(), GRB_DBL_ATTR_OBJ, ncols, colmap_O2G, obj_) );
@@ -1286,7 +1301,7 @@ double OsiGrbSolverInterface::getObjSense() const
   debugMessage("OsiGrbSolverInterface::getObjSense()\n");
 
   int sense;
-  GUROBI_CALL( "getObjSense", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "getObjSense" );
 
   GUROBI_CALL( "getObjSense", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_MODELSENSE, &sense) );
  
@@ -1311,6 +1326,7 @@ bool OsiGrbSolverInterface::isContinuous( int colNumber ) const
 const CoinPackedMatrix * OsiGrbSolverInterface::getMatrixByRow() const
 {
   debugMessage("OsiGrbSolverInterface::getMatrixByRow()\n");
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
 
   if ( matrixByRow_ == NULL ) 
   {
@@ -1327,7 +1343,7 @@ const CoinPackedMatrix * OsiGrbSolverInterface::getMatrixByRow() const
   	int *starts   = new int   [nrows + 1];
   	int *len      = new int   [nrows];
 
-  	GUROBI_CALL( "getMatrixByRow", GRBupdatemodel(getMutableLpPtr()) );
+  	updateModel( "getMatrixByRow" );
 
   	GUROBI_CALL( "getMatrixByRow", GRBgetconstrs(getMutableLpPtr(), &nelems, NULL, NULL, NULL, 0, nrows) );
 
@@ -1377,6 +1393,7 @@ const CoinPackedMatrix * OsiGrbSolverInterface::getMatrixByRow() const
 const CoinPackedMatrix * OsiGrbSolverInterface::getMatrixByCol() const
 {
 	debugMessage("OsiGrbSolverInterface::getMatrixByCol()\n");
+	OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
 
 	if ( matrixByCol_ == NULL )
 	{
@@ -1391,7 +1408,7 @@ const CoinPackedMatrix * OsiGrbSolverInterface::getMatrixByCol() const
 		  int *starts = new int   [ncols + nauxcols + 1];
 		  int *len    = new int   [ncols + nauxcols];
 
-		  GUROBI_CALL( "getMatrixByCol", GRBupdatemodel(getMutableLpPtr()) );
+		  updateModel( "getMatrixByCol" );
 
 		  GUROBI_CALL( "getMatrixByCol", GRBgetvars(getMutableLpPtr(), &nelems, NULL, NULL, NULL, 0, ncols + nauxcols) );
 
@@ -1459,6 +1476,8 @@ double OsiGrbSolverInterface::getInfinity() const
 const double * OsiGrbSolverInterface::getColSolution() const
 {
 	debugMessage("OsiGrbSolverInterface::getColSolution()\n");
+	OsiSolverStatistics::Timer
+	  timer(this,OsiSolverStatistics::getSolutionEvent);
 
 	if( colsol_ == NULL )
 	{
@@ -1467,7 +1486,7 @@ const double * OsiGrbSolverInterface::getColSolution() const
 		{
 			colsol_ = new double[ncols];
 
-			GUROBI_CALL( "getColSolution", GRBupdatemodel(getMutableLpPtr()) );
+			updateModel( "getColSolution" );
 
       if ( GRBgetdblattrelement(getMutableLpPtr(), GRB_DBL_ATTR_X, 0, colsol_) == 0 )
       { // if a solution is available, get it
@@ -1496,6 +1515,8 @@ const double * OsiGrbSolverInterface::getColSolution() const
 const double * OsiGrbSolverInterface::getRowPrice() const
 {
   debugMessage("OsiGrbSolverInterface::getRowPrice()\n");
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 
   if( rowsol_==NULL )
   {
@@ -1504,7 +1525,7 @@ const double * OsiGrbSolverInterface::getRowPrice() const
   	{
   		rowsol_ = new double[nrows];
   		
-  		GUROBI_CALL( "getRowPrice", GRBupdatemodel(getMutableLpPtr()) );
+  		updateModel( "getRowPrice" );
   	  
       if ( GRBgetdblattrelement(getMutableLpPtr(), GRB_DBL_ATTR_PI, 0, rowsol_) == 0 )
       {
@@ -1529,6 +1550,8 @@ const double * OsiGrbSolverInterface::getRowPrice() const
 const double * OsiGrbSolverInterface::getReducedCost() const
 {
   debugMessage("OsiGrbSolverInterface::getReducedCost()\n");
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 
   if( redcost_==NULL )
   {
@@ -1537,7 +1560,7 @@ const double * OsiGrbSolverInterface::getReducedCost() const
   	{
   		redcost_ = new double[ncols];
 
-  		GUROBI_CALL( "getReducedCost", GRBupdatemodel(getMutableLpPtr()) );
+  		updateModel( "getReducedCost" );
 
       if ( GRBgetdblattrelement(getMutableLpPtr(), GRB_DBL_ATTR_RC, 0, redcost_) == 0 )
       { // if reduced costs are available, get them
@@ -1563,6 +1586,8 @@ const double * OsiGrbSolverInterface::getReducedCost() const
 const double * OsiGrbSolverInterface::getRowActivity() const
 {
   debugMessage("OsiGrbSolverInterface::getRowActivity()\n");
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 
   if( rowact_==NULL )
   {
@@ -1571,7 +1596,7 @@ const double * OsiGrbSolverInterface::getRowActivity() const
   	{
   		rowact_ = new double[nrows];
 
-  		GUROBI_CALL( "getRowActivity", GRBupdatemodel(getMutableLpPtr()) );
+  		updateModel( "getRowActivity" );
 
   		if ( GRBgetdblattrelement(getMutableLpPtr(), GRB_DBL_ATTR_SLACK, 0, rowact_) == 0 )
   		{
@@ -1606,7 +1631,7 @@ double OsiGrbSolverInterface::getObjValue() const
 
   double objval = 0.0;
  
-  GUROBI_CALL( "getObjValue", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "getObjValue" );
 
   if( GRBgetdblattr(getMutableLpPtr(), GRB_DBL_ATTR_OBJVAL, &objval) == 0 )
   {
@@ -1632,7 +1657,7 @@ int OsiGrbSolverInterface::getIterationCount() const
 
   double itercnt;
   
-  GUROBI_CALL( "getIterationCount", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "getIterationCount" );
 
   GUROBI_CALL( "getIterationCount", GRBgetdblattr(getMutableLpPtr(), GRB_DBL_ATTR_ITERCOUNT, &itercnt) );
 
@@ -1730,6 +1755,9 @@ void OsiGrbSolverInterface::setObjCoeff( int elementIndex, double elementValue )
 {
   debugMessage("OsiGrbSolverInterface::setObjCoeff(%d, %g)\n", elementIndex, elementValue);
   
+  if( pendingCols_ || pendingDeletes_ )
+    updateModel( "setObjCoeff" );
+
   GUROBI_CALL( "setObjCoeff", GRBsetdblattrelement(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_PROBLEM ), GRB_DBL_ATTR_OBJ, nauxcols ? colmap_O2G[elementIndex] : elementIndex, elementValue) );
 
   if(obj_ != NULL)
@@ -1755,6 +1783,9 @@ void OsiGrbSolverInterface::setObjCoeffSet(const int* indexFirst,
   }
   assert(cnt > 1);
 
+  if( pendingCols_ || pendingDeletes_ )
+    updateModel( "setObjCoeffSet" );
+
   if( nauxcols )
   {
     int* indices = new int[cnt];
@@ -1779,6 +1810,9 @@ void OsiGrbSolverInterface::setColLower(int elementIndex, double elementValue)
 {
   debugMessage("OsiGrbSolverInterface::setColLower(%d, %g)\n", elementIndex, elementValue);
 
+  if( pendingCols_ || pendingDeletes_ )
+    updateModel( "setColLower" );
+
   GUROBI_CALL( "setColLower", GRBsetdblattrelement(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_PROBLEM ), GRB_DBL_ATTR_LB, nauxcols ? colmap_O2G[elementIndex] : elementIndex, elementValue) );
 
   if(collower_ != NULL)
@@ -1790,6 +1824,9 @@ void OsiGrbSolverInterface::setColUpper(int elementIndex, double elementValue)
 {  
   debugMessage("OsiGrbSolverInterface::setColUpper(%d, %g)\n", elementIndex, elementValue);
 
+  if( pendingCols_ || pendingDeletes_ )
+    updateModel( "setColUpper" );
+
   GUROBI_CALL( "setColUpper", GRBsetdblattrelement(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_PROBLEM ), GRB_DBL_ATTR_UB, nauxcols ? colmap_O2G[elementIndex] : elementIndex, elementValue) );
 	
   if(colupper_ != NULL)
@@ -1822,6 +1859,9 @@ void OsiGrbSolverInterface::setColSetBounds(const int* indexFirst,
     return;
   }
   assert(cnt > 1);
+
+  if( pendingCols_ || pendingDeletes_ )
+    updateModel( "setColSetBounds" );
   
   double* lbList = new double[cnt];
   double* ubList = new double[cnt];
@@ -1905,7 +1945,7 @@ OsiGrbSolverInterface::setRowType(int i, char sense, double rightHandSide, doubl
 {
   debugMessage("OsiGrbSolverInterface::setRowType(%d, %c, %g, %g)\n", i, sense, rightHandSide, range);
   
-  GUROBI_CALL( "setRowType", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "setRowType" );
 
   if( nauxcols && auxcolind[i] >= 0 )
   { // so far, row i is a ranged row
@@ -2021,7 +2061,7 @@ OsiGrbSolverInterface::setRowSetTypes(const int* indexFirst,
    }
    assert(cnt > 0);
 
-   GUROBI_CALL( "setRowSetTypes", GRBupdatemodel(getMutableLpPtr()) );
+   updateModel( "setRowSetTypes" );
 
    char* grbsense = new char[cnt];
    double* rhs = new double[cnt];
@@ -2122,8 +2162,9 @@ OsiGrbSolverInterface::setContinuous(int index)
 
   if ( probtypemip_ )
   {
-    GUROBI_CALL( "setContinuous", GRBupdatemodel(getMutableLpPtr()) );
+    updateModel( "setContinuous" );
     GUROBI_CALL( "setContinuous", GRBsetcharattrelement(getMutableLpPtr(), GRB_CHAR_ATTR_VTYPE, nauxcols ? colmap_O2G[index] : index, GRB_CONTINUOUS) );
+    updatePending_ = true;
   }
 }
 
@@ -2143,8 +2184,9 @@ OsiGrbSolverInterface::setInteger(int index)
 
   if ( probtypemip_ )
   {
-    GUROBI_CALL( "setInteger", GRBupdatemodel(getMutableLpPtr()) );
+    updateModel( "setInteger" );
     GUROBI_CALL( "setInteger", GRBsetcharattrelement(getMutableLpPtr(), GRB_CHAR_ATTR_VTYPE, nauxcols ? colmap_O2G[index] : index, coltype_[index]) );
+    updatePending_ = true;
   }
 }
 
@@ -2185,6 +2227,8 @@ OsiGrbSolverInterface::setRowName(int ndx, std::string name)
 
   OsiSolverInterface::setRowName(ndx, name);
 
+  if( pendingRows_ || pendingDeletes_ )
+    updateModel( "setRowName" );
   GUROBI_CALL( "setRowName", GRBsetstrattrelement(getLpPtr(), GRB_STR_ATTR_CONSTRNAME, ndx, const_cast<char*>(name.c_str())) );
 }
 
@@ -2203,6 +2247,8 @@ OsiGrbSolverInterface::setColName(int ndx, std::string name)
 
   OsiSolverInterface::setColName(ndx, name);
 
+  if( pendingCols_ || pendingDeletes_ )
+    updateModel( "setColName" );
   GUROBI_CALL( "setColName", GRBsetstrattrelement(getLpPtr(), GRB_STR_ATTR_VARNAME, nauxcols ? colmap_O2G[ndx] : ndx, const_cast<char*>(name.c_str())) );
 }
 
@@ -2277,13 +2323,15 @@ OsiGrbSolverInterface::addCol(const CoinPackedVectorBase& vec,
   resizeColSpace(nc + 1);
   coltype_[nc] = GRB_CONTINUOUS;
 
-  GUROBI_CALL( "addCol", GRBupdatemodel(getMutableLpPtr()) );
+  if( pendingRows_ || pendingDeletes_ )
+    updateModel( "addCol" );
 
   GUROBI_CALL( "addCol", GRBaddvar(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_ROW ),
   		vec.getNumElements(),
   		const_cast<int*>(vec.getIndices()),
   		const_cast<double*>(vec.getElements()),
   		obj, collb, colub, coltype_[nc], NULL) );
+  ++pendingCols_;
 
   if( nauxcols )
   {
@@ -2328,7 +2376,8 @@ OsiGrbSolverInterface::addCols(const int numcols,
     start[i+1] = nz;
   }
 
-  GUROBI_CALL( "addCols", GRBupdatemodel(getMutableLpPtr()) );
+  if( pendingRows_ || pendingDeletes_ )
+    updateModel( "addCols" );
   
   GUROBI_CALL( "addCols", GRBaddvars(getLpPtr(OsiGrbSolverInterface::KEEPCACHED_ROW),
   		numcols, nz,
@@ -2336,6 +2385,7 @@ OsiGrbSolverInterface::addCols(const int numcols,
   		const_cast<double*>(obj),
   		const_cast<double*>(collb), const_cast<double*>(colub),
   		NULL, NULL) );
+  pendingCols_ += numcols;
 
   delete[] start;
   delete[] elem;
@@ -2363,7 +2413,7 @@ OsiGrbSolverInterface::deleteCols(const int num, const int * columnIndices)
   if( num == 0 )
     return;
 
-  GUROBI_CALL( "deleteCols", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "deleteCols" );
   
   int* ind = NULL;
 
@@ -2380,6 +2430,8 @@ OsiGrbSolverInterface::deleteCols(const int num, const int * columnIndices)
 
     // delete indices in gurobi
     GUROBI_CALL( "deleteCols", GRBdelvars(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_ROW ), num, ind) );
+    pendingCols_ -= num;
+    pendingDeletes_ = true;
 
     nc -= num;
 
@@ -2417,6 +2469,8 @@ OsiGrbSolverInterface::deleteCols(const int num, const int * columnIndices)
   else
   {
     GUROBI_CALL( "deleteCols", GRBdelvars(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_ROW ), num, const_cast<int*>(columnIndices)) );
+    pendingCols_ -= num;
+    pendingDeletes_ = true;
   }
 
 #ifndef NDEBUG
@@ -2440,17 +2494,7 @@ OsiGrbSolverInterface::deleteCols(const int num, const int * columnIndices)
   	coltype_ = NULL;
   }
 
-  if( !getColNames().empty() )
-  {
-    if( ind == NULL )
-      ind = new int[num];
-      
-    memcpy(ind, columnIndices, num * sizeof(int));
-    qsort((void*)ind, num, sizeof(int), intcompare);
-    
-    for( int i = num-1; i >= 0; --i )
-      deleteColNames(ind[i], 1);
-  }
+  deleteColNames(num, columnIndices);
     
   delete[] ind;
 }
@@ -2512,13 +2556,15 @@ OsiGrbSolverInterface::addRow(const CoinPackedVectorBase& vec,
   	  exit(-1);
   }
 
-  GUROBI_CALL( "addRow", GRBupdatemodel(getMutableLpPtr()) );
+  if( pendingCols_ || pendingDeletes_ )
+    updateModel( "addRow" );
 
   GUROBI_CALL( "addRow", GRBaddconstr(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_COLUMN ),
   		vec.getNumElements(),
   		const_cast<int*>(vec.getIndices()),
   		const_cast<double*>(vec.getElements()),
   		grbsense, rhs, NULL) );
+  ++pendingRows_;
 
   if( rowsen == 'R' )
     convertToRangedRow(getNumRows()-1, rowrhs, rowrng);
@@ -2533,6 +2579,7 @@ OsiGrbSolverInterface::addRows(const int numrows,
 			       const double* rowlb, const double* rowub)
 {
   debugMessage("OsiGrbSolverInterface::addRows(%d, %p, %p, %p)\n", numrows, (void*)rows, (void*)rowlb, (void*)rowub);
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
 
   int i;
   int nz = 0;
@@ -2585,12 +2632,14 @@ OsiGrbSolverInterface::addRows(const int numrows,
     }
   }
   
-  GUROBI_CALL( "addRows", GRBupdatemodel(getMutableLpPtr()) );
+  if( pendingCols_ || pendingDeletes_ )
+    updateModel( "addRows" );
 
   GUROBI_CALL( "addRows", GRBaddconstrs(getLpPtr(OsiGrbSolverInterface::KEEPCACHED_ROW),
   		numrows, nz,
   		start, index, elem,
   		grbsense, rhs, NULL) );
+  pendingRows_ += numrows;
 
   delete[] start;
   delete[] elem;
@@ -2617,6 +2666,7 @@ OsiGrbSolverInterface::addRows(const int numrows,
 			       const double* rowrng)
 {
   debugMessage("OsiGrbSolverInterface::addRows(%d, %p, %p, %p, %p)\n", numrows, (void*)rows, (void*)rowsen, (void*)rowrhs, (void*)rowrng);
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
 
   int i;
   int nz = 0;
@@ -2667,12 +2717,14 @@ OsiGrbSolverInterface::addRows(const int numrows,
     }
   }
   
-  GUROBI_CALL( "addRows", GRBupdatemodel(getMutableLpPtr()) );
+  if( pendingCols_ || pendingDeletes_ )
+    updateModel( "addRows" );
 
   GUROBI_CALL( "addRows", GRBaddconstrs(getLpPtr(OsiGrbSolverInterface::KEEPCACHED_ROW),
   		numrows, nz,
   		start, index, elem,
   		grbsense, rhs, NULL) );
+  pendingRows_ += numrows;
 
   delete[] start;
   delete[] elem;
@@ -2696,6 +2748,7 @@ void
 OsiGrbSolverInterface::deleteRows(const int num, const int * rowIndices)
 {
   debugMessage("OsiGrbSolverInterface::deleteRows(%d, %p)\n", num, (void*)rowIndices);
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::deleteRowsEvent);
 
   if( nauxcols )
   { // check if a ranged row should be deleted; if so, then convert it into a normal row first
@@ -2706,9 +2759,16 @@ OsiGrbSolverInterface::deleteRows(const int num, const int * rowIndices)
     }
   }
 
+  if( pendingRows_ || pendingDeletes_ )
+    updateModel( "deleteRows" );
+
   GUROBI_CALL( "deleteRows", GRBdelconstrs(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_COLUMN ), num, const_cast<int*>(rowIndices)) );
+  pendingRows_ -= num;
+  pendingDeletes_ = true;
+
+  deleteRowNames(num, rowIndices);
 
-  if( nauxcols == 0 && getRowNames().empty() )
+  if( nauxcols == 0 )
     return;
 
   int* ind = CoinCopyOfArray(rowIndices, num);
@@ -2749,10 +2809,6 @@ OsiGrbSolverInterface::deleteRows(const int num, const int * rowIndices)
   }
 #endif
 
-  if( !getRowNames().empty() )
-    for( int i = num-1; i >=0; --i )
-      deleteRowNames(ind[i], 1);
-    
   delete[] ind;
 }
 
@@ -2929,7 +2985,7 @@ OsiGrbSolverInterface::loadProblem( const CoinPackedMatrix& matrix,
 	assert( m->isColOrdered() ); 
 	
 	int modelsense;
-	GUROBI_CALL( "loadProblem", GRBupdatemodel(getMutableLpPtr()) );
+	updateModel( "loadProblem" );
   
 	GUROBI_CALL( "loadProblem", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_MODELSENSE, &modelsense) );
 
@@ -2952,6 +3008,7 @@ OsiGrbSolverInterface::loadProblem( const CoinPackedMatrix& matrix,
 			const_cast<double *>(clb), 
 			const_cast<double *>(cub), 
 			NULL, NULL, NULL) );
+	updatePending_ = true;
 
   // GUROBI up to version 2.0.1 may return a scaled LP after GRBoptimize when requesting it via GRBgetvars
 #if (GRB_VERSION_MAJOR < 2) || (GRB_VERSION_MAJOR == 2 && GRB_VERSION_MINOR == 0 && GRB_VERSION_TECHNICAL <= 1)
@@ -3127,7 +3184,7 @@ OsiGrbSolverInterface::loadProblem(const int numcols, const int numrows,
 	for (i = 0; i < nc; ++i)
 		len[i] = start[i+1] - start[i];
 
-	GUROBI_CALL( "loadProblem", GRBupdatemodel(getMutableLpPtr()) );
+	updateModel( "loadProblem" );
 
 	int modelsense;
 	GUROBI_CALL( "loadProblem", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_MODELSENSE, &modelsense) );
@@ -3150,6 +3207,7 @@ OsiGrbSolverInterface::loadProblem(const int numcols, const int numrows,
 			const_cast<double *>(clb), 
 			const_cast<double *>(cub), 
 			NULL, NULL, NULL) );
+	updatePending_ = true;
 
   // GUROBI up to version 2.0.1 may return a scaled LP after GRBoptimize when requesting it via GRBgetvars
 #if (GRB_VERSION_MAJOR < 2) || (GRB_VERSION_MAJOR == 2 && GRB_VERSION_MINOR == 0 && GRB_VERSION_TECHNICAL <= 1)
@@ -3228,6 +3286,7 @@ GRBenv* OsiGrbSolverInterface::getEnvironmentPtr() const
 GRBmodel* OsiGrbSolverInterface::getLpPtr( int keepCached )
 {
   freeCachedData( keepCached );
+  updatePending_ = true;
   return getMutableLpPtr();
 }
 
@@ -3328,6 +3387,10 @@ OsiGrbSolverInterface::OsiGrbSolverInterface(bool use_local_env)
   : OsiSolverInterface(),
     localenv_(NULL),
     lp_(NULL),
+    updatePending_(false),
+    pendingCols_(0),
+    pendingRows_(0),
+    pendingDeletes_(false),
     hotStartCStat_(NULL),
     hotStartCStatSize_(0),
     hotStartRStat_(NULL),
@@ -3379,6 +3442,10 @@ OsiGrbSolverInterface::OsiGrbSolverInterface(GRBenv* localgrbenv)
   : OsiSolverInterface(),
     localenv_(localgrbenv),
     lp_(NULL),
+    updatePending_(false),
+    pendingCols_(0),
+    pendingRows_(0),
+    pendingDeletes_(false),
     hotStartCStat_(NULL),
     hotStartCStatSize_(0),
     hotStartRStat_(NULL),
@@ -3442,6 +3509,10 @@ OsiGrbSolverInterface::OsiGrbSolverInterface( const OsiGrbSolverInterface & sour
   : OsiSolverInterface(source),
     localenv_(NULL),
     lp_(NULL),
+    updatePending_(false),
+    pendingCols_(0),
+    pendingRows_(0),
+    pendingDeletes_(false),
     hotStartCStat_(NULL),
     hotStartCStatSize_(0),
     hotStartRStat_(NULL),
@@ -3527,6 +3598,7 @@ OsiSolverInterface::ApplyCutsReturnCode OsiGrbSolverInterface::applyCuts(const O
         double effectivenessLb)
 {
     debugMessage("OsiGrbSolverInterface::applyCuts(%p)\n", (void*)&cs);
+    OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::applyCutsEvent);
   
     OsiSolverInterface::ApplyCutsReturnCode retVal;
     int i;
@@ -3638,22 +3710,27 @@ OsiSolverInterface::ApplyCutsReturnCode OsiGrbSolverInterface::applyCuts(const O
 
     int nPrevVars = getNumCols();
 
+    if( pendingCols_ || pendingDeletes_ )
+        updateModel( "applyRowCuts" );
+
     GUROBI_CALL( "applyRowCuts", GRBaddrangeconstrs( getLpPtr( OsiGrbSolverInterface::KEEPCACHED_COLUMN ),
                  nToApply, static_cast<int>(space), start, indices, values, lower, upper, NULL) );
+    pendingRows_ += nToApply;
 
-    GUROBI_CALL( "applyRowCuts", GRBupdatemodel(getMutableLpPtr()) );
+    if (nTrulyRanged > 0) {
+        // only an update shows the variables Gurobi added for ranged rows
+        updateModel( "applyRowCuts" );
 
-    // store correspondence between ranged rows and new variables added by Gurobi
-    int nNewVars = getNumCols() - nPrevVars;
+        // store correspondence between ranged rows and new variables added by Gurobi
+        int nNewVars = getNumCols() - nPrevVars;
 
-    if (nNewVars != nTrulyRanged) {
+        if (nNewVars != nTrulyRanged) {
 
-        std::cerr << "ERROR in applying cuts for Gurobi: " << __FILE__ << " : " << "line "
-                  << __LINE__ << " . Exiting" << std::endl;
-        exit(-1);
-    }
+            std::cerr << "ERROR in applying cuts for Gurobi: " << __FILE__ << " : " << "line "
+                      << __LINE__ << " . Exiting" << std::endl;
+            exit(-1);
+        }
 
-    if (nTrulyRanged > 0) {
         if( nauxcols == 0 ) {
             // this is the first ranged row
             assert(colmap_O2G == NULL);
@@ -3799,6 +3876,25 @@ GRBmodel* OsiGrbSolverInterface::getMutableLpPtr() const
   return lp_;
 }
 
+//-------------------------------------------------------------------
+// Gurobi keeps changes to the model until GRBupdatemodel.  Until then
+// queries see the model as it was and new rows or columns cannot be
+// referred to, but changes are cheap, so we only update when we need to:
+// before queries, before solves, and before changes that refer to rows or
+// columns which were added or shifted by a deletion since the last update.
+//-------------------------------------------------------------------
+void OsiGrbSolverInterface::updateModel( const char* caller ) const
+{
+  if( updatePending_ )
+  {
+    GUROBI_CALL( caller, GRBupdatemodel(getMutableLpPtr()) );
+    updatePending_ = false;
+    pendingCols_ = 0;
+    pendingRows_ = 0;
+    pendingDeletes_ = false;
+  }
+}
+
 //-------------------------------------------------------------------
 
 void OsiGrbSolverInterface::gutsOfCopy( const OsiGrbSolverInterface & source )
@@ -3847,6 +3943,10 @@ void OsiGrbSolverInterface::gutsOfDestructor()
   {
     GUROBI_CALL( "gutsOfDestructor", GRBfreemodel(lp_) );
   	lp_ = NULL;
+    updatePending_ = false;
+    pendingCols_ = 0;
+    pendingRows_ = 0;
+    pendingDeletes_ = false;
   	freeAllMemory();
   }
   assert( lp_==NULL );
@@ -3982,12 +4082,13 @@ void OsiGrbSolverInterface::convertToRangedRow(int rowidx, double rhs, double ra
   resizeAuxColIndSpace();
   assert(auxcolind[rowidx] == -1); /* not a ranged row yet */
 
-  GUROBI_CALL( "convertToRangedRow", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "convertToRangedRow" );
 
   double minusone = -1.0;
   GUROBI_CALL( "convertToRangedRow", GRBaddvar(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_PROBLEM ),
       1, &rowidx, &minusone,
       0.0, rhs-range, rhs, GRB_CONTINUOUS, NULL) );
+  ++pendingCols_;
 
   auxcolind[rowidx] = getNumCols() + nauxcols - 1;
   colmap_G2O[auxcolind[rowidx]] = -rowidx - 1;
@@ -4024,10 +4125,12 @@ void OsiGrbSolverInterface::convertToNormalRow(int rowidx, char sense, double rh
   assert(auxvar >= 0);
   assert(colmap_G2O[auxvar] == -rowidx - 1);
 
-  GUROBI_CALL( "convertToNormalRow", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "convertToNormalRow" );
 
   /* row rowidx should be an ordinary equality row with rhs == 0 now */
   GUROBI_CALL( "convertToNormalRow", GRBdelvars(getLpPtr( OsiGrbSolverInterface::KEEPCACHED_ROW ), 1, &auxcolind[rowidx]) );
+  --pendingCols_;
+  pendingDeletes_ = true;
 
   auxcolind[rowidx] = -1;
 
@@ -4099,7 +4202,7 @@ bool OsiGrbSolverInterface::basisIsAvailable() const {
   if (getNumCols() == 0)
   	return true;
 
-  GUROBI_CALL( "basisIsAvailable", GRBupdatemodel(getMutableLpPtr()) );
+  updateModel( "basisIsAvailable" );
 
   int status;
   GUROBI_CALL( "basisIsAvailable", GRBgetintattr(getMutableLpPtr(), GRB_INT_ATTR_STATUS, &status) );
@@ -4122,7 +4225,7 @@ void OsiGrbSolverInterface::getBasisStatus(int* cstat, int* rstat) const {
 	int numcols = getNumCols();
 	int numrows = getNumRows();
 
-	GUROBI_CALL( "getBasisStatus", GRBupdatemodel(getMutableLpPtr()) );
+	updateModel( "getBasisStatus" );
 
   if( nauxcols )
     GUROBI_CALL( "getBasisStatus", GRBgetintattrlist(getMutableLpPtr(), GRB_INT_ATTR_VBASIS, numcols, colmap_O2G, cstat) );
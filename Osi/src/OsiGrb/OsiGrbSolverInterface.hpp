@@ -794,6 +794,9 @@ private:
 	/// Get LP Pointer for const methods
 	GRBmodel* getMutableLpPtr() const;
 
+	/// Pass pending changes to Gurobi (GRBupdatemodel), if there are any
+	void updateModel(const char* caller) const;
+
 	/// The real work of a copy constructor (used by copy and assignment)
 	void gutsOfCopy(const OsiGrbSolverInterface & source);
 
@@ -837,6 +840,18 @@ private:
 	/// Gurobi model represented by this class instance
 	mutable GRBmodel* lp_;	
 
+	/**@name Changes to the model not yet seen by GRBupdatemodel */
+	//@{
+	/// Whether there may be any (set by getLpPtr())
+	mutable bool updatePending_;
+	/// Columns (including auxiliary ones) added less columns deleted
+	mutable int pendingCols_;
+	/// Rows added less rows deleted
+	mutable int pendingRows_;
+	/// Whether rows or columns were deleted, so indices have shifted
+	mutable bool pendingDeletes_;
+	//@}
+
 	/// Hotstart information
 	int *hotStartCStat_;
 	int hotStartCStatSize_;
@@ -62,17 +62,6 @@ inline void freeCacheDouble( double*& ptr )
   }
 }
 
-// Free memory pointet to by a char pointer
-
-inline void freeCacheChar( char*& ptr )
-{
-  if( ptr != NULL )
-  {
-    delete [] ptr;
-    ptr = NULL;
-  }
-}
-
 // Free memory pointet to by a CoinPackedMatrix pointer 
 
 inline void freeCacheMatrix( CoinPackedMatrix*& ptr )
@@ -1851,77 +1840,79 @@ int OsiMskSolverInterface::getNumElements() const
 
 
 //-----------------------------------------------------------------------------
-// Returns lower bounds on columns in MOSEK task
+// Fetches the column bounds which are out of date from MOSEK task
 
-const double * OsiMskSolverInterface::getColLower() const
+void OsiMskSolverInterface::cacheColBounds() const
 {
-  #if MSK_OSI_DEBUG_LEVEL > 3
-  debugMessage("Begin OsiMskSolverInterface::getColLower()\n");
-  #endif
-
-  if(collower_ == NULL )
+  if( !collower_.isCached() )
   {
-    int ncols = getNumCols();
-
-    MSKassert(3,colupper_ == NULL,"colupper_","getColLower");
+    MSKassert(3,!colupper_.isCached(),"!colupper_.isCached()","cacheColBounds");
 
-    if( ncols > 0 )
-    {
-      if(colupper_ == NULL)
-        colupper_       = new double[ncols];
-
-      if(collower_ == NULL)
-        collower_       = new double[ncols];
+    int ncols = getNumCols();
 
-      int *dummy_tags = new int[ncols];
+    collower_.allocate(ncols);
+    colupper_.allocate(ncols);
+  }
 
-      int err = MSK_getboundslice(getMutableLpPtr(), 
-                                  MSK_ACC_VAR, 
-                                  (MSKidxt)0, 
-                                  (MSKidxt)ncols, 
-                                  (MSKboundkeye*) (dummy_tags), 
-                                  collower_, 
-                                  colupper_);
+  // collower_ and colupper_ are always out of date together
+  if( collower_.isDirty() )
+  {
+    const int first = collower_.dirtyStart();
+    const int last = collower_.dirtyEnd();
+    double *lower = collower_.array();
+    double *upper = colupper_.array();
+    int *dummy_tags = new int[last-first];
+
+    int err = MSK_getboundslice(getMutableLpPtr(), 
+                                MSK_ACC_VAR, 
+                                (MSKidxt)first, 
+                                (MSKidxt)last, 
+                                (MSKboundkeye*) (dummy_tags), 
+                                lower+first, 
+                                upper+first);
                                   
-      checkMSKerror(err, "MSK_getboundslice","getColUpper");
+    checkMSKerror(err, "MSK_getboundslice","cacheColBounds");
 
-      for( int k = 0; k < ncols; ++k )
+    for( int k = first; k < last; ++k )
+    {
+      if( dummy_tags[k-first] == MSK_BK_UP ||
+          dummy_tags[k-first] == MSK_BK_FR )
       {
-        if( dummy_tags[k] == MSK_BK_UP ||
-            dummy_tags[k] == MSK_BK_FR )
-        {
-          /* No lower */
-          collower_[k] = -getInfinity();
-        }
+        /* No lower */
+        lower[k] = -getInfinity();
+      }
 
-        if( dummy_tags[k] == MSK_BK_LO ||
-            dummy_tags[k] == MSK_BK_FR )
-        {
-          /* No upper */
-          colupper_[k] =  getInfinity();
-        }
+      if( dummy_tags[k-first] == MSK_BK_LO ||
+          dummy_tags[k-first] == MSK_BK_FR )
+      {
+        /* No upper */
+        upper[k] =  getInfinity();
       }
+    }
 
-      delete[] dummy_tags;
+    delete[] dummy_tags;
 
-    } 
-    else
-    {
-      if(colupper_ != NULL)
-        delete [] colupper_;
+    collower_.markClean();
+    colupper_.markClean();
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Returns lower bounds on columns in MOSEK task
 
-      if(collower_ != NULL)
-        delete [] collower_;
+const double * OsiMskSolverInterface::getColLower() const
+{
+  #if MSK_OSI_DEBUG_LEVEL > 3
+  debugMessage("Begin OsiMskSolverInterface::getColLower()\n");
+  #endif
 
-      colupper_ = collower_ = NULL;
-    }
-  }
+  cacheColBounds();
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::getColLower()\n");
   #endif
 
-  return collower_;
+  return collower_.array();
 }
 
 //-----------------------------------------------------------------------------
@@ -1933,51 +1924,13 @@ const double * OsiMskSolverInterface::getColUpper() const
   debugMessage("Begin OsiMskSolverInterface::getColUpper()\n");
   #endif
 
-  if( colupper_ == NULL )
-  {
-    int ncols = getNumCols();
-
-    MSKassert(3,collower_ == NULL,"collower_ == NULL","getColUpper");
-
-    if( ncols > 0 )
-    {
-      if(colupper_ == NULL)
-        colupper_       = new double[ncols];
-
-      if(collower_ == NULL)
-        collower_       = new double[ncols];
-
-      int *dummy_tags = new int[ncols];
-      
-      int err = MSK_getboundslice( getMutableLpPtr(), 
-                                   MSK_ACC_VAR, 
-                                   (MSKidxt)0, 
-                                   (MSKidxt)ncols, 
-                                   (MSKboundkeye*) (dummy_tags), 
-                                   collower_, 
-                                   colupper_);
-                                  
-      checkMSKerror(err,"MSK_getboundslice","getColUpper");
-      
-      delete[] dummy_tags;
-    } 
-    else
-    {
-      if(colupper_ != NULL)
-        delete [] colupper_;
-
-      if(collower_ != NULL)
-        delete [] collower_;
-
-      colupper_ = collower_ = NULL;
-    }
-  }
+  cacheColBounds();
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::getColUpper()\n");
   #endif
 
-  return colupper_;
+  return colupper_.array();
 }
 
 
@@ -1990,19 +1943,19 @@ const char * OsiMskSolverInterface::getRowSense() const
   debugMessage("Begin OsiMskSolverInterface::getRowSense()\n");
   #endif
 
-  if( rowsense_==NULL )
+  if( !rowsense_.isCached() || rowsense_.isDirty() )
   {      
     getRightHandSide();
 
     if( getNumRows() != 0 )
-      MSKassert(3,rowsense_!=NULL,"rowsense_!=NULL","getRowSense");
+      MSKassert(3,rowsense_.isCached(),"rowsense_.isCached()","getRowSense");
   }
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::getRowSense()\n");
   #endif
 
-  return rowsense_;
+  return rowsense_.array();
 }
 
 //-----------------------------------------------------------------------------
@@ -2015,30 +1968,40 @@ const double * OsiMskSolverInterface::getRightHandSide() const
   debugMessage("Begin OsiMskSolverInterface::getRightHandSide()\n");
   #endif
 
-  if(rowsense_ == NULL) 
+  if( !rowsense_.isCached() ) 
   {
     int nr = getNumRows();
-    if ( nr != 0 ) 
-    {
-      MSKassert(3,(rhs_ == NULL) && (rowrange_ == NULL),"(rhs_ == NULL) && (rowrange_ == NULL)","getRightHandSide");
+
+    MSKassert(3,!rhs_.isCached() && !rowrange_.isCached(),"!rhs_.isCached() && !rowrange_.isCached()","getRightHandSide");
       
-      rowsense_         = new char[nr];
-      rhs_              = new double[nr];
-      rowrange_         = new double[nr]; 
-      const double * lb = getRowLower();
-      const double * ub = getRowUpper();      
-      int i;
+    rowsense_.allocate(nr);
+    rhs_.allocate(nr);
+    rowrange_.allocate(nr);
+  }
+
+  if( rowsense_.isDirty() )
+  {
+    // only rows changed since last time (all if none were cached)
+    const double * lb = getRowLower();
+    const double * ub = getRowUpper();      
+    char * sense = rowsense_.array();
+    double * rhs = rhs_.array();
+    double * range = rowrange_.array();
+    int i;
       
-      for ( i=0; i<nr; i++ )
-        convertBoundToSense(lb[i], ub[i], rowsense_[i], rhs_[i], rowrange_[i]);
-    }
+    for ( i=rowsense_.dirtyStart(); i<rowsense_.dirtyEnd(); i++ )
+      convertBoundToSense(lb[i], ub[i], sense[i], rhs[i], range[i]);
+
+    rowsense_.markClean();
+    rhs_.markClean();
+    rowrange_.markClean();
   }
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::getRightHandSide()\n");
   #endif
 
-  return rhs_;
+  return rhs_.array();
 }
 
 //-----------------------------------------------------------------------------
@@ -2050,60 +2013,75 @@ const double * OsiMskSolverInterface::getRowRange() const
   debugMessage("Begin OsiMskSolverInterface::getRowRange()\n");
   #endif
 
-  if( rowrange_ == NULL ) 
+  if( !rowrange_.isCached() || rowrange_.isDirty() ) 
   {
     getRightHandSide();
-    MSKassert(3,rowrange_!=NULL || getNumRows() == 0,"rowrange_!=NULL || getNumRows() == 0","getRowRange");
+    MSKassert(3,rowrange_.isCached() || getNumRows() == 0,"rowrange_.isCached() || getNumRows() == 0","getRowRange");
   }
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::getRowRange()\n");
   #endif
 
-  return rowrange_;
+  return rowrange_.array();
 }
 
 
 //-----------------------------------------------------------------------------
-// Returns lower bounds on rows in MOSEK task.
+// Fetches the row bounds which are out of date from MOSEK task
 
-const double * OsiMskSolverInterface::getRowLower() const
+void OsiMskSolverInterface::cacheRowBounds() const
 {
-  #if MSK_OSI_DEBUG_LEVEL > 3
-  debugMessage("Begin OsiMskSolverInterface::getRowLower()\n");
-  #endif
-
-  if( rowlower_ == NULL )
+  if( !rowlower_.isCached() )
   {
-    MSKassert(3,rowupper_ == NULL,"rowupper_ == NULL","getRowLower");
+    MSKassert(3,!rowupper_.isCached(),"!rowupper_.isCached()","cacheRowBounds");
 
     int nrows = getNumRows();
 
-    if( nrows > 0 )
-    {
-      rowlower_       = new double[nrows];
-      rowupper_       = new double[nrows];
-      int *dummy_tags = new int[nrows];
+    rowlower_.allocate(nrows);
+    rowupper_.allocate(nrows);
+  }
+
+  // rowlower_ and rowupper_ are always out of date together
+  if( rowlower_.isDirty() )
+  {
+    const int first = rowlower_.dirtyStart();
+    const int last = rowlower_.dirtyEnd();
+    int *dummy_tags = new int[last-first];
         
-      int err = MSK_getboundslice(getMutableLpPtr(), 
-                                  MSK_ACC_CON, 
-                                  (MSKidxt)0, 
-                                  (MSKidxt)nrows, 
-                                  (MSKboundkeye*) (dummy_tags), 
-                                  rowlower_, 
-                                  rowupper_);
+    int err = MSK_getboundslice(getMutableLpPtr(), 
+                                MSK_ACC_CON, 
+                                (MSKidxt)first, 
+                                (MSKidxt)last, 
+                                (MSKboundkeye*) (dummy_tags), 
+                                rowlower_.array()+first, 
+                                rowupper_.array()+first);
         
-      checkMSKerror(err,"MSK_getboundslice","getRowLower");
+    checkMSKerror(err,"MSK_getboundslice","cacheRowBounds");
       
-      delete[] dummy_tags;
-    }
+    delete[] dummy_tags;
+
+    rowlower_.markClean();
+    rowupper_.markClean();
   }
+}
+
+//-----------------------------------------------------------------------------
+// Returns lower bounds on rows in MOSEK task.
+
+const double * OsiMskSolverInterface::getRowLower() const
+{
+  #if MSK_OSI_DEBUG_LEVEL > 3
+  debugMessage("Begin OsiMskSolverInterface::getRowLower()\n");
+  #endif
+
+  cacheRowBounds();
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::getRowLower()\n");
   #endif
 
-  return rowlower_;
+  return rowlower_.array();
 }
 
 
@@ -2116,37 +2094,13 @@ const double * OsiMskSolverInterface::getRowUpper() const
   debugMessage("Begin OsiMskSolverInterface::getRowUpper()\n");
   #endif
 
-  if( rowupper_ == NULL )
-  {
-    MSKassert(3,rowlower_ == NULL,"probtypemip_","getRowUpper");
-
-    int nrows = getNumRows();
-    
-    if( nrows > 0 )
-    {
-      rowupper_       = new double[nrows];
-      rowlower_       = new double[nrows];
-      int *dummy_tags = new int[nrows];
-        
-      int err = MSK_getboundslice(getMutableLpPtr(), 
-                                  MSK_ACC_CON, 
-                                  (MSKidxt)0,
-                                  (MSKidxt)nrows, 
-                                  (MSKboundkeye*) (dummy_tags), 
-                                  rowlower_, 
-                                  rowupper_);
-        
-      checkMSKerror(err,"MSK_getboundslice","getRowUpper");
-      
-      delete[] dummy_tags;
-    }
-  }
+  cacheRowBounds();
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::getRowUpper()\n");
   #endif
 
-  return rowupper_;
+  return rowupper_.array();
 }
 
 
@@ -2160,24 +2114,24 @@ const double * OsiMskSolverInterface::getObjCoefficients() const
   debugMessage("Begin OsiMskSolverInterface::getObjCoefficients()\n");
   #endif
 
-  if( obj_ == NULL )
-  {
-    int ncols = getNumCols();
+  if( !obj_.isCached() )
+    obj_.allocate(getNumCols());
 
-    if( ncols > 0 )
-    {
-      obj_    = new double[ncols]; 
-      int err = MSK_getc( getMutableLpPtr(), obj_ );
+  if( obj_.isDirty() )
+  {
+    const int first = obj_.dirtyStart();
+    int err = MSK_getcslice( getMutableLpPtr(), first, obj_.dirtyEnd(), obj_.array()+first );
       
-      checkMSKerror( err, "MSK_getc", "getObjCoefficients" );
-    }
+    checkMSKerror( err, "MSK_getcslice", "getObjCoefficients" );
+
+    obj_.markClean();
   }
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::getObjCoefficients()\n");
   #endif
 
-  return obj_;
+  return obj_.array();
 }
 
 
@@ -2835,12 +2789,10 @@ void OsiMskSolverInterface::setObjCoeff( int elementIndex, double elementValue )
   debugMessage("Begin OsiMskSolverInterface::setObjCoeff(%d, %g)\n", elementIndex, elementValue);
   #endif
 
-  const double *oldobj;
+  const double *oldobj = NULL;
 
-  if( redcost_  && !obj_ )
+  if( redcost_ )
     oldobj = getObjCoefficients();
-  else
-    oldobj = obj_;
 
   int err = MSK_putclist(getMutableLpPtr(), 
                           1, 
@@ -2849,18 +2801,10 @@ void OsiMskSolverInterface::setObjCoeff( int elementIndex, double elementValue )
 
   checkMSKerror(err, "MSK_putclist", "setObjCoeff");
 
-  if( obj_  )
-  {
-    if( redcost_  )
-    {
-      redcost_[elementIndex] += elementValue-oldobj[elementIndex];
-      obj_[elementIndex]      = elementValue;
-    }
-    else
-    {
-      obj_[elementIndex] = elementValue;
-    }
-  }
+  if( redcost_ )
+    redcost_[elementIndex] += elementValue-oldobj[elementIndex];
+
+  obj_.set(elementIndex, elementValue);
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::setObjCoeff(%d, %g)\n", elementIndex, elementValue);
@@ -2878,13 +2822,11 @@ void OsiMskSolverInterface::setObjCoeffSet(const int* indexFirst,
   debugMessage("Begin OsiMskSolverInterface::setObjCoeffSet(%p, %p, %p)\n", (void *)indexFirst, (void *)indexLast, (void *)coeffList);
   #endif
 
-  const double *oldobj;
+  const double *oldobj = NULL;
   const long int cnt = indexLast - indexFirst;
 
-  if( redcost_  && !obj_ )
+  if( redcost_ )
     oldobj = getObjCoefficients();
-  else
-    oldobj = obj_;
 
   int err = MSK_putclist(getMutableLpPtr(),
                          static_cast<int>(cnt),
@@ -2893,23 +2835,12 @@ void OsiMskSolverInterface::setObjCoeffSet(const int* indexFirst,
 
   checkMSKerror(err, "MSK_putclist", "setObjCoeffSet");
 
-  if( obj_  )
+  for( int j = 0; j < cnt; ++j)
   {
-    if( redcost_  )
-    {
-      for( int j = 0; j < cnt; ++j)
-      {
-        redcost_[j] += coeffList[indexFirst[j]]-oldobj[j];
-        obj_[j]      = coeffList[indexFirst[j]];
-      }
-    }
-    else
-    {
-      for( int j = 0; j < cnt; ++j)
-      {
-        obj_[j] = coeffList[indexFirst[j]];
-      }
-    }
+    if( redcost_ )
+      redcost_[indexFirst[j]] += coeffList[j]-oldobj[indexFirst[j]];
+
+    obj_.set(indexFirst[j], coeffList[j]);
   }
 
 
@@ -2941,8 +2872,7 @@ void OsiMskSolverInterface::setColLower(int elementIndex, double elementValue)
 
   checkMSKerror( err, "MSK_chgbound", "setColLower" );
    
-  if( collower_ != NULL )
-    collower_[elementIndex] = elementValue;
+  collower_.set(elementIndex, elementValue);
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::setColLower(%d, %g)\n", elementIndex, elementValue);
@@ -2972,8 +2902,7 @@ void OsiMskSolverInterface::setColUpper(int elementIndex, double elementValue)
 
   checkMSKerror( err, "MSK_chgbound", "setColUpper" );
     
-  if( colupper_ != NULL )
-    colupper_[elementIndex] = elementValue;
+  colupper_.set(elementIndex, elementValue);
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::setColUpper(%d, %g)\n", elementIndex, elementValue);
@@ -3114,16 +3043,20 @@ OsiMskSolverInterface::setRowType(int i, char sense, double rightHandSide,double
                          rlb, 
                          rub);
 
-  if( rowsense_ != NULL )
-     rowsense_[i] = sense;
+  checkMSKerror( err, "MSK_putbound", "setRowType" );
 
-  if( rowrange_ != NULL )
-     rowrange_[i] = range;
+  rowsense_.set(i, sense);
+  rowrange_.set(i, range);
+  rhs_.set(i, rightHandSide);
 
-  if( rhs_      != NULL )
-     rhs_[i]      = rightHandSide;
-                  
-  checkMSKerror( err, "MSK_putbound", "setRowType" );
+  if( rowlower_.isCached() )
+  {
+    double lower, upper;
+
+    convertSenseToBound(sense, rightHandSide, range, lower, upper);
+    rowlower_.set(i, lower);
+    rowupper_.set(i, upper);
+  }
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::setRowType(%d, %c, %g, %g)\n", i, sense, rightHandSide, range);
@@ -3700,7 +3633,7 @@ OsiMskSolverInterface::addCol(const CoinPackedVectorBase& vec,
 
   int ends = vec.getNumElements();
   MSKboundkeye tag;
-  MSKtask_t task=getLpPtr(); 
+  MSKtask_t task=getLpPtr( OsiMskSolverInterface::KEEPCACHED_COLUMN | OsiMskSolverInterface::KEEPCACHED_ROW ); 
 
   double inf = getInfinity();
   if(collb > -inf && colub >= inf)
@@ -3749,6 +3682,10 @@ OsiMskSolverInterface::addCol(const CoinPackedVectorBase& vec,
 
   checkMSKerror( err, "MSK_appendvars", "addCol" );
 
+  obj_.append(1, &obj);
+  collower_.append(1, &collb);
+  colupper_.append(1, &colub);
+
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::addCol(%p, %g, %g, %g)\n", (void *)&vec, collb, colub, obj);
   #endif
@@ -3770,7 +3707,7 @@ OsiMskSolverInterface::addCols(const int numcols,
   int i, nz = 0, err = MSK_RES_OK;
   
   // For efficiency we put hints on the total future size
-  err = MSK_getmaxnumanz(getLpPtr(),
+  err = MSK_getmaxnumanz(getMutableLpPtr(),
                          &nz);
                      
   checkMSKerror( err, "MSK_getmaxanz", "addCols" );
@@ -3778,12 +3715,12 @@ OsiMskSolverInterface::addCols(const int numcols,
   for( i = 0; i < numcols; ++i)
     nz += cols[i]->getNumElements();
   
-  err = MSK_putmaxnumanz(getLpPtr(),
+  err = MSK_putmaxnumanz(getMutableLpPtr(),
                          nz);
                      
   checkMSKerror( err, "MSK_putmaxanz", "addCols" );
           
-  err = MSK_putmaxnumvar(getLpPtr(),
+  err = MSK_putmaxnumvar(getMutableLpPtr(),
                          numcols+getNumCols());
                      
   checkMSKerror( err, "MSK_putmaxnumvar", "addCols" );
@@ -3808,7 +3745,7 @@ OsiMskSolverInterface::deleteCols(const int num, const int * columnIndices)
 
 #if MSK_VERSION_MAJOR >= 7
   int err;
-  err = MSK_removevars(getLpPtr( OsiMskSolverInterface::KEEPCACHED_ROW ),
+  err = MSK_removevars(getLpPtr( OsiMskSolverInterface::KEEPCACHED_ROW | OsiMskSolverInterface::KEEPCACHED_COLUMN ),
                        num,
                        const_cast<int*>(columnIndices));
 
@@ -3816,7 +3753,7 @@ OsiMskSolverInterface::deleteCols(const int num, const int * columnIndices)
 
 #else
   int err;
-  err = MSK_remove(getLpPtr( OsiMskSolverInterface::KEEPCACHED_ROW ),
+  err = MSK_remove(getLpPtr( OsiMskSolverInterface::KEEPCACHED_ROW | OsiMskSolverInterface::KEEPCACHED_COLUMN ),
                    MSK_ACC_VAR,
                    num,
                    const_cast<int*>(columnIndices));
@@ -3824,6 +3761,10 @@ OsiMskSolverInterface::deleteCols(const int num, const int * columnIndices)
   checkMSKerror( err, "MSK_remove", "deleteCols" );
 #endif
 
+  obj_.remove(num, columnIndices);
+  collower_.remove(num, columnIndices);
+  colupper_.remove(num, columnIndices);
+
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::deleteCols(%d, %p)\n", num, (void *)columnIndices);
   #endif
@@ -3845,7 +3786,7 @@ OsiMskSolverInterface::addRow(const CoinPackedVectorBase& vec,
   int          ends = vec.getNumElements();
   double       inf = getInfinity();
   MSKboundkeye tag;
-  MSKtask_t    task = getLpPtr( OsiMskSolverInterface::KEEPCACHED_COLUMN );
+  MSKtask_t    task = getLpPtr( OsiMskSolverInterface::KEEPCACHED_COLUMN | OsiMskSolverInterface::KEEPCACHED_ROW );
   
   if(rowlb > -inf && rowub >= inf)
     tag = MSK_BK_LO;
@@ -3890,6 +3831,19 @@ OsiMskSolverInterface::addRow(const CoinPackedVectorBase& vec,
 
   checkMSKerror( err, "MSK_appendcons", "addRow" );
 
+  rowlower_.append(1, &rowlb);
+  rowupper_.append(1, &rowub);
+  if( rowsense_.isCached() )
+  {
+    char sense;
+    double rhs, range;
+    
+    convertBoundToSense(rowlb, rowub, sense, rhs, range);
+    rowsense_.append(1, &sense);
+    rhs_.append(1, &rhs);
+    rowrange_.append(1, &range);
+  }
+
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::addRow(%p, %g, %g)\n", (void *)&vec, rowlb, rowub);
   #endif
@@ -3933,7 +3887,7 @@ OsiMskSolverInterface::addRows(const int numrows,
   
   // For efficiency we put hints on the total future size
   err = MSK_getmaxnumanz(
-                     getLpPtr(),
+                     getMutableLpPtr(),
                      &nz);
                      
   checkMSKerror( err, "MSK_getmaxanz", "addRows" );
@@ -3942,12 +3896,12 @@ OsiMskSolverInterface::addRows(const int numrows,
   for( i = 0; i < numrows; ++i)
     nz += rows[i]->getNumElements();
   
-  err = MSK_putmaxnumanz(getLpPtr(),
+  err = MSK_putmaxnumanz(getMutableLpPtr(),
                          nz);
                      
   checkMSKerror( err, "MSK_putmaxanz", "addRows" );
           
-  err = MSK_putmaxnumcon(getLpPtr(),
+  err = MSK_putmaxnumcon(getMutableLpPtr(),
                         numrows+getNumRows());
                     
   checkMSKerror( err, "MSK_putmaxnumcon", "addRows" );
@@ -3980,13 +3934,13 @@ OsiMskSolverInterface::addRows(const int numrows,
     nz += rows[i]->getNumElements();
   
   err = MSK_putmaxnumanz(
-                     getLpPtr(),
+                     getMutableLpPtr(),
                      nz);
                      
   checkMSKerror( err, "MSK_putmaxanz", "addRows" );
           
   err = MSK_putmaxnumcon(
-                     getLpPtr(),
+                     getMutableLpPtr(),
                      numrows);
                      
   checkMSKerror( err, "MSK_putmaxnumcon", "addRows" );
@@ -4011,14 +3965,14 @@ OsiMskSolverInterface::deleteRows(const int num, const int * rowIndices)
 
   int err;
 #if MSK_VERSION_MAJOR >= 7
-  err = MSK_removecons(getLpPtr( OsiMskSolverInterface::KEEPCACHED_COLUMN ),
+  err = MSK_removecons(getLpPtr( OsiMskSolverInterface::KEEPCACHED_COLUMN | OsiMskSolverInterface::KEEPCACHED_ROW ),
                        num,
                        const_cast<int*>(rowIndices));
 
   checkMSKerror( err, "MSK_removecons", "deleteRows" );
 
 #else
-  err = MSK_remove(getLpPtr( OsiMskSolverInterface::KEEPCACHED_COLUMN ),
+  err = MSK_remove(getLpPtr( OsiMskSolverInterface::KEEPCACHED_COLUMN | OsiMskSolverInterface::KEEPCACHED_ROW ),
                    MSK_ACC_CON,
                    num,
                    const_cast<int*>(rowIndices));
@@ -4026,6 +3980,12 @@ OsiMskSolverInterface::deleteRows(const int num, const int * rowIndices)
   checkMSKerror( err, "MSK_remove", "deleteRows" );
 #endif
 
+  rowlower_.remove(num, rowIndices);
+  rowupper_.remove(num, rowIndices);
+  rowsense_.remove(num, rowIndices);
+  rhs_.remove(num, rowIndices);
+  rowrange_.remove(num, rowIndices);
+
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::deleteRows(%d, %p)\n", num, (void *)rowIndices);
   #endif
@@ -4715,14 +4675,6 @@ OsiMskSolverInterface::OsiMskSolverInterface(MSKenv_t mskenv)
     hotStartRStat_(NULL),
     hotStartRStatSize_(0),
     hotStartMaxIteration_(1000000), 
-    obj_(NULL),
-    collower_(NULL),
-    colupper_(NULL),
-    rowsense_(NULL),
-    rhs_(NULL),
-    rowrange_(NULL),
-    rowlower_(NULL),
-    rowupper_(NULL),
     colsol_(NULL),
     rowsol_(NULL),
     redcost_(NULL),
@@ -4784,14 +4736,6 @@ OsiMskSolverInterface::OsiMskSolverInterface( const OsiMskSolverInterface & sour
     hotStartRStat_(NULL),
     hotStartRStatSize_(0),
     hotStartMaxIteration_(source.hotStartMaxIteration_),
-    obj_(NULL),
-    collower_(NULL),
-    colupper_(NULL),
-    rowsense_(NULL),
-    rhs_(NULL),
-    rowrange_(NULL),
-    rowlower_(NULL),
-    rowupper_(NULL),
     colsol_(NULL),
     rowsol_(NULL),
     redcost_(NULL),
@@ -5078,14 +5022,14 @@ void OsiMskSolverInterface::gutsOfDestructor()
   }
 
   MSKassert(3,task_==NULL,"task_==NULL","gutsOfDestructor");
-  MSKassert(3,obj_==NULL,"obj_==NULL","gutsOfDestructor");
-  MSKassert(3,collower_==NULL,"collower_==NULL","gutsOfDestructor");
-  MSKassert(3,colupper_==NULL,"colupper_==NULL","gutsOfDestructor");
-  MSKassert(3,rowsense_==NULL,"rowsense_==NULL","gutsOfDestructor");
-  MSKassert(3,rhs_==NULL,"rhs_==NULL","gutsOfDestructor");
-  MSKassert(3,rowrange_==NULL,"rowrange_==NULL","gutsOfDestructor");
-  MSKassert(3,rowlower_==NULL,"rowlower_==NULL","gutsOfDestructor");
-  MSKassert(3,rowupper_==NULL,"rowupper_==NULL","gutsOfDestructor");
+  MSKassert(3,!obj_.isCached(),"!obj_.isCached()","gutsOfDestructor");
+  MSKassert(3,!collower_.isCached(),"!collower_.isCached()","gutsOfDestructor");
+  MSKassert(3,!colupper_.isCached(),"!colupper_.isCached()","gutsOfDestructor");
+  MSKassert(3,!rowsense_.isCached(),"!rowsense_.isCached()","gutsOfDestructor");
+  MSKassert(3,!rhs_.isCached(),"!rhs_.isCached()","gutsOfDestructor");
+  MSKassert(3,!rowrange_.isCached(),"!rowrange_.isCached()","gutsOfDestructor");
+  MSKassert(3,!rowlower_.isCached(),"!rowlower_.isCached()","gutsOfDestructor");
+  MSKassert(3,!rowupper_.isCached(),"!rowupper_.isCached()","gutsOfDestructor");
   MSKassert(3,colsol_==NULL,"colsol_==NULL","gutsOfDestructor");
   MSKassert(3,rowsol_==NULL,"rowsol_==NULL","gutsOfDestructor");
   MSKassert(3,redcost_==NULL,"redcost_==NULL","gutsOfDestructor");
@@ -5110,13 +5054,9 @@ void OsiMskSolverInterface::freeCachedColRim()
   debugMessage("Begin OsiMskSolverInterface::freeCachedColRim()\n");
   #endif
 
-  freeCacheDouble( obj_ );  
-  freeCacheDouble( collower_ ); 
-  freeCacheDouble( colupper_ );
-  
-  MSKassert(3,obj_==NULL,"obj_==NULL","freeCachedColRim");
-  MSKassert(3,collower_==NULL,"collower_==NULL","freeCachedColRim");
-  MSKassert(3,colupper_==NULL,"colupper_==NULL","freeCachedColRim");
+  obj_.free();
+  collower_.free();
+  colupper_.free();
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::freeCachedColRim()\n");
@@ -5132,17 +5072,11 @@ void OsiMskSolverInterface::freeCachedRowRim()
   debugMessage("Begin OsiMskSolverInterface::freeCachedRowRim()\n");
   #endif
 
-  freeCacheChar( rowsense_ );
-  freeCacheDouble( rhs_ );
-  freeCacheDouble( rowrange_ );
-  freeCacheDouble( rowlower_ );
-  freeCacheDouble( rowupper_ );
-  
-  MSKassert(3,rowsense_==NULL,"rowsense_==NULL","freeCachedRowRim");
-  MSKassert(3,rhs_==NULL,"rhs_==NULL","freeCachedRowRim");
-  MSKassert(3,rowrange_==NULL,"rowrange_==NULL","freeCachedRowRim");
-  MSKassert(3,rowlower_==NULL,"rowlower_==NULL","freeCachedRowRim");
-  MSKassert(3,rowupper_==NULL,"rowupper_==NULL","freeCachedRowRim");
+  rowsense_.free();
+  rhs_.free();
+  rowrange_.free();
+  rowlower_.free();
+  rowupper_.free();
 
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("End OsiMskSolverInterface::freeCachedRowRim()\n");
@@ -12,6 +12,7 @@
 #define OsiMskSolverInterface_H
 
 #include "OsiSolverInterface.hpp"
+#include "OsiCachedArray.hpp"
 
 typedef void* MSKtask_t;
 typedef void* MSKenv_t;
@@ -742,6 +743,12 @@ private:
   /// The real work of the destructor
   void gutsOfDestructor();
 
+  /// fetch out of date column bounds
+  void cacheColBounds() const;
+
+  /// fetch out of date row bounds
+  void cacheRowBounds() const;
+
   /// free cached column rim vectors
   void freeCachedColRim();
 
@@ -772,31 +779,39 @@ private:
   int hotStartRStatSize_;
   int hotStartMaxIteration_;
 
-  /**@name Cached information derived from the MOSEK model */
+  /**@name Cached information derived from the MOSEK model
+
+     Rim vectors are patched in place or marked out of date entry by entry
+     (see OsiCachedArray) and are closed up when rows or columns are
+     deleted, so changing the model rarely means fetching all of it again.
+     MOSEK keeps bounds, so collower_ and colupper_ are fetched together,
+     as are rowlower_ and rowupper_.  rowsense_, rhs_ and rowrange_ are
+     derived from the row bounds and are out of date together.
+  */
   //@{
-  /// Pointer to objective vector
-  mutable double  *obj_;
+  /// Objective vector
+  mutable OsiCachedArray<double> obj_;
   
-  /// Pointer to dense vector of variable lower bounds
-  mutable double  *collower_;
+  /// Dense vector of variable lower bounds
+  mutable OsiCachedArray<double> collower_;
   
-  /// Pointer to dense vector of variable lower bounds
-  mutable double  *colupper_;
+  /// Dense vector of variable upper bounds
+  mutable OsiCachedArray<double> colupper_;
   
-  /// Pointer to dense vector of row sense indicators
-  mutable char    *rowsense_;
+  /// Dense vector of row sense indicators
+  mutable OsiCachedArray<char> rowsense_;
   
-  /// Pointer to dense vector of row right-hand side values
-  mutable double  *rhs_;
+  /// Dense vector of row right-hand side values
+  mutable OsiCachedArray<double> rhs_;
   
-  /// Pointer to dense vector of slack upper bounds for range constraints (undefined for non-range rows)
-  mutable double  *rowrange_;
+  /// Dense vector of slack upper bounds for range constraints (undefined for non-range rows)
+  mutable OsiCachedArray<double> rowrange_;
   
-  /// Pointer to dense vector of row lower bounds
-  mutable double  *rowlower_;
+  /// Dense vector of row lower bounds
+  mutable OsiCachedArray<double> rowlower_;
   
-  /// Pointer to dense vector of row upper bounds
-  mutable double  *rowupper_;
+  /// Dense vector of row upper bounds
+  mutable OsiCachedArray<double> rowupper_;
   
   /// Pointer to primal solution vector
   mutable double  *colsol_;
@@ -23,6 +23,7 @@
 #include "OsiColCut.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "OsiRowCut.hpp"
+#include "OsiSolverStatistics.hpp"
 #include "CoinWarmStartBasis.hpp"
 #include "CoinMessage.hpp"
 
@@ -74,6 +75,8 @@ void reporterror(const char *fname, int iline, int ierr)
 
 void
 OsiXprSolverInterface::initialSolve() {
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::initialSolveEvent);
 
   freeSolution();
 
@@ -96,6 +99,7 @@ OsiXprSolverInterface::initialSolve() {
 
 void
 OsiXprSolverInterface::resolve() {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::resolveEvent);
 
    freeSolution();
 
@@ -594,167 +598,155 @@ OsiXprSolverInterface::getNumElements() const
 const double *
 OsiXprSolverInterface::getColLower() const
 {
-    if ( collower_ == NULL ) {
-	if ( isDataLoaded() ) {
-	    int	    ncols = getNumCols();
-	    
-	    if ( ncols > 0 ) {
-	       collower_ = new double[ncols];
-	       XPRS_CHECKED( XPRSgetlb, (prob_,collower_, 0, ncols - 1) );
-	    }
-	}
+    if ( !collower_.isCached() )
+	collower_.allocate(getNumCols());
+    if ( collower_.isDirty() ) {
+	int first = collower_.dirtyStart();
+
+	XPRS_CHECKED( XPRSgetlb, (prob_,collower_.array() + first, first, collower_.dirtyEnd() - 1) );
+	collower_.markClean();
     }
     
-    return collower_;
+    return collower_.array();
 }
 
 //-----------------------------------------------------------------------------
 const double *
 OsiXprSolverInterface::getColUpper() const
 {
-   if ( colupper_ == NULL ) {
-      if ( isDataLoaded() ) {
-	 int	 ncols = getNumCols();	 
-	 
-	 if ( ncols > 0 ) {
-	    colupper_ = new double[ncols];
-	    XPRS_CHECKED( XPRSgetub, (prob_,colupper_, 0, ncols - 1) );
-	 }
-      }
+   if ( !colupper_.isCached() )
+      colupper_.allocate(getNumCols());
+   if ( colupper_.isDirty() ) {
+      int first = colupper_.dirtyStart();
+
+      XPRS_CHECKED( XPRSgetub, (prob_,colupper_.array() + first, first, colupper_.dirtyEnd() - 1) );
+      colupper_.markClean();
    }
 
-   return colupper_;
+   return colupper_.array();
 }
 //-----------------------------------------------------------------------------
 const char *
 OsiXprSolverInterface::getRowSense() const
 {
-    if ( rowsense_ == NULL ) {
-	if ( isDataLoaded() ) {
-	    int nrows = getNumRows();
+    if ( !rowsense_.isCached() )
+	rowsense_.allocate(getNumRows());
+    if ( rowsense_.isDirty() ) {
+	int first = rowsense_.dirtyStart();
 
-	    if ( nrows > 0 ) {
-	       rowsense_ = new char[nrows];
-	       XPRS_CHECKED( XPRSgetrowtype, (prob_,rowsense_, 0, nrows - 1) );
-	    }
-	}
+	XPRS_CHECKED( XPRSgetrowtype, (prob_,rowsense_.array() + first, first, rowsense_.dirtyEnd() - 1) );
+	rowsense_.markClean();
     }
 
-   return rowsense_;
+   return rowsense_.array();
 }
 //-----------------------------------------------------------------------------
 const double *
 OsiXprSolverInterface::getRightHandSide() const
 {
-   if ( rhs_ == NULL ) {
-      if ( isDataLoaded() ) {
-	 int	 nrows = getNumRows();	
-
-	 if ( nrows > 0 ) {
-	    rhs_ = new double[nrows];
-	    XPRS_CHECKED( XPRSgetrhs, (prob_,rhs_, 0, nrows - 1) );
-
-	    // Make sure free rows have rhs of zero
-	    const char * rs = getRowSense();
-	    int nr = getNumRows();
-	    int i;
-	    for ( i = 0;  i < nr;	i++ ) {
-	       if ( rs[i] == 'N' ) rhs_[i]=0.0;
-	    }
-	 }
+   if ( !rhs_.isCached() )
+      rhs_.allocate(getNumRows());
+   if ( rhs_.isDirty() ) {
+      int first = rhs_.dirtyStart();
+      int last = rhs_.dirtyEnd();
+      double * rhs = rhs_.array();
+
+      XPRS_CHECKED( XPRSgetrhs, (prob_,rhs + first, first, last - 1) );
+
+      // Make sure free rows have rhs of zero
+      const char * rs = getRowSense();
+      int i;
+      for ( i = first;  i < last;	i++ ) {
+	 if ( rs[i] == 'N' ) rhs[i]=0.0;
       }
+      rhs_.markClean();
    }
 
-   return rhs_;
+   return rhs_.array();
 }
 //-----------------------------------------------------------------------------
 const double *
 OsiXprSolverInterface::getRowRange() const
 {
-   if ( rowrange_ == NULL ) {
-      if ( isDataLoaded() ) {
-	 int	 nrows = getNumRows();
-
-	 if ( nrows > 0 ) {
-	    rowrange_ = new double[nrows];
-	    XPRS_CHECKED( XPRSgetrhsrange, (prob_,rowrange_, 0, nrows - 1) );
-
-	    // Make sure non-R rows have range of 0.0
-	    // XPRESS seems to set N and L rows to a range of Infinity
-	    const char * rs = getRowSense();
-	    int nr = getNumRows();
-	    int i;
-	    for ( i = 0;  i < nr;	i++ ) {
-	       if ( rs[i] != 'R' ) rowrange_[i] = 0.0;
-	    }
-	 }
+   if ( !rowrange_.isCached() )
+      rowrange_.allocate(getNumRows());
+   if ( rowrange_.isDirty() ) {
+      int first = rowrange_.dirtyStart();
+      int last = rowrange_.dirtyEnd();
+      double * range = rowrange_.array();
+
+      XPRS_CHECKED( XPRSgetrhsrange, (prob_,range + first, first, last - 1) );
+
+      // Make sure non-R rows have range of 0.0
+      // XPRESS seems to set N and L rows to a range of Infinity
+      const char * rs = getRowSense();
+      int i;
+      for ( i = first;  i < last;	i++ ) {
+	 if ( rs[i] != 'R' ) range[i] = 0.0;
       }
+      rowrange_.markClean();
    }
 
-   return rowrange_;
+   return rowrange_.array();
 }
 //-----------------------------------------------------------------------------
 const double *
 OsiXprSolverInterface::getRowLower() const
 {
-   if ( rowlower_ == NULL ) {
-      int     nrows = getNumRows();
+   if ( !rowlower_.isCached() )
+      rowlower_.allocate(getNumRows());
+   if ( rowlower_.isDirty() ) {
       const   char    *rowsense = getRowSense();
       const   double  *rhs	= getRightHandSide();
       const   double  *rowrange = getRowRange();
+      double  *bound = rowlower_.array();
 
-      if ( nrows > 0 ) {
-	 rowlower_ = new double[nrows];
-
-	 double dum1;
-	 for ( int i = 0;  i < nrows;  i++ ) {
-	   convertSenseToBound(rowsense[i], rhs[i], rowrange[i],
-			       rowlower_[i], dum1);
-	 }
+      double dum1;
+      for ( int i = rowlower_.dirtyStart();  i < rowlower_.dirtyEnd();  i++ ) {
+	convertSenseToBound(rowsense[i], rhs[i], rowrange[i],
+			    bound[i], dum1);
       }
+      rowlower_.markClean();
    }
 
-   return rowlower_;
+   return rowlower_.array();
 }
 //-----------------------------------------------------------------------------
 const double *
 OsiXprSolverInterface::getRowUpper() const
 {
-   if ( rowupper_ == NULL ) {
-      int     nrows = getNumRows();
+   if ( !rowupper_.isCached() )
+      rowupper_.allocate(getNumRows());
+   if ( rowupper_.isDirty() ) {
       const   char    *rowsense = getRowSense();
       const   double  *rhs	= getRightHandSide();
       const   double  *rowrange = getRowRange();
+      double  *bound = rowupper_.array();
 
-      if ( nrows > 0 ) {
-	 rowupper_ = new double[nrows];
-
-	 double dum1;
-	 for ( int i = 0;  i < nrows;  i++ ) {
-	   convertSenseToBound(rowsense[i], rhs[i], rowrange[i],
-			       dum1, rowupper_[i]);
-	 }
+      double dum1;
+      for ( int i = rowupper_.dirtyStart();  i < rowupper_.dirtyEnd();  i++ ) {
+	convertSenseToBound(rowsense[i], rhs[i], rowrange[i],
+			    dum1, bound[i]);
       }
+      rowupper_.markClean();
    }
 
-   return rowupper_;
+   return rowupper_.array();
 }
 //-----------------------------------------------------------------------------
 const double *
 OsiXprSolverInterface::getObjCoefficients() const
 {
-   if ( objcoeffs_ == NULL ) {
-      if ( isDataLoaded() ) {
-	 int	 ncols = getNumCols();
+   if ( !objcoeffs_.isCached() )
+      objcoeffs_.allocate(getNumCols());
+   if ( objcoeffs_.isDirty() ) {
+      int first = objcoeffs_.dirtyStart();
 
-	 if ( ncols > 0 ) {
-	    objcoeffs_ = new double[ncols];
-	    XPRS_CHECKED( XPRSgetobj, (prob_,objcoeffs_, 0, ncols - 1) );
-	 }
-      }
+      XPRS_CHECKED( XPRSgetobj, (prob_,objcoeffs_.array() + first, first, objcoeffs_.dirtyEnd() - 1) );
+      objcoeffs_.markClean();
    }
 
-   return objcoeffs_;
+   return objcoeffs_.array();
 }
 //-----------------------------------------------------------------------------
 double
@@ -828,6 +820,7 @@ OsiXprSolverInterface::isFreeBinary( int colNumber ) const
 const CoinPackedMatrix *
 OsiXprSolverInterface::getMatrixByRow() const
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
   if ( matrixByRow_ == NULL ) {
     if ( isDataLoaded() ) {
 
@@ -864,6 +857,7 @@ OsiXprSolverInterface::getMatrixByRow() const
 const CoinPackedMatrix *
 OsiXprSolverInterface::getMatrixByCol() const
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
    if ( matrixByCol_ == NULL ) {
       matrixByCol_ = new CoinPackedMatrix(*getMatrixByRow());
       matrixByCol_->reverseOrdering();
@@ -888,6 +882,8 @@ OsiXprSolverInterface::getInfinity() const
 const double *
 OsiXprSolverInterface::getColSolution() const
 {
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 	if ( colsol_ == NULL ) {
 		if ( isDataLoaded() ) {
 			int status;
@@ -923,6 +919,8 @@ OsiXprSolverInterface::getColSolution() const
 const double *
 OsiXprSolverInterface::getRowPrice() const
 {
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 	if ( rowprice_ == NULL ) {
 		if ( isDataLoaded() ) {
 			int nr = getNumRows();
@@ -948,6 +946,8 @@ OsiXprSolverInterface::getRowPrice() const
 
 const double * OsiXprSolverInterface::getReducedCost() const
 {
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
   if ( colprice_ == NULL ) {
     if ( isDataLoaded() ) {
     	int status;
@@ -969,6 +969,8 @@ const double * OsiXprSolverInterface::getReducedCost() const
 
 const double * OsiXprSolverInterface::getRowActivity() const
 {
+  OsiSolverStatistics::Timer
+    timer(this,OsiSolverStatistics::getSolutionEvent);
 	if( rowact_ == NULL ) {
 		if ( isDataLoaded() ) {
 			int nrows = getNumRows();
@@ -1185,7 +1187,8 @@ OsiXprSolverInterface::setObjCoeff( int elementIndex, double elementValue )
 {
    if ( isDataLoaded() ) {
        XPRS_CHECKED( XPRSchgobj, (prob_,1, &elementIndex, &elementValue) );
-      freeCachedResults();
+      freeSolution();
+      objcoeffs_.set(elementIndex, elementValue);
    }
 }
 
@@ -1205,12 +1208,12 @@ OsiXprSolverInterface::setColLower( int elementIndex, double elementValue )
 	char elementType = 'I';
 	
 	XPRS_CHECKED( XPRSchgcoltype, (prob_,1, &elementIndex, &elementType) );
+	freeVarTypes();
       }
       XPRS_CHECKED( XPRSchgbounds, (prob_,1, &elementIndex, &boundType, &elementValue) );
 
-      freeCachedResults();
-      //    delete [] collower_;
-      //    collower_ = NULL;
+      freeSolution();
+      collower_.set(elementIndex, elementValue);
    }
 }
 
@@ -1231,10 +1234,10 @@ OsiXprSolverInterface::setColUpper( int elementIndex, double elementValue )
 	 char elementType = 'I';  
 	 
 	 XPRS_CHECKED( XPRSchgcoltype, (prob_,1, &elementIndex, &elementType) );
+	 freeVarTypes();
       }
-      freeCachedResults();
-      //    delete [] colupper_;
-      //    colupper_ = NULL;
+      freeSolution();
+      colupper_.set(elementIndex, elementValue);
    } 
 }
 
@@ -1263,10 +1266,11 @@ void OsiXprSolverInterface::setColBounds(const int elementIndex, double lower, d
        char elementType = 'I';	
 	 
        XPRS_CHECKED( XPRSchgcoltype, (prob_,1, &mindex[0], &elementType) );
+       freeVarTypes();
      }
-     freeCachedResults();
-     //	   delete [] colupper_;
-     //	   colupper_ = NULL;
+     freeSolution();
+     collower_.set(elementIndex, lower);
+     colupper_.set(elementIndex, upper);
    }
 }
 
@@ -1346,7 +1350,8 @@ OsiXprSolverInterface::setRowType(int index, char sense, double rightHandSide,
     if (sense == 'R')
     	XPRS_CHECKED( XPRSchgrhsrange, (prob_,1, mindex, rng) );
 
-    freeCachedResults();
+    freeSolution();
+    cacheRowType(index, sense, rightHandSide, range);
   }
 }
 
@@ -1384,7 +1389,8 @@ OsiXprSolverInterface::setContinuous(int index)
       char qctype = 'C';
 
       XPRS_CHECKED( XPRSchgcoltype, (prob_,1, &index, &qctype) );
-      freeCachedResults();
+      freeSolution();
+      freeVarTypes();
     }
   }
 }
@@ -1406,7 +1412,8 @@ OsiXprSolverInterface::setInteger(int index)
       else
 	qctype = 'I';
       XPRS_CHECKED( XPRSchgcoltype, (prob_,1, &index, &qctype) );
-      freeCachedResults();
+      freeSolution();
+      freeVarTypes();
     }
   }
 }
@@ -1425,7 +1432,8 @@ OsiXprSolverInterface::setContinuous(const int* indices, int len)
       CoinFillN(qctype, len, 'C');
       
       XPRS_CHECKED( XPRSchgcoltype, (prob_,len, const_cast<int *>(indices), qctype) );
-      freeCachedResults();
+      freeSolution();
+      freeVarTypes();
       delete[] qctype;
     }
   }
@@ -1452,7 +1460,8 @@ OsiXprSolverInterface::setInteger(const int* indices, int len)
       }
 
       XPRS_CHECKED( XPRSchgcoltype, (prob_,len, const_cast<int *>(indices), qctype) );
-      freeCachedResults();
+      freeSolution();
+      freeVarTypes();
       delete[] qctype;
     }
   }
@@ -1506,7 +1515,9 @@ OsiXprSolverInterface::addCol(const CoinPackedVectorBase& vec,
 			      const double obj)
 {
   if ( isDataLoaded() ) {
-    freeCachedResults();
+    freeSolution();
+    freeCachedMatrix();
+    freeVarTypes();
 
     int mstart = 0;
 
@@ -1516,6 +1527,10 @@ OsiXprSolverInterface::addCol(const CoinPackedVectorBase& vec,
 	    const_cast<double*>(vec.getElements()),
 	    const_cast<double*>(&collb),
 	    const_cast<double*>(&colub)) );
+
+    objcoeffs_.append(1, &obj);
+    collower_.append(1, &collb);
+    colupper_.append(1, &colub);
   }
 }
 //-----------------------------------------------------------------------------
@@ -1534,8 +1549,14 @@ OsiXprSolverInterface::addCols(const int numcols,
 void 
 OsiXprSolverInterface::deleteCols(const int num, const int *columnIndices)
 {
-  freeCachedResults();
+  freeSolution();
+  freeCachedMatrix();
+  freeVarTypes();
   XPRS_CHECKED( XPRSdelcols, (prob_,num, const_cast<int *>(columnIndices)) );
+
+  objcoeffs_.remove(num, columnIndices);
+  collower_.remove(num, columnIndices);
+  colupper_.remove(num, columnIndices);
 }
 //-----------------------------------------------------------------------------
 void 
@@ -1556,7 +1577,8 @@ OsiXprSolverInterface::addRow(const CoinPackedVectorBase& vec,
 			      const char rowsen, const double rowrhs,	
 			      const double rowrng)
 {
-  freeCachedResults();
+  freeSolution();
+  freeCachedMatrix();
 
    int mstart[2] = {0, vec.getNumElements()};
 
@@ -1565,6 +1587,17 @@ OsiXprSolverInterface::addRow(const CoinPackedVectorBase& vec,
 	  const_cast<double *>(&rowrng), mstart,
 	  const_cast<int *>(vec.getIndices()),
 	  const_cast<double *>(vec.getElements())) );
+
+  // as getRightHandSide() and getRowRange() would find them
+  double rhs = ( rowsen == 'N' ) ? 0.0 : rowrhs;
+  double range = ( rowsen == 'R' ) ? rowrng : 0.0;
+  double lower, upper;
+  convertSenseToBound(rowsen, rhs, range, lower, upper);
+  rowsense_.append(1, &rowsen);
+  rhs_.append(1, &rhs);
+  rowrange_.append(1, &range);
+  rowlower_.append(1, &lower);
+  rowupper_.append(1, &upper);
 }
 //-----------------------------------------------------------------------------
 void 
@@ -1591,9 +1624,17 @@ OsiXprSolverInterface::addRows(const int numrows,
 void 
 OsiXprSolverInterface::deleteRows(const int num, const int * rowIndices)
 {
-  freeCachedResults();
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::deleteRowsEvent);
+  freeSolution();
+  freeCachedMatrix();
 
   XPRS_CHECKED( XPRSdelrows, (prob_,num, const_cast<int *>(rowIndices)) );
+
+  rowsense_.remove(num, rowIndices);
+  rhs_.remove(num, rowIndices);
+  rowrange_.remove(num, rowIndices);
+  rowlower_.remove(num, rowIndices);
+  rowupper_.remove(num, rowIndices);
 }
 
 //#############################################################################
@@ -2290,14 +2331,6 @@ OsiSolverInterface(),
 prob_(NULL),
 matrixByRow_(NULL),
 matrixByCol_(NULL),
-colupper_(NULL),
-collower_(NULL),
-rowupper_(NULL),
-rowlower_(NULL),
-rowsense_(NULL),
-rhs_(NULL),
-rowrange_(NULL),
-objcoeffs_(NULL),
 objsense_(1),
 colsol_(NULL),
 rowsol_(NULL),
@@ -2343,14 +2376,6 @@ OsiXprSolverInterface (const OsiXprSolverInterface & source) :
     prob_(NULL),
    matrixByRow_(NULL),
    matrixByCol_(NULL),
-   colupper_(NULL),
-   collower_(NULL),
-   rowupper_(NULL),
-   rowlower_(NULL),
-   rowsense_(NULL),
-   rhs_(NULL),
-   rowrange_(NULL),
-   objcoeffs_(NULL),
    objsense_(source.objsense_),
    colsol_(NULL),
    rowsol_(NULL),
@@ -2443,13 +2468,17 @@ OsiXprSolverInterface::applyColCut( const OsiColCut & cc )
 
     XPRS_CHECKED( XPRSchgbounds, (prob_,nbds, index, btype, value) );
 
+   freeSolution();
+   for ( i = 0;  i < nbds;  i++ ) {
+      if ( btype[i] == 'L' )
+	 collower_.set(index[i], value[i]);
+      else
+	 colupper_.set(index[i], value[i]);
+   }
+
    delete [] index;
    delete [] btype;
    delete [] value;
-
-   freeCachedResults();
-   //  delete [] colupper_;      colupper_ = NULL;
-   //  delete [] collower_;      collower_ = NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -2489,7 +2518,18 @@ OsiXprSolverInterface::applyRowCut( const OsiRowCut & rowCut )
 			const_cast<double *>(row.getElements())); 
    assert( rc == 0 );
    
-   freeCachedResults();
+   freeSolution();
+   freeCachedMatrix();
+
+   if ( sense == 'N' ) rhs = 0.0;
+   if ( sense != 'R' ) r = 0.0;
+   double lower, upper;
+   convertSenseToBound(sense, rhs, r, lower, upper);
+   rowsense_.append(1, &sense);
+   rhs_.append(1, &rhs);
+   rowrange_.append(1, &r);
+   rowlower_.append(1, &lower);
+   rowupper_.append(1, &upper);
 }
 
 //#############################################################################
@@ -2560,16 +2600,16 @@ OsiXprSolverInterface::gutsOfDestructor()
 
    assert(matrixByRow_ == NULL);
    assert(matrixByCol_ == NULL);
-   assert(colupper_    == NULL);
-   assert(collower_    == NULL);
-   assert(rowupper_    == NULL);
-   assert(rowlower_    == NULL);
+   assert(!colupper_.isCached());
+   assert(!collower_.isCached());
+   assert(!rowupper_.isCached());
+   assert(!rowlower_.isCached());
                     
-   assert(rowsense_    == NULL);
-   assert(rhs_         == NULL);
-   assert(rowrange_    == NULL);
+   assert(!rowsense_.isCached());
+   assert(!rhs_.isCached());
+   assert(!rowrange_.isCached());
                     
-   assert(objcoeffs_   == NULL);
+   assert(!objcoeffs_.isCached());
                     
    assert(colsol_      == NULL);
    assert(rowsol_      == NULL);
@@ -2595,28 +2635,69 @@ OsiXprSolverInterface::freeSolution()
 //-------------------------------------------------------------------
 
 void
-OsiXprSolverInterface::freeCachedResults()
+OsiXprSolverInterface::freeCachedMatrix()
 {
    delete matrixByRow_;     matrixByRow_ = NULL;
    delete matrixByCol_;     matrixByCol_ = NULL;
-   delete [] colupper_;     colupper_    = NULL;
-   delete [] collower_;	    collower_    = NULL;
-   delete [] rowupper_;	    rowupper_    = NULL;
-   delete [] rowlower_;	    rowlower_    = NULL;
-
-   delete [] rowsense_;	    rowsense_    = NULL;
-   delete [] rhs_;	    rhs_         = NULL;
-   delete [] rowrange_;	    rowrange_    = NULL;
-
-   delete [] objcoeffs_;    objcoeffs_   = NULL;
+}
 
-   freeSolution();
+//-------------------------------------------------------------------
 
+void
+OsiXprSolverInterface::freeVarTypes()
+{
    delete [] ivarind_;      ivarind_     = NULL;
    delete [] ivartype_;     ivartype_    = NULL;
    delete [] vartype_;      vartype_     = NULL;
 }
 
+//-------------------------------------------------------------------
+
+void
+OsiXprSolverInterface::freeCachedResults()
+{
+   freeCachedMatrix();
+   colupper_.free();
+   collower_.free();
+   rowupper_.free();
+   rowlower_.free();
+
+   rowsense_.free();
+   rhs_.free();
+   rowrange_.free();
+
+   objcoeffs_.free();
+
+   freeSolution();
+   freeVarTypes();
+}
+
+//-------------------------------------------------------------------
+void OsiXprSolverInterface::cacheRowType( int i, char sense, double rhs,
+					  double range )
+{
+  // as getRightHandSide() and getRowRange() would find them
+  if ( sense == 'N' )
+    {
+      rhs = 0.0;
+      range = 0.0;
+    }
+  else if ( sense != 'R' )
+    {
+      range = 0.0;
+    }
+  rowsense_.set( i, sense );
+  rhs_.set( i, rhs );
+  rowrange_.set( i, range );
+  if ( rowlower_.isCached() || rowupper_.isCached() )
+    {
+      double lower, upper;
+      convertSenseToBound( sense, rhs, range, lower, upper );
+      rowlower_.set( i, lower );
+      rowupper_.set( i, upper );
+    }
+}
+
 //-------------------------------------------------------------------
 // Set up lists of integer variables
 //-------------------------------------------------------------------
@@ -9,6 +9,7 @@
 #include <cstdio>
 
 #include "OsiSolverInterface.hpp"
+#include "OsiCachedArray.hpp"
 
 typedef struct xo_prob_struct* XPRSprob;
 
@@ -689,6 +690,15 @@ private:
 	change) */
     void freeCachedResults();
 
+    /// Destroy cached copies of the matrix
+    void freeCachedMatrix();
+
+    /// Destroy cached copies of variable types
+    void freeVarTypes();
+
+    /// Patch cached row data after a row has changed
+    void cacheRowType( int i, char sense, double rhs, double range );
+
     /// Number of integer variables in the problem
     int getNumIntVars() const;
 
@@ -722,7 +732,13 @@ private:
       mutable std::string  xprProbname_;
     //@}
 
-    /**@name Cached copies of XPRESS-MP problem data */
+    /**@name Cached copies of XPRESS-MP problem data
+
+       Rim vectors are patched in place or marked out of date entry by
+       entry (see OsiCachedArray) and are closed up when rows or columns
+       are deleted, so changing the model rarely means fetching all of it
+       again.  The matrices are dropped whenever rows or columns change.
+    */
     //@{
       /** Pointer to row-wise copy of problem matrix coefficients.<br>
           Note that XPRESS keeps the objective row in the 
@@ -732,31 +748,31 @@ private:
       mutable CoinPackedMatrix *matrixByRow_;
       mutable CoinPackedMatrix *matrixByCol_;
 
-      /// Pointer to dense vector of structural variable upper bounds
-      mutable double  *colupper_;
+      /// Dense vector of structural variable upper bounds
+      mutable OsiCachedArray<double> colupper_;
 
-      /// Pointer to dense vector of structural variable lower bounds
-      mutable double  *collower_;
+      /// Dense vector of structural variable lower bounds
+      mutable OsiCachedArray<double> collower_;
 
-      /// Pointer to dense vector of slack variable upper bounds
-      mutable double  *rowupper_;
+      /// Dense vector of slack variable upper bounds
+      mutable OsiCachedArray<double> rowupper_;
 
-      /// Pointer to dense vector of slack variable lower bounds
-      mutable double  *rowlower_;
+      /// Dense vector of slack variable lower bounds
+      mutable OsiCachedArray<double> rowlower_;
 
-      /// Pointer to dense vector of row sense indicators
-      mutable char    *rowsense_;
+      /// Dense vector of row sense indicators
+      mutable OsiCachedArray<char> rowsense_;
 
-      /// Pointer to dense vector of row right-hand side values
-      mutable double  *rhs_;
+      /// Dense vector of row right-hand side values
+      mutable OsiCachedArray<double> rhs_;
 
-      /** Pointer to dense vector of slack upper bounds for range 
+      /** Dense vector of slack upper bounds for range 
           constraints (undefined for non-range rows)
       */
-      mutable double  *rowrange_;
+      mutable OsiCachedArray<double> rowrange_;
 
-      /// Pointer to dense vector of objective coefficients
-      mutable double  *objcoeffs_;
+      /// Dense vector of objective coefficients
+      mutable OsiCachedArray<double> objcoeffs_;
 
       /// Sense of objective (1 for min; -1 for max)
       mutable double  objsense_;
@@ -23,16 +23,14 @@ VOL_dvector::operator=(const VOL_dvector& w) {
       sz = 0;
    } else {
       v = new double[sz = wsz];
-      for (int i = sz - 1; i >= 0; --i)
-      v[i] = w[i];
+      std::copy(w.v, w.v + sz, v);
    }
    return *this;
 }
 /// Usage v=w; where w is a double. It copies w in every entry of v
 VOL_dvector&
 VOL_dvector::operator=(const double w) {
-   for (int i = sz - 1; i >= 0; --i)
-   v[i] = w;
+   std::fill(v, v + sz, w);
    return *this;
 }
 
@@ -62,18 +60,32 @@ VOL_ivector::operator=(const int w) {
 }
 
 //############################################################################
+/*
+  The loops below run once or more per iteration over vectors of the size of
+  the primal or the dual, so they are written over raw arrays with the
+  conditions folded into selects rather than branches, which lets the
+  compiler vectorize them. Sums are split over four accumulators to break the
+  dependency chain of a single running total.
+*/
+
 /// find maximum absolute value of the primal violations
 void
 VOL_primal::find_max_viol(const VOL_dvector& dual_lb, 
 			  const VOL_dvector& dual_ub)
 {
    const int nc = v.size();
-   viol = 0;
+   const double * vv = v.v;
+   const double * lb = dual_lb.v;
+   const double * ub = dual_ub.v;
+   double mx = 0.0;
    for ( int i = 0; i < nc; ++i ) {
-     if ( (v[i] > 0.0 && dual_ub[i] != 0.0) ||
-	  (v[i] < 0.0 && dual_lb[i] != 0.0) )
-       viol = VolMax(viol, VolAbs(v[i]));
+      const double vi = vv[i];
+      const bool counts = (vi > 0.0 && ub[i] != 0.0) ||
+			  (vi < 0.0 && lb[i] != 0.0);
+      const double a = counts ? VolAbs(vi) : 0.0;
+      mx = a > mx ? a : mx;
    }
+   viol = mx;
 }
 
 //############################################################################
@@ -84,27 +96,43 @@ VOL_dual::step(const double target, const double lambda,
 	       const VOL_dvector& dual_lb, const VOL_dvector& dual_ub,
 	       const VOL_dvector& v) {
    const int nc = u.size();
+   double * uu = u.v;
+   const double * vv = v.v;
+   const double * lb = dual_lb.v;
+   const double * ub = dual_ub.v;
    int i;
 
-   double viol = 0.0;
-   for (i = 0; i < nc; ++i) {
-      if (( v[i] > 0.0 && u[i] < dual_ub[i] ) ||
-	  ( v[i] < 0.0 && u[i] > dual_lb[i] )) {
-	 viol += v[i] * v[i];
-      }
+   double viol0 = 0.0, viol1 = 0.0, viol2 = 0.0, viol3 = 0.0;
+   for (i = 0; i + 3 < nc; i += 4) {
+      viol0 += (( vv[i] > 0.0 && uu[i] < ub[i] ) ||
+		( vv[i] < 0.0 && uu[i] > lb[i] )) ? vv[i] * vv[i] : 0.0;
+      viol1 += (( vv[i+1] > 0.0 && uu[i+1] < ub[i+1] ) ||
+		( vv[i+1] < 0.0 && uu[i+1] > lb[i+1] )) ?
+	 vv[i+1] * vv[i+1] : 0.0;
+      viol2 += (( vv[i+2] > 0.0 && uu[i+2] < ub[i+2] ) ||
+		( vv[i+2] < 0.0 && uu[i+2] > lb[i+2] )) ?
+	 vv[i+2] * vv[i+2] : 0.0;
+      viol3 += (( vv[i+3] > 0.0 && uu[i+3] < ub[i+3] ) ||
+		( vv[i+3] < 0.0 && uu[i+3] > lb[i+3] )) ?
+	 vv[i+3] * vv[i+3] : 0.0;
+   }
+   for ( ; i < nc; ++i) {
+      viol0 += (( vv[i] > 0.0 && uu[i] < ub[i] ) ||
+		( vv[i] < 0.0 && uu[i] > lb[i] )) ? vv[i] * vv[i] : 0.0;
    }
+   const double viol = (viol0 + viol1) + (viol2 + viol3);
 
    const double stp = viol == 0.0 ? 0.0 : (target - lcost) / viol * lambda;
 
    for (i = 0; i < nc; ++i) {
-      if (( v[i] > 0.0 && u[i] < dual_ub[i] ) ||
-	  ( v[i] < 0.0 && u[i] > dual_lb[i] )) {
-	 u[i] += stp * v[i];
-	 if (u[i] < dual_lb[i])
-	    u[i] = dual_lb[i];
-	 else if (u[i] > dual_ub[i])
-	    u[i] = dual_ub[i];
-      }
+      const double vi = vv[i];
+      const double ui = uu[i];
+      const bool move = ( vi > 0.0 && ui < ub[i] ) ||
+			( vi < 0.0 && ui > lb[i] );
+      double ni = ui + stp * vi;
+      ni = ni < lb[i] ? lb[i] : ni;
+      ni = ni > ub[i] ? ub[i] : ni;
+      uu[i] = move ? ni : ui;
    }
 }
 
@@ -113,11 +141,20 @@ double
 VOL_dual::ascent(const VOL_dvector& v, const VOL_dvector& last_u) const 
 {
    const int nc = u.size();
+   const double * vv = v.v;
+   const double * uu = u.v;
+   const double * lu = last_u.v;
    int i;
-   double asc = 0.0;
-   for (i = 0; i < nc; ++i)
-      asc += v[i] * (u[i] - last_u[i]);
-   return asc;
+   double asc0 = 0.0, asc1 = 0.0, asc2 = 0.0, asc3 = 0.0;
+   for (i = 0; i + 3 < nc; i += 4) {
+      asc0 += vv[i] * (uu[i] - lu[i]);
+      asc1 += vv[i+1] * (uu[i+1] - lu[i+1]);
+      asc2 += vv[i+2] * (uu[i+2] - lu[i+2]);
+      asc3 += vv[i+3] * (uu[i+3] - lu[i+3]);
+   }
+   for ( ; i < nc; ++i)
+      asc0 += vv[i] * (uu[i] - lu[i]);
+   return (asc0 + asc1) + (asc2 + asc3);
 }
 /** compute xrc. This is (c - u A) * ( xstar - x ). This is just
     miscellaneous information, it is not used in the algorithm. */
@@ -126,10 +163,20 @@ VOL_dual::compute_xrc(const VOL_dvector& xstar, const VOL_dvector& x,
 		      const VOL_dvector& rc)
 {
    const int nc = x.size();
-   xrc = 0;
-   for (int i = 0; i < nc; ++i) {
-      xrc += rc[i] * (xstar[i] - x[i]);
+   const double * r = rc.v;
+   const double * xs = xstar.v;
+   const double * xx = x.v;
+   int i;
+   double xrc0 = 0.0, xrc1 = 0.0, xrc2 = 0.0, xrc3 = 0.0;
+   for (i = 0; i + 3 < nc; i += 4) {
+      xrc0 += r[i] * (xs[i] - xx[i]);
+      xrc1 += r[i+1] * (xs[i+1] - xx[i+1]);
+      xrc2 += r[i+2] * (xs[i+2] - xx[i+2]);
+      xrc3 += r[i+3] * (xs[i+3] - xx[i+3]);
    }
+   for ( ; i < nc; ++i)
+      xrc0 += r[i] * (xs[i] - xx[i]);
+   xrc = (xrc0 + xrc1) + (xrc2 + xrc3);
 }
 
 //############################################################################
@@ -142,18 +189,22 @@ VOL_vh::VOL_vh(const double alpha,
 	       const VOL_dvector& u) : 
    hh(0), norm(0), vh(0), asc(0)
 {
-   int i;
    const int nc = vstar.size();
-   double vv;
+   const double * pv = v.v;
+   const double * pvs = vstar.v;
+   const double * pu = u.v;
+   const double * lb = dual_lb.v;
+   const double * ub = dual_ub.v;
+   const double one_alpha = 1.0 - alpha;
 
-   for (i = 0; i < nc; ++i) {
-      const double vi = v[i];
-      const double vsi = vstar[i];
-      vv = alpha * vi + (1.0 - alpha) * vsi;
-      if (u[i] == 0.0  &&  dual_lb[i] == 0.0  &&  vv <= 0.0)
-	 continue;
-      if (u[i] == 0.0  &&  dual_ub[i] == 0.0  &&  vv >= 0.0)
-	 continue;
+   for (int i = 0; i < nc; ++i) {
+      // entries at a zero bound which the combined direction would push
+      // further out are left out of every product
+      const double vv = alpha * pv[i] + one_alpha * pvs[i];
+      const bool skip = pu[i] == 0.0 &&
+	 ((lb[i] == 0.0 && vv <= 0.0) || (ub[i] == 0.0 && vv >= 0.0));
+      const double vi = skip ? 0.0 : pv[i];
+      const double vsi = skip ? 0.0 : pvs[i];
       asc  += vi * vv;
       vh   += vi * vsi;
       norm += vi * vi;
@@ -170,9 +221,9 @@ VOL_indc::VOL_indc(const VOL_dvector& dual_lb, const VOL_dvector& dual_ub,
 		   const VOL_dual& dual) {
 
    v2 = vu = vabs = asc = 0.0;
-   const VOL_dvector v = primal.v;
-   const VOL_dvector vstar = pstar.v;
-   const VOL_dvector u = dual.u;
+   const VOL_dvector& v = primal.v;
+   const VOL_dvector& vstar = pstar.v;
+   const VOL_dvector& u = dual.u;
    int i;
    const int nc = vstar.size();
 
@@ -201,12 +201,12 @@ public:
 	 printf("bad VOL_dvector sizes\n");
 	 abort();
       }
-      double * p_v = v - 1;
-      const double * p_w = w.v - 1;
-      const double * const p_e = v + sz;
+      // plain indexed loop so that the compiler can vectorize it
+      double * p_v = v;
+      const double * p_w = w.v;
       const double one_gamma = 1.0 - gamma;
-      while ( ++p_v != p_e ){
-	 *p_v = one_gamma * (*p_v) + gamma * (*++p_w);
+      for (int i = 0; i < sz; ++i) {
+	 p_v[i] = one_gamma * p_v[i] + gamma * p_w[i];
       }
    }
 
@@ -8,12 +8,18 @@
 
 #include <cstdlib>
 #include <numeric>
+#include <vector>
 #include <cassert>
 #include <cmath>
 
+#include "CoinUtilsConfig.h"
 #include "CoinHelperFunctions.hpp"
 #include "CoinWarmStartDual.hpp"
 
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+#endif
+
 #include "OsiTestSolverInterface.hpp"
 #include "OsiRowCut.hpp"
 #include "OsiColCut.hpp"
@@ -22,26 +28,6 @@
 //  Private helper methods
 //#######################################################################
 
-void
-OsiTestSolverInterface::updateRowMatrix_() const 
-{
-   if (! rowMatrixCurrent_) {
-      rowMatrix_.reverseOrderedCopyOf(colMatrix_);
-      rowMatrixCurrent_ = true;
-   }
-}
-
-void
-OsiTestSolverInterface::updateColMatrix_() const
-{
-   if (! colMatrixCurrent_) {
-      colMatrix_.reverseOrderedCopyOf(rowMatrix_);
-      colMatrixCurrent_ = true;
-   }
-}
-
-//-----------------------------------------------------------------------------
-
 void
 OsiTestSolverInterface::checkData_() const
 {
@@ -64,16 +50,17 @@ OsiTestSolverInterface::checkData_() const
 //-----------------------------------------------------------------------------
 
 void
-OsiTestSolverInterface::compute_rc_(const double* u, double* rc) const 
+OsiTestSolverInterface::compute_rc_(const double* obj, const double* u,
+				    double* rc) const 
 {
   if (isZeroOneMinusOne_) {
-    rowMatrixOneMinusOne_->timesMajor(u, rc);
+    colMatrixOneMinusOne_->times(u, rc);
   } else {
-    rowMatrix_.transposeTimes(u, rc);
+    matrix_->getByRow().transposeTimes(u, rc);
   }
 
   const int psize = getNumCols();
-  std::transform(rc, rc+psize, objcoeffs_, rc, std::minus<double>());
+  std::transform(rc, rc+psize, obj, rc, std::minus<double>());
   std::transform(rc, rc+psize, rc, std::negate<double>());
 }
 
@@ -101,7 +88,8 @@ OsiTestSolverInterface::test_zero_one_minusone_(const CoinPackedMatrix& m) const
 //-----------------------------------------------------------------------------
 
 OsiTestSolverInterface::OsiVolMatrixOneMinusOne_::
-OsiVolMatrixOneMinusOne_(const CoinPackedMatrix& m) {
+OsiVolMatrixOneMinusOne_(const CoinPackedMatrix& m, const int numberThreads,
+			 const int minBlockSize) {
   const int major = m.getMajorDim();
   const double* elem = m.getElements();
   const int* ind = m.getIndices();
@@ -109,120 +97,234 @@ OsiVolMatrixOneMinusOne_(const CoinPackedMatrix& m) {
   const int* length = m.getVectorLengths();
 
   majorDim_ = major;
-  minorDim_ = m.getMinorDim();
+  workers_ = NULL;
 
-  plusSize_ = 0;
-  minusSize_ = 0;
+  int size = 0;
   int i, j;
   for (i = 0; i < major; ++i) {
     for (j = start[i] + length[i] - 1; j >= start[i]; --j) {
       const double val = elem[j];
-      if (val == 1.0) {
-	++plusSize_;
-      } else if (val == -1.0) {
-	++minusSize_;
+      if (val == 1.0 || val == -1.0) {
+	++size;
       }
     }
   }
-  if (plusSize_ > 0) {
-    plusInd_ = new int[plusSize_];
-  }
-  if (minusSize_ > 0) {
-    minusInd_ = new int[minusSize_];
-  }
-  plusStart_ = new int[major];
-  plusLength_ = new int[major];
-  minusStart_ = new int[major];
-  minusLength_ = new int[major];
+  ind_ = new int[size > 0 ? size : 1];
+  start_ = new int[major + 1];
+  sep_ = new int[major > 0 ? major : 1];
 
-  plusSize_ = 0;
-  minusSize_ = 0;
+  // the +1 entries of each vector go first, then the -1 entries
+  size = 0;
   for (i = 0; i < major; ++i) {
-    plusStart_[i] = plusSize_;
-    minusStart_[i] = minusSize_;
+    start_[i] = size;
     const int last = start[i] + length[i];
     for (j = start[i]; j < last; ++j) {
-      const double val = elem[j];
-      if (val == 1.0) {
-	plusInd_[plusSize_++] = ind[j];
-      } else if (val == -1.0) {
-	minusInd_[minusSize_++] = ind[j];
+      if (elem[j] == 1.0) {
+	ind_[size++] = ind[j];
+      }
+    }
+    sep_[i] = size;
+    for (j = start[i]; j < last; ++j) {
+      if (elem[j] == -1.0) {
+	ind_[size++] = ind[j];
       }
     }
-    plusLength_[i] = plusSize_ - plusStart_[i];
-    minusLength_[i] = minusSize_ - minusStart_[i];
-  }
-  if (plusSize_ == 0) {
-    delete[] plusStart_;    plusStart_  = NULL;
-    delete[] plusLength_;   plusLength_ = NULL;
   }
-  if (minusSize_ == 0) {
-    delete[] minusStart_;    minusStart_  = NULL;
-    delete[] minusLength_;   minusLength_ = NULL;
+  start_[major] = size;
+
+  /*
+    Cut the major vectors into blocks of roughly equal numbers of entries.
+    Blocks are only worth a thread when they hold a fair amount of work, so
+    small matrices get a single block.
+  */
+  numBlocks_ = CoinMin(numberThreads, size / CoinMax(minBlockSize, 1));
+  if (numBlocks_ < 1)
+    numBlocks_ = 1;
+  blockStart_ = new int[numBlocks_ + 1];
+  blockStart_[0] = 0;
+  i = 0;
+  for (int k = 1; k < numBlocks_; ++k) {
+    const int target = static_cast<int>((static_cast<double>(size) * k) /
+					numBlocks_);
+    while (i < major && start_[i] < target)
+      ++i;
+    blockStart_[k] = i;
   }
+  blockStart_[numBlocks_] = major;
 }
 
 //-----------------------------------------------------------------------------
 
 OsiTestSolverInterface::OsiVolMatrixOneMinusOne_::
 ~OsiVolMatrixOneMinusOne_() {
-  if (plusSize_ > 0) {
-    delete[] plusInd_;      plusInd_    = NULL;
-    delete[] plusStart_;    plusStart_  = NULL;
-    delete[] plusLength_;   plusLength_ = NULL;
-  }
-  if (minusSize_ > 0) {
-    delete[] minusInd_;      minusInd_    = NULL;
-    delete[] minusStart_;    minusStart_  = NULL;
-    delete[] minusLength_;   minusLength_ = NULL;
-  }
+  delete[] ind_;
+  delete[] start_;
+  delete[] sep_;
+  delete[] blockStart_;
 }
 
 //-----------------------------------------------------------------------------
 
 void OsiTestSolverInterface::OsiVolMatrixOneMinusOne_::
-timesMajor(const double* x, double* y) const
+timesBlock_(const double* x, double* y, const int first, const int last) const
 {
-  memset(y, 0, minorDim_ * sizeof(double));
-  int i;
+  for (int i = first; i < last; ++i) {
+    const int sep = sep_[i];
+    const int end = start_[i + 1];
+    double plus = 0.0;
+    double minus = 0.0;
+    int j;
+    for (j = start_[i]; j < sep; ++j)
+      plus += x[ind_[j]];
+    for ( ; j < end; ++j)
+      minus += x[ind_[j]];
+    y[i] = plus - minus;
+  }
+}
 
-  if (plusSize_ > 0 && minusSize_ > 0) {
-    for (i = majorDim_ - 1; i >= 0; --i) {
-      const double x_i = x[i];
-      if (x_i != 0.0) {
-	const int* vecInd = plusInd_ + plusStart_[i];
-        int j;
-	for ( j = plusLength_[i] - 1; j >= 0; --j)
-	  y[vecInd[j]] += x_i;
-	vecInd = minusInd_ + minusStart_[i];
-	for ( j = minusLength_[i] - 1; j >= 0; --j)
-	  y[vecInd[j]] -= x_i;
-      }
-    }
-    return;
+#ifdef COINUTILS_PTHREADS
+/*
+  Threads are started once per resolve() and wait between products, as
+  starting them for every product (twice per Volume iteration) would cost
+  as much as the blocks they run. Worker k runs block k+1; the calling
+  thread runs block 0 and any blocks beyond the workers.
+*/
+class OsiTestSolverInterface::OsiVolWorkers_ {
+public:
+  explicit OsiVolWorkers_(int numberWorkers);
+  ~OsiVolWorkers_();
+  void times(const OsiVolMatrixOneMinusOne_& matrix,
+	     const double* x, double* y);
+
+private:
+  struct Worker_ {
+    OsiVolWorkers_ * pool;
+    int index;
+    pthread_t thread;
+  };
+  static void * workerThread_(void* arg);
+  void work_(int index);
+
+  /// Allocated before any thread starts, so entries stay put
+  std::vector<Worker_> workers_;
+  int numberWorkers_;
+  pthread_mutex_t mutex_;
+  pthread_cond_t start_;
+  pthread_cond_t finished_;
+  /// Number of the current product; workers wait for it to change
+  int generation_;
+  /// Workers not yet through the current product
+  int pending_;
+  bool quit_;
+  const OsiVolMatrixOneMinusOne_ * matrix_;
+  const double * x_;
+  double * y_;
+
+  OsiVolWorkers_(const OsiVolWorkers_&);
+  OsiVolWorkers_& operator=(const OsiVolWorkers_&);
+};
+
+OsiTestSolverInterface::OsiVolWorkers_::OsiVolWorkers_(int numberWorkers) :
+  workers_(CoinMax(numberWorkers, 0)),
+  numberWorkers_(0),
+  generation_(0),
+  pending_(0),
+  quit_(false),
+  matrix_(NULL),
+  x_(NULL),
+  y_(NULL)
+{
+  pthread_mutex_init(&mutex_, NULL);
+  pthread_cond_init(&start_, NULL);
+  pthread_cond_init(&finished_, NULL);
+  for (int k = 0; k < numberWorkers; ++k) {
+    workers_[k].pool = this;
+    workers_[k].index = k;
+    if (pthread_create(&workers_[k].thread, NULL, workerThread_,
+		       &workers_[k]))
+      break;  // the calling thread runs the blocks left over
+    numberWorkers_++;
   }
-  if (plusSize_ > 0) {
-    for (i = majorDim_ - 1; i >= 0; --i) {
-      const double x_i = x[i];
-      if (x_i != 0.0) {
-	const int* vecInd = plusInd_ + plusStart_[i];
-	for (int j = plusLength_[i] - 1; j >= 0; --j)
-	  y[vecInd[j]] += x_i;
-      }
-    }
-    return;
+}
+
+OsiTestSolverInterface::OsiVolWorkers_::~OsiVolWorkers_()
+{
+  pthread_mutex_lock(&mutex_);
+  quit_ = true;
+  pthread_cond_broadcast(&start_);
+  pthread_mutex_unlock(&mutex_);
+  for (int k = 0; k < numberWorkers_; ++k)
+    pthread_join(workers_[k].thread, NULL);
+  pthread_cond_destroy(&finished_);
+  pthread_cond_destroy(&start_);
+  pthread_mutex_destroy(&mutex_);
+}
+
+void * OsiTestSolverInterface::OsiVolWorkers_::workerThread_(void* arg)
+{
+  Worker_* worker = static_cast<Worker_*>(arg);
+  worker->pool->work_(worker->index);
+  return NULL;
+}
+
+void OsiTestSolverInterface::OsiVolWorkers_::work_(int index)
+{
+  int seen = 0;
+  pthread_mutex_lock(&mutex_);
+  for (;;) {
+    while (generation_ == seen && !quit_)
+      pthread_cond_wait(&start_, &mutex_);
+    if (quit_)
+      break;
+    seen = generation_;
+    const OsiVolMatrixOneMinusOne_ * matrix = matrix_;
+    const double * x = x_;
+    double * y = y_;
+    pthread_mutex_unlock(&mutex_);
+    // every block writes its own part of y
+    const int block = index + 1;
+    if (block < matrix->numBlocks_)
+      matrix->timesBlock_(x, y, matrix->blockStart_[block],
+			  matrix->blockStart_[block + 1]);
+    pthread_mutex_lock(&mutex_);
+    if (--pending_ == 0)
+      pthread_cond_signal(&finished_);
   }
-  if (minusSize_ > 0) {
-    for (i = majorDim_ - 1; i >= 0; --i) {
-      const double x_i = x[i];
-      if (x_i != 0.0) {
-	const int* vecInd = minusInd_ + minusStart_[i];
-	for (int j = minusLength_[i] - 1; j >= 0; --j)
-	  y[vecInd[j]] -= x_i;
-      }
-    }
+  pthread_mutex_unlock(&mutex_);
+}
+
+void OsiTestSolverInterface::OsiVolWorkers_::
+times(const OsiVolMatrixOneMinusOne_& matrix, const double* x, double* y)
+{
+  pthread_mutex_lock(&mutex_);
+  matrix_ = &matrix;
+  x_ = x;
+  y_ = y;
+  pending_ = numberWorkers_;
+  ++generation_;
+  pthread_cond_broadcast(&start_);
+  pthread_mutex_unlock(&mutex_);
+  const int * blockStart = matrix.blockStart_;
+  matrix.timesBlock_(x, y, blockStart[0], blockStart[1]);
+  for (int k = numberWorkers_ + 1; k < matrix.numBlocks_; ++k)
+    matrix.timesBlock_(x, y, blockStart[k], blockStart[k + 1]);
+  pthread_mutex_lock(&mutex_);
+  while (pending_)
+    pthread_cond_wait(&finished_, &mutex_);
+  pthread_mutex_unlock(&mutex_);
+}
+#endif
+
+void OsiTestSolverInterface::OsiVolMatrixOneMinusOne_::
+times(const double* x, double* y) const
+{
+#ifdef COINUTILS_PTHREADS
+  if (workers_ && numBlocks_ > 1) {
+    workers_->times(*this, x, y);
     return;
   }
+#endif
+  timesBlock_(x, y, 0, majorDim_);
 }
 
 //#############################################################################
@@ -230,20 +332,12 @@ timesMajor(const double* x, double* y) const
 void
 OsiTestSolverInterface::gutsOfDestructor_()
 {
-  rowMatrix_.clear();
-  colMatrix_.clear();
-  rowMatrixCurrent_ = true;
-  colMatrixCurrent_ = true;
-
-  delete[] colupper_;   colupper_ = 0;  
-  delete[] collower_;	collower_ = 0;  
-  delete[] continuous_; continuous_ = 0;
-  delete[] rowupper_;	rowupper_ = 0; 
-  delete[] rowlower_;	rowlower_ = 0; 
-  delete[] rowsense_;	rowsense_ = 0; 
-  delete[] rhs_;	rhs_ = 0;      
-  delete[] rowrange_;	rowrange_ = 0; 
-  delete[] objcoeffs_;	objcoeffs_ = 0;
+  // a clone may still share these
+  matrix_.reset(new CoinPackedMatrixPair);
+  colRim_.reset(NULL);
+  rowRim_.reset(NULL);
+  setColRimPointers_();
+  setRowRimPointers_();
 
   delete[] colsol_;	        colsol_ = 0;   
   delete[] rowprice_;	        rowprice_ = 0;
@@ -259,91 +353,190 @@ OsiTestSolverInterface::gutsOfDestructor_()
 
 //#############################################################################
 
+OsiTestSolverInterface::ColRim_::ColRim_(int n) :
+   upper(n ? new double[n] : 0),
+   lower(n ? new double[n] : 0),
+   continuous(n ? new bool[n] : 0),
+   obj(n ? new double[n] : 0),
+   capacity(n)
+{
+}
+
+OsiTestSolverInterface::ColRim_::ColRim_(const ColRim_& rim) :
+   upper(CoinCopyOfArray(rim.upper, rim.capacity)),
+   lower(CoinCopyOfArray(rim.lower, rim.capacity)),
+   continuous(CoinCopyOfArray(rim.continuous, rim.capacity)),
+   obj(CoinCopyOfArray(rim.obj, rim.capacity)),
+   capacity(rim.capacity)
+{
+}
+
+OsiTestSolverInterface::ColRim_::~ColRim_()
+{
+   delete[] upper;
+   delete[] lower;
+   delete[] continuous;
+   delete[] obj;
+}
+
+//-----------------------------------------------------------------------------
+
+OsiTestSolverInterface::RowRim_::RowRim_(int n) :
+   upper(n ? new double[n] : 0),
+   lower(n ? new double[n] : 0),
+   sense(n ? new char[n] : 0),
+   rhs(n ? new double[n] : 0),
+   range(n ? new double[n] : 0),
+   capacity(n)
+{
+}
+
+OsiTestSolverInterface::RowRim_::RowRim_(const RowRim_& rim) :
+   upper(CoinCopyOfArray(rim.upper, rim.capacity)),
+   lower(CoinCopyOfArray(rim.lower, rim.capacity)),
+   sense(CoinCopyOfArray(rim.sense, rim.capacity)),
+   rhs(CoinCopyOfArray(rim.rhs, rim.capacity)),
+   range(CoinCopyOfArray(rim.range, rim.capacity)),
+   capacity(rim.capacity)
+{
+}
+
+OsiTestSolverInterface::RowRim_::~RowRim_()
+{
+   delete[] upper;
+   delete[] lower;
+   delete[] sense;
+   delete[] rhs;
+   delete[] range;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+OsiTestSolverInterface::setRowRimPointers_()
+{
+   const RowRim_ * rim = rowRim_.get();
+   if (rim) {
+      rowupper_ = rim->upper;
+      rowlower_ = rim->lower;
+      rowsense_ = rim->sense;
+      rhs_      = rim->rhs;
+      rowrange_ = rim->range;
+   } else {
+      rowupper_ = 0;
+      rowlower_ = 0;
+      rowsense_ = 0;
+      rhs_      = 0;
+      rowrange_ = 0;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
 void
+OsiTestSolverInterface::setColRimPointers_()
+{
+   const ColRim_ * rim = colRim_.get();
+   if (rim) {
+      colupper_   = rim->upper;
+      collower_   = rim->lower;
+      continuous_ = rim->continuous;
+      objcoeffs_  = rim->obj;
+   } else {
+      colupper_   = 0;
+      collower_   = 0;
+      continuous_ = 0;
+      objcoeffs_  = 0;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+OsiTestSolverInterface::RowRim_ &
 OsiTestSolverInterface::rowRimAllocator_()
 {
-   rowupper_ = new double[maxNumrows_];
-   rowlower_ = new double[maxNumrows_];
-   rowsense_ = new char[maxNumrows_];
-   rhs_      = new double[maxNumrows_];
-   rowrange_ = new double[maxNumrows_];
+   RowRim_ * rim = new RowRim_(maxNumrows_);
+   rowRim_.reset(rim);
+   setRowRimPointers_();
    rowprice_ = new double[maxNumrows_];
    lhs_      = new double[maxNumrows_];
+   return *rim;
 }
 
 //-----------------------------------------------------------------------------
 
-void
+OsiTestSolverInterface::ColRim_ &
 OsiTestSolverInterface::colRimAllocator_()
 {
-   colupper_  = new double[maxNumcols_];
-   collower_  = new double[maxNumcols_];
-   continuous_ = new bool[maxNumcols_];
-   objcoeffs_ = new double[maxNumcols_];
+   ColRim_ * rim = new ColRim_(maxNumcols_);
+   colRim_.reset(rim);
+   setColRimPointers_();
    colsol_    = new double[maxNumcols_];
    rc_        = new double[maxNumcols_];
+   return *rim;
 }
 
 //-----------------------------------------------------------------------------
 
-void
+OsiTestSolverInterface::RowRim_ &
 OsiTestSolverInterface::rowRimResize_(const int newSize)
 {
    if (newSize > maxNumrows_) {
-      double* rub   = rowupper_;
-      double* rlb   = rowlower_;
-      char*   sense = rowsense_;
-      double* right = rhs_;
-      double* range = rowrange_;
+      // keeps the old rim alive (shared or not) until copied
+      const OsiShared<RowRim_> old = rowRim_;
+      const double* rub   = rowupper_;
+      const double* rlb   = rowlower_;
+      const char*   sense = rowsense_;
+      const double* right = rhs_;
+      const double* range = rowrange_;
       double* dual  = rowprice_;
       double* left  = lhs_;
       maxNumrows_ = CoinMax(1000, (newSize * 5) / 4);
-      rowRimAllocator_();
+      RowRim_ & rim = rowRimAllocator_();
       const int rownum = getNumRows();
-      CoinDisjointCopyN(rub  , rownum, rowupper_);
-      CoinDisjointCopyN(rlb  , rownum, rowlower_);
-      CoinDisjointCopyN(sense, rownum, rowsense_);
-      CoinDisjointCopyN(right, rownum, rhs_);
-      CoinDisjointCopyN(range, rownum, rowrange_);
+      CoinDisjointCopyN(rub  , rownum, rim.upper);
+      CoinDisjointCopyN(rlb  , rownum, rim.lower);
+      CoinDisjointCopyN(sense, rownum, rim.sense);
+      CoinDisjointCopyN(right, rownum, rim.rhs);
+      CoinDisjointCopyN(range, rownum, rim.range);
       CoinDisjointCopyN(dual , rownum, rowprice_);
       CoinDisjointCopyN(left , rownum, lhs_);
-      delete[] rub;
-      delete[] rlb;
-      delete[] sense;
-      delete[] right;
-      delete[] range;
       delete[] dual;
       delete[] left;
+      return rim;
+   } else {
+      return mutableRowRim_();
    }
 }
 
 //-----------------------------------------------------------------------------
 
-void
+OsiTestSolverInterface::ColRim_ &
 OsiTestSolverInterface::colRimResize_(const int newSize)
 {
    if (newSize > maxNumcols_) {
-      double* cub = colupper_;
-      double* clb = collower_;
-      bool* cont  = continuous_;
-      double* obj = objcoeffs_;
+      // keeps the old rim alive (shared or not) until copied
+      const OsiShared<ColRim_> old = colRim_;
+      const double* cub = colupper_;
+      const double* clb = collower_;
+      const bool* cont  = continuous_;
+      const double* obj = objcoeffs_;
       double* sol = colsol_;
       double* rc  = rc_;
       maxNumcols_ = CoinMax(1000, (newSize * 5) / 4);
-      colRimAllocator_();
+      ColRim_ & rim = colRimAllocator_();
       const int colnum = getNumCols();
-      CoinDisjointCopyN(cub , colnum, colupper_);
-      CoinDisjointCopyN(clb , colnum, collower_);
-      CoinDisjointCopyN(cont, colnum, continuous_);
-      CoinDisjointCopyN(obj , colnum, objcoeffs_);
+      CoinDisjointCopyN(cub , colnum, rim.upper);
+      CoinDisjointCopyN(clb , colnum, rim.lower);
+      CoinDisjointCopyN(cont, colnum, rim.continuous);
+      CoinDisjointCopyN(obj , colnum, rim.obj);
       CoinDisjointCopyN(sol , colnum, colsol_);
       CoinDisjointCopyN(rc  , colnum, rc_);
-      delete[] cub;
-      delete[] clb;
-      delete[] cont;
-      delete[] obj;
       delete[] sol;
       delete[] rc;
+      return rim;
+   } else {
+      return mutableColRim_();
    }
 }
 
@@ -352,9 +545,10 @@ OsiTestSolverInterface::colRimResize_(const int newSize)
 void
 OsiTestSolverInterface::convertBoundsToSenses_()
 {
+   RowRim_ & rim = mutableRowRim_();
    for (int i = getNumRows() - 1; i >= 0; --i ) {
-      convertBoundToSense(rowlower_[i], rowupper_[i],
-			  rowsense_[i], rhs_[i], rowrange_[i]);
+      convertBoundToSense(rim.lower[i], rim.upper[i],
+			  rim.sense[i], rim.rhs[i], rim.range[i]);
    }
 }
 
@@ -363,9 +557,10 @@ OsiTestSolverInterface::convertBoundsToSenses_()
 void
 OsiTestSolverInterface::convertSensesToBounds_()
 {
+   RowRim_ & rim = mutableRowRim_();
    for (int i = getNumRows() - 1; i >= 0; --i) {
-      convertSenseToBound(rowsense_[i], rhs_[i], rowrange_[i],
-			  rowlower_[i], rowupper_[i]);
+      convertSenseToBound(rim.sense[i], rim.rhs[i], rim.range[i],
+			  rim.lower[i], rim.upper[i]);
    }
 }
 
@@ -377,7 +572,7 @@ OsiTestSolverInterface::convertSensesToBounds_()
 int
 OsiTestSolverInterface::compute_rc(const VOL_dvector& u, VOL_dvector& rc)
 {
-   compute_rc_(u.v, rc.v);
+   compute_rc_(solveObj_, u.v, rc.v);
    return 0;
 }
 
@@ -402,15 +597,15 @@ OsiTestSolverInterface::solve_subproblem(const VOL_dvector& dual,
 	   std::inner_product(x.v, x.v + psize, rc.v, 0.0) );
 
   if (isZeroOneMinusOne_) {
-    colMatrixOneMinusOne_->timesMajor(x.v, v.v);
+    rowMatrixOneMinusOne_->times(x.v, v.v);
   } else {
-    colMatrix_.times(x.v, v.v);
+    matrix_->getByColumn().times(x.v, v.v);
   }
 
   std::transform(v.v, v.v+dsize, rhs_, v.v, std::minus<double>());
   std::transform(v.v, v.v+dsize, v.v, std::negate<double>());
 
-  pcost = std::inner_product(x.v, x.v + psize, objcoeffs_, 0.0);
+  pcost = std::inner_product(x.v, x.v + psize, solveObj_, 0.0);
 
   return 0;
 }
@@ -422,6 +617,8 @@ OsiTestSolverInterface::solve_subproblem(const VOL_dvector& dual,
 void 
 OsiTestSolverInterface::initialSolve()
 {
+   OsiSolverStatistics::Timer
+     timer(this,OsiSolverStatistics::initialSolveEvent);
    // set every entry to 0.0 in the dual solution
    CoinFillN(rowprice_, getNumRows(), 0.0);
    resolve();
@@ -432,21 +629,27 @@ OsiTestSolverInterface::initialSolve()
 void 
 OsiTestSolverInterface::resolve()
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::resolveEvent);
   int i;
   
   checkData_();
 
   // Only one of these can do any work
-  updateRowMatrix_();
-  updateColMatrix_();
+  matrix_->getByRow();
+  matrix_->getByColumn();
 
   const int dsize = getNumRows();
   const int psize = getNumCols();
 
-  // Negate the objective coefficients if necessary
-  if (objsense_ < 0) {
-    std::transform(objcoeffs_, objcoeffs_+psize, objcoeffs_,
+  // Negate the objective coefficients if necessary. The coefficients may
+  // be shared with clones, so negate a copy.
+  std::vector<double> negatedObj;
+  solveObj_ = objcoeffs_;
+  if (objsense_ < 0 && psize > 0) {
+    negatedObj.resize(psize);
+    std::transform(objcoeffs_, objcoeffs_+psize, negatedObj.begin(),
 		   std::negate<double>());
+    solveObj_ = &negatedObj[0];
   }
 
   // Set the lb/ub on the duals
@@ -481,10 +684,23 @@ OsiTestSolverInterface::resolve()
 #if 0
   isZeroOneMinusOne_ = false;
 #else
-  isZeroOneMinusOne_ = test_zero_one_minusone_(colMatrix_);
+  isZeroOneMinusOne_ = test_zero_one_minusone_(matrix_->getByColumn());
   if (isZeroOneMinusOne_) {
-    colMatrixOneMinusOne_ = new OsiVolMatrixOneMinusOne_(colMatrix_);
-    rowMatrixOneMinusOne_ = new OsiVolMatrixOneMinusOne_(rowMatrix_);
+    colMatrixOneMinusOne_ =
+      new OsiVolMatrixOneMinusOne_(matrix_->getByColumn(), numberThreads_);
+    rowMatrixOneMinusOne_ =
+      new OsiVolMatrixOneMinusOne_(matrix_->getByRow(), numberThreads_);
+  }
+#endif
+#ifdef COINUTILS_PTHREADS
+  // one set of threads for all the products of this solve
+  const int numberBlocks = !isZeroOneMinusOne_ ? 1 :
+    CoinMax(colMatrixOneMinusOne_->numberBlocks(),
+	    rowMatrixOneMinusOne_->numberBlocks());
+  OsiVolWorkers_ workers(numberBlocks - 1);
+  if (numberBlocks > 1) {
+    colMatrixOneMinusOne_->setWorkers(&workers);
+    rowMatrixOneMinusOne_->setWorkers(&workers);
   }
 #endif
 
@@ -497,11 +713,9 @@ OsiTestSolverInterface::resolve()
   // the primal solution
   CoinDisjointCopyN(volprob_.psol.v, psize, colsol_);
 
-  // Reset the objective coefficients if necessary
+  solveObj_ = 0;
   if (objsense_ < 0) {
-    std::transform(objcoeffs_, objcoeffs_ + psize, objcoeffs_,
-		   std::negate<double>());
-    // also, multiply the dual solution by -1
+    // multiply the dual solution by -1
     std::transform(volprob_.dsol.v, volprob_.dsol.v+dsize, rowprice_,
 		   std::negate<double>());
   } else {
@@ -510,13 +724,13 @@ OsiTestSolverInterface::resolve()
   }
 
   // Compute the reduced costs
-  compute_rc_(rowprice_, rc_);
+  compute_rc_(objcoeffs_, rowprice_, rc_);
 
   // Compute the left hand side (row activity levels)
   if (isZeroOneMinusOne_) {
-    colMatrixOneMinusOne_->timesMajor(colsol_, lhs_);
+    rowMatrixOneMinusOne_->times(colsol_, lhs_);
   } else {
-    colMatrix_.times(colsol_, lhs_);
+    matrix_->getByColumn().times(colsol_, lhs_);
   }
 
   if (isZeroOneMinusOne_) {
@@ -524,6 +738,7 @@ OsiTestSolverInterface::resolve()
     colMatrixOneMinusOne_ = NULL;
     delete rowMatrixOneMinusOne_;
     rowMatrixOneMinusOne_ = NULL;
+    isZeroOneMinusOne_ = false;
   }
 }
 
@@ -780,6 +995,7 @@ OsiTestSolverInterface::markHotStart()
 void
 OsiTestSolverInterface::solveFromHotStart()
 {
+   OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::hotStartEvent);
    int itlimOrig = volprob_.parm.maxsgriters;
    getIntParam(OsiMaxNumIterationHotStart, volprob_.parm.maxsgriters);
    CoinDisjointCopyN(rowpriceHotStart_, getNumRows(), rowprice_);
@@ -810,16 +1026,16 @@ OsiTestSolverInterface::isContinuous(int colNumber) const
 
 const CoinPackedMatrix *
 OsiTestSolverInterface::getMatrixByRow() const {
-   updateRowMatrix_();
-   return &rowMatrix_;
+   OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
+   return &matrix_->getByRow();
 }
 
 //-----------------------------------------------------------------------
 
 const CoinPackedMatrix *
 OsiTestSolverInterface::getMatrixByCol() const {
-   updateColMatrix_();
-   return &colMatrix_;
+   OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::getMatrixEvent);
+   return &matrix_->getByColumn();
 }
 
 //#############################################################################
@@ -852,10 +1068,11 @@ void OsiTestSolverInterface::setColSetBounds(const int* indexFirst,
 					    const int* indexLast,
 					    const double* boundList)
 {
+  ColRim_ & rim = mutableColRim_();
   while (indexFirst < indexLast) {
     const int ind = *indexFirst;
-    collower_[ind] = boundList[0];
-    colupper_[ind] = boundList[1];
+    rim.lower[ind] = boundList[0];
+    rim.upper[ind] = boundList[1];
     ++indexFirst;
     boundList += 2;
   }
@@ -874,10 +1091,11 @@ void OsiTestSolverInterface::setRowSetBounds(const int* indexFirst,
     }
   } else {
     // it's better to convert everything at once
+    RowRim_ & rim = mutableRowRim_();
     while (indexFirst < indexLast) {
       const int ind = *indexFirst;
-      rowlower_[ind] = boundList[0];
-      rowupper_[ind] = boundList[1];
+      rim.lower[ind] = boundList[0];
+      rim.upper[ind] = boundList[1];
       ++indexFirst;
       boundList += 2;
     }
@@ -898,11 +1116,12 @@ void OsiTestSolverInterface::setRowSetTypes(const int* indexFirst,
     }
   } else {
     // it's better to convert everything at once
+    RowRim_ & rim = mutableRowRim_();
     while (indexFirst < indexLast) {
       const int ind = *indexFirst++;
-      rowsense_[ind] = *senseList++;
-      rhs_[ind] = *rhsList++;
-      rowrange_[ind] = *rangeList++;
+      rim.sense[ind] = *senseList++;
+      rim.rhs[ind] = *rhsList++;
+      rim.range[ind] = *rangeList++;
     }
     convertSensesToBounds_();
   }
@@ -918,7 +1137,7 @@ OsiTestSolverInterface::setContinuous(int index)
     throw CoinError("Index out of bound.", "setContinuous",
 		   "OsiTestSolverInterface");
   }
-  continuous_[index] = true;
+  mutableColRim_().continuous[index] = true;
 }
 
 //-----------------------------------------------------------------------
@@ -931,7 +1150,7 @@ OsiTestSolverInterface::setInteger(int index)
     throw CoinError("Index out of bound.", "setContinuous",
 		   "OsiTestSolverInterface");
   }
-  continuous_[index] = false;
+  mutableColRim_().continuous[index] = false;
 }
 
 //-----------------------------------------------------------------------
@@ -950,8 +1169,9 @@ OsiTestSolverInterface::setContinuous(const int* indices, int len)
     }
   }
   
+  bool * continuous = mutableColRim_().continuous;
   for (i = len - 1; i >= 0; --i) {
-    continuous_[indices[i]] = true;
+    continuous[indices[i]] = true;
   }
 }
 
@@ -971,8 +1191,9 @@ OsiTestSolverInterface::setInteger(const int* indices, int len)
     }
   }
   
+  bool * continuous = mutableColRim_().continuous;
   for (i = len - 1; i >= 0; --i) {
-    continuous_[indices[i]] = false;
+    continuous[indices[i]] = false;
   }
 }
 
@@ -984,9 +1205,9 @@ OsiTestSolverInterface::setColSolution(const double *colsol)
    CoinDisjointCopyN(colsol, getNumCols(), colsol_);
   // Compute the left hand side (row activity levels)
   if (isZeroOneMinusOne_) {
-    colMatrixOneMinusOne_->timesMajor(colsol_, lhs_);
+    rowMatrixOneMinusOne_->times(colsol_, lhs_);
   } else {
-    colMatrix_.times(colsol_, lhs_);
+    matrix_->getByColumn().times(colsol_, lhs_);
   }
 }
 
@@ -996,7 +1217,7 @@ void
 OsiTestSolverInterface::setRowPrice(const double *rowprice)
 {
    CoinDisjointCopyN(rowprice, getNumRows(), rowprice_);
-   compute_rc_(rowprice_, rc_);
+   compute_rc_(objcoeffs_, rowprice_, rc_);
 }
 
 //#############################################################################
@@ -1009,17 +1230,15 @@ OsiTestSolverInterface::addCol(const CoinPackedVectorBase& vec,
 			      const double obj)
 {
   const int colnum = getNumCols();
-  colRimResize_(colnum + 1);
-  collower_[colnum]   = collb;
-  colupper_[colnum]   = colub;
-  objcoeffs_[colnum]  = obj;
-  continuous_[colnum] = true;
+  ColRim_ & rim = colRimResize_(colnum + 1);
+  rim.lower[colnum]      = collb;
+  rim.upper[colnum]      = colub;
+  rim.obj[colnum]        = obj;
+  rim.continuous[colnum] = true;
   colsol_[colnum]     = fabs(collb)<fabs(colub) ? collb : colub;
   rc_[colnum]         = 0.0;
 
-  updateColMatrix_();
-  colMatrix_.appendCol(vec);
-  rowMatrixCurrent_ = false;
+  mutableMatrix_().appendCol(vec);
 }
 
 //-----------------------------------------------------------------------------
@@ -1032,11 +1251,11 @@ OsiTestSolverInterface::addCols(const int numcols,
 {
   if (numcols > 0) {
     const int colnum = getNumCols();
-    colRimResize_(colnum + numcols);
-    CoinDisjointCopyN(collb, numcols, collower_ + colnum);
-    CoinDisjointCopyN(colub, numcols, colupper_ + colnum);
-    CoinDisjointCopyN(obj, numcols, objcoeffs_ + colnum);
-    CoinFillN(continuous_ + colnum, numcols, true);
+    ColRim_ & rim = colRimResize_(colnum + numcols);
+    CoinDisjointCopyN(collb, numcols, rim.lower + colnum);
+    CoinDisjointCopyN(colub, numcols, rim.upper + colnum);
+    CoinDisjointCopyN(obj, numcols, rim.obj + colnum);
+    CoinFillN(rim.continuous + colnum, numcols, true);
     int c;
     for ( c=0; c<numcols; c++ ) {
       if ( fabs(collb[c]) < fabs(colub[c]) ) {
@@ -1049,9 +1268,7 @@ OsiTestSolverInterface::addCols(const int numcols,
     //CoinFillN(colsol_     + colnum, numcols, 0.0);
     CoinFillN(rc_         + colnum, numcols, 0.0);
 
-    updateColMatrix_();
-    colMatrix_.appendCols(numcols, cols);
-    rowMatrixCurrent_ = false;
+    mutableMatrix_().appendCols(numcols, cols);
   }
 }
 
@@ -1068,22 +1285,21 @@ OsiTestSolverInterface::deleteCols(const int num, const int * columnIndices)
       static_cast<int>(std::unique(delPos, delPos + num) - delPos);
 
     const int colnum = getNumCols();
-    CoinDeleteEntriesFromArray(collower_, collower_ + colnum,
+    ColRim_ & rim = mutableColRim_();
+    CoinDeleteEntriesFromArray(rim.lower, rim.lower + colnum,
 			       delPos, delPos + delNum);
-    CoinDeleteEntriesFromArray(colupper_, colupper_ + colnum,
+    CoinDeleteEntriesFromArray(rim.upper, rim.upper + colnum,
 			       delPos, delPos + delNum);
-    CoinDeleteEntriesFromArray(objcoeffs_, objcoeffs_ + colnum,
+    CoinDeleteEntriesFromArray(rim.obj, rim.obj + colnum,
 			       delPos, delPos + delNum);
-    CoinDeleteEntriesFromArray(continuous_, continuous_ + colnum,
+    CoinDeleteEntriesFromArray(rim.continuous, rim.continuous + colnum,
 			       delPos, delPos + delNum);
     CoinDeleteEntriesFromArray(colsol_, colsol_ + colnum,
 			       delPos, delPos + delNum);
     CoinDeleteEntriesFromArray(rc_, rc_ + colnum,
 			       delPos, delPos + delNum);
 
-    updateColMatrix_();
-    colMatrix_.deleteCols(delNum, delPos);
-    rowMatrixCurrent_ = false;
+    mutableMatrix_().deleteCols(delNum, delPos);
   }
 }
 
@@ -1095,17 +1311,15 @@ OsiTestSolverInterface::addRow(const CoinPackedVectorBase& vec,
 			      const double rowlb, const double rowub)
 {
   const int rownum = getNumRows();
-  rowRimResize_(rownum + 1);
-  rowlower_[rownum] = rowlb;
-  rowupper_[rownum] = rowub;
+  RowRim_ & rim = rowRimResize_(rownum + 1);
+  rim.lower[rownum] = rowlb;
+  rim.upper[rownum] = rowub;
   convertBoundToSense(rowlb, rowub,
-		      rowsense_[rownum], rhs_[rownum], rowrange_[rownum]);
+		      rim.sense[rownum], rim.rhs[rownum], rim.range[rownum]);
   rowprice_[rownum] = 0.0;
   lhs_[rownum] = 0.0;
 
-  updateRowMatrix_();
-  rowMatrix_.appendRow(vec);
-  colMatrixCurrent_ = false;
+  mutableMatrix_().appendRow(vec);
 }
 
 //-----------------------------------------------------------------------------
@@ -1116,18 +1330,16 @@ OsiTestSolverInterface::addRow(const CoinPackedVectorBase& vec,
 			      const double rowrng)
 {
   const int rownum = getNumRows();
-  rowRimResize_(rownum + 1);
-  rowsense_[rownum] = rowsen;
-  rhs_[rownum] = rowrhs;
-  rowrange_[rownum] = rowrng;
+  RowRim_ & rim = rowRimResize_(rownum + 1);
+  rim.sense[rownum] = rowsen;
+  rim.rhs[rownum] = rowrhs;
+  rim.range[rownum] = rowrng;
   convertSenseToBound(rowsen, rowrhs, rowrng,
-		      rowlower_[rownum], rowupper_[rownum]);
+		      rim.lower[rownum], rim.upper[rownum]);
   rowprice_[rownum] = 0.0;
   lhs_[rownum] = 0.0;
 
-  updateRowMatrix_();
-  rowMatrix_.appendRow(vec);
-  colMatrixCurrent_ = false;
+  mutableMatrix_().appendRow(vec);
 }
 
 //-----------------------------------------------------------------------------
@@ -1137,21 +1349,20 @@ OsiTestSolverInterface::addRows(const int numrows,
 			       const CoinPackedVectorBase * const * rows,
 			       const double* rowlb, const double* rowub)
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
   if (numrows > 0) {
     const int rownum = getNumRows();
-    rowRimResize_(rownum + numrows);
-    CoinDisjointCopyN(rowlb, numrows, rowlower_ + rownum);
-    CoinDisjointCopyN(rowub, numrows, rowupper_ + rownum);
+    RowRim_ & rim = rowRimResize_(rownum + numrows);
+    CoinDisjointCopyN(rowlb, numrows, rim.lower + rownum);
+    CoinDisjointCopyN(rowub, numrows, rim.upper + rownum);
     for (int i = rownum + numrows - 1; i >= rownum; --i) {
-      convertBoundToSense(rowlower_[i], rowupper_[i],
-			  rowsense_[i], rhs_[i], rowrange_[i]);
+      convertBoundToSense(rim.lower[i], rim.upper[i],
+			  rim.sense[i], rim.rhs[i], rim.range[i]);
     }
     CoinFillN(rowprice_ + rownum, numrows, 0.0);
     CoinFillN(lhs_      + rownum, numrows, 0.0);
 
-    updateRowMatrix_();
-    rowMatrix_.appendRows(numrows, rows);
-    colMatrixCurrent_ = false;
+    mutableMatrix_().appendRows(numrows, rows);
   }
 }
 
@@ -1163,22 +1374,21 @@ OsiTestSolverInterface::addRows(const int numrows,
 			       const char* rowsen, const double* rowrhs,   
 			       const double* rowrng)
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::addRowsEvent);
   if (numrows > 0) {
     const int rownum = getNumRows();
-    rowRimResize_(rownum + numrows);
-    CoinDisjointCopyN(rowsen, numrows, rowsense_ + rownum);
-    CoinDisjointCopyN(rowrhs, numrows, rhs_ + rownum);
-    CoinDisjointCopyN(rowrng, numrows, rowrange_ + rownum);
+    RowRim_ & rim = rowRimResize_(rownum + numrows);
+    CoinDisjointCopyN(rowsen, numrows, rim.sense + rownum);
+    CoinDisjointCopyN(rowrhs, numrows, rim.rhs + rownum);
+    CoinDisjointCopyN(rowrng, numrows, rim.range + rownum);
     for (int i = rownum + numrows - 1; i >= rownum; --i) {
-      convertSenseToBound(rowsense_[i], rhs_[i], rowrange_[i],
-			  rowlower_[i], rowupper_[i]);
+      convertSenseToBound(rim.sense[i], rim.rhs[i], rim.range[i],
+			  rim.lower[i], rim.upper[i]);
     }
     CoinFillN(rowprice_ + rownum, numrows, 0.0);
     CoinFillN(lhs_      + rownum, numrows, 0.0);
 
-    updateRowMatrix_();
-    rowMatrix_.appendRows(numrows, rows);
-    colMatrixCurrent_ = false;
+    mutableMatrix_().appendRows(numrows, rows);
   }
 }
 
@@ -1187,6 +1397,7 @@ OsiTestSolverInterface::addRows(const int numrows,
 void 
 OsiTestSolverInterface::deleteRows(const int num, const int * rowIndices)
 {
+  OsiSolverStatistics::Timer timer(this,OsiSolverStatistics::deleteRowsEvent);
   if (num > 0) {
     int * delPos = new int[num];
     CoinDisjointCopyN(rowIndices, num, delPos);
@@ -1195,24 +1406,23 @@ OsiTestSolverInterface::deleteRows(const int num, const int * rowIndices)
         static_cast<int>(std::unique(delPos, delPos + num) - delPos);
 
     const int rownum = getNumRows();
-    CoinDeleteEntriesFromArray(rowlower_, rowlower_ + rownum,
+    RowRim_ & rim = mutableRowRim_();
+    CoinDeleteEntriesFromArray(rim.lower, rim.lower + rownum,
 			       delPos, delPos + delNum);
-    CoinDeleteEntriesFromArray(rowupper_, rowupper_ + rownum,
+    CoinDeleteEntriesFromArray(rim.upper, rim.upper + rownum,
 			       delPos, delPos + delNum);
-    CoinDeleteEntriesFromArray(rowsense_, rowsense_ + rownum,
+    CoinDeleteEntriesFromArray(rim.sense, rim.sense + rownum,
 			       delPos, delPos + delNum);
-    CoinDeleteEntriesFromArray(rowrange_, rowrange_ + rownum,
+    CoinDeleteEntriesFromArray(rim.range, rim.range + rownum,
 			       delPos, delPos + delNum);
-    CoinDeleteEntriesFromArray(rhs_, rhs_ + rownum,
+    CoinDeleteEntriesFromArray(rim.rhs, rim.rhs + rownum,
 			       delPos, delPos + delNum);
     CoinDeleteEntriesFromArray(rowprice_, rowprice_ + rownum,
 			       delPos, delPos + delNum);
     CoinDeleteEntriesFromArray(lhs_, lhs_ + rownum,
 			       delPos, delPos + delNum);
 
-    updateRowMatrix_();
-    rowMatrix_.deleteRows(delNum, delPos);
-    colMatrixCurrent_ = false;
+    mutableMatrix_().deleteRows(delNum, delPos);
 
     delete[] delPos;
   }
@@ -1223,11 +1433,11 @@ OsiTestSolverInterface::deleteRows(const int num, const int * rowIndices)
 //#############################################################################
 
 OsiTestSolverInterface::OsiTestSolverInterface () :
-   rowMatrixCurrent_(true),
-   rowMatrix_(),
-   colMatrixCurrent_(true),
-   colMatrix_(),
+   matrix_(new CoinPackedMatrixPair),
+   colRim_(),
+   rowRim_(),
    isZeroOneMinusOne_(false),
+   numberThreads_(1),
 
    colupper_(0),
    collower_(0),
@@ -1239,6 +1449,7 @@ OsiTestSolverInterface::OsiTestSolverInterface () :
    rowrange_(0),
 
    objcoeffs_(0),
+   solveObj_(0),
    objsense_(1.0),
    
    colsol_(0),
@@ -1270,11 +1481,11 @@ OsiTestSolverInterface::clone(bool copyData) const {
 
 OsiTestSolverInterface::OsiTestSolverInterface(const OsiTestSolverInterface& x) :
   OsiSolverInterface(x),
-   rowMatrixCurrent_(true),
-   rowMatrix_(),
-   colMatrixCurrent_(true),
-   colMatrix_(),
+   matrix_(new CoinPackedMatrixPair),
+   colRim_(),
+   rowRim_(),
    isZeroOneMinusOne_(false),
+   numberThreads_(1),
 
    colupper_(0),
    collower_(0),
@@ -1286,6 +1497,7 @@ OsiTestSolverInterface::OsiTestSolverInterface(const OsiTestSolverInterface& x)
    rowrange_(0),
 
    objcoeffs_(0),
+   solveObj_(0),
    objsense_(1.0),
    
    colsol_(0),
@@ -1316,36 +1528,38 @@ OsiTestSolverInterface::operator=(const OsiTestSolverInterface& rhs)
    OsiSolverInterface::operator=(rhs);
    gutsOfDestructor_();
 
-   rowMatrixCurrent_ = rhs.rowMatrixCurrent_;
-   if (rowMatrixCurrent_)
-      rowMatrix_ = rhs.rowMatrix_;
-   colMatrixCurrent_ = rhs.colMatrixCurrent_;
-   if (colMatrixCurrent_)
-      colMatrix_ = rhs.colMatrix_;
+   // Share the problem. Build both orderings first, so that nothing
+   // builds them in the shared matrix later.
+   rhs.matrix_->getByRow();
+   rhs.matrix_->getByColumn();
+   matrix_ = rhs.matrix_;
+   rowRim_ = rhs.rowRim_;
+   colRim_ = rhs.colRim_;
+   setRowRimPointers_();
+   setColRimPointers_();
 
    if (rhs.maxNumrows_) {
       maxNumrows_ = rhs.maxNumrows_;
-      rowRimAllocator_();
+      rowprice_ = new double[maxNumrows_];
+      lhs_      = new double[maxNumrows_];
       const int rownum = getNumRows();
-      CoinDisjointCopyN(rhs.rowupper_, rownum, rowupper_);
-      CoinDisjointCopyN(rhs.rowlower_, rownum, rowlower_);
-      CoinDisjointCopyN(rhs.rowsense_, rownum, rowsense_);
-      CoinDisjointCopyN(rhs.rhs_, rownum, rhs_);
-      CoinDisjointCopyN(rhs.rowrange_, rownum, rowrange_);
       CoinDisjointCopyN(rhs.rowprice_, rownum, rowprice_);
       CoinDisjointCopyN(rhs.lhs_, rownum, lhs_);
    }
    if (rhs.maxNumcols_) {
       maxNumcols_ = rhs.maxNumcols_;
-      colRimAllocator_();
+      colsol_ = new double[maxNumcols_];
+      rc_     = new double[maxNumcols_];
       const int colnum = getNumCols();
-      CoinDisjointCopyN(rhs.colupper_, colnum, colupper_);
-      CoinDisjointCopyN(rhs.collower_, colnum, collower_);
-      CoinDisjointCopyN(rhs.continuous_, colnum, continuous_);
-      CoinDisjointCopyN(rhs.objcoeffs_, colnum, objcoeffs_);
       CoinDisjointCopyN(rhs.colsol_, colnum, colsol_);
       CoinDisjointCopyN(rhs.rc_, colnum, rc_);
    }
+   // Carry the Volume settings (print level, limits) over, but keep our
+   // own dual file name - the volume problem owns that string
+   numberThreads_ = rhs.numberThreads_;
+   char * dualfile = volprob_.parm.temp_dualfile;
+   volprob_.parm = rhs.volprob_.parm;
+   volprob_.parm.temp_dualfile = dualfile;
    volprob_.parm.granularity = 0.0;
    return *this;
 }
@@ -1367,16 +1581,14 @@ OsiTestSolverInterface::applyRowCut(const OsiRowCut& rc)
    const int rownum = getNumRows();
    const double lb = rc.lb();
    const double ub = rc.ub();
-   rowRimResize_(rownum + 1);
+   RowRim_ & rim = rowRimResize_(rownum + 1);
    rowprice_[rownum] = 0.0;
-   rowlower_[rownum] = lb;
-   rowupper_[rownum] = ub;
+   rim.lower[rownum] = lb;
+   rim.upper[rownum] = ub;
    convertBoundToSense(lb, ub,
-		       rowsense_[rownum], rhs_[rownum], rowrange_[rownum]);
+		       rim.sense[rownum], rim.rhs[rownum], rim.range[rownum]);
 
-   updateRowMatrix_();
-   rowMatrix_.appendRow(rc.row());
-   colMatrixCurrent_ = false;
+   mutableMatrix_().appendRow(rc.row());
 }
 
 //-----------------------------------------------------------------------
@@ -1386,16 +1598,17 @@ OsiTestSolverInterface::applyColCut(const OsiColCut& cc)
 {
    int i;
 
+   ColRim_ & rim = mutableColRim_();
    const double* lb_elem = cc.lbs().getElements();
    const int* lb_ind = cc.lbs().getIndices();
    for (i = cc.lbs().getNumElements() - 1; i >= 0; --i) {
-      collower_[lb_ind[i]] = CoinMax(collower_[lb_ind[i]], lb_elem[i]);
+      rim.lower[lb_ind[i]] = CoinMax(rim.lower[lb_ind[i]], lb_elem[i]);
    }
    
    const double* ub_elem = cc.ubs().getElements();
    const int* ub_ind = cc.ubs().getIndices();
    for (i = cc.ubs().getNumElements() - 1; i >= 0; --i) {
-      colupper_[ub_ind[i]] = CoinMin(colupper_[ub_ind[i]], ub_elem[i]);
+      rim.upper[ub_ind[i]] = CoinMin(rim.upper[ub_ind[i]], ub_elem[i]);
    }
 }
 
@@ -12,8 +12,11 @@
 #include "OsiTestSolver.hpp"
 
 #include "CoinPackedMatrix.hpp"
+#include "CoinPackedMatrixPair.hpp"
 
+#include "OsiShared.hpp"
 #include "OsiSolverInterface.hpp"
+#include "OsiSolverStatistics.hpp"
 
 static const double OsiTestInfinity = 1.0e31;
 
@@ -29,24 +32,60 @@ class OsiTestSolverInterface :
    friend void OsiTestSolverInterfaceUnitTest(const std::string & mpsDir, const std::string & netlibDir);
 
 private:
+  struct ColRim_;
+  struct RowRim_;
+  /* Threads running blocks of 0/1/-1 matrix products (only defined if
+     CoinUtils was built with thread support) */
+  class OsiVolWorkers_;
+
+  /* A 0/1/-1 matrix stored without its elements. times() computes y = M x
+     with y indexed by the major dimension, one dot product per major
+     vector, so the major vectors can be processed in independent blocks;
+     given workers (see setWorkers()), the blocks run on their threads. The
+     column ordered copy gives the reduced costs and the row ordered copy
+     the row activities.
+
+     Each dot product sums the +1 entries and the -1 entries separately
+     and then subtracts, which is a different order of summation from
+     CoinPackedMatrix::times(), so the results can differ from it in the
+     last bits. Each y[i] is summed by one thread, in the same order
+     whatever the blocks, so the results do not depend on the number of
+     threads. */
   class OsiVolMatrixOneMinusOne_ {
+    friend class OsiVolWorkers_;
     int majorDim_;
-    int minorDim_;
 
-    int plusSize_;
-    int * plusInd_;
-    int * plusStart_;
-    int * plusLength_;
+    /* Minor indices of the +1 entries of vector i are in
+       ind_[start_[i]..sep_[i]-1], those of the -1 entries in
+       ind_[sep_[i]..start_[i+1]-1]. */
+    int * ind_;
+    int * start_;
+    int * sep_;
 
-    int minusSize_;
-    int * minusInd_;
-    int * minusStart_;
-    int * minusLength_;
+    /// Number of blocks and the first major vector of each (plus end)
+    int numBlocks_;
+    int * blockStart_;
+    /// Threads for the blocks other than the first (not owned)
+    OsiVolWorkers_ * workers_;
+
+    void timesBlock_(const double* x, double* y,
+		     const int first, const int last) const;
+
+    OsiVolMatrixOneMinusOne_(const OsiVolMatrixOneMinusOne_&);
+    OsiVolMatrixOneMinusOne_& operator=(const OsiVolMatrixOneMinusOne_&);
 
   public:
-    OsiVolMatrixOneMinusOne_(const CoinPackedMatrix& m);
+    /* Up to numberThreads blocks, each of at least minBlockSize entries
+       (but always one block) */
+    OsiVolMatrixOneMinusOne_(const CoinPackedMatrix& m,
+			     const int numberThreads = 1,
+			     const int minBlockSize = 16384);
+    int numberBlocks() const { return numBlocks_; }
+    /* Run the blocks on these workers from now on (NULL: all in the
+       calling thread) */
+    void setWorkers(OsiVolWorkers_ * workers) { workers_ = workers; }
     ~OsiVolMatrixOneMinusOne_();
-    void timesMajor(const double* x, double* y) const;
+    void times(const double* x, double* y) const;
   };
 
 public:
@@ -164,19 +203,13 @@ public:
     /**@name Methods related to querying the input data */
     //@{
       /// Get number of columns
-      virtual int getNumCols() const {
-        return rowMatrixCurrent_?
-  	rowMatrix_.getNumCols() : colMatrix_.getNumCols(); }
+      virtual int getNumCols() const { return matrix_->getNumCols(); }
   
       /// Get number of rows
-      virtual int getNumRows() const {
-        return rowMatrixCurrent_?
-  	rowMatrix_.getNumRows() : colMatrix_.getNumRows(); }
+      virtual int getNumRows() const { return matrix_->getNumRows(); }
   
       /// Get number of nonzero elements
-      virtual int getNumElements() const {
-        return rowMatrixCurrent_?
-  	rowMatrix_.getNumElements() : colMatrix_.getNumElements(); }
+      virtual int getNumElements() const { return matrix_->getNumElements(); }
   
       /// Get pointer to array[getNumCols()] of column lower bounds
       virtual const double * getColLower() const { return collower_; }
@@ -260,17 +293,33 @@ public:
     /**@name Methods related to querying the solution */
     //@{
       /// Get pointer to array[getNumCols()] of primal solution vector
-      virtual const double * getColSolution() const { return colsol_; }
+      virtual const double * getColSolution() const {
+	OsiSolverStatistics::Timer
+	  timer(this,OsiSolverStatistics::getSolutionEvent);
+	return colsol_;
+      }
   
       /// Get pointer to array[getNumRows()] of dual prices
-      virtual const double * getRowPrice() const { return rowprice_; }
+      virtual const double * getRowPrice() const {
+	OsiSolverStatistics::Timer
+	  timer(this,OsiSolverStatistics::getSolutionEvent);
+	return rowprice_;
+      }
   
       /// Get a pointer to array[getNumCols()] of reduced costs
-      virtual const double * getReducedCost() const { return rc_; }
+      virtual const double * getReducedCost() const {
+	OsiSolverStatistics::Timer
+	  timer(this,OsiSolverStatistics::getSolutionEvent);
+	return rc_;
+      }
   
       /** Get pointer to array[getNumRows()] of row activity levels (constraint
   	matrix times the solution vector */
-      virtual const double * getRowActivity() const { return lhs_; }
+      virtual const double * getRowActivity() const {
+	OsiSolverStatistics::Timer
+	  timer(this,OsiSolverStatistics::getSolutionEvent);
+	return lhs_;
+      }
   
       /// Get objective function value
       virtual double getObjValue() const { 
@@ -336,28 +385,29 @@ public:
     //@{
       /** Set an objective function coefficient */
       virtual void setObjCoeff( int elementIndex, double elementValue ) {
-	objcoeffs_[elementIndex] = elementValue;
+	mutableColRim_().obj[elementIndex] = elementValue;
       }
 
       using OsiSolverInterface::setColLower ;
       /** Set a single column lower bound<br>
     	  Use -COIN_DBL_MAX for -infinity. */
       virtual void setColLower( int elementIndex, double elementValue ) {
-	collower_[elementIndex] = elementValue;
+	mutableColRim_().lower[elementIndex] = elementValue;
       }
       
       using OsiSolverInterface::setColUpper ;
       /** Set a single column upper bound<br>
     	  Use COIN_DBL_MAX for infinity. */
       virtual void setColUpper( int elementIndex, double elementValue ) {
-	colupper_[elementIndex] = elementValue;
+	mutableColRim_().upper[elementIndex] = elementValue;
       }
 
       /** Set a single column lower and upper bound */
       virtual void setColBounds( int elementIndex,
     				 double lower, double upper ) {
-	collower_[elementIndex] = lower;
-	colupper_[elementIndex] = upper;
+	ColRim_ & rim = mutableColRim_();
+	rim.lower[elementIndex] = lower;
+	rim.upper[elementIndex] = upper;
       }
 
       /** Set the bounds on a number of columns simultaneously<br>
@@ -375,39 +425,43 @@ public:
       /** Set a single row lower bound<br>
     	  Use -COIN_DBL_MAX for -infinity. */
       virtual void setRowLower( int elementIndex, double elementValue ) {
-	rowlower_[elementIndex] = elementValue;
-	convertBoundToSense(elementValue, rowupper_[elementIndex],
-			    rowsense_[elementIndex], rhs_[elementIndex],
-			    rowrange_[elementIndex]);
+	RowRim_ & rim = mutableRowRim_();
+	rim.lower[elementIndex] = elementValue;
+	convertBoundToSense(elementValue, rim.upper[elementIndex],
+			    rim.sense[elementIndex], rim.rhs[elementIndex],
+			    rim.range[elementIndex]);
       }
       
       /** Set a single row upper bound<br>
     	  Use COIN_DBL_MAX for infinity. */
       virtual void setRowUpper( int elementIndex, double elementValue ) {
-	rowupper_[elementIndex] = elementValue;
-	convertBoundToSense(rowlower_[elementIndex], elementValue,
-			    rowsense_[elementIndex], rhs_[elementIndex],
-			    rowrange_[elementIndex]);
+	RowRim_ & rim = mutableRowRim_();
+	rim.upper[elementIndex] = elementValue;
+	convertBoundToSense(rim.lower[elementIndex], elementValue,
+			    rim.sense[elementIndex], rim.rhs[elementIndex],
+			    rim.range[elementIndex]);
       }
     
       /** Set a single row lower and upper bound */
       virtual void setRowBounds( int elementIndex,
     				 double lower, double upper ) {
-	rowlower_[elementIndex] = lower;
-	rowupper_[elementIndex] = upper;
+	RowRim_ & rim = mutableRowRim_();
+	rim.lower[elementIndex] = lower;
+	rim.upper[elementIndex] = upper;
 	convertBoundToSense(lower, upper,
-			    rowsense_[elementIndex], rhs_[elementIndex],
-			    rowrange_[elementIndex]);
+			    rim.sense[elementIndex], rim.rhs[elementIndex],
+			    rim.range[elementIndex]);
       }
     
       /** Set the type of a single row<br> */
       virtual void setRowType(int index, char sense, double rightHandSide,
     			      double range) {
-	rowsense_[index] = sense;
-	rhs_[index] = rightHandSide;
-	rowrange_[index] = range;
+	RowRim_ & rim = mutableRowRim_();
+	rim.sense[index] = sense;
+	rim.rhs[index] = rightHandSide;
+	rim.range[index] = range;
 	convertSenseToBound(sense, rightHandSide, range,
-			    rowlower_[index], rowupper_[index]);
+			    rim.lower[index], rim.upper[index]);
       }
     
       /** Set the bounds on a number of rows simultaneously<br>
@@ -679,6 +733,12 @@ public:
   //@{
     /// Get pointer to Vol model
     VOL_problem* volprob() { return &volprob_; }
+    /** Threads used for products with a 0/1/-1 matrix (default 1).
+	Only large matrices are split, and the parts run on threads only if
+	CoinUtils was built with thread support. Takes effect at the next
+	solve. */
+    int numberThreads() const { return numberThreads_; }
+    void setNumberThreads(int value) { numberThreads_ = value > 1 ? value : 1; }
   //@}
 
   //---------------------------------------------------------------------------
@@ -739,31 +799,58 @@ private:
 private:
   /**@name Private helper methods */
   //@{
-    /** Update the row ordered matrix from the column ordered one */
-    void updateRowMatrix_() const;
-    /** Update the column ordered matrix from the row ordered one */
-    void updateColMatrix_() const;
-
     /** Test whether the Volume Algorithm can be applied to the given problem.
      */
     void checkData_() const;
-    /** Compute the reduced costs (<code>rc</code>) with respect to the dual
-        values given in <code>u</code>. */
-    void compute_rc_(const double* u, double* rc) const;
+    /** Compute the reduced costs (<code>rc</code>) of the objective
+	<code>obj</code> with respect to the dual values given in
+	<code>u</code>. */
+    void compute_rc_(const double* obj, const double* u, double* rc) const;
     /** A method deleting every member data */
     void gutsOfDestructor_();
 
     /** A method allocating sufficient space for the rim vectors corresponding
-        to the rows. */
-    void rowRimAllocator_();
+        to the rows (and the row solution). Returns the new row rim. */
+    RowRim_ & rowRimAllocator_();
     /** A method allocating sufficient space for the rim vectors corresponding
-        to the columns. */
-    void colRimAllocator_();
-
-    /** Reallocate the rim arrays corresponding to the rows. */
-    void rowRimResize_(const int newSize);
-    /** Reallocate the rim arrays corresponding to the columns. */
-    void colRimResize_(const int newSize);
+        to the columns (and the column solution). Returns the new column
+        rim. */
+    ColRim_ & colRimAllocator_();
+
+    /** Reallocate the rim arrays corresponding to the rows. Returns the
+	row rim, which is then not shared. */
+    RowRim_ & rowRimResize_(const int newSize);
+    /** Reallocate the rim arrays corresponding to the columns. Returns
+	the column rim, which is then not shared. */
+    ColRim_ & colRimResize_(const int newSize);
+
+    /** Point rowupper_ and friends at the arrays of rowRim_. */
+    void setRowRimPointers_();
+    /** Point colupper_ and friends at the arrays of colRim_. */
+    void setColRimPointers_();
+    /** The row rim, copied first if it is shared with a clone; use it to
+	change the row rim vectors. */
+    inline RowRim_ & mutableRowRim_() {
+      if (rowRim_.isShared()) {
+	rowRim_.getMutable();
+	setRowRimPointers_();
+      }
+      return *rowRim_.getMutable();
+    }
+    /** The column rim, copied first if it is shared with a clone; use it
+	to change the column rim vectors. */
+    inline ColRim_ & mutableColRim_() {
+      if (colRim_.isShared()) {
+	colRim_.getMutable();
+	setColRimPointers_();
+      }
+      return *colRim_.getMutable();
+    }
+    /** The matrix, copied first if it is shared with a clone; use it to
+	change the matrix. */
+    inline CoinPackedMatrixPair & mutableMatrix_() {
+      return *matrix_.getMutable();
+    }
 
     /** For each row convert LB/UB style row constraints to sense/rhs style. */
     void convertBoundsToSenses_();
@@ -779,17 +866,50 @@ private:
 private:
   
   //---------------------------------------------------------------------------
-  /**@name The problem matrix in row and column ordered forms <br>
-     Note that at least one of the matrices is always current. */
+  /**@name Problem data shared with clones <br>
+     The copy constructor shares the matrix and the rim vectors with the
+     original; whichever changes them first copies them
+     (see OsiShared). Clones made for strong branching thus share the
+     matrix throughout and copy only the rim they change. */
   //@{
-    /// A flag indicating whether the row ordered matrix is up-to-date
-    mutable bool rowMatrixCurrent_;
-    /// The problem matrix in a row ordered form
-    mutable CoinPackedMatrix rowMatrix_;
-    /// A flag indicating whether the column ordered matrix is up-to-date
-    mutable bool colMatrixCurrent_;
-    /// The problem matrix in a column ordered form
-    mutable CoinPackedMatrix colMatrix_;
+    /// Rim vectors of the columns
+    struct ColRim_ {
+      /// Allocate capacity entries (none if 0)
+      explicit ColRim_(int capacity);
+      ColRim_(const ColRim_ & rhs);
+      ~ColRim_();
+      double * upper;
+      double * lower;
+      bool * continuous;
+      double * obj;
+      int capacity;
+    private:
+      ColRim_ & operator=(const ColRim_ &);
+    };
+    /// Rim vectors of the rows
+    struct RowRim_ {
+      /// Allocate capacity entries (none if 0)
+      explicit RowRim_(int capacity);
+      RowRim_(const RowRim_ & rhs);
+      ~RowRim_();
+      double * upper;
+      double * lower;
+      char * sense;
+      double * rhs;
+      double * range;
+      int capacity;
+    private:
+      RowRim_ & operator=(const RowRim_ &);
+    };
+
+    /** The problem matrix in row and column ordered forms. Once both
+	orderings have been requested, modifications are applied to both
+	of them; both are built before the matrix is shared. */
+    OsiShared<CoinPackedMatrixPair> matrix_;
+    /// The column rim vectors (colupper_ ... point into it)
+    OsiShared<ColRim_> colRim_;
+    /// The row rim vectors (rowupper_ ... point into it)
+    OsiShared<RowRim_> rowRim_;
   //@}
 
   //---------------------------------------------------------------------------
@@ -797,6 +917,8 @@ private:
   //@{
     /// An indicator whether the matrix is 0/1/-1
     bool isZeroOneMinusOne_;
+    /// Threads to split the 0/1/-1 matrix products over
+    int numberThreads_;
     /// The row ordered matrix without the elements
     OsiVolMatrixOneMinusOne_* rowMatrixOneMinusOne_;
     /// The column ordered matrix without the elements
@@ -804,27 +926,32 @@ private:
   //@}
 
   //---------------------------------------------------------------------------
-  /**@name The rim vectors */
+  /**@name The rim vectors <br>
+     Read only views into colRim_ and rowRim_, which may be shared;
+     change them through mutableColRim_() or mutableRowRim_(). */
   //@{
     /// Pointer to dense vector of structural variable upper bounds
-    double  *colupper_;
+    const double  *colupper_;
     /// Pointer to dense vector of structural variable lower bounds
-    double  *collower_;
+    const double  *collower_;
     /// Pointer to dense vector of bool to indicate if column is continuous
-    bool    *continuous_;
+    const bool    *continuous_;
     /// Pointer to dense vector of slack variable upper bounds
-    double  *rowupper_;
+    const double  *rowupper_;
     /// Pointer to dense vector of slack variable lower bounds
-    double  *rowlower_;
+    const double  *rowlower_;
     /// Pointer to dense vector of row sense indicators
-    char    *rowsense_;
+    const char    *rowsense_;
     /// Pointer to dense vector of row right-hand side values
-    double  *rhs_;
+    const double  *rhs_;
     /** Pointer to dense vector of slack upper bounds for range 
         constraints (undefined for non-range rows). */
-    double  *rowrange_;
+    const double  *rowrange_;
     /// Pointer to dense vector of objective coefficients
-    double  *objcoeffs_;
+    const double  *objcoeffs_;
+    /** Objective minimised by the Volume algorithm: objcoeffs_, or a
+	negated copy when maximising. Only valid during resolve(). */
+    const double  *solveObj_;
   //@}
 
   //---------------------------------------------------------------------------
@@ -864,4 +991,9 @@ private:
 void
 OsiTestSolverInterfaceUnitTest(const std::string & mpsDir, const std::string & netlibDir);
 
+/** Run the Volume algorithm on the larger problems in \p mpsDir and report
+    the iteration rate. Problems the algorithm cannot handle are skipped. */
+void
+OsiTestSolverInterfaceBenchmark(const std::string & mpsDir);
+
 #endif
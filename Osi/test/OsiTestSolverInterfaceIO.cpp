@@ -21,16 +21,16 @@ OsiTestSolverInterface::initFromRlbRub(const int rownum,
 				      const double* rowub)
 {
    if (maxNumrows_ > 0) {
-      rowRimAllocator_();
+      RowRim_ & rim = rowRimAllocator_();
       if (rowub) {
-	 CoinDisjointCopyN(rowub, rownum, rowupper_);
+	 CoinDisjointCopyN(rowub, rownum, rim.upper);
       } else {
-	 CoinFillN(rowupper_, rownum, getInfinity());
+	 CoinFillN(rim.upper, rownum, getInfinity());
       }
       if (rowlb) {
-	 CoinDisjointCopyN(rowlb, rownum, rowlower_);
+	 CoinDisjointCopyN(rowlb, rownum, rim.lower);
       } else {
-	 CoinFillN(rowlower_, rownum, -getInfinity());
+	 CoinFillN(rim.lower, rownum, -getInfinity());
       }
       // Set the initial dual solution
       CoinFillN(rowprice_, rownum, 0.0);
@@ -47,21 +47,21 @@ OsiTestSolverInterface::initFromRhsSenseRange(const int rownum,
 					     const double* rowrng)
 {
    if (maxNumrows_ > 0) {
-      rowRimAllocator_();
+      RowRim_ & rim = rowRimAllocator_();
       if (rowsen) {
-	 CoinDisjointCopyN(rowsen, rownum, rowsense_);
+	 CoinDisjointCopyN(rowsen, rownum, rim.sense);
       } else {
-	 CoinFillN(rowsense_, rownum, 'G');
+	 CoinFillN(rim.sense, rownum, 'G');
       }
       if (rowrhs) {
-	 CoinDisjointCopyN(rowrhs, rownum, rhs_);
+	 CoinDisjointCopyN(rowrhs, rownum, rim.rhs);
       } else {
-	 CoinFillN(rhs_, rownum, 0.0);
+	 CoinFillN(rim.rhs, rownum, 0.0);
       }
       if (rowrng) {
-	 CoinDisjointCopyN(rowrng, rownum, rowrange_);
+	 CoinDisjointCopyN(rowrng, rownum, rim.range);
       } else {
-	 CoinFillN(rowrange_, rownum, 0.0);
+	 CoinFillN(rim.range, rownum, 0.0);
       }
       // Set the initial dual solution
       CoinFillN(rowprice_, rownum, 0.0);
@@ -77,22 +77,22 @@ OsiTestSolverInterface::initFromClbCubObj(const int colnum,
                                          const double* obj)
 {
   if (maxNumcols_ > 0) {
-    colRimAllocator_();
+    ColRim_ & rim = colRimAllocator_();
     if (colub) {
-      CoinDisjointCopyN(colub, colnum, colupper_);
+      CoinDisjointCopyN(colub, colnum, rim.upper);
     } else {
-      CoinFillN(colupper_, colnum, getInfinity());
+      CoinFillN(rim.upper, colnum, getInfinity());
     }
     if (collb) {
-      CoinDisjointCopyN(collb, colnum, collower_);
+      CoinDisjointCopyN(collb, colnum, rim.lower);
     } else {
-      CoinFillN(collower_, colnum, 0.0);
+      CoinFillN(rim.lower, colnum, 0.0);
     }
-    CoinFillN(continuous_,colnum,true);
+    CoinFillN(rim.continuous,colnum,true);
     if (obj) {
-      CoinDisjointCopyN(obj, colnum, objcoeffs_);
+      CoinDisjointCopyN(obj, colnum, rim.obj);
     } else {
-      CoinFillN(objcoeffs_, colnum, 0.0);
+      CoinFillN(rim.obj, colnum, 0.0);
     }
     int c;
     for ( c=0; c<colnum; c++ ) {
@@ -120,24 +120,17 @@ OsiTestSolverInterface::loadProblem(const CoinPackedMatrix& matrix,
    const int rownum = matrix.getNumRows();
    const int colnum = matrix.getNumCols();
 
+   mutableMatrix_().setMatrix(matrix);
    if (matrix.isColOrdered()) {
-      colMatrix_.setExtraGap(matrix.getExtraGap());
-      colMatrix_.setExtraMajor(matrix.getExtraMajor());
-      colMatrix_ = matrix;
-      colMatrixCurrent_ = true;
-      rowMatrixCurrent_ = false;
-      maxNumcols_ = colMatrix_.getMaxMajorDim();
-      maxNumrows_ = static_cast<int>((1+colMatrix_.getExtraGap()) *
-				     colMatrix_.getMinorDim());
+      const CoinPackedMatrix& colMatrix = matrix_->getByColumn();
+      maxNumcols_ = colMatrix.getMaxMajorDim();
+      maxNumrows_ = static_cast<int>((1+colMatrix.getExtraGap()) *
+				     colMatrix.getMinorDim());
    } else {
-      rowMatrix_.setExtraGap(matrix.getExtraGap());
-      rowMatrix_.setExtraMajor(matrix.getExtraMajor());
-      rowMatrix_ = matrix;
-      rowMatrixCurrent_ = true;
-      colMatrixCurrent_ = false;
-      maxNumcols_ = static_cast<int>((1+rowMatrix_.getExtraGap()) *
-				     rowMatrix_.getMinorDim());
-      maxNumrows_ = rowMatrix_.getMaxMajorDim();
+      const CoinPackedMatrix& rowMatrix = matrix_->getByRow();
+      maxNumcols_ = static_cast<int>((1+rowMatrix.getExtraGap()) *
+				     rowMatrix.getMinorDim());
+      maxNumrows_ = rowMatrix.getMaxMajorDim();
    }
 
    initFromRlbRub(rownum, rowlb, rowub);
@@ -158,35 +151,31 @@ OsiTestSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
    maxNumcols_ = colnum;
    maxNumrows_ = rownum;
 
-   if (matrix->isColOrdered()) {
-      colMatrix_.swap(*matrix);
-      colMatrixCurrent_ = true;
-      rowMatrixCurrent_ = false;
-   } else {
-      rowMatrix_.swap(*matrix);
-      rowMatrixCurrent_ = true;
-      colMatrixCurrent_ = false;
-   }
-   delete matrix; matrix = 0;
+   mutableMatrix_().assignMatrix(matrix);
       
-   rowupper_  = rowub;     rowub  = 0;
-   rowlower_  = rowlb;     rowlb  = 0;
-   colupper_  = colub;     colub  = 0;
-   collower_  = collb;     collb  = 0;
-   objcoeffs_ = obj;       obj    = 0;
+   RowRim_ * rowRim = rowRim_.reset(new RowRim_(0));
+   ColRim_ * colRim = colRim_.reset(new ColRim_(0));
+   rowRim->capacity = maxNumrows_;
+   colRim->capacity = maxNumcols_;
+   rowRim->upper = rowub;  rowub  = 0;
+   rowRim->lower = rowlb;  rowlb  = 0;
+   colRim->upper = colub;  colub  = 0;
+   colRim->lower = collb;  collb  = 0;
+   colRim->obj   = obj;    obj    = 0;
 
    if (maxNumrows_ > 0) {
-      if (!rowupper_) {
-	 rowupper_ = new double[maxNumrows_];
-	 CoinFillN(rowupper_, rownum, getInfinity());
+      if (!rowRim->upper) {
+	 rowRim->upper = new double[maxNumrows_];
+	 CoinFillN(rowRim->upper, rownum, getInfinity());
       }
-      if (!rowlower_) {
-	 rowlower_ = new double[maxNumrows_];
-	 CoinFillN(rowlower_, rownum, -getInfinity());
+      if (!rowRim->lower) {
+	 rowRim->lower = new double[maxNumrows_];
+	 CoinFillN(rowRim->lower, rownum, -getInfinity());
       }
-      rowsense_ = new char[maxNumrows_];
-      rhs_      = new double[maxNumrows_];
-      rowrange_ = new double[maxNumrows_];
+      rowRim->sense = new char[maxNumrows_];
+      rowRim->rhs   = new double[maxNumrows_];
+      rowRim->range = new double[maxNumrows_];
+      setRowRimPointers_();
       rowprice_ = new double[maxNumrows_];
       lhs_      = new double[maxNumrows_];
       // Set the initial dual solution
@@ -194,18 +183,20 @@ OsiTestSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
       convertBoundsToSenses_();
    }
    if (maxNumcols_ > 0) {
-      if (!colupper_) {
-	 colupper_ = new double[maxNumcols_];
-	 CoinFillN(colupper_, colnum, getInfinity());
+      if (!colRim->upper) {
+	 colRim->upper = new double[maxNumcols_];
+	 CoinFillN(colRim->upper, colnum, getInfinity());
       }
-      if (!collower_) {
-	 collower_ = new double[maxNumcols_];
-	 CoinFillN(collower_, colnum, -getInfinity());
+      if (!colRim->lower) {
+	 colRim->lower = new double[maxNumcols_];
+	 CoinFillN(colRim->lower, colnum, -getInfinity());
       }
-      if (!objcoeffs_) {
-	 objcoeffs_ = new double[maxNumcols_];
-	 CoinFillN(objcoeffs_, colnum, -getInfinity());
+      if (!colRim->obj) {
+	 colRim->obj = new double[maxNumcols_];
+	 CoinFillN(colRim->obj, colnum, -getInfinity());
       }
+      colRim->continuous = new bool[maxNumcols_];
+      setColRimPointers_();
 
       colsol_    = new double[maxNumcols_];
       int c;
@@ -219,7 +210,6 @@ OsiTestSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
       }
 
       rc_        = new double[maxNumcols_];
-      continuous_ = new bool[maxNumcols_];
    }
 }
 
@@ -236,20 +226,17 @@ OsiTestSolverInterface::loadProblem(const CoinPackedMatrix& matrix,
    const int rownum = matrix.getNumRows();
    const int colnum = matrix.getNumCols();
 
+   mutableMatrix_().setMatrix(matrix);
    if (matrix.isColOrdered()) {
-      colMatrix_ = matrix;
-      colMatrixCurrent_ = true;
-      rowMatrixCurrent_ = false;
-      maxNumcols_ = colMatrix_.getMaxMajorDim();
-      maxNumrows_ = static_cast<int>((1+colMatrix_.getExtraGap()) *
-				     colMatrix_.getMinorDim());
+      const CoinPackedMatrix& colMatrix = matrix_->getByColumn();
+      maxNumcols_ = colMatrix.getMaxMajorDim();
+      maxNumrows_ = static_cast<int>((1+colMatrix.getExtraGap()) *
+				     colMatrix.getMinorDim());
    } else {
-      rowMatrix_ = matrix;
-      rowMatrixCurrent_ = true;
-      colMatrixCurrent_ = false;
-      maxNumcols_ = static_cast<int>((1+rowMatrix_.getExtraGap()) *
-				     rowMatrix_.getMinorDim());
-      maxNumrows_ = rowMatrix_.getMaxMajorDim();
+      const CoinPackedMatrix& rowMatrix = matrix_->getByRow();
+      maxNumcols_ = static_cast<int>((1+rowMatrix.getExtraGap()) *
+				     rowMatrix.getMinorDim());
+      maxNumrows_ = rowMatrix.getMaxMajorDim();
    }
 
    initFromRhsSenseRange(rownum, rowsen, rowrhs, rowrng);
@@ -271,39 +258,35 @@ OsiTestSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
    maxNumcols_ = colnum;
    maxNumrows_ = rownum;
 
-   if (matrix->isColOrdered()) {
-      colMatrix_.swap(*matrix);
-      colMatrixCurrent_ = true;
-      rowMatrixCurrent_ = false;
-   } else {
-      rowMatrix_.swap(*matrix);
-      rowMatrixCurrent_ = true;
-      colMatrixCurrent_ = false;
-   }
-   delete matrix; matrix = 0;
+   mutableMatrix_().assignMatrix(matrix);
       
-   rowsense_  = rowsen;   rowsen = 0;
-   rhs_       = rowrhs;   rowrhs = 0;
-   rowrange_  = rowrng;   rowrng = 0;
-   colupper_  = colub;    colub  = 0;
-   collower_  = collb;    collb  = 0;
-   objcoeffs_ = obj;      obj    = 0;
+   RowRim_ * rowRim = rowRim_.reset(new RowRim_(0));
+   ColRim_ * colRim = colRim_.reset(new ColRim_(0));
+   rowRim->capacity = maxNumrows_;
+   colRim->capacity = maxNumcols_;
+   rowRim->sense = rowsen;  rowsen = 0;
+   rowRim->rhs   = rowrhs;  rowrhs = 0;
+   rowRim->range = rowrng;  rowrng = 0;
+   colRim->upper = colub;   colub  = 0;
+   colRim->lower = collb;   collb  = 0;
+   colRim->obj   = obj;     obj    = 0;
 
    if (maxNumrows_ > 0) {
-      if (!rowsense_) {
-	 rowsense_ = new char[maxNumrows_];
-	 CoinFillN(rowsense_, rownum, 'G');
+      if (!rowRim->sense) {
+	 rowRim->sense = new char[maxNumrows_];
+	 CoinFillN(rowRim->sense, rownum, 'G');
       }
-      if (!rhs_) {
-	 rhs_ = new double[maxNumrows_];
-	 CoinFillN(rhs_, rownum, 0.0);
+      if (!rowRim->rhs) {
+	 rowRim->rhs = new double[maxNumrows_];
+	 CoinFillN(rowRim->rhs, rownum, 0.0);
       }
-      if (!rowrange_) {
-	 rowrange_ = new double[maxNumrows_];
-	 CoinFillN(rowrange_, rownum, 0.0);
+      if (!rowRim->range) {
+	 rowRim->range = new double[maxNumrows_];
+	 CoinFillN(rowRim->range, rownum, 0.0);
       }
-      rowlower_ = new double[maxNumrows_];
-      rowupper_ = new double[maxNumrows_];
+      rowRim->lower = new double[maxNumrows_];
+      rowRim->upper = new double[maxNumrows_];
+      setRowRimPointers_();
       rowprice_ = new double[maxNumrows_];
       lhs_      = new double[maxNumrows_];
       // Set the initial dual solution
@@ -311,18 +294,20 @@ OsiTestSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
       convertSensesToBounds_();
    }
    if (maxNumcols_ > 0) {
-      if (!colupper_) {
-	 colupper_ = new double[maxNumcols_];
-	 CoinFillN(colupper_, colnum, getInfinity());
+      if (!colRim->upper) {
+	 colRim->upper = new double[maxNumcols_];
+	 CoinFillN(colRim->upper, colnum, getInfinity());
       }
-      if (!collower_) {
-	 collower_ = new double[maxNumcols_];
-	 CoinFillN(collower_, colnum, -getInfinity());
+      if (!colRim->lower) {
+	 colRim->lower = new double[maxNumcols_];
+	 CoinFillN(colRim->lower, colnum, -getInfinity());
       }
-      if (!objcoeffs_) {
-	 objcoeffs_ = new double[maxNumcols_];
-	 CoinFillN(objcoeffs_, colnum, -getInfinity());
+      if (!colRim->obj) {
+	 colRim->obj = new double[maxNumcols_];
+	 CoinFillN(colRim->obj, colnum, -getInfinity());
       }
+      colRim->continuous = new bool[maxNumcols_];
+      setColRimPointers_();
 
       colsol_    = new double[maxNumcols_];
       int c;
@@ -336,7 +321,6 @@ OsiTestSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
       }
 
       rc_        = new double[maxNumcols_];
-      continuous_ = new bool[maxNumcols_];
    }
 }
 
@@ -352,13 +336,12 @@ OsiTestSolverInterface::loadProblem(const int numcols, const int numrows,
 {
    gutsOfDestructor_();
 
-   colMatrix_.copyOf(true, numrows, numcols, start[numcols],
-		     value, index, start, 0);
-   colMatrixCurrent_ = true;
-   rowMatrixCurrent_ = false;
-   maxNumcols_ = colMatrix_.getMaxMajorDim();
-   maxNumrows_ = static_cast<int>((1+colMatrix_.getExtraGap()) *
-				  colMatrix_.getMinorDim());
+   mutableMatrix_().copyOf(true, numrows, numcols, start[numcols],
+		  value, index, start, 0);
+   const CoinPackedMatrix& colMatrix = matrix_->getByColumn();
+   maxNumcols_ = colMatrix.getMaxMajorDim();
+   maxNumrows_ = static_cast<int>((1+colMatrix.getExtraGap()) *
+				  colMatrix.getMinorDim());
 
    initFromRlbRub(numrows, rowlb, rowub);
    initFromClbCubObj(numcols, collb, colub, obj);
@@ -377,13 +360,12 @@ OsiTestSolverInterface::loadProblem(const int numcols, const int numrows,
 {
    gutsOfDestructor_();
 
-   colMatrix_.copyOf(true, numrows, numcols, start[numcols],
-		     value, index, start, 0);
-   colMatrixCurrent_ = true;
-   rowMatrixCurrent_ = false;
-   maxNumcols_ = colMatrix_.getMaxMajorDim();
-   maxNumrows_ = static_cast<int>((1+colMatrix_.getExtraGap()) *
-				  colMatrix_.getMinorDim());
+   mutableMatrix_().copyOf(true, numrows, numcols, start[numcols],
+		  value, index, start, 0);
+   const CoinPackedMatrix& colMatrix = matrix_->getByColumn();
+   maxNumcols_ = colMatrix.getMaxMajorDim();
+   maxNumrows_ = static_cast<int>((1+colMatrix.getExtraGap()) *
+				  colMatrix.getMinorDim());
 
    initFromRhsSenseRange(numrows, rowsen, rowrhs, rowrng);
    initFromClbCubObj(numcols, collb, colub, obj);
@@ -405,7 +387,7 @@ OsiTestSolverInterface::readMps(const char *filename, const char *extension)
 	         reader.getRowLower(),reader.getRowUpper());
      int nc = getNumCols();
      assert (continuous_);
-     CoinFillN(continuous_, nc, true);
+     CoinFillN(mutableColRim_().continuous, nc, true);
    }
    return retVal;
 }
@@ -2,6 +2,20 @@
 // Corporation and others.  All Rights Reserved.
 // This file is licensed under the terms of Eclipse Public License (EPL).
 
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "CoinFloatEqual.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinTime.hpp"
+
+#include "OsiBranchingObject.hpp"
+#include "OsiChooseReliable.hpp"
+#include "OsiCuts.hpp"
+#include "OsiRacingSolverInterface.hpp"
+#include "OsiSolverStatistics.hpp"
 #include "OsiTestSolverInterface.hpp"
 #include "OsiUnitTests.hpp"
 
@@ -18,4 +32,483 @@ OsiTestSolverInterfaceUnitTest(const std::string & mpsDir, const std::string & n
     OsiSolverInterfaceCommonUnitTest(&m, mpsDir, netlibDir);
   }
 
+  // Instrumentation: max x+y subject to x+y <= 5, 0 <= x,y <= 10
+  {
+    OsiTestSolverInterface si;
+    si.messageHandler()->setLogLevel(0);
+    si.volprob()->parm.printflag = 0;
+    const int starts[] = { 0, 1, 2 };
+    const int rowIndices[] = { 0, 0 };
+    const int indices[] = { 0, 1 };
+    const double elements[] = { 1.0, 1.0 };
+    const double colLower[] = { 0.0, 0.0 };
+    const double colUpper[] = { 10.0, 10.0 };
+    const double obj[] = { -1.0, -1.0 };
+    const double rowUpper[] = { 5.0 };
+    const double rowLower[] = { -si.getInfinity() };
+    si.loadProblem(2, 1, starts, rowIndices, elements, colLower, colUpper,
+		   obj, rowLower, rowUpper);
+    OsiSolverStatistics statistics;
+    FILE * events = tmpfile();
+    statistics.setEventStream(events);
+    si.setStatistics(&statistics);
+    si.initialSolve();
+    si.getColSolution();
+    si.getMatrixByRow();
+    OsiCuts cuts;
+    OsiRowCut cut;
+    cut.setRow(2, indices, elements);
+    cut.setLb(-si.getInfinity());
+    cut.setUb(4.0);
+    cuts.insert(cut);
+    si.applyCuts(cuts);
+    CoinPackedVector row(2, indices, elements);
+    const CoinPackedVectorBase * rows[] = { &row };
+    const double lower[] = { -si.getInfinity() };
+    const double upper[] = { 3.0 };
+    si.addRows(1, rows, lower, upper);
+    si.resolve();
+    si.markHotStart();
+    si.solveFromHotStart();
+    si.unmarkHotStart();
+    const int deleted[] = { 2 };
+    si.deleteRows(1, deleted);
+    OsiSolverInterface * clone = si.clone();
+    OSIUNITTEST_ASSERT_ERROR(clone->statistics() == &statistics, {}, "testsolver", "clone shares statistics");
+    delete clone;
+    si.setStatistics(NULL);
+    si.resolve();
+
+    OSIUNITTEST_ASSERT_ERROR(statistics.numberCalls(OsiSolverStatistics::initialSolveEvent) == 1, {}, "testsolver", "statistics initialSolve");
+    // initialSolve and solveFromHotStart go through resolve
+    OSIUNITTEST_ASSERT_ERROR(statistics.numberCalls(OsiSolverStatistics::resolveEvent) == 3, {}, "testsolver", "statistics resolve");
+    OSIUNITTEST_ASSERT_ERROR(statistics.numberCalls(OsiSolverStatistics::hotStartEvent) == 1, {}, "testsolver", "statistics solveFromHotStart");
+    OSIUNITTEST_ASSERT_ERROR(statistics.numberCalls(OsiSolverStatistics::applyCutsEvent) == 1, {}, "testsolver", "statistics applyCuts");
+    OSIUNITTEST_ASSERT_ERROR(statistics.numberCalls(OsiSolverStatistics::addRowsEvent) == 1, {}, "testsolver", "statistics addRows");
+    OSIUNITTEST_ASSERT_ERROR(statistics.numberCalls(OsiSolverStatistics::deleteRowsEvent) == 1, {}, "testsolver", "statistics deleteRows");
+    OSIUNITTEST_ASSERT_ERROR(statistics.numberCalls(OsiSolverStatistics::getMatrixEvent) >= 1, {}, "testsolver", "statistics getMatrix");
+    OSIUNITTEST_ASSERT_ERROR(statistics.numberCalls(OsiSolverStatistics::getSolutionEvent) >= 1, {}, "testsolver", "statistics getSolution");
+    OSIUNITTEST_ASSERT_ERROR(statistics.iterations(OsiSolverStatistics::initialSolveEvent) > 0, {}, "testsolver", "statistics iterations");
+    OSIUNITTEST_ASSERT_ERROR(statistics.seconds(OsiSolverStatistics::resolveEvent) >= statistics.maxSeconds(OsiSolverStatistics::resolveEvent), {}, "testsolver", "statistics seconds");
+
+    // one line per call, apart from getters
+    rewind(events);
+    char line[1000];
+    int numberLines = 0;
+    int numberResolves = 0;
+    const char * resolveLine = "{\"event\":\"resolve\",";
+    while (fgets(line, sizeof(line), events)) {
+      numberLines++;
+      if (!strncmp(line, resolveLine, strlen(resolveLine)))
+	numberResolves++;
+    }
+    fclose(events);
+    OSIUNITTEST_ASSERT_ERROR(numberLines == 8 && numberResolves == 3, {}, "testsolver", "statistics event stream");
+  }
+
+  // Scanning all objects at once must match asking each object
+  {
+    OsiTestSolverInterface si;
+    const int numberColumns = 8;
+    int starts[numberColumns+1];
+    int rowIndices[numberColumns];
+    double elements[numberColumns];
+    double colLower[numberColumns];
+    double colUpper[numberColumns];
+    double obj[numberColumns];
+    for (int j = 0; j < numberColumns; j++) {
+      starts[j] = j;
+      rowIndices[j] = 0;
+      elements[j] = 1.0;
+      colLower[j] = 0.0;
+      colUpper[j] = 4.0;
+      obj[j] = 1.0;
+    }
+    starts[numberColumns] = numberColumns;
+    const double rowLower[] = { 1.0 };
+    const double rowUpper[] = { 10.0 };
+    si.loadProblem(numberColumns, 1, starts, rowIndices, elements,
+		   colLower, colUpper, obj, rowLower, rowUpper);
+    for (int j = 0; j < numberColumns-1; j++)
+      si.setInteger(j);
+    si.findIntegers(false);
+    const int members[] = { 0, 7 };
+    const double weights[] = { 1.0, 2.0 };
+    OsiObject * sos = new OsiSOS(&si, 2, members, weights, 1);
+    si.addObjects(1, &sos);
+    delete sos;
+    OsiObject ** objects = si.objects();
+    const int numberObjects = si.numberObjects();
+    static_cast<OsiObject2 *>(objects[3])->setPreferredWay(1);
+    // satisfied, within tolerance, fractional, below bound, above bound
+    const double solution[numberColumns] =
+      { 1.0, 2.0+1.0e-9, 0.3, 2.7, 0.5, -0.4, 4.6, 0.2 };
+    OsiBranchingInformation info(&si, true);
+    info.solution_ = solution;
+    OsiObjectScan scan;
+    bool same = true;
+    for (int pass = 0; pass < 2; pass++) {
+      scan.scan(&info, numberObjects, objects);
+      std::vector<double> up(numberObjects), down(numberObjects);
+      for (int i = 0; i < numberObjects; i++) {
+	up[i] = scan.upEstimate(i);
+	down[i] = scan.downEstimate(i);
+      }
+      for (int i = 0; i < numberObjects; i++) {
+	int way;
+	double value = objects[i]->infeasibility(&info, way);
+	if (value != scan.infeasibilities()[i] || way != scan.whichWays()[i] ||
+	    objects[i]->whichWay() != way ||
+	    up[i] != objects[i]->upEstimate() ||
+	    down[i] != objects[i]->downEstimate())
+	  same = false;
+      }
+    }
+    OSIUNITTEST_ASSERT_ERROR(same, {}, "testsolver", "object scan matches infeasibility");
+    OSIUNITTEST_ASSERT_ERROR(scan.numberSimple() == numberColumns-1, {}, "testsolver", "object scan simple integers");
+  }
+
+  // Shared pseudocosts keep counts as well as totals
+  {
+    OsiSharedPseudoCosts costs;
+    costs.initialize(3);
+    costs.update(1, 0, 2.0);
+    costs.update(1, 0, 4.0);
+    costs.updateInfeasible(1, 1);
+    costs.updateStrong(2, 10);
+    costs.updateStrong(2, 5);
+    OSIUNITTEST_ASSERT_ERROR(costs.number(1, 0) == 2 && costs.total(1, 0) == 6.0 &&
+			     costs.average(1, 0, 0.0) == 3.0 &&
+			     costs.average(1, 1, 7.0) == 7.0, {}, "testsolver", "shared pseudocost averages");
+    OSIUNITTEST_ASSERT_ERROR(costs.numberInfeasible(1, 1) == 1 && costs.numberInfeasible(1, 0) == 0 &&
+			     costs.numberStrong(2) == 2 && costs.numberStrongIterations(2) == 15,
+			     {}, "testsolver", "shared pseudocost statistics");
+    OsiPseudoCosts copy;
+    copy.initialize(3);
+    copy.setNumberBeforeTrusted(4);
+    costs.copyTo(copy);
+    OSIUNITTEST_ASSERT_ERROR(copy.downNumber()[1] == 2 && copy.downTotalChange()[1] == 6.0 &&
+			     copy.upNumber()[1] == 0 && copy.numberBeforeTrusted() == 4,
+			     {}, "testsolver", "shared pseudocosts copied");
+  }
+
+  // Reliability branching strong branches on untrusted candidates only
+  {
+    CoinMpsIO mps;
+    mps.messageHandler()->setLogLevel(0);
+    std::string fn = mpsDir+"p0033";
+    mps.readMps(fn.c_str(), "mps");
+    OsiTestSolverInterface si;
+    si.messageHandler()->setLogLevel(0);
+    si.volprob()->parm.printflag = 0;
+    si.loadProblem(*mps.getMatrixByCol(), mps.getColLower(), mps.getColUpper(),
+		   mps.getObjCoefficients(), mps.getRowLower(), mps.getRowUpper());
+    for (int j = 0; j < mps.getNumCols(); j++) {
+      if (mps.isInteger(j))
+	si.setInteger(j);
+    }
+    si.initialSolve();
+    si.findIntegers(false);
+    const int numberColumns = si.getNumCols();
+    std::vector<double> solution(si.getColSolution(), si.getColSolution()+numberColumns);
+    OsiSharedPseudoCosts costs;
+    costs.initialize(si.numberObjects());
+    OsiChooseReliable choose(&si);
+    choose.setSharedPseudoCosts(&costs);
+    choose.setNumberStrong(10);
+    choose.setNumberBeforeTrusted(1);
+    OsiChooseVariable * other = choose.clone();
+    OSIUNITTEST_ASSERT_ERROR(static_cast<OsiChooseReliable *>(other)->sharedPseudoCosts() == &costs,
+			     {}, "testsolver", "reliability clone shares pseudocosts");
+    int numberDone[3];
+    bool consistent = true;
+    for (int pass = 0; pass < 3; pass++) {
+      OsiChooseReliable & chooser = pass < 2 ? choose : *static_cast<OsiChooseReliable *>(other);
+      if (pass == 1)
+	chooser.setLookahead(2);
+      if (pass == 2)
+	chooser.setNumberThreads(2);
+      OsiBranchingInformation info(&si, true);
+      info.solution_ = &solution[0];
+      chooser.setupList(&info, true);
+      const int returnCode = chooser.chooseVariable(&si, &info, false);
+      numberDone[pass] = chooser.numberStrongDone();
+      int numberStrong = 0;
+      for (int i = 0; i < costs.numberObjects(); i++)
+	numberStrong += costs.numberStrong(i);
+      int total = 0;
+      for (int k = 0; k <= pass; k++)
+	total += numberDone[k];
+      if (returnCode < -1 || returnCode > 4 || numberStrong != total ||
+	  numberDone[pass]+chooser.numberTrusted() > chooser.numberOnList())
+	consistent = false;
+      if (!returnCode && chooser.bestObjectIndex() < 0)
+	consistent = false;
+    }
+    delete other;
+    OSIUNITTEST_ASSERT_ERROR(consistent, {}, "testsolver", "reliability branching statistics");
+    OSIUNITTEST_ASSERT_ERROR(numberDone[0] > 0 && numberDone[1] < numberDone[0],
+			     {}, "testsolver", "reliability branching trusts updated pseudocosts");
+  }
+
+  // Clones share the problem until they change it
+  {
+    OsiTestSolverInterface si;
+    const int starts[] = { 0, 2, 4 };
+    const int rowIndices[] = { 0, 1, 0, 1 };
+    const double elements[] = { 1.0, 1.0, 1.0, -1.0 };
+    const double colLower[] = { 0.0, 0.0 };
+    const double colUpper[] = { 10.0, 10.0 };
+    const double obj[] = { -1.0, -1.0 };
+    const double rowLower[] = { -si.getInfinity(), -1.0 };
+    const double rowUpper[] = { 5.0, 1.0 };
+    si.loadProblem(2, 2, starts, rowIndices, elements, colLower, colUpper,
+		   obj, rowLower, rowUpper);
+    OsiTestSolverInterface * other =
+      dynamic_cast<OsiTestSolverInterface *>(si.clone());
+    OSIUNITTEST_ASSERT_ERROR(other->matrix_.get() == si.matrix_.get() &&
+			     other->getColUpper() == si.getColUpper() &&
+			     other->getRowUpper() == si.getRowUpper() &&
+			     si.matrix_.useCount() == 2,
+			     {}, "testsolver", "clone shares problem");
+    other->setColUpper(0, 2.0);
+    OSIUNITTEST_ASSERT_ERROR(other->getColUpper() != si.getColUpper() &&
+			     other->getColUpper()[0] == 2.0 && si.getColUpper()[0] == 10.0 &&
+			     other->getRowUpper() == si.getRowUpper() &&
+			     other->matrix_.get() == si.matrix_.get(),
+			     {}, "testsolver", "bound change copies only column rim");
+    CoinPackedVector row;
+    row.insert(0, 1.0);
+    other->addRow(row, 0.0, 1.0);
+    OSIUNITTEST_ASSERT_ERROR(other->getNumRows() == 3 && si.getNumRows() == 2 &&
+			     si.getMatrixByRow()->getNumRows() == 2 &&
+			     si.getRowUpper()[1] == 1.0 && other->getRowUpper()[2] == 1.0,
+			     {}, "testsolver", "adding a row copies matrix and row rim");
+    OsiTestSolverInterface * third =
+      dynamic_cast<OsiTestSolverInterface *>(si.clone());
+    delete other;
+    si.setInteger(1);
+    OSIUNITTEST_ASSERT_ERROR(!si.isContinuous(1) && third->isContinuous(1) &&
+			     third->getNumRows() == 2,
+			     {}, "testsolver", "original copies when shared");
+    delete third;
+    OSIUNITTEST_ASSERT_ERROR(si.matrix_.useCount() == 1, {}, "testsolver", "clones release problem");
+  }
+
+  // Solving a maximisation problem leaves the shared objective alone
+  {
+    OsiTestSolverInterface si;
+    si.messageHandler()->setLogLevel(0);
+    si.volprob()->parm.printflag = 0;
+    const int starts[] = { 0, 1, 2 };
+    const int rowIndices[] = { 0, 0 };
+    const double elements[] = { 1.0, 1.0 };
+    const double colLower[] = { 0.0, 0.0 };
+    const double colUpper[] = { 10.0, 10.0 };
+    const double obj[] = { 1.0, 2.0 };
+    const double rowLower[] = { -si.getInfinity() };
+    const double rowUpper[] = { 5.0 };
+    si.loadProblem(2, 1, starts, rowIndices, elements, colLower, colUpper,
+		   obj, rowLower, rowUpper);
+    si.setObjSense(-1.0);
+    OsiTestSolverInterface * other =
+      dynamic_cast<OsiTestSolverInterface *>(si.clone());
+    other->initialSolve();
+    OSIUNITTEST_ASSERT_ERROR(other->getObjCoefficients() == si.getObjCoefficients() &&
+			     si.colRim_.useCount() == 2 &&
+			     si.getObjCoefficients()[1] == 2.0,
+			     {}, "testsolver", "maximising does not write the shared objective");
+    delete other;
+  }
+
+  // Splitting the 0/1/-1 products over threads gives the same iterates
+  {
+    const int numberRows = 400;
+    const int numberColumns = 2000;
+    const int perColumn = 20;
+    std::vector<int> starts(numberColumns+1);
+    std::vector<int> rowIndices;
+    std::vector<double> elements;
+    for (int j = 0; j < numberColumns; j++) {
+      starts[j] = static_cast<int>(rowIndices.size());
+      for (int k = 0; k < perColumn; k++) {
+	rowIndices.push_back((7*j+19*k)%numberRows);
+	elements.push_back((j+k)%5 ? 1.0 : -1.0);
+      }
+    }
+    starts[numberColumns] = static_cast<int>(rowIndices.size());
+    std::vector<double> colLower(numberColumns, 0.0);
+    std::vector<double> colUpper(numberColumns, 1.0);
+    std::vector<double> obj(numberColumns);
+    for (int j = 0; j < numberColumns; j++)
+      obj[j] = 1.0+(j%11)/7.0;
+    std::vector<double> rowLower(numberRows, 1.0);
+    std::vector<double> rowUpper(numberRows, OsiTestInfinity);
+    double objValue[2];
+    std::vector<double> solution[2];
+    for (int pass = 0; pass < 2; pass++) {
+      OsiTestSolverInterface si;
+      si.messageHandler()->setLogLevel(0);
+      si.volprob()->parm.printflag = 0;
+      si.volprob()->parm.maxsgriters = 50;
+      si.setNumberThreads(pass ? 2 : 1);
+      si.loadProblem(numberColumns, numberRows, &starts[0], &rowIndices[0],
+		     &elements[0], &colLower[0], &colUpper[0], &obj[0],
+		     &rowLower[0], &rowUpper[0]);
+      if (pass) {
+	OsiTestSolverInterface::OsiVolMatrixOneMinusOne_
+	  byColumn(*si.getMatrixByCol(), si.numberThreads());
+	OSIUNITTEST_ASSERT_ERROR(byColumn.numberBlocks() == 2, {}, "testsolver", "0/1/-1 matrix split into blocks");
+	OsiSolverInterface * copy = si.clone();
+	OSIUNITTEST_ASSERT_ERROR(dynamic_cast<OsiTestSolverInterface *>(copy)->numberThreads() == 2,
+				 {}, "testsolver", "clone keeps number of threads");
+	delete copy;
+      }
+      si.initialSolve();
+      objValue[pass] = si.getObjValue();
+      solution[pass].assign(si.getColSolution(), si.getColSolution()+numberColumns);
+    }
+    OSIUNITTEST_ASSERT_ERROR(objValue[0] == objValue[1] && solution[0] == solution[1],
+			     {}, "testsolver", "threaded 0/1/-1 products");
+  }
+
+  // Racing two solvers: same answer as one, modifications reach both
+  {
+    CoinRelFltEq eq;
+    OsiRacingSolverInterface racer;
+    for (int i = 0; i < 2; i++) {
+      OsiTestSolverInterface * si = new OsiTestSolverInterface;
+      si->messageHandler()->setLogLevel(0);
+      si->volprob()->parm.printflag = 0;
+      racer.addSolver(si);
+    }
+    OsiTestSolverInterface single;
+    single.messageHandler()->setLogLevel(0);
+    single.volprob()->parm.printflag = 0;
+    const int starts[] = { 0, 1, 2 };
+    const int rowIndices[] = { 0, 0 };
+    const double elements[] = { 1.0, 1.0 };
+    const double colLower[] = { 0.0, 0.0 };
+    const double colUpper[] = { 10.0, 10.0 };
+    const double obj[] = { -1.0, -1.0 };
+    const double rowUpper[] = { 5.0 };
+    const double rowLower[] = { -racer.getInfinity() };
+    racer.loadProblem(2, 1, starts, rowIndices, elements, colLower, colUpper,
+		      obj, rowLower, rowUpper);
+    single.loadProblem(2, 1, starts, rowIndices, elements, colLower, colUpper,
+		       obj, rowLower, rowUpper);
+    OSIUNITTEST_ASSERT_ERROR(racer.getNumCols() == 2 && racer.getNumRows() == 1 &&
+			     racer.solver(1)->getNumCols() == 2,
+			     {}, "testsolver", "racing load");
+    racer.initialSolve();
+    single.initialSolve();
+    OSIUNITTEST_ASSERT_ERROR(racer.winner() >= 0 && racer.winner() < 2, {}, "testsolver", "racing winner");
+    OSIUNITTEST_ASSERT_ERROR(eq(racer.getObjValue(), single.getObjValue()), {}, "testsolver", "racing initialSolve");
+
+    // the loser may still be running; it only sees changes once finished
+    racer.waitForAll();
+    racer.setColUpper(0, 2.0);
+    single.setColUpper(0, 2.0);
+    racer.setDblParam(OsiObjOffset, 1.0);
+    double offset = 0.0;
+    racer.solver(1)->getDblParam(OsiObjOffset, offset);
+    OSIUNITTEST_ASSERT_ERROR(racer.solver(0)->getColUpper()[0] == 2.0 &&
+			     racer.solver(1)->getColUpper()[0] == 2.0 && offset == 1.0,
+			     {}, "testsolver", "racing modifications");
+    racer.waitForAll();
+    racer.resolve();
+    single.setDblParam(OsiObjOffset, 1.0);
+    single.resolve();
+    OSIUNITTEST_ASSERT_ERROR(eq(racer.getObjValue(), single.getObjValue()), {}, "testsolver", "racing resolve");
+
+    OsiRacingSolverInterface * copy =
+      dynamic_cast<OsiRacingSolverInterface *>(racer.clone());
+    OSIUNITTEST_ASSERT_ERROR(copy && copy->numberSolvers() == 2 &&
+			     copy->solver(1)->getColUpper()[0] == 2.0,
+			     {}, "testsolver", "racing clone");
+    delete copy;
+
+    OsiRacingSolverInterface empty;
+    bool thrown = false;
+    try {
+      empty.initialSolve();
+    } catch (CoinError &) {
+      thrown = true;
+    }
+    OSIUNITTEST_ASSERT_ERROR(thrown, {}, "testsolver", "racing needs solvers");
+
+    // the Volume algorithm refuses ranged rows, so every entrant throws
+    racer.setRowLower(0, 1.0);
+    racer.waitForAll();
+    thrown = false;
+    try {
+      racer.resolve();
+    } catch (CoinError & error) {
+      thrown = (error.message().find("ranged rows") != std::string::npos);
+    }
+    OSIUNITTEST_ASSERT_ERROR(thrown, {}, "testsolver", "racing passes on errors");
+  }
+}
+
+//--------------------------------------------------------------------------
+/*
+  The Volume algorithm needs finite column bounds. Many of the sample
+  problems have free or half-bounded columns; they are boxed at +/- bigBound
+  here since only the speed of the iterations is of interest. The stopping
+  tests are switched off so that every problem runs the full iteration
+  limit.
+*/
+void
+OsiTestSolverInterfaceBenchmark(const std::string & mpsDir)
+{
+  const char * const names[] = {
+    "wedding_16", "retail3", "atm_5_10_1", "finnis", "p0548", "e226",
+    "p0201", "brandy"
+  };
+  const int numNames = static_cast<int>(sizeof(names)/sizeof(names[0]));
+  const int maxIters = 1000;
+  const double bigBound = 1.0e4;
+
+  printf("%-12s %7s %7s %8s %7s %9s %12s\n", "problem", "rows", "cols",
+	 "elements", "iters", "seconds", "iters/sec");
+  for (int k = 0; k < numNames; ++k) {
+    CoinMpsIO mps;
+    mps.messageHandler()->setLogLevel(0);
+    const std::string fn = mpsDir + names[k];
+    if (mps.readMps(fn.c_str(), "mps") != 0) {
+      printf("%-12s could not be read\n", names[k]);
+      continue;
+    }
+    const int n = mps.getNumCols();
+    std::vector<double> lower(mps.getColLower(), mps.getColLower() + n);
+    std::vector<double> upper(mps.getColUpper(), mps.getColUpper() + n);
+    for (int j = 0; j < n; ++j) {
+      lower[j] = CoinMax(lower[j], -bigBound);
+      upper[j] = CoinMin(upper[j], bigBound);
+    }
+    OsiTestSolverInterface si;
+    si.loadProblem(*mps.getMatrixByCol(), &lower[0], &upper[0],
+		   mps.getObjCoefficients(),
+		   mps.getRowLower(), mps.getRowUpper());
+
+    VOL_parms& parm = si.volprob()->parm;
+    parm.maxsgriters = maxIters;
+    parm.printflag = 0;
+    parm.primal_abs_precision = 0.0;
+    parm.minimum_rel_ascent = 0.0;
+
+    const double start = CoinWallclockTime();
+    try {
+      si.initialSolve();
+    }
+    catch (CoinError& e) {
+      printf("%-12s skipped: %s\n", names[k], e.message().c_str());
+      continue;
+    }
+    const double elapsed = CoinWallclockTime() - start;
+    const int iters = si.getIterationCount();
+    printf("%-12s %7d %7d %8d %7d %9.3f %12.1f\n", names[k],
+	   si.getNumRows(), si.getNumCols(), si.getNumElements(), iters,
+	   elapsed, elapsed > 0.0 ? iters/elapsed : 0.0);
+  }
 }
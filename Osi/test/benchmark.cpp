@@ -0,0 +1,1097 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/*
+  Time a solver interface on the Sample and Netlib problems.
+
+  Each problem goes through the phases a branch-and-cut code leans on:
+  reading the MPS file, loading it into the solver, solving from scratch,
+  resolving from the optimal warm start after a bound change, and probing
+  bound changes from a hot start. Every phase is timed on its own and each
+  problem is repeated; the best time per call over the repeats is the
+  figure of merit, as it is the least disturbed by the rest of the machine.
+
+  The rows of each problem are also used as a set of cuts, to time adding
+  them to an OsiCutPool and to OsiCuts and applying them from each to a
+  fresh copy of the problem. Those times are per cut, and the memory per
+  cut of each container is reported alongside.
+
+  For problems with integer variables a small depth first branch and
+  bound can also be run from the root, once choosing with OsiChooseStrong
+  and once with OsiChooseReliable, to compare the strong branching each
+  does for the size of tree it gets.
+
+  Results can be written as CSV or JSON. A CSV file written by an earlier
+  run can be given as a baseline, in which case the phases which got
+  slower by more than the tolerance are listed and the exit status is
+  nonzero, so that the comparison can be scripted.
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CoinPragma.hpp"
+#include "OsiConfig.h"
+
+#include "CoinError.hpp"
+#include "CoinFileIO.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinTime.hpp"
+#include "CoinWarmStart.hpp"
+
+#include "OsiBranchingObject.hpp"
+#include "OsiChooseReliable.hpp"
+#include "OsiCutPool.hpp"
+#include "OsiCuts.hpp"
+#include "OsiSolverInterface.hpp"
+#include "OsiTestSolverInterface.hpp"
+
+#ifdef COIN_HAS_XPR
+#include "OsiXprSolverInterface.hpp"
+#endif
+#ifdef COIN_HAS_CPX
+#include "OsiCpxSolverInterface.hpp"
+#endif
+#ifdef COIN_HAS_GLPK
+#include "OsiGlpkSolverInterface.hpp"
+#endif
+#ifdef COIN_HAS_MSK
+#include "OsiMskSolverInterface.hpp"
+#endif
+#ifdef COIN_HAS_GRB
+#include "OsiGrbSolverInterface.hpp"
+#endif
+#ifdef COIN_HAS_SOPLEX
+#include "OsiSpxSolverInterface.hpp"
+#endif
+
+namespace {
+
+// Problems from Data/Sample which are LPs or MIPs
+const char * const sampleNames[] = {
+  "exmip1", "afiro", "brandy", "e226", "finnis", "p0033", "p0201",
+  "p0548", "lseu", "retail3", "wedding_16", "atm_5_10_1"
+};
+
+// Problems from Data/Netlib, as in OsiNetlibTest
+const char * const netlibNames[] = {
+  "25fv47", "80bau3b", "adlittle", "afiro", "agg", "agg2", "agg3",
+  "bandm", "beaconfd", "blend", "bnl1", "bnl2", "boeing1", "boeing2",
+  "bore3d", "brandy", "capri", "cycle", "czprob", "d2q06c", "d6cube",
+  "degen2", "degen3", "dfl001", "e226", "etamacro", "fffff800",
+  "finnis", "fit1d", "fit1p", "fit2d", "fit2p", "forplan", "ganges",
+  "gfrd-pnc", "greenbea", "greenbeb", "grow15", "grow22", "grow7",
+  "israel", "kb2", "lotfi", "maros", "maros-r7", "modszk1", "nesm",
+  "perold", "pilot", "pilot4", "pilot87", "pilotnov", "recipe",
+  "sc105", "sc205", "sc50a", "sc50b", "scagr25", "scagr7", "scfxm1",
+  "scfxm2", "scfxm3", "scorpion", "scrs8", "scsd1", "scsd6", "scsd8",
+  "sctap1", "sctap2", "sctap3", "seba", "share1b", "share2b", "shell",
+  "ship04l", "ship04s", "ship08l", "ship08s", "ship12l", "ship12s",
+  "sierra", "stair", "standata", "standmps", "stocfor1", "stocfor2",
+  "tuff", "vtpbase", "wood1p", "woodw"
+};
+
+enum Phase {
+  readPhase = 0,
+  loadPhase,
+  initialSolvePhase,
+  resolvePhase,
+  hotStartPhase,
+  poolInsertPhase,
+  poolApplyPhase,
+  cutsInsertPhase,
+  cutsApplyPhase,
+  numberPhases
+};
+
+const char * const phaseNames[numberPhases] = {
+  "read", "load", "initialSolve", "resolve", "hotStart",
+  "poolInsert", "poolApply", "cutsInsert", "cutsApply"
+};
+
+/*
+  Bytes taken by a heap block beyond what was asked for (the chunk header
+  of glibc malloc); used to estimate the memory of OsiCuts.
+*/
+const int mallocOverhead = 16;
+
+/*
+  Changes in times below this are timer noise and are not reported as
+  regressions however large the ratio.
+*/
+const double noiseSeconds = 1.0e-4;
+
+struct PhaseResult {
+  /// Calls in one repeat
+  int calls;
+  /// Best over repeats of seconds per call
+  double best;
+  /// Sum over repeats of seconds per call
+  double sum;
+  /// Iterations per call in the last repeat
+  double iterations;
+};
+
+struct ModelResult {
+  std::string name;
+  /// Empty if all went well, otherwise why the problem was not timed
+  std::string error;
+  int rows;
+  int columns;
+  int elements;
+  double objective;
+  int repeats;
+  PhaseResult phase[numberPhases];
+  /// Memory per cut in an OsiCutPool
+  double poolBytes;
+  /// Estimated memory per cut in OsiCuts
+  double cutsBytes;
+};
+
+enum Chooser {
+  strongChooser = 0,
+  reliableChooser,
+  numberChoosers
+};
+
+const char * const chooserNames[numberChoosers] = {
+  "strong", "reliable"
+};
+
+struct BranchResult {
+  /// Nodes solved
+  int nodes;
+  /// Strong branching LPs (two per candidate)
+  int strongLps;
+  /// Simplex iterations of strong branching
+  int strongIterations;
+  /// Best integer solution found (COIN_DBL_MAX if none)
+  double bestObjective;
+  /// True if the tree was searched to the end
+  bool finished;
+  double seconds;
+};
+
+// Names of solvers in this build, the preferred one first
+std::vector<std::string> solverNames()
+{
+  std::vector<std::string> names;
+#ifdef COIN_HAS_CPX
+  names.push_back("cpx");
+#endif
+#ifdef COIN_HAS_GRB
+  names.push_back("grb");
+#endif
+#ifdef COIN_HAS_XPR
+  names.push_back("xpr");
+#endif
+#ifdef COIN_HAS_MSK
+  names.push_back("msk");
+#endif
+#ifdef COIN_HAS_SOPLEX
+  names.push_back("spx");
+#endif
+#ifdef COIN_HAS_GLPK
+  names.push_back("glpk");
+#endif
+  names.push_back("test");
+  return names;
+}
+
+// New quiet solver, NULL if name is not in the build
+OsiSolverInterface * newSolver(const std::string & name)
+{
+  OsiSolverInterface * si = NULL;
+#ifdef COIN_HAS_CPX
+  if (name == "cpx")
+    si = new OsiCpxSolverInterface;
+#endif
+#ifdef COIN_HAS_GRB
+  if (name == "grb")
+    si = new OsiGrbSolverInterface;
+#endif
+#ifdef COIN_HAS_XPR
+  if (name == "xpr")
+    si = new OsiXprSolverInterface;
+#endif
+#ifdef COIN_HAS_MSK
+  if (name == "msk")
+    si = new OsiMskSolverInterface;
+#endif
+#ifdef COIN_HAS_SOPLEX
+  if (name == "spx")
+    si = new OsiSpxSolverInterface;
+#endif
+#ifdef COIN_HAS_GLPK
+  if (name == "glpk")
+    si = new OsiGlpkSolverInterface;
+#endif
+  if (name == "test") {
+    OsiTestSolverInterface * testSi = new OsiTestSolverInterface;
+    testSi->volprob()->parm.printflag = 0;
+    si = testSi;
+  }
+  if (si) {
+    si->messageHandler()->setLogLevel(0);
+    si->setHintParam(OsiDoReducePrint,true,OsiHintTry);
+  }
+  return si;
+}
+
+// Split a comma separated list
+std::vector<std::string> splitList(const std::string & list)
+{
+  std::vector<std::string> items;
+  std::string::size_type start = 0;
+  while (start <= list.size()) {
+    std::string::size_type comma = list.find(',',start);
+    if (comma == std::string::npos)
+      comma = list.size();
+    items.push_back(list.substr(start,comma-start));
+    start = comma+1;
+  }
+  return items;
+}
+
+// Add seconds per call for one repeat of a phase
+void addTime(PhaseResult & result, int calls, double seconds,
+	     double iterations, bool first)
+{
+  double perCall = seconds/calls;
+  result.calls = calls;
+  result.sum += perCall;
+  if (first || perCall < result.best)
+    result.best = perCall;
+  result.iterations = iterations/calls;
+}
+
+/*
+  Time adding the rows of a problem as cuts and applying them. Each
+  container applies its cuts to its own fresh copy of the problem, so
+  both add rows to the same matrix.
+*/
+void timeCuts(const std::string & solverName, const CoinMpsIO & mps,
+	      const double * lower, const double * upper, bool first,
+	      ModelResult & result)
+{
+  const CoinPackedMatrix * byRow = mps.getMatrixByRow();
+  const int numberCuts = mps.getNumRows();
+  if (!numberCuts)
+    return;
+  const int * starts = byRow->getVectorStarts();
+  const int * lengths = byRow->getVectorLengths();
+  const int * columns = byRow->getIndices();
+  const double * elements = byRow->getElements();
+  const double * rowLower = mps.getRowLower();
+  const double * rowUpper = mps.getRowUpper();
+
+  OsiCutPool pool;
+  double start = CoinWallclockTime();
+  for (int i = 0; i < numberCuts; i++)
+    pool.insert(lengths[i],columns+starts[i],elements+starts[i],
+		rowLower[i],rowUpper[i]);
+  addTime(result.phase[poolInsertPhase],numberCuts,
+	  CoinWallclockTime()-start,0.0,first);
+  result.poolBytes = pool.bytesPerCut();
+
+  OsiCuts cuts;
+  start = CoinWallclockTime();
+  for (int i = 0; i < numberCuts; i++) {
+    OsiRowCut * cut = new OsiRowCut;
+    cut->setRow(lengths[i],columns+starts[i],elements+starts[i],false);
+    cut->setLb(rowLower[i]);
+    cut->setUb(rowUpper[i]);
+    cuts.insert(cut);
+  }
+  addTime(result.phase[cutsInsertPhase],numberCuts,
+	  CoinWallclockTime()-start,0.0,first);
+  double bytes = 0.0;
+  std::vector<const OsiRowCut *> cutPointers(numberCuts);
+  for (int i = 0; i < numberCuts; i++) {
+    const OsiRowCut * cut = cuts.rowCutPtr(i);
+    cutPointers[i] = cut;
+    // pointer in OsiCuts, the cut, and indices, elements and original
+    // positions in its packed vector
+    bytes += sizeof(OsiRowCut *) + sizeof(OsiRowCut) + 4*mallocOverhead +
+      cut->row().capacity()*(2*sizeof(int)+sizeof(double));
+  }
+  result.cutsBytes = bytes/numberCuts;
+
+  for (int k = 0; k < 2; k++) {
+    OsiSolverInterface * si = newSolver(solverName);
+    si->loadProblem(*mps.getMatrixByCol(),lower,upper,
+		    mps.getObjCoefficients(),rowLower,rowUpper);
+    start = CoinWallclockTime();
+    if (k == 0)
+      si->applyCutPool(pool,numberCuts);
+    else
+      si->applyRowCuts(numberCuts,&cutPointers[0]);
+    addTime(result.phase[k == 0 ? poolApplyPhase : cutsApplyPhase],
+	    numberCuts,CoinWallclockTime()-start,0.0,first);
+    delete si;
+  }
+}
+
+/*
+  Time one problem. Bound changes are made on the columns furthest above
+  their lower bound, halving the distance; that keeps the change feasible
+  for the column and large enough to make the solver work.
+*/
+void timeModel(const std::string & solverName, const std::string & fileName,
+	       int repeat, int numberProbes, double boxBound,
+	       int maxIterations, ModelResult & result)
+{
+  for (int k = 0; k < numberPhases; k++) {
+    result.phase[k].calls = 0;
+    result.phase[k].best = 0.0;
+    result.phase[k].sum = 0.0;
+    result.phase[k].iterations = 0.0;
+  }
+  result.rows = 0;
+  result.columns = 0;
+  result.elements = 0;
+  result.objective = 0.0;
+  result.repeats = 0;
+  result.poolBytes = 0.0;
+  result.cutsBytes = 0.0;
+  for (int r = 0; r < repeat; r++) {
+    bool first = r == 0;
+    CoinMpsIO mps;
+    mps.messageHandler()->setLogLevel(0);
+    double start = CoinWallclockTime();
+    if (mps.readMps(fileName.c_str(),"mps") != 0) {
+      result.error = "could not be read";
+      return;
+    }
+    addTime(result.phase[readPhase],1,CoinWallclockTime()-start,0.0,first);
+    const int n = mps.getNumCols();
+    std::vector<double> lower(mps.getColLower(), mps.getColLower() + n);
+    std::vector<double> upper(mps.getColUpper(), mps.getColUpper() + n);
+    if (boxBound > 0.0) {
+      for (int j = 0; j < n; ++j) {
+	lower[j] = CoinMax(lower[j], -boxBound);
+	upper[j] = CoinMin(upper[j], boxBound);
+      }
+    }
+    OsiSolverInterface * si = newSolver(solverName);
+    CoinWarmStart * warmStart = NULL;
+    try {
+      if (maxIterations > 0)
+	si->setIntParam(OsiMaxNumIteration,maxIterations);
+      // A probe should not take longer than a full solve
+      int solveLimit;
+      int hotStartLimit;
+      si->getIntParam(OsiMaxNumIteration,solveLimit);
+      si->getIntParam(OsiMaxNumIterationHotStart,hotStartLimit);
+      if (hotStartLimit > solveLimit)
+	si->setIntParam(OsiMaxNumIterationHotStart,solveLimit);
+      start = CoinWallclockTime();
+      si->loadProblem(*mps.getMatrixByCol(), &lower[0], &upper[0],
+		      mps.getObjCoefficients(),
+		      mps.getRowLower(), mps.getRowUpper());
+      addTime(result.phase[loadPhase],1,CoinWallclockTime()-start,0.0,first);
+
+      start = CoinWallclockTime();
+      si->initialSolve();
+      addTime(result.phase[initialSolvePhase],1,CoinWallclockTime()-start,
+	      si->getIterationCount(),first);
+      result.rows = si->getNumRows();
+      result.columns = si->getNumCols();
+      result.elements = si->getNumElements();
+      result.objective = si->getObjValue();
+      if (si->isAbandoned() || si->isProvenPrimalInfeasible()) {
+	result.error = "no solution";
+	delete si;
+	return;
+      }
+
+      // Choose probes
+      const double infinity = si->getInfinity();
+      const double * x = si->getColSolution();
+      std::vector<std::pair<double,int> > candidates;
+      for (int j = 0; j < n; j++) {
+	if (lower[j] > -infinity && x[j] > lower[j] + 1.0e-6)
+	  candidates.push_back(std::make_pair(lower[j]-x[j],j));
+      }
+      std::sort(candidates.begin(),candidates.end());
+      int probes = CoinMin(numberProbes,
+			   static_cast<int>(candidates.size()));
+      std::vector<int> probeColumn(probes);
+      std::vector<double> probeUpper(probes);
+      for (int k = 0; k < probes; k++) {
+	int j = candidates[k].second;
+	probeColumn[k] = j;
+	probeUpper[k] = lower[j] + 0.5*(x[j]-lower[j]);
+      }
+      if (probes) {
+	warmStart = si->getWarmStart();
+	double seconds = 0.0;
+	double iterations = 0.0;
+	for (int k = 0; k < probes; k++) {
+	  int j = probeColumn[k];
+	  si->setColUpper(j,probeUpper[k]);
+	  si->setWarmStart(warmStart);
+	  start = CoinWallclockTime();
+	  si->resolve();
+	  seconds += CoinWallclockTime()-start;
+	  iterations += si->getIterationCount();
+	  si->setColUpper(j,upper[j]);
+	}
+	addTime(result.phase[resolvePhase],probes,seconds,iterations,first);
+
+	// Back to the optimum before marking
+	si->setWarmStart(warmStart);
+	si->resolve();
+	si->markHotStart();
+	seconds = 0.0;
+	iterations = 0.0;
+	for (int k = 0; k < probes; k++) {
+	  int j = probeColumn[k];
+	  si->setColUpper(j,probeUpper[k]);
+	  start = CoinWallclockTime();
+	  si->solveFromHotStart();
+	  seconds += CoinWallclockTime()-start;
+	  iterations += si->getIterationCount();
+	  si->setColUpper(j,upper[j]);
+	}
+	si->unmarkHotStart();
+	addTime(result.phase[hotStartPhase],probes,seconds,iterations,first);
+      }
+      timeCuts(solverName,mps,&lower[0],&upper[0],first,result);
+    }
+    catch (CoinError & e) {
+      result.error = e.message();
+      delete warmStart;
+      delete si;
+      return;
+    }
+    delete warmStart;
+    delete si;
+    result.repeats++;
+  }
+}
+
+/*
+  A node of the branch and bound below: the column bounds, and the branch
+  which made it so that the chooser can be told how it went.
+*/
+struct BranchNode {
+  std::vector<double> lower;
+  std::vector<double> upper;
+  /// Object branched on, -1 for the root
+  int object;
+  /// 0 down, 1 up
+  int way;
+  /// Distance the object's value was moved
+  double changeInValue;
+  double parentObjective;
+};
+
+/*
+  Depth first branch and bound from the root with the given chooser, at
+  most maxNodes nodes. The choosers do not fix variables; a node is
+  pruned when its LP is not optimal or cannot beat the best solution.
+  Each node is solved from scratch, as the test solver does not recover
+  from the warm start of an infeasible node; strong branching still uses
+  hot starts.
+*/
+void branchAndBound(OsiSolverInterface * si, OsiChooseVariable & choose,
+		    int maxNodes, BranchResult & result)
+{
+  const int n = si->getNumCols();
+  const double direction = si->getObjSense();
+  double start = CoinWallclockTime();
+  result.nodes = 0;
+  result.strongLps = 0;
+  result.strongIterations = 0;
+  result.bestObjective = COIN_DBL_MAX;
+  std::vector<BranchNode> stack(1);
+  stack[0].lower.assign(si->getColLower(), si->getColLower() + n);
+  stack[0].upper.assign(si->getColUpper(), si->getColUpper() + n);
+  stack[0].object = -1;
+  stack[0].way = 0;
+  stack[0].changeInValue = 0.0;
+  stack[0].parentObjective = 0.0;
+  while (!stack.empty() && result.nodes < maxNodes) {
+    BranchNode node = stack.back();
+    stack.pop_back();
+    result.nodes++;
+    const double * lower = si->getColLower();
+    const double * upper = si->getColUpper();
+    for (int j = 0; j < n; j++) {
+      if (lower[j] != node.lower[j])
+	si->setColLower(j, node.lower[j]);
+      if (upper[j] != node.upper[j])
+	si->setColUpper(j, node.upper[j]);
+    }
+    si->initialSolve();
+    const double objective = direction*si->getObjValue();
+    const bool feasible = si->isProvenOptimal() && objective < 1.0e20;
+    if (node.object >= 0)
+      choose.updateInformation(node.object, node.way,
+			       CoinMax(0.0, objective - node.parentObjective),
+			       node.changeInValue, feasible ? 0 : 1);
+    if (!feasible || objective >= result.bestObjective - 1.0e-6)
+      continue;
+    OsiBranchingInformation info(si, true, true);
+    int numberUnsatisfied = choose.setupList(&info, true);
+    if (numberUnsatisfied < 0)
+      continue;
+    if (!numberUnsatisfied) {
+      result.bestObjective = objective;
+      si->setDblParam(OsiDualObjectiveLimit, direction*objective);
+      continue;
+    }
+    const int returnCode = choose.chooseVariable(si, &info, false);
+    result.strongLps += 2*choose.numberStrongDone();
+    result.strongIterations += choose.numberStrongIterations();
+    if (returnCode < 0)
+      continue;
+    int iObject = choose.bestObjectIndex();
+    int way = choose.bestWhichWay();
+    if (iObject < 0) {
+      iObject = choose.firstForcedObjectIndex();
+      way = choose.firstForcedWhichWay();
+    }
+    if (iObject < 0) {
+      iObject = choose.candidates()[0];
+      way = 0;
+    }
+    way = way == 1 ? 1 : 0;
+    const OsiObject * object = si->object(iObject);
+    OsiBranchingObject * branch = object->createBranch(si, &info, way);
+    const double value = branch->value();
+    BranchNode child[2];
+    for (int k = 0; k < 2; k++) {
+      branch->branch(si);
+      child[k].lower.assign(si->getColLower(), si->getColLower() + n);
+      child[k].upper.assign(si->getColUpper(), si->getColUpper() + n);
+      child[k].object = iObject;
+      child[k].way = k ? 1 - way : way;
+      child[k].changeInValue = child[k].way ?
+	ceil(value) - value : value - floor(value);
+      child[k].parentObjective = objective;
+      lower = si->getColLower();
+      upper = si->getColUpper();
+      for (int j = 0; j < n; j++) {
+	if (lower[j] != node.lower[j])
+	  si->setColLower(j, node.lower[j]);
+	if (upper[j] != node.upper[j])
+	  si->setColUpper(j, node.upper[j]);
+      }
+    }
+    delete branch;
+    // The preferred way goes on top so that it is solved first
+    stack.push_back(child[1]);
+    stack.push_back(child[0]);
+  }
+  result.finished = stack.empty();
+  result.seconds = CoinWallclockTime() - start;
+}
+
+/*
+  Branch on one problem with each chooser. Returns false, with error set,
+  if the problem has no integer variables or could not be read.
+*/
+bool branchModel(const std::string & solverName, const std::string & fileName,
+		 double boxBound, int maxNodes, int numberStrong,
+		 BranchResult * results, std::string & error)
+{
+  CoinMpsIO mps;
+  mps.messageHandler()->setLogLevel(0);
+  if (mps.readMps(fileName.c_str(),"mps") != 0) {
+    error = "could not be read";
+    return false;
+  }
+  const int n = mps.getNumCols();
+  bool integers = false;
+  for (int j = 0; j < n; j++) {
+    if (mps.isInteger(j))
+      integers = true;
+  }
+  if (!integers) {
+    error = "no integer variables";
+    return false;
+  }
+  std::vector<double> lower(mps.getColLower(), mps.getColLower() + n);
+  std::vector<double> upper(mps.getColUpper(), mps.getColUpper() + n);
+  if (boxBound > 0.0) {
+    for (int j = 0; j < n; ++j) {
+      lower[j] = CoinMax(lower[j], -boxBound);
+      upper[j] = CoinMin(upper[j], boxBound);
+    }
+  }
+  for (int k = 0; k < numberChoosers; k++) {
+    OsiSolverInterface * si = newSolver(solverName);
+    try {
+      si->loadProblem(*mps.getMatrixByCol(), &lower[0], &upper[0],
+		      mps.getObjCoefficients(),
+		      mps.getRowLower(), mps.getRowUpper());
+      for (int j = 0; j < n; j++) {
+	if (mps.isInteger(j))
+	  si->setInteger(j);
+      }
+      si->findIntegers(false);
+      OsiChooseVariable * choose;
+      if (k == strongChooser)
+	choose = new OsiChooseStrong(si);
+      else
+	choose = new OsiChooseReliable(si);
+      choose->setNumberStrong(numberStrong);
+      branchAndBound(si, *choose, maxNodes, results[k]);
+      delete choose;
+    }
+    catch (CoinError & e) {
+      error = e.message();
+      delete si;
+      return false;
+    }
+    delete si;
+  }
+  return true;
+}
+
+void writeCsv(FILE * fp, const std::string & solverName,
+	      const std::vector<ModelResult> & results)
+{
+  fprintf(fp,"solver,model,rows,columns,elements,phase,calls,best,mean,"
+	  "iterations,objective\n");
+  for (size_t i = 0; i < results.size(); i++) {
+    const ModelResult & result = results[i];
+    if (!result.error.empty())
+      continue;
+    for (int k = 0; k < numberPhases; k++) {
+      const PhaseResult & phase = result.phase[k];
+      if (!phase.calls)
+	continue;
+      fprintf(fp,"%s,%s,%d,%d,%d,%s,%d,%.6g,%.6g,%.6g,%.12g\n",
+	      solverName.c_str(),result.name.c_str(),
+	      result.rows,result.columns,result.elements,phaseNames[k],
+	      phase.calls,phase.best,phase.sum/result.repeats,
+	      phase.iterations,result.objective);
+    }
+  }
+}
+
+void writeJson(FILE * fp, const std::string & solverName, int repeat,
+	       const std::vector<ModelResult> & results)
+{
+  fprintf(fp,"{\"solver\":\"%s\",\"repeat\":%d,\"models\":[",
+	  solverName.c_str(),repeat);
+  for (size_t i = 0; i < results.size(); i++) {
+    const ModelResult & result = results[i];
+    fprintf(fp,"%s\n {\"model\":\"%s\"",i ? "," : "",result.name.c_str());
+    if (!result.error.empty()) {
+      std::string error;
+      for (size_t c = 0; c < result.error.size(); c++) {
+	char ch = result.error[c];
+	if (ch == '"' || ch == '\\')
+	  error += '\\';
+	if (ch >= ' ')
+	  error += ch;
+      }
+      fprintf(fp,",\"error\":\"%s\"}",error.c_str());
+      continue;
+    }
+    fprintf(fp,",\"rows\":%d,\"columns\":%d,\"elements\":%d,"
+	    "\"objective\":%.12g,\"phases\":{",
+	    result.rows,result.columns,result.elements,result.objective);
+    bool firstPhase = true;
+    for (int k = 0; k < numberPhases; k++) {
+      const PhaseResult & phase = result.phase[k];
+      if (!phase.calls)
+	continue;
+      fprintf(fp,"%s\"%s\":{\"calls\":%d,\"best\":%.6g,\"mean\":%.6g,"
+	      "\"iterations\":%.6g}",firstPhase ? "" : ",",phaseNames[k],
+	      phase.calls,phase.best,phase.sum/result.repeats,
+	      phase.iterations);
+      firstPhase = false;
+    }
+    fprintf(fp,"}}");
+  }
+  fprintf(fp,"\n]}\n");
+}
+
+/*
+  Compare best times with a CSV file written by writeCsv. Returns the
+  number of regressions, or -1 if the file could not be read.
+*/
+int compareBaseline(const std::string & fileName,
+		    const std::string & solverName,
+		    const std::vector<ModelResult> & results,
+		    double tolerance)
+{
+  FILE * fp = fopen(fileName.c_str(),"r");
+  if (!fp) {
+    std::cerr << "Unable to open baseline " << fileName << std::endl;
+    return -1;
+  }
+  std::map<std::string,double> baseline;
+  std::set<std::string> baselineSolvers;
+  char line[1000];
+  while (fgets(line,sizeof(line),fp)) {
+    std::string text(line);
+    while (!text.empty() &&
+	   (text[text.size()-1] == '\n' || text[text.size()-1] == '\r'))
+      text.erase(text.size()-1);
+    std::vector<std::string> fields = splitList(text);
+    if (fields.size() < 8 || fields[0] == "solver")
+      continue;
+    baselineSolvers.insert(fields[0]);
+    baseline[fields[1] + "," + fields[5]] = atof(fields[7].c_str());
+  }
+  fclose(fp);
+  if (baselineSolvers.size() != 1 ||
+      *baselineSolvers.begin() != solverName)
+    std::cout << "Warning: baseline " << fileName
+	      << " was not made with solver " << solverName << std::endl;
+
+  printf("\nComparison with %s (tolerance %g%%)\n",fileName.c_str(),
+	 100.0*tolerance);
+  printf("%-12s %-12s %11s %11s %8s\n","problem","phase","baseline",
+	 "current","ratio");
+  int numberRegressions = 0;
+  int numberFaster = 0;
+  int numberCompared = 0;
+  int numberMissing = 0;
+  for (size_t i = 0; i < results.size(); i++) {
+    const ModelResult & result = results[i];
+    if (!result.error.empty())
+      continue;
+    for (int k = 0; k < numberPhases; k++) {
+      const PhaseResult & phase = result.phase[k];
+      if (!phase.calls)
+	continue;
+      std::map<std::string,double>::const_iterator it =
+	baseline.find(result.name + "," + phaseNames[k]);
+      if (it == baseline.end()) {
+	numberMissing++;
+	continue;
+      }
+      numberCompared++;
+      double before = it->second;
+      double after = phase.best;
+      if (fabs(after-before) <= noiseSeconds)
+	continue;
+      const char * verdict = NULL;
+      if (after > before*(1.0+tolerance)) {
+	verdict = "REGRESSION";
+	numberRegressions++;
+      }
+      else if (after*(1.0+tolerance) < before) {
+	verdict = "faster";
+	numberFaster++;
+      }
+      if (verdict)
+	printf("%-12s %-12s %11.6f %11.6f %8.2f %s\n",result.name.c_str(),
+	       phaseNames[k],before,after,before > 0.0 ? after/before : 0.0,
+	       verdict);
+    }
+  }
+  printf("%d timings compared, %d slower and %d faster",
+	 numberCompared,numberRegressions,numberFaster);
+  if (numberMissing)
+    printf(", %d not in baseline",numberMissing);
+  printf("\n");
+  return numberRegressions;
+}
+
+}
+
+//----------------------------------------------------------------
+// benchmark [-mpsDir=V1] [-netlibDir=V2] [-solver=V3] [-models=V4]
+//           [-repeat=V5] [-probes=V6] [-boxBound=V7] [-iterations=V8]
+//           [-csv=V9] [-json=V10] [-baseline=V11] [-tolerance=V12]
+//           [-nodes=V13] [-strong=V14]
+//
+// where (unix defaults):
+//   -mpsDir: directory containing the Sample problems
+//       Default value V1="../../Data/Sample"
+//   -netlibDir: directory containing the Netlib problems
+//       Netlib is only timed if this is given
+//   -solver: solver interface to time
+//       Default value V3 is the first solver in the build, the test
+//       solver if there are none
+//   -models: comma separated problems to time, looked for in the
+//       Sample and then the Netlib directory
+//       Default is all the LPs and MIPs
+//   -repeat: number of times each problem is timed
+//       Default value V5="3"
+//   -probes: number of bound changes for resolve and hot start
+//       Default value V6="10"
+//   -boxBound: bound free columns at +/- V7 (0 for none)
+//       Default value V7="1e4" for the test solver, "0" otherwise
+//   -iterations: iteration limit (0 for the solver default), hot start
+//       probes are never allowed more than this
+//       Default value V8="0"
+//   -csv, -json: write the results to file V9 or V10
+//   -baseline: compare with CSV file V11 from an earlier run, exit
+//       status is 1 if any phase is slower by more than V12
+//   -tolerance: allowed fractional slowdown
+//       Default value V12="0.1"
+//   -nodes: node limit of the branch and bound comparing OsiChooseStrong
+//       with OsiChooseReliable on the problems with integer variables
+//       (0 for none)
+//       Default value V13="0"
+//   -strong: candidates each chooser may strong branch on at a node
+//       Default value V14="10"
+//
+// All parameters are optional.
+//----------------------------------------------------------------
+
+int main (int argc, const char *argv[])
+{
+  const char dirsep =  CoinFindDirSeparator();
+  std::string dataDir ;
+  if (dirsep == '/')
+    dataDir = "../../Data" ;
+  else
+    dataDir = "..\\..\\Data" ;
+  std::vector<std::string> solvers = solverNames();
+  std::set<std::string> definedKeyWords;
+  definedKeyWords.insert("-mpsDir");
+  definedKeyWords.insert("-netlibDir");
+  definedKeyWords.insert("-solver");
+  definedKeyWords.insert("-models");
+  definedKeyWords.insert("-repeat");
+  definedKeyWords.insert("-probes");
+  definedKeyWords.insert("-boxBound");
+  definedKeyWords.insert("-iterations");
+  definedKeyWords.insert("-csv");
+  definedKeyWords.insert("-json");
+  definedKeyWords.insert("-baseline");
+  definedKeyWords.insert("-tolerance");
+  definedKeyWords.insert("-nodes");
+  definedKeyWords.insert("-strong");
+  std::string mpsDir = dataDir + dirsep + "Sample" + dirsep ;
+  std::string netlibDir ;
+  std::string solverName = solvers[0] ;
+  int repeat = 3 ;
+  int numberProbes = 10 ;
+  int maxIterations = 0 ;
+  double tolerance = 0.1 ;
+  int maxNodes = 0 ;
+  int numberStrong = 10 ;
+  std::map<std::string,std::string> parms;
+  for (int i = 1 ;  i < argc ; i++) {
+    std::string parm(argv[i]);
+    std::string key,value;
+    std::string::size_type eqPos = parm.find('=');
+    if (eqPos == std::string::npos) {
+      key = parm ;
+      value = "" ;
+    }
+    else {
+      key = parm.substr(0,eqPos) ;
+      value = parm.substr(eqPos+1) ;
+    }
+    if (definedKeyWords.find(key) == definedKeyWords.end()) {
+      std::string available ;
+      for (size_t k = 0; k < solvers.size(); k++)
+	available += (k ? ", " : "") + solvers[k] ;
+      std::cerr
+	  << "Undefined parameter \"" << key << "\".\n"
+	  << "Correct usage: \n"
+	  << "  benchmark [-mpsDir=V1] [-netlibDir=V2] [-solver=V3]"
+	  << " [-models=V4]\n"
+	  << "            [-repeat=V5] [-probes=V6] [-boxBound=V7]"
+	  << " [-iterations=V8]\n"
+	  << "            [-csv=V9] [-json=V10] [-baseline=V11]"
+	  << " [-tolerance=V12]\n"
+	  << "            [-nodes=V13] [-strong=V14]\n"
+	  << "where:\n"
+	  << "  -mpsDir: directory containing the Sample problems\n"
+	  << "        Default value V1=\"" << mpsDir << "\"\n"
+	  << "  -netlibDir: directory containing the Netlib problems\n"
+	  << "        Netlib is only timed if this is given\n"
+	  << "  -solver: solver interface to time (" << available << ")\n"
+	  << "        Default value V3=\"" << solverName << "\"\n"
+	  << "  -models: comma separated problems to time\n"
+	  << "        Default is all the LPs and MIPs\n"
+	  << "  -repeat: number of times each problem is timed\n"
+	  << "        Default value V5=\"" << repeat << "\"\n"
+	  << "  -probes: number of bound changes for resolve and hot start\n"
+	  << "        Default value V6=\"" << numberProbes << "\"\n"
+	  << "  -boxBound: bound free columns at +/- V7 (0 for none)\n"
+	  << "        Default value V7=\"1e4\" for the test solver,"
+	  << " \"0\" otherwise\n"
+	  << "  -iterations: iteration limit (0 for the solver default)\n"
+	  << "        Default value V8=\"" << maxIterations << "\"\n"
+	  << "  -csv, -json: write the results to file V9 or V10\n"
+	  << "  -baseline: compare with CSV file V11 from an earlier run\n"
+	  << "  -tolerance: allowed fractional slowdown\n"
+	  << "        Default value V12=\"" << tolerance << "\"\n"
+	  << "  -nodes: node limit of the branch and bound comparing"
+	  << " choosers (0 for none)\n"
+	  << "        Default value V13=\"" << maxNodes << "\"\n"
+	  << "  -strong: candidates strong branched on at a node\n"
+	  << "        Default value V14=\"" << numberStrong << "\"\n";
+      return 1 ;
+    }
+    parms[key] = value ;
+  }
+  if (parms.find("-mpsDir") != parms.end())
+    mpsDir = parms["-mpsDir"] + dirsep;
+  if (parms.find("-netlibDir") != parms.end())
+    netlibDir = parms["-netlibDir"] + dirsep;
+  if (parms.find("-solver") != parms.end())
+    solverName = parms["-solver"] ;
+  if (parms.find("-repeat") != parms.end())
+    repeat = CoinMax(atoi(parms["-repeat"].c_str()),1) ;
+  if (parms.find("-probes") != parms.end())
+    numberProbes = CoinMax(atoi(parms["-probes"].c_str()),0) ;
+  if (parms.find("-iterations") != parms.end())
+    maxIterations = atoi(parms["-iterations"].c_str()) ;
+  if (parms.find("-tolerance") != parms.end())
+    tolerance = atof(parms["-tolerance"].c_str()) ;
+  if (parms.find("-nodes") != parms.end())
+    maxNodes = CoinMax(atoi(parms["-nodes"].c_str()),0) ;
+  if (parms.find("-strong") != parms.end())
+    numberStrong = CoinMax(atoi(parms["-strong"].c_str()),1) ;
+  // The Volume algorithm in the test solver needs finite bounds
+  double boxBound = solverName == "test" ? 1.0e4 : 0.0 ;
+  if (parms.find("-boxBound") != parms.end())
+    boxBound = atof(parms["-boxBound"].c_str()) ;
+  OsiSolverInterface * check = newSolver(solverName);
+  if (!check) {
+    std::cerr << "Solver \"" << solverName << "\" is not in this build"
+	      << std::endl;
+    return 1;
+  }
+  delete check;
+
+  // Problems as names and files
+  std::vector<std::pair<std::string,std::string> > models;
+  if (parms.find("-models") != parms.end()) {
+    std::vector<std::string> names = splitList(parms["-models"]);
+    for (size_t i = 0; i < names.size(); i++) {
+      if (names[i].empty())
+	continue;
+      std::string fileName = mpsDir + names[i];
+      std::string check = fileName + ".mps";
+      if (!fileCoinReadable(check) && !netlibDir.empty())
+	fileName = netlibDir + names[i];
+      models.push_back(std::make_pair(names[i],fileName));
+    }
+  }
+  else {
+    const int numberSample =
+      static_cast<int>(sizeof(sampleNames)/sizeof(sampleNames[0]));
+    for (int i = 0; i < numberSample; i++)
+      models.push_back(std::make_pair(std::string(sampleNames[i]),
+				      mpsDir + sampleNames[i]));
+    if (!netlibDir.empty()) {
+      const int numberNetlib =
+	static_cast<int>(sizeof(netlibNames)/sizeof(netlibNames[0]));
+      for (int i = 0; i < numberNetlib; i++)
+	models.push_back(std::make_pair("netlib/" + std::string(netlibNames[i]),
+					netlibDir + netlibNames[i]));
+    }
+  }
+
+  printf("Solver %s, best of %d, seconds per call\n",solverName.c_str(),
+	 repeat);
+  printf("%-16s %6s %6s %9s %9s %12s %9s %9s\n","problem","rows","cols",
+	 phaseNames[readPhase],phaseNames[loadPhase],
+	 phaseNames[initialSolvePhase],phaseNames[resolvePhase],
+	 phaseNames[hotStartPhase]);
+  std::vector<ModelResult> results(models.size());
+  for (size_t i = 0; i < models.size(); i++) {
+    ModelResult & result = results[i];
+    result.name = models[i].first;
+    timeModel(solverName,models[i].second,repeat,numberProbes,boxBound,
+	      maxIterations,result);
+    if (!result.error.empty()) {
+      printf("%-16s skipped: %s\n",result.name.c_str(),result.error.c_str());
+      continue;
+    }
+    printf("%-16s %6d %6d",result.name.c_str(),result.rows,result.columns);
+    for (int k = 0; k <= hotStartPhase; k++) {
+      int width = k == initialSolvePhase ? 12 : 9;
+      if (result.phase[k].calls)
+	printf(" %*.6f",width,result.phase[k].best);
+      else
+	printf(" %*s",width,"-");
+    }
+    printf("\n");
+  }
+
+  printf("\nCuts from the problem rows, seconds per cut and bytes per cut\n");
+  printf("%-16s %6s %11s %11s %11s %11s %8s %8s\n","problem","cuts",
+	 phaseNames[poolInsertPhase],phaseNames[cutsInsertPhase],
+	 phaseNames[poolApplyPhase],phaseNames[cutsApplyPhase],
+	 "pool","cuts");
+  for (size_t i = 0; i < results.size(); i++) {
+    const ModelResult & result = results[i];
+    if (!result.error.empty() || !result.phase[poolInsertPhase].calls)
+      continue;
+    printf("%-16s %6d %11.3g %11.3g %11.3g %11.3g %8.1f %8.1f\n",
+	   result.name.c_str(),result.phase[poolInsertPhase].calls,
+	   result.phase[poolInsertPhase].best,
+	   result.phase[cutsInsertPhase].best,
+	   result.phase[poolApplyPhase].best,
+	   result.phase[cutsApplyPhase].best,
+	   result.poolBytes,result.cutsBytes);
+  }
+
+  if (maxNodes) {
+    printf("\nBranch and bound, at most %d nodes, %d strong candidates\n",
+	   maxNodes,numberStrong);
+    printf("%-16s %-9s %7s %9s %11s %14s %9s\n","problem","chooser",
+	   "nodes","strongLPs","strongIters","best","seconds");
+    for (size_t i = 0; i < models.size(); i++) {
+      BranchResult branchResults[numberChoosers];
+      std::string error;
+      if (!branchModel(solverName,models[i].second,boxBound,maxNodes,
+		       numberStrong,branchResults,error))
+	continue;
+      for (int k = 0; k < numberChoosers; k++) {
+	const BranchResult & result = branchResults[k];
+	printf("%-16s %-9s %7d%s %9d %11d",models[i].first.c_str(),
+	       chooserNames[k],result.nodes,result.finished ? " " : "+",
+	       result.strongLps,result.strongIterations);
+	if (result.bestObjective < COIN_DBL_MAX)
+	  printf(" %14.6g",result.bestObjective);
+	else
+	  printf(" %14s","-");
+	printf(" %9.3f\n",result.seconds);
+      }
+    }
+  }
+
+  if (parms.find("-csv") != parms.end()) {
+    FILE * fp = fopen(parms["-csv"].c_str(),"w");
+    if (!fp) {
+      std::cerr << "Unable to open " << parms["-csv"] << std::endl;
+      return 1;
+    }
+    writeCsv(fp,solverName,results);
+    fclose(fp);
+  }
+  if (parms.find("-json") != parms.end()) {
+    FILE * fp = fopen(parms["-json"].c_str(),"w");
+    if (!fp) {
+      std::cerr << "Unable to open " << parms["-json"] << std::endl;
+      return 1;
+    }
+    writeJson(fp,solverName,repeat,results);
+    fclose(fp);
+  }
+  if (parms.find("-baseline") != parms.end()) {
+    int numberRegressions =
+      compareBaseline(parms["-baseline"],solverName,results,tolerance);
+    if (numberRegressions)
+      return 1;
+  }
+  return 0;
+}
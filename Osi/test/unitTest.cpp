@@ -125,12 +125,36 @@ int main (int argc, const char *argv[])
   Process command line parameters.
 */
   std::map<std::string,std::string> parms ;
-  if (processParameters(argc,argv,parms) == false)
+  std::map<std::string,int> ignorekeywords ;
+#ifdef USETESTSOLVER
+/*
+  -volBenchmark belongs to the test solver only, so it is picked out here
+  rather than added to the common keywords.
+*/
+  bool volBenchmark = false ;
+  for (int i = 1 ; i < argc ; i++) {
+    if (std::string(argv[i]) == "-volBenchmark")
+      volBenchmark = true ;
+  }
+  ignorekeywords["-volBenchmark"] = 0 ;
+#endif
+  if (processParameters(argc,argv,parms,ignorekeywords) == false)
     return 1;
 
   std::string mpsDir = parms["-mpsDir"] ;
   std::string netlibDir = parms["-netlibDir"] ;
 
+#ifdef USETESTSOLVER
+/*
+  Timing the Volume algorithm replaces the unit test.
+*/
+  if (volBenchmark) {
+    testingMessage( "Benchmarking OsiTestSolverInterface\n" );
+    OsiTestSolverInterfaceBenchmark(mpsDir);
+    return 0;
+  }
+#endif
+
 /*
   Test Osi{Row,Col}Cut routines.
 */
@@ -181,6 +205,11 @@ int main (int argc, const char *argv[])
     testingMessage( "Testing OsiColCut with OsiTestSolverInterface\n" );
     OSIUNITTEST_CATCH_ERROR(OsiColCutUnitTest(&testSi,mpsDir), {}, testSi, "colcut unittest");
   }
+  {
+    OsiTestSolverInterface testSi;
+    testingMessage( "Testing OsiCutPool with OsiTestSolverInterface\n" );
+    OSIUNITTEST_CATCH_ERROR(OsiCutPoolUnitTest(&testSi), {}, testSi, "cutpool unittest");
+  }
 #endif
 
 #ifdef COIN_HAS_GLPK
@@ -258,6 +287,12 @@ int main (int argc, const char *argv[])
   testingMessage( "Testing OsiCuts\n" );
   OSIUNITTEST_CATCH_ERROR(OsiCutsUnitTest(), {}, "osi", "osicuts unittest");
 
+  testingMessage( "Testing OsiCachedArray\n" );
+  OSIUNITTEST_CATCH_ERROR(OsiCachedArrayUnitTest(), {}, "osi", "osicachedarray unittest");
+
+  testingMessage( "Testing OsiNameList\n" );
+  OSIUNITTEST_CATCH_ERROR(OsiNameListUnitTest(), {}, "osi", "osinamelist unittest");
+
 /*
   Testing OsiCuts only? A useful option when doing memory access and leak
   checks. Keeps the run time to something reasonable.